@@ -13,6 +13,7 @@ static const char *TAG = "controls";
 #define BACK_BUTTON_PIN GPIO_NUM_14  // Moved from GPIO 15 (strapping pin)
 #define PAUSE_BUTTON_PIN GPIO_NUM_15 // Moved from GPIO 16
 #define REED_SWITCH_PIN GPIO_NUM_17
+#define REED_SWITCH_B_PIN GPIO_NUM_16  // Shuttle press second station (unused on single presses)
 #define HEATING_SWITCH_PIN GPIO_NUM_8  // Physical heating enable switch (INPUT_PULLUP, active LOW)
 #define LED_GREEN_PIN GPIO_NUM_18 // Temperature ready indicator
 #define LED_BLUE_PIN GPIO_NUM_19  // Pause mode indicator
@@ -139,9 +140,9 @@ esp_err_t controls_init(void)
     };
     gpio_config(&button_config);
 
-    // Configure reed switch pin
+    // Configure reed switch pins (pull-up reads open when station B is not fitted)
     gpio_config_t reed_config = {
-        .pin_bit_mask = (1ULL << REED_SWITCH_PIN),
+        .pin_bit_mask = (1ULL << REED_SWITCH_PIN) | (1ULL << REED_SWITCH_B_PIN),
         .mode = GPIO_MODE_INPUT,
         .pull_up_en = GPIO_PULLUP_ENABLE,
         .pull_down_en = GPIO_PULLDOWN_DISABLE,
@@ -291,6 +292,27 @@ bool controls_is_press_closed(void)
     return closed;
 }
 
+bool controls_is_station_closed(uint8_t station)
+{
+    if (station == 0)
+    {
+        return controls_is_press_closed();
+    }
+
+    int level = gpio_get_level(REED_SWITCH_B_PIN);
+    bool closed = (level == 0); // Active low (switch connects to GND)
+    static bool last_closed = false;
+
+    // Log state changes
+    if (closed != last_closed)
+    {
+        ESP_LOGI(TAG, "Station B reed switch %s (GPIO level: %d)", closed ? "CLOSED" : "OPEN", level);
+        last_closed = closed;
+    }
+
+    return closed;
+}
+
 bool controls_is_rotary_button_pressed(void)
 {
     // Read current GPIO level - button is active low (pressed = 0)
@@ -39,6 +39,9 @@ rotary_event_t controls_get_rotary_event(void);
 // Check reed switch (press closed)
 bool controls_is_press_closed(void);
 
+// Check a shuttle press station's reed switch (0 = the press reed switch, 1 = station B)
+bool controls_is_station_closed(uint8_t station);
+
 // Check heating enable switch (physical switch)
 bool controls_is_heating_switch_on(void);
 
@@ -7,6 +7,7 @@
  * - PID temperature controller with configurable parameters
  * - Emergency shutoff capabilities
  * - Power level control and status monitoring
+ * - SSR switching and on-time counters for wear tracking
  *
  * The heating system uses LEDC PWM to control the SSR, allowing precise
  * power control from 0-100%. The PID controller maintains target temperature
@@ -40,6 +41,42 @@ static const char *TAG = "heating";
 // PID Controller Instance
 static pid_controller_t g_pid_controller;
 
+// Power applied by the last heating_set_power() call
+static uint8_t g_applied_power = 0;
+
+// SSR usage since boot; heating_set_power() may be called from any task
+static portMUX_TYPE g_ssr_lock = portMUX_INITIALIZER_UNLOCKED;
+static uint32_t g_ssr_switches = 0;
+static uint64_t g_ssr_on_us = 0;          ///< Time with power applied
+static uint64_t g_ssr_power_us = 0;       ///< Time x power (%), divide by 100 for full-power time
+static int64_t g_ssr_last_change_us = 0;  ///< When g_applied_power last changed
+
+/**
+ * @brief Book the time at the current power and switch to a new power
+ *
+ * Counts commanded off -> on transitions. The SSR also follows the PWM
+ * within each period, which adds wear in proportion to the on time.
+ */
+static void ssr_account(uint8_t new_power)
+{
+    int64_t now = esp_timer_get_time();
+
+    portENTER_CRITICAL(&g_ssr_lock);
+    if (g_applied_power > 0)
+    {
+        uint64_t elapsed = (uint64_t)(now - g_ssr_last_change_us);
+        g_ssr_on_us += elapsed;
+        g_ssr_power_us += elapsed * g_applied_power;
+    }
+    if (g_applied_power == 0 && new_power > 0)
+    {
+        g_ssr_switches++;
+    }
+    g_applied_power = new_power;
+    g_ssr_last_change_us = now;
+    portEXIT_CRITICAL(&g_ssr_lock);
+}
+
 /**
  * @brief Initialize the heating control system
  *
@@ -173,6 +210,8 @@ void heating_set_power(uint8_t power_percent)
         return;
     }
 
+    ssr_account(power_percent);
+
     // Update simulation model if in simulation mode
     if (sensor_is_simulation_mode())
     {
@@ -182,6 +221,52 @@ void heating_set_power(uint8_t power_percent)
     ESP_LOGD(TAG, "Heating power set to %d%% (duty: %lu)", power_percent, duty);
 }
 
+/**
+ * @brief Get the applied heating power
+ *
+ * Returns the power last written to the SSR, after the heating switch
+ * and clamping checks, so models see what the heater really got.
+ *
+ * @return Power level as percentage (0-100)
+ */
+uint8_t heating_get_power(void)
+{
+    return g_applied_power;
+}
+
+/**
+ * @brief Get the SSR usage since boot
+ *
+ * The caller adds the difference between two readings to its persisted
+ * totals. The current on period is included up to now.
+ *
+ * @param[out] usage Switch count and on time
+ */
+void heating_get_ssr_usage(heating_ssr_usage_t *usage)
+{
+    if (!usage)
+    {
+        return;
+    }
+
+    int64_t now = esp_timer_get_time();
+
+    portENTER_CRITICAL(&g_ssr_lock);
+    uint64_t on_us = g_ssr_on_us;
+    uint64_t power_us = g_ssr_power_us;
+    if (g_applied_power > 0)
+    {
+        uint64_t elapsed = (uint64_t)(now - g_ssr_last_change_us);
+        on_us += elapsed;
+        power_us += elapsed * g_applied_power;
+    }
+    usage->switch_count = g_ssr_switches;
+    portEXIT_CRITICAL(&g_ssr_lock);
+
+    usage->on_seconds = (uint32_t)(on_us / 1000000);
+    usage->full_power_seconds = (uint32_t)(power_us / 100000000);
+}
+
 /**
  * @brief Emergency shutoff of heating system
  *
@@ -271,3 +356,67 @@ float pid_update(float current_temp)
 {
     return pid_controller_update(&g_pid_controller, current_temp);
 }
+
+/**
+ * @brief Change the PID setpoint
+ *
+ * Moves the running controller to a new setpoint while keeping its
+ * integral state, so a small change (e.g. switching to the back side
+ * of a double-sided shirt) does not cause a power dip.
+ *
+ * @param setpoint New target temperature (°C), clamped to [0, 300]
+ */
+void pid_set_setpoint(float setpoint)
+{
+    if (setpoint < 0.0f || setpoint > 300.0f)
+    {
+        ESP_LOGW(TAG, "pid_set_setpoint: Setpoint=%.2f out of range [0, 300], clamping", setpoint);
+        setpoint = CLAMP(setpoint, 0.0f, 300.0f);
+    }
+
+    pid_controller_set_setpoint(&g_pid_controller, setpoint, false);
+}
+
+/**
+ * @brief Change the PID gains
+ *
+ * Applies new gains to the running controller with the integral term
+ * carried over, so gain updates between presses do not disturb the
+ * heater output.
+ *
+ * @param kp Proportional gain, clamped to [0, 1000]
+ * @param ki Integral gain, clamped to [0, 100]
+ * @param kd Derivative gain, clamped to [0, 1000]
+ */
+void pid_set_gains(float kp, float ki, float kd)
+{
+    pid_controller_set_gains(&g_pid_controller,
+                             CLAMP(kp, 0.0f, 1000.0f),
+                             CLAMP(ki, 0.0f, 100.0f),
+                             CLAMP(kd, 0.0f, 1000.0f));
+}
+
+/**
+ * @brief Set the feedforward term
+ *
+ * The value is added to the PID terms before the output is clamped.
+ *
+ * @param feedforward Output added every update (%), clamped to [0, 100]
+ */
+void pid_set_feedforward(float feedforward)
+{
+    pid_controller_set_feedforward(&g_pid_controller, CLAMP(feedforward, 0.0f, 100.0f));
+}
+
+/**
+ * @brief Preload the PID integral
+ *
+ * Sets the integral so that, together with the feedforward, the
+ * controller outputs hold_output at zero error. Call on mode entry.
+ *
+ * @param hold_output Output expected to hold the setpoint (%), clamped to [0, 100]
+ */
+void pid_preload(float hold_output)
+{
+    pid_controller_preload(&g_pid_controller, CLAMP(hold_output, 0.0f, 100.0f));
+}
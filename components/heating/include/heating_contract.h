@@ -15,6 +15,20 @@ esp_err_t heating_deinit(void);
 // Set heater power (0-100%)
 void heating_set_power(uint8_t power_percent);
 
+// Get the heater power actually applied (0-100%)
+uint8_t heating_get_power(void);
+
+// SSR usage since boot (for wear tracking)
+typedef struct
+{
+    uint32_t switch_count;        // off -> on transitions of the applied power
+    uint32_t on_seconds;          // time with any power applied
+    uint32_t full_power_seconds;  // on time weighted by the applied power
+} heating_ssr_usage_t;
+
+// Get the SSR usage since boot, including the current on period
+void heating_get_ssr_usage(heating_ssr_usage_t *usage);
+
 // Emergency shutoff
 void heating_emergency_shutoff(void);
 
@@ -38,4 +52,16 @@ void pid_init(pid_config_t config);
 // Update PID with current temperature
 float pid_update(float current_temp);
 
+// Change PID setpoint without re-initializing the controller
+void pid_set_setpoint(float setpoint);
+
+// Change PID gains without re-initializing the controller (bumpless)
+void pid_set_gains(float kp, float ki, float kd);
+
+// Set a static output term added before clamping (0 = none)
+void pid_set_feedforward(float feedforward);
+
+// Preload the integral so the controller starts at a known holding output
+void pid_preload(float hold_output);
+
 #endif // HEATING_CONTRACT_H
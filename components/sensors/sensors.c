@@ -10,7 +10,8 @@
  * - Error handling and recovery
  *
  * The MAX31855 provides 14-bit resolution with 0.25°C precision and includes
- * cold junction compensation for accurate thermocouple measurements.
+ * cold junction compensation. Its conversion assumes a linear type K curve,
+ * so readings are re-linearized against the NIST tables (thermocouple_k.h).
  *
  * @author Insta Retrofit Development Team
  * @date 2025
@@ -22,6 +23,7 @@
 #include "driver/gpio.h"
 #include "system_config.h"
 #include "esp_timer.h"
+#include "thermocouple_k.h"
 
 static const char *TAG = "sensors";
 
@@ -259,7 +261,7 @@ esp_err_t sensor_deinit(void)
  *
  * MAX31855 Data Format:
  * - Bits 31-18: Thermocouple temperature (14-bit signed)
- * - Bits 17-4: Internal temperature (12-bit signed)
+ * - Bits 15-4: Internal (cold junction) temperature (12-bit signed)
  * - Bits 3-2: Reserved
  * - Bit 1: SCV fault (thermocouple short-circuited to VCC)
  * - Bit 0: SCG fault (thermocouple short-circuited to GND)
@@ -342,10 +344,26 @@ bool sensor_read_temperature(float *temperature)
         temp_raw |= 0xC000; // Sign extend
     }
 
-    // Convert to Celsius (0.25°C per LSB) and apply calibration offset
-    *temperature = (temp_raw * 0.25f) + SYSTEM_CONFIG.temperature.calibration_offset_celsius;
+    // Extract internal temperature (bits 15-4, signed 12-bit)
+    int16_t cold_junction_raw = (data >> 4) & 0x0FFF;
+    if (cold_junction_raw & 0x0800)
+    {
+        cold_junction_raw |= 0xF000;
+    }
+
+    // Convert to Celsius and apply calibration offset
+    if (SYSTEM_CONFIG.sensor.nist_linearization)
+    {
+        *temperature = thermocouple_k_centi_celsius(temp_raw, cold_junction_raw) / 100.0f;
+    }
+    else
+    {
+        *temperature = temp_raw * 0.25f; // Chip's linear conversion, 0.25°C per LSB
+    }
+    *temperature += SYSTEM_CONFIG.temperature.calibration_offset_celsius;
 
-    ESP_LOGD(TAG, "Temperature read: %.2f°C (raw: 0x%04X)", *temperature, temp_raw);
+    ESP_LOGD(TAG, "Temperature read: %.2f°C (raw: 0x%04X, cold junction: %.2f°C)",
+             *temperature, temp_raw, cold_junction_raw * 0.0625f);
     return true;
 }
 
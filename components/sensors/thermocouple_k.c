@@ -0,0 +1,76 @@
+/**
+ * @file thermocouple_k.c
+ * @brief NIST type K linearization implementation
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#include "thermocouple_k.h"
+#include "type_k_tables.h"
+
+#define MAX31855_SLOPE_NV 41276  ///< Fixed slope the chip converts with (nV/°C)
+
+// =============================================================================
+// Internal Helpers
+// =============================================================================
+
+/**
+ * @brief Cold junction voltage (nV) at a die temperature in 1/16 °C
+ */
+static int32_t cold_junction_emf_nv(int32_t sixteenths)
+{
+    int32_t offset = sixteenths - TYPE_K_CJ_MIN_C * 16;
+    int32_t step = TYPE_K_CJ_STEP_C * 16;
+    int32_t index = offset / step;
+
+    // Clamp to the table; the die is never outside it while the chip is in spec
+    if (offset < 0)
+    {
+        return type_k_cj_emf_nv[0];
+    }
+    if (index >= TYPE_K_CJ_POINTS - 1)
+    {
+        return type_k_cj_emf_nv[TYPE_K_CJ_POINTS - 1];
+    }
+
+    int32_t low = type_k_cj_emf_nv[index];
+    int32_t high = type_k_cj_emf_nv[index + 1];
+    return low + (high - low) * (offset - index * step) / step;
+}
+
+/**
+ * @brief Hot junction temperature (0.01 °C) at a total voltage in nV
+ */
+static int32_t emf_to_centi_celsius(int32_t emf_nv)
+{
+    int32_t offset = emf_nv - TYPE_K_EMF_MIN_UV * 1000;
+    int32_t step = TYPE_K_EMF_STEP_UV * 1000;
+    int32_t index = offset / step;
+
+    if (offset < 0)
+    {
+        return type_k_temp_centi[0];
+    }
+    if (index >= TYPE_K_EMF_POINTS - 1)
+    {
+        return type_k_temp_centi[TYPE_K_EMF_POINTS - 1];
+    }
+
+    int32_t low = type_k_temp_centi[index];
+    int32_t high = type_k_temp_centi[index + 1];
+    return low + (high - low) * (offset - index * step) / step;
+}
+
+// =============================================================================
+// Linearization
+// =============================================================================
+
+int32_t thermocouple_k_centi_celsius(int16_t thermocouple_raw, int16_t cold_junction_raw)
+{
+    // The chip reports T_cj + V / slope; recover V from the difference, in 1/16 °C
+    int32_t difference = (int32_t)thermocouple_raw * 4 - cold_junction_raw;
+    int32_t measured_nv = difference * MAX31855_SLOPE_NV / 16;
+
+    return emf_to_centi_celsius(measured_nv + cold_junction_emf_nv(cold_junction_raw));
+}
@@ -0,0 +1,35 @@
+/**
+ * @file thermocouple_k.h
+ * @brief NIST type K linearization of MAX31855 readings
+ *
+ * The MAX31855 converts the thermocouple voltage to temperature with a
+ * fixed 41.276 uV/°C slope, and adds its cold junction temperature the
+ * same way. The real type K curve is not a straight line: the reading
+ * is off by several degrees in the 150-220 °C pressing range, and the
+ * error changes with the cold junction (board) temperature.
+ *
+ * This module undoes the chip's conversion to recover the measured
+ * voltage, adds the cold junction voltage from the NIST ITS-90 reference
+ * function and converts the total back to temperature with the inverse.
+ * Both directions are lookup tables generated by
+ * tools/gen_type_k_tables.py and interpolated in integer arithmetic.
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#ifndef THERMOCOUPLE_K_H
+#define THERMOCOUPLE_K_H
+
+#include <stdint.h>
+
+/**
+ * @brief Linearize one MAX31855 reading
+ *
+ * @param thermocouple_raw Thermocouple field, sign-extended (0.25 °C/LSB)
+ * @param cold_junction_raw Internal temperature field, sign-extended (0.0625 °C/LSB)
+ * @return Hot junction temperature (0.01 °C), clamped to -200..1372 °C
+ */
+int32_t thermocouple_k_centi_celsius(int16_t thermocouple_raw, int16_t cold_junction_raw);
+
+#endif // THERMOCOUPLE_K_H
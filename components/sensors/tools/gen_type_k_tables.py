@@ -0,0 +1,115 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+Generate components/sensors/type_k_tables.h from the NIST ITS-90 type K
+reference function (NIST Monograph 175).
+
+The firmware linearizes thermocouple readings by interpolating in these
+tables, so the reference function (which has an exponential term for
+positive temperatures) is never evaluated on the device. The inverse
+table is built by solving the reference function numerically rather than
+from the NIST inverse polynomials, so the two tables are exact inverses
+of each other up to interpolation error.
+
+Usage: python3 gen_type_k_tables.py > ../type_k_tables.h
+"""
+
+import math
+
+# E(t) in mV for -270 <= t < 0 degC
+NEGATIVE = [
+    0.000000000000e+00, 0.394501280250e-01, 0.236223735980e-04,
+    -0.328589067840e-06, -0.499048287770e-08, -0.675090591730e-10,
+    -0.574103274280e-12, -0.310888728940e-14, -0.104516093650e-16,
+    -0.198892668780e-19, -0.163226974860e-22,
+]
+
+# E(t) in mV for 0 <= t <= 1372 degC, plus a0 * exp(a1 * (t - a2)^2)
+POSITIVE = [
+    -0.176004136860e-01, 0.389212049750e-01, 0.185587700320e-04,
+    -0.994575928740e-07, 0.318409457190e-09, -0.560728448890e-12,
+    0.560750590590e-15, -0.320207200030e-18, 0.971511471520e-22,
+    -0.121047212750e-25,
+]
+A0, A1, A2 = 0.118597600000e+00, -0.118343200000e-03, 0.126968600000e+03
+
+# Cold junction table: the MAX31855 die temperature range
+CJ_MIN_C, CJ_MAX_C, CJ_STEP_C = -40, 125, 5
+
+# Inverse table: -200 degC to above 1372 degC in 256 uV steps
+EMF_MIN_UV, EMF_STEP_UV, EMF_STEPS = -6144, 256, 240
+T_MIN_C, T_MAX_C = -200.0, 1372.0
+
+
+def emf_mv(t):
+    if t < 0.0:
+        return sum(c * t ** i for i, c in enumerate(NEGATIVE))
+    return sum(c * t ** i for i, c in enumerate(POSITIVE)) + A0 * math.exp(A1 * (t - A2) ** 2)
+
+
+def temperature_c(emf_uv):
+    """Invert the reference function by bisection (it is monotonic)."""
+    low, high = T_MIN_C, T_MAX_C
+    if emf_uv <= emf_mv(low) * 1000.0:
+        return low
+    if emf_uv >= emf_mv(high) * 1000.0:
+        return high
+    for _ in range(60):
+        middle = 0.5 * (low + high)
+        if emf_mv(middle) * 1000.0 < emf_uv:
+            low = middle
+        else:
+            high = middle
+    return 0.5 * (low + high)
+
+
+def rows(values, per_row=8):
+    out = []
+    for i in range(0, len(values), per_row):
+        out.append("    " + ", ".join("%d" % v for v in values[i:i + per_row]) + ",")
+    return "\n".join(out)
+
+
+def main():
+    cj = [round(emf_mv(t) * 1e6) for t in range(CJ_MIN_C, CJ_MAX_C + 1, CJ_STEP_C)]
+    inverse = [round(temperature_c(EMF_MIN_UV + i * EMF_STEP_UV) * 100.0) for i in range(EMF_STEPS + 1)]
+
+    print("""/**
+ * @file type_k_tables.h
+ * @brief NIST ITS-90 type K lookup tables
+ *
+ * GENERATED by tools/gen_type_k_tables.py - do not edit by hand.
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#ifndef TYPE_K_TABLES_H
+#define TYPE_K_TABLES_H
+
+#include <stdint.h>
+
+#define TYPE_K_CJ_MIN_C %d    ///< First cold junction table entry (°C)
+#define TYPE_K_CJ_STEP_C %d     ///< Cold junction table step (°C)
+#define TYPE_K_CJ_POINTS %d    ///< Cold junction table entries
+
+#define TYPE_K_EMF_MIN_UV %d ///< First inverse table entry (uV)
+#define TYPE_K_EMF_STEP_UV %d ///< Inverse table step (uV)
+#define TYPE_K_EMF_POINTS %d  ///< Inverse table entries
+
+/// Thermoelectric voltage at each cold junction temperature (nV)
+static const int32_t type_k_cj_emf_nv[TYPE_K_CJ_POINTS] = {
+%s
+};
+
+/// Temperature at each thermoelectric voltage (0.01 °C)
+static const int32_t type_k_temp_centi[TYPE_K_EMF_POINTS] = {
+%s
+};
+
+#endif // TYPE_K_TABLES_H""" % (CJ_MIN_C, CJ_STEP_C, len(cj), EMF_MIN_UV, EMF_STEP_UV, len(inverse),
+                             rows(cj), rows(inverse, 10)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,62 @@
+/**
+ * @file type_k_tables.h
+ * @brief NIST ITS-90 type K lookup tables
+ *
+ * GENERATED by tools/gen_type_k_tables.py - do not edit by hand.
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#ifndef TYPE_K_TABLES_H
+#define TYPE_K_TABLES_H
+
+#include <stdint.h>
+
+#define TYPE_K_CJ_MIN_C -40    ///< First cold junction table entry (°C)
+#define TYPE_K_CJ_STEP_C 5     ///< Cold junction table step (°C)
+#define TYPE_K_CJ_POINTS 34    ///< Cold junction table entries
+
+#define TYPE_K_EMF_MIN_UV -6144 ///< First inverse table entry (uV)
+#define TYPE_K_EMF_STEP_UV 256 ///< Inverse table step (uV)
+#define TYPE_K_EMF_POINTS 241  ///< Inverse table entries
+
+/// Thermoelectric voltage at each cold junction temperature (nV)
+static const int32_t type_k_cj_emf_nv[TYPE_K_CJ_POINTS] = {
+    -1526948, -1342549, -1156131, -967768, -777540, -585535, -391854, -196622,
+    0, 197851, 396862, 596972, 798120, 1000242, 1203275, 1407149,
+    1611792, 1817128, 2023078, 2229555, 2436472, 2643734, 2851249, 3058917,
+    3266642, 3474327, 3681879, 3889208, 4096230, 4302870, 4509060, 4714746,
+    4919882, 5124438,
+};
+
+/// Temperature at each thermoelectric voltage (0.01 °C)
+static const int32_t type_k_temp_centi[TYPE_K_EMF_POINTS] = {
+    -20000, -19978, -18443, -17108, -15904, -14795, -13759, -12780, -11849, -10958,
+    -10100, -9271, -8466, -7684, -6922, -6176, -5446, -4729, -4025, -3332,
+    -2649, -1975, -1310, -652, 0, 646, 1288, 1925, 2559, 3188,
+    3815, 4439, 5060, 5680, 6298, 6915, 7531, 8148, 8764, 9381,
+    9999, 10619, 11240, 11864, 12489, 13117, 13747, 14379, 15014, 15651,
+    16289, 16929, 17569, 18210, 18852, 19493, 20134, 20774, 21413, 22050,
+    22686, 23320, 23953, 24584, 25213, 25840, 26466, 27090, 27713, 28335,
+    28955, 29574, 30192, 30808, 31424, 32039, 32653, 33267, 33879, 34491,
+    35102, 35713, 36323, 36932, 37540, 38148, 38756, 39363, 39969, 40575,
+    41180, 41785, 42389, 42993, 43597, 44200, 44803, 45405, 46007, 46609,
+    47211, 47812, 48413, 49014, 49615, 50215, 50816, 51416, 52016, 52616,
+    53217, 53817, 54417, 55018, 55618, 56219, 56820, 57421, 58022, 58623,
+    59225, 59827, 60430, 61032, 61635, 62239, 62843, 63447, 64052, 64657,
+    65263, 65869, 66476, 67084, 67692, 68301, 68910, 69521, 70131, 70743,
+    71355, 71968, 72582, 73196, 73812, 74428, 75045, 75662, 76281, 76901,
+    77521, 78142, 78764, 79387, 80011, 80636, 81262, 81889, 82516, 83145,
+    83775, 84405, 85037, 85669, 86303, 86937, 87573, 88209, 88847, 89486,
+    90125, 90766, 91408, 92050, 92694, 93339, 93985, 94632, 95280, 95929,
+    96579, 97230, 97883, 98537, 99191, 99847, 100504, 101162, 101822, 102482,
+    103144, 103807, 104472, 105137, 105804, 106472, 107142, 107813, 108485, 109159,
+    109834, 110511, 111189, 111869, 112550, 113233, 113918, 114604, 115292, 115982,
+    116673, 117366, 118061, 118758, 119457, 120158, 120861, 121566, 122273, 122983,
+    123694, 124408, 125124, 125842, 126562, 127285, 128010, 128737, 129467, 130200,
+    130934, 131672, 132411, 133153, 133897, 134644, 135393, 136145, 136898, 137200,
+    137200,
+};
+
+#endif // TYPE_K_TABLES_H
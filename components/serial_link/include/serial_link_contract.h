@@ -0,0 +1,22 @@
+// serial_link_contract.h - Line-based Serial Port Interface
+#ifndef SERIAL_LINK_CONTRACT_H
+#define SERIAL_LINK_CONTRACT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "esp_err.h"
+
+// Initialize the serial port (port 0 is the USB/console port; pins -1 keep the current routing)
+esp_err_t serial_link_init(int port, int baud_rate, int tx_pin, int rx_pin);
+
+// Deinitialize the serial port and free resources
+esp_err_t serial_link_deinit(void);
+
+// Get the next complete received line without its line ending (non-blocking)
+bool serial_link_read_line(char *line, size_t size);
+
+// Send a line (caller supplies the line ending)
+void serial_link_write(const char *line);
+
+#endif // SERIAL_LINK_CONTRACT_H
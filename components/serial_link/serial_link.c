@@ -0,0 +1,140 @@
+/**
+ * @file serial_link.c
+ * @brief Line-based serial port for host communication
+ *
+ * Uses the UART driver with an RX ring buffer. Reads are non-blocking:
+ * serial_link_read_line() drains whatever has arrived and returns once a
+ * whole line has been collected. Overlong lines are discarded up to the
+ * next line ending rather than returned truncated.
+ *
+ * On the console port the ESP log shares the TX line; the host tells
+ * protocol lines from log output by their framing.
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#include "serial_link_contract.h"
+#include "esp_log.h"
+#include "driver/uart.h"
+#include <string.h>
+
+static const char *TAG = "serial_link";
+
+#define SERIAL_RX_BUFFER 512   ///< Driver RX ring buffer (bytes)
+#define SERIAL_LINE_BUFFER 128 ///< Longest line collected
+
+static int link_port = -1;
+static char line_buffer[SERIAL_LINE_BUFFER];
+static size_t line_length = 0;
+static bool line_overflow = false;
+
+esp_err_t serial_link_init(int port, int baud_rate, int tx_pin, int rx_pin)
+{
+    ESP_LOGI(TAG, "Initializing serial link on UART%d (TX %d, RX %d) at %d baud",
+             port, tx_pin, rx_pin, baud_rate);
+
+    uart_config_t config = {
+        .baud_rate = baud_rate,
+        .data_bits = UART_DATA_8_BITS,
+        .parity = UART_PARITY_DISABLE,
+        .stop_bits = UART_STOP_BITS_1,
+        .flow_ctrl = UART_HW_FLOWCTRL_DISABLE,
+        .source_clk = UART_SCLK_DEFAULT};
+
+    esp_err_t ret = uart_driver_install(port, SERIAL_RX_BUFFER, 0, 0, NULL, 0);
+    if (ret != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Failed to install UART driver: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    ret = uart_param_config(port, &config);
+    if (ret != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Failed to configure UART: %s", esp_err_to_name(ret));
+        uart_driver_delete(port);
+        return ret;
+    }
+
+    ret = uart_set_pin(port, tx_pin < 0 ? UART_PIN_NO_CHANGE : tx_pin,
+                       rx_pin < 0 ? UART_PIN_NO_CHANGE : rx_pin,
+                       UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE);
+    if (ret != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Failed to route UART pins: %s", esp_err_to_name(ret));
+        uart_driver_delete(port);
+        return ret;
+    }
+
+    link_port = port;
+    line_length = 0;
+    line_overflow = false;
+    ESP_LOGI(TAG, "Serial link initialized successfully");
+    return ESP_OK;
+}
+
+esp_err_t serial_link_deinit(void)
+{
+    if (link_port < 0)
+    {
+        return ESP_OK;
+    }
+
+    esp_err_t ret = uart_driver_delete(link_port);
+    link_port = -1;
+    return ret;
+}
+
+bool serial_link_read_line(char *line, size_t size)
+{
+    if (link_port < 0 || !line || size == 0)
+    {
+        return false;
+    }
+
+    uint8_t byte;
+    while (uart_read_bytes(link_port, &byte, 1, 0) == 1)
+    {
+        if (byte == '\r' || byte == '\n')
+        {
+            bool complete = line_length > 0 && !line_overflow;
+            size_t length = line_length;
+            line_length = 0;
+            line_overflow = false;
+
+            if (complete && length < size)
+            {
+                memcpy(line, line_buffer, length);
+                line[length] = '\0';
+                return true;
+            }
+            if (complete)
+            {
+                ESP_LOGW(TAG, "Dropped %u byte line (caller buffer too small)", (unsigned)length);
+            }
+            continue;
+        }
+
+        if (line_length < sizeof(line_buffer) - 1)
+        {
+            line_buffer[line_length++] = (char)byte;
+        }
+        else if (!line_overflow)
+        {
+            ESP_LOGW(TAG, "Line too long, discarding");
+            line_overflow = true;
+        }
+    }
+    return false;
+}
+
+void serial_link_write(const char *line)
+{
+    if (link_port < 0 || !line)
+    {
+        return;
+    }
+
+    uart_write_bytes(link_port, line, strlen(line));
+}
@@ -16,12 +16,60 @@ typedef enum {
 } shirt_side_t;
 
 typedef enum {
-    IDLE,
-    STAGE1,
-    STAGE2,
+    IDLE,     // no cycle, or between stages waiting for the press
+    ACTIVE,   // a stage is timing (pressing_cycle_t.stage says which)
     COMPLETE
 } cycle_status_t;
 
+// How a cycle stage ends
+typedef enum {
+    STAGE_END_TIME,      // after duration seconds
+    STAGE_END_DOSE       // after duration equivalent seconds at the stage setpoint
+} stage_end_t;
+
+// What starts a cycle stage once the previous one has ended
+typedef enum {
+    STAGE_ENTRY_REOPEN,  // press opened and closed again (moisture release, peel)
+    STAGE_ENTRY_CLOSED   // straight on, press stays closed
+} stage_entry_t;
+
+// Pressing cycle definition (see main/utils/cycle_engine.h)
+#define CYCLE_MAX_STAGES 6
+#define CYCLE_PROGRAM_COUNT 3
+
+typedef struct {
+    const char *name; // shown while the stage runs (9 chars max)
+    uint16_t duration; // seconds, or equivalent seconds for STAGE_END_DOSE
+    stage_end_t end;
+    stage_entry_t entry; // ignored for the first stage, which the press close starts
+    float setpoint_offset; // °C added to the target during the stage
+} cycle_stage_t;
+
+typedef struct {
+    uint8_t stage_count;
+    cycle_stage_t stages[CYCLE_MAX_STAGES];
+} cycle_definition_t;
+
+// Where the press's time goes (session accounting)
+typedef enum {
+    TIME_HEATING_UP,     // warming up, target not yet reached since boot
+    TIME_READY_IDLE,     // at temperature, waiting for the operator
+    TIME_PRESSING,       // pressing cycle in progress
+    TIME_WAITING_TEMP,   // temperature recovering after a press or setpoint change
+    TIME_PAUSED,         // operator pause
+    TIME_FAULT,          // emergency shutdown or unhealthy system
+    TIME_CATEGORY_COUNT
+} time_category_t;
+
+// Learned steady-state heater power, one point every POWER_MAP_SPACING °C from 0
+#define POWER_MAP_POINTS 13
+#define POWER_MAP_SPACING 20.0f
+
+typedef struct {
+    float hold_power[POWER_MAP_POINTS]; // % needed to hold each point
+    uint8_t samples[POWER_MAP_POINTS]; // settled periods learned into each point (saturates)
+} power_map_t;
+
 // Structs
 typedef struct {
     uint32_t id;
@@ -31,13 +79,172 @@ typedef struct {
     uint32_t time_elapsed; // seconds
     uint16_t shirts_completed;
     uint32_t avg_time_per_shirt; // seconds
+    shirt_side_t next_side; // side to press on the next cycle (double-sided runs)
+    uint16_t front_presses; // front-side presses completed in this run
+    uint16_t back_presses; // back-side presses completed in this run
+    uint32_t front_press_time; // seconds spent pressing front sides
+    uint32_t back_press_time; // seconds spent pressing back sides
+    bool manual; // set up by hand in Job Setup: queued job tickets wait until it is finished
 } print_run_t;
 
+// Job tickets pushed by the shop system over the serial link (see main/utils/job_ticket.h)
+#define JOB_ID_LEN 16 // including the terminator
+#define JOB_QUEUE_MAX 8
+#define JOB_PROFILE_KEEP 0xFF // ticket leaves the current material settings alone
+
+typedef struct {
+    char id[JOB_ID_LEN];
+    uint16_t num_shirts;
+    printing_type_t type;
+    uint8_t profile; // material profile index, or JOB_PROFILE_KEEP
+} job_ticket_t;
+
+typedef struct {
+    uint8_t count;
+    bool active; // tickets[0] is loaded into the print run
+    job_ticket_t tickets[JOB_QUEUE_MAX]; // oldest first
+} job_queue_t;
+
+// Scheduled pre-heat (see main/utils/preheat_schedule.h)
+#define PREHEAT_DAYS 7
+#define PREHEAT_DAY_OFF 0xFFFF // no pre-heat that weekday
+
+typedef struct {
+    int16_t utc_offset_min; // local time = UTC + offset
+    uint16_t ready_minute[PREHEAT_DAYS]; // ready by, minutes after local midnight; Sunday first
+    float warmup_sec_per_degree; // learned heat-up time per °C of rise (0 = not learned yet)
+    uint16_t warmup_samples; // heat-ups learned (saturates)
+} preheat_schedule_t;
+
+// Heater wear (see main/utils/rainflow.h)
+#define WEAR_RANGE_BINS 8 // thermal cycle range bins
+#define WEAR_RESIDUE_MAX 24 // open reversals kept between cycles
+
+typedef struct {
+    uint32_t half_cycles[WEAR_RANGE_BINS]; // closed half cycles per range bin
+    float damage; // life used, in full cycles at the reference range
+    float residue[WEAR_RESIDUE_MAX]; // reversals not yet closed into a cycle, oldest first (°C)
+    uint8_t residue_count;
+} thermal_cycles_t;
+
+typedef struct {
+    uint32_t ssr_switches; // SSR off -> on transitions
+    uint32_t ssr_on_seconds; // seconds with any heater power
+    uint32_t heater_full_power_seconds; // on time weighted by power
+    thermal_cycles_t element; // heater element (core estimate)
+    thermal_cycles_t platen; // platen surface (thermocouple)
+} wear_stats_t;
+
+// Heater health trend (see main/pid/heater_health.h)
+#define HEATER_HEALTH_POINTS 24 // one point per day with heat-ups, oldest dropped
+
+typedef struct {
+    uint32_t day; // days since 1970 (UTC), 0 = wall clock was not set
+    uint16_t fits; // heat-ups averaged into this point
+    float heater_watts; // effective heater power at 100% (W)
+    float loss_coefficient; // loss to ambient (W/°C)
+} heater_health_point_t;
+
+typedef struct {
+    heater_health_point_t points[HEATER_HEALTH_POINTS]; // oldest first
+    uint8_t count;
+    float baseline_watts; // average of the first points (0 = not established yet)
+    float baseline_loss;
+} heater_health_t;
+
+// Heater health series against its baseline
+typedef struct {
+    bool valid; // baseline established
+    float recent_watts; // heater power over the latest points (W)
+    float recent_loss; // loss coefficient over the latest points (W/°C)
+    float watts_change_percent; // against the baseline (negative = weaker)
+    float loss_change_percent; // against the baseline (positive = leakier)
+    float watts_per_month; // fitted slope over dated points (W per 30 days, 0 = unknown)
+} heater_trend_t;
+
+// Surface calibration table (see main/utils/surface_cal.h)
+#define SURFACE_CAL_POINTS 6
+
+typedef struct {
+    float sensor_celsius; // thermocouple reading, without the table (°C)
+    float surface_celsius; // reference probe on the platen surface (°C)
+    float as_found; // probe minus the reading corrected by the previous table (°C)
+} surface_cal_point_t;
+
+typedef struct {
+    surface_cal_point_t points[SURFACE_CAL_POINTS]; // ascending sensor reading
+    uint8_t count; // 0 = no correction
+    uint32_t day; // days since 1970 (UTC) when calibrated, 0 = wall clock was not set
+    float as_found_max; // largest |as_found| (°C), drift since the previous calibration
+    float interpolation_max; // largest error at an inner point left out of the table (°C)
+} surface_calibration_t;
+
+// Surface calibration procedure progress
+typedef struct {
+    bool active; // procedure running (the table is not applied meanwhile)
+    bool settled; // reading has held the setpoint long enough: read the probe now
+    uint8_t point; // setpoint being measured, 0-based (== points once all are measured)
+    uint8_t points; // setpoints in the procedure
+    float setpoint; // current calibration setpoint (°C)
+    float reading; // uncorrected reading averaged while settled (°C)
+    uint16_t settle_remaining; // seconds until settled
+    float as_found_max; // of the points recorded so far (°C)
+    float interpolation_max; // of the points recorded so far (°C)
+} surface_cal_status_t;
+
+// Adaptive tuning record (see main/pid/pid_adaptive.h)
+#define ADAPTIVE_AUDIT_SIZE 8 // audit log entries kept
+
+typedef struct {
+    float kp;
+    float ki;
+    float kd;
+} pid_gains_t;
+
+// Reason for a gain change
+typedef enum {
+    ADAPTIVE_CHANGE_DETUNE, // less gain: overshoot or oscillation
+    ADAPTIVE_CHANGE_STIFFEN, // more gain: deep sag, slow recovery
+    ADAPTIVE_CHANGE_ACCEPT, // trial kept
+    ADAPTIVE_CHANGE_ROLLBACK, // trial performed worse, gains restored
+    ADAPTIVE_CHANGE_ANCHOR, // gains set from outside (manual edit, relay autotune): new reference
+    ADAPTIVE_CHANGE_COUNT
+} adaptive_change_t;
+
+typedef struct {
+    uint32_t cycle; // cycle count when the change was made
+    uint8_t change; // adaptive_change_t
+    pid_gains_t from;
+    pid_gains_t to;
+    float score; // window score that triggered the change
+} adaptive_audit_entry_t;
+
+typedef struct {
+    pid_gains_t reference; // gains adaptation is bounded around
+    pid_gains_t baseline; // last known-good gains (rollback target)
+    pid_gains_t gains; // gains the tuner last applied
+    float baseline_score; // mean score of the baseline window
+    bool trial_active; // gains are a trial still to be judged
+    uint32_t cycles; // scored cycles since the first anchor
+    adaptive_audit_entry_t audit[ADAPTIVE_AUDIT_SIZE]; // ring, audit_head = next slot
+    uint8_t audit_count;
+    uint8_t audit_head;
+} adaptive_record_t;
+
+// Parts whose wear is tracked
+typedef enum {
+    WEAR_PART_SSR,
+    WEAR_PART_ELEMENT,
+    WEAR_PART_PLATEN,
+    WEAR_PART_COUNT
+} wear_part_t;
+
 typedef struct {
     uint16_t shirt_id;
     shirt_side_t side;
-    uint16_t stage1_duration; // seconds
-    uint16_t stage2_duration; // seconds
+    uint8_t program; // cycle program (settings_t.cycle_program)
+    uint8_t stage; // current stage, 0-based
+    uint8_t stage_count;
     uint32_t start_time; // timestamp
     cycle_status_t status;
 } pressing_cycle_t;
@@ -49,6 +256,28 @@ typedef struct {
     float pid_kd;
     uint16_t stage1_default; // seconds
     uint16_t stage2_default; // seconds
+    uint16_t back_stage1_default; // seconds, back side of double-sided shirts
+    uint16_t back_stage2_default; // seconds, back side of double-sided shirts
+    uint16_t station_b_stage1_default; // seconds, shuttle press station B (front/single side)
+    uint16_t station_b_stage2_default; // seconds, shuttle press station B (front/single side)
+    float back_temp_offset; // °C added to target_temp for the back side
+    float keep_warm_drop; // °C below target held while paused (0 = heater off)
+    float ramp_rate; // °C/s heat-up setpoint ramp (0 = step)
+    uint16_t soak_time; // seconds held at target after heat-up before ready
+    bool adaptive_tuning; // adjust PID gains between presses from measured performance
+    bool cascade_enabled; // inner heater-core loop under the surface loop
+    float outer_kp; // cascade outer (surface) loop gains, core °C per surface °C
+    float outer_ki;
+    float outer_kd;
+    float inner_kp; // cascade inner (heater core) loop gains
+    float inner_ki;
+    float inner_kd;
+    bool smith_enabled; // dead-time compensation (Smith predictor) on the single loop
+    bool load_compensation; // feed the observed thermal load forward into the heater output
+    bool power_feedforward; // feed the learned holding power forward into the heater output
+    bool press_preboost; // raise the setpoint just before the predicted press close
+    power_map_t power_map; // holding power vs setpoint, learned while settled
+    uint8_t cycle_program; // 0 = two stages from the stage timers, else a built-in multi-stage program
 } settings_t;
 
 typedef struct {
@@ -65,8 +294,40 @@ typedef struct {
     uint16_t sensor_failures;
     uint16_t emergency_stops;
     uint32_t session_start_time;
+    uint32_t front_presses; // front-side presses (double-sided runs)
+    uint32_t back_presses; // back-side presses (double-sided runs)
+    uint32_t front_press_time; // seconds spent pressing front sides
+    uint32_t back_press_time; // seconds spent pressing back sides
+    uint32_t double_sided_shirts; // shirts finished on both sides
 } statistics_t;
 
+typedef struct {
+    uint32_t start_time; // timestamp (seconds since boot)
+    uint32_t seconds[TIME_CATEGORY_COUNT]; // seconds spent in each category
+    uint32_t presses;
+    uint32_t shirts; // finished shirts (both sides for double-sided jobs)
+} session_tally_t;
+
+// What holds production back over a pacing window
+typedef enum {
+    PACE_LIMIT_NONE,     // on pace, or not enough data
+    PACE_LIMIT_PRESS,    // pressing overran the plan or the platen was recovering
+    PACE_LIMIT_OPERATOR  // loading/unloading took longer than the plan
+} pace_limit_t;
+
+// Rolling throughput over the last few minutes against the job's plan
+typedef struct {
+    uint16_t window_min; // minutes of data the figures cover
+    uint16_t shirts;
+    uint16_t presses;
+    uint16_t target_takt; // planned seconds per shirt
+    uint16_t actual_takt; // seconds per shirt over the window (0 = no shirts yet)
+    uint16_t press_sec; // average seconds pressing per press
+    uint16_t handling_sec; // average seconds loading/unloading per press
+    uint16_t recovery_sec; // average seconds waiting for temperature per press
+    pace_limit_t limit;
+} pace_status_t;
+
 // Validation functions
 bool validate_print_run(const print_run_t *run);
 bool validate_pressing_cycle(const pressing_cycle_t *cycle);
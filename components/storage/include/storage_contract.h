@@ -22,6 +22,42 @@ esp_err_t storage_save_print_run(const print_run_t *run);
 // Load print run
 esp_err_t storage_load_print_run(print_run_t *run);
 
+// Save job ticket queue
+esp_err_t storage_save_job_queue(const job_queue_t *queue);
+
+// Load job ticket queue
+esp_err_t storage_load_job_queue(job_queue_t *queue);
+
+// Save pre-heat schedule
+esp_err_t storage_save_preheat_schedule(const preheat_schedule_t *schedule);
+
+// Load pre-heat schedule
+esp_err_t storage_load_preheat_schedule(preheat_schedule_t *schedule);
+
+// Save heater wear counters
+esp_err_t storage_save_wear_stats(const wear_stats_t *wear);
+
+// Load heater wear counters
+esp_err_t storage_load_wear_stats(wear_stats_t *wear);
+
+// Save heater health series
+esp_err_t storage_save_heater_health(const heater_health_t *health);
+
+// Load heater health series
+esp_err_t storage_load_heater_health(heater_health_t *health);
+
+// Save adaptive tuning reference and audit trail
+esp_err_t storage_save_adaptive_record(const adaptive_record_t *record);
+
+// Load adaptive tuning reference and audit trail
+esp_err_t storage_load_adaptive_record(adaptive_record_t *record);
+
+// Save surface calibration table
+esp_err_t storage_save_surface_calibration(const surface_calibration_t *calibration);
+
+// Load surface calibration table
+esp_err_t storage_load_surface_calibration(surface_calibration_t *calibration);
+
 // Check if data exists
 bool storage_has_saved_data(void);
 
@@ -11,6 +11,12 @@ static const char *TAG = "storage";
 // NVS keys
 #define NVS_KEY_SETTINGS "settings"
 #define NVS_KEY_PRINT_RUN "print_run"
+#define NVS_KEY_JOB_QUEUE "job_queue"
+#define NVS_KEY_PREHEAT "preheat"
+#define NVS_KEY_WEAR "wear"
+#define NVS_KEY_HEATER_HEALTH "heater_health"
+#define NVS_KEY_SURFACE_CAL "surface_cal"
+#define NVS_KEY_ADAPTIVE "adaptive"
 
 static nvs_handle_t my_nvs_handle;
 
@@ -141,6 +147,282 @@ esp_err_t storage_load_print_run(print_run_t *run)
     return ESP_OK;
 }
 
+esp_err_t storage_save_job_queue(const job_queue_t *queue)
+{
+    if (!queue)
+        return ESP_ERR_INVALID_ARG;
+
+    esp_err_t ret = nvs_set_blob(my_nvs_handle, NVS_KEY_JOB_QUEUE, queue, sizeof(job_queue_t));
+    if (ret != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Failed to save job queue: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    ret = nvs_commit(my_nvs_handle);
+    if (ret != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Failed to commit job queue: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    ESP_LOGI(TAG, "Job queue saved successfully");
+    return ESP_OK;
+}
+
+esp_err_t storage_load_job_queue(job_queue_t *queue)
+{
+    if (!queue)
+        return ESP_ERR_INVALID_ARG;
+
+    size_t required_size = sizeof(job_queue_t);
+    esp_err_t ret = nvs_get_blob(my_nvs_handle, NVS_KEY_JOB_QUEUE, queue, &required_size);
+    if (ret != ESP_OK)
+    {
+        ESP_LOGW(TAG, "Failed to load job queue: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    if (required_size != sizeof(job_queue_t))
+    {
+        ESP_LOGW(TAG, "Job queue size mismatch, starting empty");
+        return ESP_ERR_NVS_INVALID_LENGTH;
+    }
+
+    ESP_LOGI(TAG, "Job queue loaded successfully");
+    return ESP_OK;
+}
+
+esp_err_t storage_save_preheat_schedule(const preheat_schedule_t *schedule)
+{
+    if (!schedule)
+        return ESP_ERR_INVALID_ARG;
+
+    esp_err_t ret = nvs_set_blob(my_nvs_handle, NVS_KEY_PREHEAT, schedule, sizeof(preheat_schedule_t));
+    if (ret != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Failed to save pre-heat schedule: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    ret = nvs_commit(my_nvs_handle);
+    if (ret != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Failed to commit pre-heat schedule: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    ESP_LOGI(TAG, "Pre-heat schedule saved successfully");
+    return ESP_OK;
+}
+
+esp_err_t storage_load_preheat_schedule(preheat_schedule_t *schedule)
+{
+    if (!schedule)
+        return ESP_ERR_INVALID_ARG;
+
+    size_t required_size = sizeof(preheat_schedule_t);
+    esp_err_t ret = nvs_get_blob(my_nvs_handle, NVS_KEY_PREHEAT, schedule, &required_size);
+    if (ret != ESP_OK)
+    {
+        ESP_LOGW(TAG, "Failed to load pre-heat schedule: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    if (required_size != sizeof(preheat_schedule_t))
+    {
+        ESP_LOGW(TAG, "Pre-heat schedule size mismatch, using defaults");
+        return ESP_ERR_NVS_INVALID_LENGTH;
+    }
+
+    ESP_LOGI(TAG, "Pre-heat schedule loaded successfully");
+    return ESP_OK;
+}
+
+esp_err_t storage_save_wear_stats(const wear_stats_t *wear)
+{
+    if (!wear)
+        return ESP_ERR_INVALID_ARG;
+
+    esp_err_t ret = nvs_set_blob(my_nvs_handle, NVS_KEY_WEAR, wear, sizeof(wear_stats_t));
+    if (ret != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Failed to save wear counters: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    ret = nvs_commit(my_nvs_handle);
+    if (ret != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Failed to commit wear counters: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    ESP_LOGD(TAG, "Wear counters saved successfully");
+    return ESP_OK;
+}
+
+esp_err_t storage_load_wear_stats(wear_stats_t *wear)
+{
+    if (!wear)
+        return ESP_ERR_INVALID_ARG;
+
+    size_t required_size = sizeof(wear_stats_t);
+    esp_err_t ret = nvs_get_blob(my_nvs_handle, NVS_KEY_WEAR, wear, &required_size);
+    if (ret != ESP_OK)
+    {
+        ESP_LOGW(TAG, "Failed to load wear counters: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    if (required_size != sizeof(wear_stats_t))
+    {
+        ESP_LOGW(TAG, "Wear counters size mismatch, starting from zero");
+        return ESP_ERR_NVS_INVALID_LENGTH;
+    }
+
+    ESP_LOGI(TAG, "Wear counters loaded successfully");
+    return ESP_OK;
+}
+
+esp_err_t storage_save_heater_health(const heater_health_t *health)
+{
+    if (!health)
+        return ESP_ERR_INVALID_ARG;
+
+    esp_err_t ret = nvs_set_blob(my_nvs_handle, NVS_KEY_HEATER_HEALTH, health, sizeof(heater_health_t));
+    if (ret != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Failed to save heater health: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    ret = nvs_commit(my_nvs_handle);
+    if (ret != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Failed to commit heater health: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    ESP_LOGI(TAG, "Heater health saved successfully");
+    return ESP_OK;
+}
+
+esp_err_t storage_load_heater_health(heater_health_t *health)
+{
+    if (!health)
+        return ESP_ERR_INVALID_ARG;
+
+    size_t required_size = sizeof(heater_health_t);
+    esp_err_t ret = nvs_get_blob(my_nvs_handle, NVS_KEY_HEATER_HEALTH, health, &required_size);
+    if (ret != ESP_OK)
+    {
+        ESP_LOGW(TAG, "Failed to load heater health: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    if (required_size != sizeof(heater_health_t))
+    {
+        ESP_LOGW(TAG, "Heater health size mismatch, starting a new series");
+        return ESP_ERR_NVS_INVALID_LENGTH;
+    }
+
+    ESP_LOGI(TAG, "Heater health loaded successfully");
+    return ESP_OK;
+}
+
+esp_err_t storage_save_adaptive_record(const adaptive_record_t *record)
+{
+    if (!record)
+        return ESP_ERR_INVALID_ARG;
+
+    esp_err_t ret = nvs_set_blob(my_nvs_handle, NVS_KEY_ADAPTIVE, record, sizeof(adaptive_record_t));
+    if (ret != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Failed to save adaptive tuning record: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    ret = nvs_commit(my_nvs_handle);
+    if (ret != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Failed to commit adaptive tuning record: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    ESP_LOGD(TAG, "Adaptive tuning record saved successfully");
+    return ESP_OK;
+}
+
+esp_err_t storage_load_adaptive_record(adaptive_record_t *record)
+{
+    if (!record)
+        return ESP_ERR_INVALID_ARG;
+
+    size_t required_size = sizeof(adaptive_record_t);
+    esp_err_t ret = nvs_get_blob(my_nvs_handle, NVS_KEY_ADAPTIVE, record, &required_size);
+    if (ret != ESP_OK)
+    {
+        ESP_LOGW(TAG, "Failed to load adaptive tuning record: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    if (required_size != sizeof(adaptive_record_t))
+    {
+        ESP_LOGW(TAG, "Adaptive tuning record size mismatch, re-anchoring");
+        return ESP_ERR_NVS_INVALID_LENGTH;
+    }
+
+    ESP_LOGI(TAG, "Adaptive tuning record loaded successfully");
+    return ESP_OK;
+}
+
+esp_err_t storage_save_surface_calibration(const surface_calibration_t *calibration)
+{
+    if (!calibration)
+        return ESP_ERR_INVALID_ARG;
+
+    esp_err_t ret = nvs_set_blob(my_nvs_handle, NVS_KEY_SURFACE_CAL, calibration, sizeof(surface_calibration_t));
+    if (ret != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Failed to save surface calibration: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    ret = nvs_commit(my_nvs_handle);
+    if (ret != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Failed to commit surface calibration: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    ESP_LOGI(TAG, "Surface calibration saved successfully");
+    return ESP_OK;
+}
+
+esp_err_t storage_load_surface_calibration(surface_calibration_t *calibration)
+{
+    if (!calibration)
+        return ESP_ERR_INVALID_ARG;
+
+    size_t required_size = sizeof(surface_calibration_t);
+    esp_err_t ret = nvs_get_blob(my_nvs_handle, NVS_KEY_SURFACE_CAL, calibration, &required_size);
+    if (ret != ESP_OK)
+    {
+        ESP_LOGW(TAG, "Failed to load surface calibration: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    if (required_size != sizeof(surface_calibration_t))
+    {
+        ESP_LOGW(TAG, "Surface calibration size mismatch, no correction applied");
+        return ESP_ERR_NVS_INVALID_LENGTH;
+    }
+
+    ESP_LOGI(TAG, "Surface calibration loaded successfully");
+    return ESP_OK;
+}
+
 bool storage_has_saved_data(void)
 {
     size_t required_size;
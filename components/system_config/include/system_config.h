@@ -43,6 +43,7 @@ typedef struct
         uint32_t temp_task_timeout_sec;         ///< Temperature task watchdog timeout (s)
         uint32_t sensor_timeout_sec;            ///< Maximum time without sensor reading (s)
         uint32_t sensor_validation_timeout_sec; ///< Sensor timeout for cycle validation (s)
+        uint32_t settings_save_delay_sec;       ///< Quiet time after a settings edit before the NVS write (s)
     } timing;
 
     // Temperature thresholds
@@ -63,6 +64,7 @@ typedef struct
     {
         uint8_t retry_count;     ///< Number of sensor read retry attempts
         uint32_t retry_delay_ms; ///< Delay between retry attempts (ms)
+        bool nist_linearization; ///< Correct the MAX31855 reading with the NIST type K tables
     } sensor;
 
     // Heat-up display configuration
@@ -73,6 +75,134 @@ typedef struct
         float min_heating_rate;         ///< Minimum heating rate for valid ETA (°C/s)
     } heat_up;
 
+    // Pause keep-warm configuration
+    struct
+    {
+        float keep_warm_drop_celsius;   ///< Default drop below target held while paused (°C)
+        float resume_ramp_rate;         ///< Setpoint ramp back to target after unpause (°C/s)
+        float default_heating_rate;     ///< Heating rate assumed for resume ETA until measured (°C/s)
+    } pause;
+
+    // Cascade control (heater-core model)
+    struct
+    {
+        float core_gain_celsius;        ///< Steady core rise above the surface at 100% power (°C)
+        float core_time_constant_sec;   ///< Heater core to surface time constant (s)
+        float max_core_excess_celsius;  ///< Inner setpoint limit above/below the surface setpoint (°C)
+    } cascade;
+
+    // Smith predictor (FOPDT process model)
+    struct
+    {
+        float model_gain;               ///< Steady temperature rise per % power (°C/%)
+        float time_constant_sec;        ///< Process lag (s)
+        float dead_time_sec;            ///< Element-to-thermocouple transport delay (s)
+        float mismatch_limit_celsius;   ///< Residual variation that means the model is off (°C)
+        float mismatch_hold_sec;        ///< Time over the limit before falling back (s)
+        float ident_max_start_celsius;  ///< Heat-ups starting below this refine the model (°C)
+    } smith;
+
+    // Disturbance observer (platen heat balance)
+    struct
+    {
+        float heater_watts;             ///< Heater power at 100% (W)
+        float capacity_j_per_celsius;   ///< Platen heat capacity (J/°C)
+        float loss_w_per_celsius;       ///< Loss to ambient (W/°C)
+        float observer_gain;            ///< Share of each step's prediction error taken as load
+        float compensation_fraction;    ///< Share of the estimated load fed forward
+    } observer;
+
+    // Holding power map (static feedforward)
+    struct
+    {
+        float settle_band_celsius;      ///< Within this of the setpoint counts as settled (°C)
+        uint16_t settle_time_sec;       ///< Settled time averaged into one map update (s)
+        float learn_weight;             ///< Share of a new average taken into the map
+    } power_map;
+
+    // Anticipatory pre-boost before a predicted press close
+    struct
+    {
+        float boost_celsius;            ///< Setpoint raise ahead of the close (°C)
+        uint16_t lead_sec;              ///< Boost starts this long before the early close (s)
+        uint8_t min_samples;            ///< Intervals needed before boosting
+        uint16_t max_spread_sec;        ///< Widest interquartile range still treated as a rhythm (s)
+        uint16_t max_interval_sec;      ///< Longer open periods are breaks, not learned (s)
+    } preboost;
+
+    // Predictive readiness gate
+    struct
+    {
+        bool enabled;                   ///< Allow ready on a predicted in-tolerance stage 1
+        float max_deficit_celsius;      ///< Reading may be at most this far below the ready band (°C)
+        float slope_window_sec;         ///< Smoothing of the reading slope (s)
+    } ready_gate;
+
+    // Shuttle press: two lower stations under one heated upper platen
+    struct
+    {
+        bool enabled;                   ///< Second station reed switch fitted
+    } shuttle;
+
+    // Operator pacing
+    struct
+    {
+        uint16_t handling_sec;          ///< Planned open/unload/load/close time per press (s)
+        uint8_t window_min;             ///< Window shown on the pressing screens (minutes)
+    } pacing;
+
+    // Job ticket import from the shop system
+    struct
+    {
+        bool enabled;                   ///< Accept job tickets on the serial port
+        uint8_t uart_port;              ///< UART number (0 = USB/console port, shared with the log)
+        int8_t tx_pin;                  ///< TX GPIO (-1 = keep the port's routing, UART0 only)
+        int8_t rx_pin;                  ///< RX GPIO (-1 = keep the port's routing, UART0 only)
+        uint32_t baud_rate;             ///< Line speed
+    } job_link;
+
+    // Scheduled automatic pre-heat
+    struct
+    {
+        uint16_t margin_sec;            ///< Extra lead for the final approach and soak (s)
+        uint16_t abandon_sec;           ///< Heating stops this long after the ready time if nobody came (s)
+        float min_learn_rise;           ///< Shorter heat-ups are not learned (°C)
+        float learn_weight;             ///< Weight of each new heat-up in the learned rate
+    } preheat;
+
+    // Heater and SSR wear tracking
+    struct
+    {
+        float cycle_hysteresis;         ///< Smaller temperature reversals are noise, not cycles (°C)
+        float reference_range;          ///< Range the rated cycles are quoted at (°C)
+        float damage_exponent;          ///< Damage grows with range to this power (Coffin-Manson)
+        uint32_t element_rated_cycles;  ///< Element life at the reference range (full cycles)
+        uint32_t platen_rated_cycles;   ///< Platen life at the reference range (full cycles)
+        uint32_t ssr_rated_switches;    ///< SSR life (off -> on transitions)
+        uint8_t service_percent;        ///< Flag a part for service at this much life used
+        uint16_t save_interval_sec;     ///< Counters are written to flash this often (s)
+    } wear;
+
+    // Heater degradation trend
+    struct
+    {
+        float min_rise;                 ///< Heat-ups with less rise are not fitted (°C)
+        uint16_t settle_sec;            ///< Settled time that ends a fit (s)
+        float power_drop_percent;       ///< Alert when heater power falls this far below the baseline
+        float loss_rise_percent;        ///< Alert when losses rise this far above the baseline
+    } heater_health;
+
+    // Surface calibration procedure
+    struct
+    {
+        float first_setpoint;           ///< Lowest calibration setpoint (°C)
+        float setpoint_step;            ///< Spacing between calibration setpoints (°C)
+        uint8_t points;                 ///< Setpoints visited (at most SURFACE_CAL_POINTS)
+        float settle_band;              ///< Reading must stay this close to the setpoint (°C)
+        uint16_t settle_sec;            ///< Time in the band before the probe is read (s)
+        float max_correction;           ///< Larger probe differences are rejected as entry errors (°C)
+    } surface_cal;
+
     // Simulation mode configuration
     struct
     {
@@ -116,6 +246,7 @@ extern const system_config_t SYSTEM_CONFIG;
 #define TEMP_TASK_TIMEOUT_SEC (SYSTEM_CONFIG.timing.temp_task_timeout_sec)
 #define SENSOR_TIMEOUT_SEC (SYSTEM_CONFIG.timing.sensor_timeout_sec)
 #define SENSOR_VALIDATION_TIMEOUT_SEC (SYSTEM_CONFIG.timing.sensor_validation_timeout_sec)
+#define SETTINGS_SAVE_DELAY_SEC (SYSTEM_CONFIG.timing.settings_save_delay_sec)
 
 // Temperature Constants
 #define TEMP_HYSTERESIS (SYSTEM_CONFIG.temperature.hysteresis_celsius)
@@ -135,6 +266,93 @@ extern const system_config_t SYSTEM_CONFIG;
 #define HEAT_UP_MIN_ELAPSED_TIME (SYSTEM_CONFIG.heat_up.min_elapsed_time_sec)
 #define HEAT_UP_MIN_HEATING_RATE (SYSTEM_CONFIG.heat_up.min_heating_rate)
 
+// Pause Keep-warm Constants
+#define PAUSE_KEEP_WARM_DROP (SYSTEM_CONFIG.pause.keep_warm_drop_celsius)
+#define PAUSE_RESUME_RAMP_RATE (SYSTEM_CONFIG.pause.resume_ramp_rate)
+#define PAUSE_DEFAULT_HEATING_RATE (SYSTEM_CONFIG.pause.default_heating_rate)
+
+// Cascade control shortcuts
+#define CASCADE_CORE_GAIN (SYSTEM_CONFIG.cascade.core_gain_celsius)
+#define CASCADE_CORE_TIME_CONSTANT (SYSTEM_CONFIG.cascade.core_time_constant_sec)
+#define CASCADE_MAX_CORE_EXCESS (SYSTEM_CONFIG.cascade.max_core_excess_celsius)
+
+// Smith predictor shortcuts
+#define SMITH_MODEL_GAIN (SYSTEM_CONFIG.smith.model_gain)
+#define SMITH_TIME_CONSTANT (SYSTEM_CONFIG.smith.time_constant_sec)
+#define SMITH_DEAD_TIME (SYSTEM_CONFIG.smith.dead_time_sec)
+#define SMITH_MISMATCH_LIMIT (SYSTEM_CONFIG.smith.mismatch_limit_celsius)
+#define SMITH_MISMATCH_HOLD_SEC (SYSTEM_CONFIG.smith.mismatch_hold_sec)
+#define SMITH_IDENT_MAX_START_TEMP (SYSTEM_CONFIG.smith.ident_max_start_celsius)
+
+// Disturbance observer shortcuts
+#define OBSERVER_HEATER_WATTS (SYSTEM_CONFIG.observer.heater_watts)
+#define OBSERVER_CAPACITY (SYSTEM_CONFIG.observer.capacity_j_per_celsius)
+#define OBSERVER_LOSS_COEFFICIENT (SYSTEM_CONFIG.observer.loss_w_per_celsius)
+#define OBSERVER_GAIN (SYSTEM_CONFIG.observer.observer_gain)
+#define OBSERVER_COMPENSATION (SYSTEM_CONFIG.observer.compensation_fraction)
+
+// Holding power map shortcuts
+#define POWER_MAP_SETTLE_BAND (SYSTEM_CONFIG.power_map.settle_band_celsius)
+#define POWER_MAP_SETTLE_TIME_SEC (SYSTEM_CONFIG.power_map.settle_time_sec)
+#define POWER_MAP_LEARN_WEIGHT (SYSTEM_CONFIG.power_map.learn_weight)
+
+// Pre-boost shortcuts
+#define PREBOOST_CELSIUS (SYSTEM_CONFIG.preboost.boost_celsius)
+#define PREBOOST_LEAD_SEC (SYSTEM_CONFIG.preboost.lead_sec)
+#define PREBOOST_MIN_SAMPLES (SYSTEM_CONFIG.preboost.min_samples)
+#define PREBOOST_MAX_SPREAD_SEC (SYSTEM_CONFIG.preboost.max_spread_sec)
+#define PREBOOST_MAX_INTERVAL_SEC (SYSTEM_CONFIG.preboost.max_interval_sec)
+
+// Ready gate shortcuts
+#define READY_GATE_ENABLED (SYSTEM_CONFIG.ready_gate.enabled)
+#define READY_GATE_MAX_DEFICIT (SYSTEM_CONFIG.ready_gate.max_deficit_celsius)
+#define READY_GATE_SLOPE_WINDOW (SYSTEM_CONFIG.ready_gate.slope_window_sec)
+
+// Shuttle press shortcuts
+#define SHUTTLE_ENABLED (SYSTEM_CONFIG.shuttle.enabled)
+#define STATION_COUNT 2
+
+// Pacing shortcuts
+#define PACING_HANDLING_SEC (SYSTEM_CONFIG.pacing.handling_sec)
+#define PACING_WINDOW_MIN (SYSTEM_CONFIG.pacing.window_min)
+
+// Job link shortcuts
+#define JOB_LINK_ENABLED (SYSTEM_CONFIG.job_link.enabled)
+#define JOB_LINK_UART_PORT (SYSTEM_CONFIG.job_link.uart_port)
+#define JOB_LINK_TX_PIN (SYSTEM_CONFIG.job_link.tx_pin)
+#define JOB_LINK_RX_PIN (SYSTEM_CONFIG.job_link.rx_pin)
+#define JOB_LINK_BAUD_RATE (SYSTEM_CONFIG.job_link.baud_rate)
+
+// Pre-heat shortcuts
+#define PREHEAT_MARGIN_SEC (SYSTEM_CONFIG.preheat.margin_sec)
+#define PREHEAT_ABANDON_SEC (SYSTEM_CONFIG.preheat.abandon_sec)
+#define PREHEAT_MIN_LEARN_RISE (SYSTEM_CONFIG.preheat.min_learn_rise)
+#define PREHEAT_LEARN_WEIGHT (SYSTEM_CONFIG.preheat.learn_weight)
+
+// Wear shortcuts
+#define WEAR_CYCLE_HYSTERESIS (SYSTEM_CONFIG.wear.cycle_hysteresis)
+#define WEAR_REFERENCE_RANGE (SYSTEM_CONFIG.wear.reference_range)
+#define WEAR_DAMAGE_EXPONENT (SYSTEM_CONFIG.wear.damage_exponent)
+#define WEAR_ELEMENT_RATED_CYCLES (SYSTEM_CONFIG.wear.element_rated_cycles)
+#define WEAR_PLATEN_RATED_CYCLES (SYSTEM_CONFIG.wear.platen_rated_cycles)
+#define WEAR_SSR_RATED_SWITCHES (SYSTEM_CONFIG.wear.ssr_rated_switches)
+#define WEAR_SERVICE_PERCENT (SYSTEM_CONFIG.wear.service_percent)
+#define WEAR_SAVE_INTERVAL_SEC (SYSTEM_CONFIG.wear.save_interval_sec)
+
+// Heater health shortcuts
+#define HEATER_HEALTH_MIN_RISE (SYSTEM_CONFIG.heater_health.min_rise)
+#define HEATER_HEALTH_SETTLE_SEC (SYSTEM_CONFIG.heater_health.settle_sec)
+#define HEATER_HEALTH_POWER_DROP (SYSTEM_CONFIG.heater_health.power_drop_percent)
+#define HEATER_HEALTH_LOSS_RISE (SYSTEM_CONFIG.heater_health.loss_rise_percent)
+
+// Surface calibration shortcuts
+#define SURFACE_CAL_FIRST_SETPOINT (SYSTEM_CONFIG.surface_cal.first_setpoint)
+#define SURFACE_CAL_SETPOINT_STEP (SYSTEM_CONFIG.surface_cal.setpoint_step)
+#define SURFACE_CAL_SETPOINT_COUNT (SYSTEM_CONFIG.surface_cal.points)
+#define SURFACE_CAL_SETTLE_BAND (SYSTEM_CONFIG.surface_cal.settle_band)
+#define SURFACE_CAL_SETTLE_SEC (SYSTEM_CONFIG.surface_cal.settle_sec)
+#define SURFACE_CAL_MAX_CORRECTION (SYSTEM_CONFIG.surface_cal.max_correction)
+
 // Default Values
 #define DEFAULT_TEMPERATURE 25.0f
 
@@ -161,6 +379,11 @@ extern const system_config_t SYSTEM_CONFIG;
 
 #define PID_MIN_UPDATE_INTERVAL_MS 100
 
+// Factory PID gains (tuned for the platen's high thermal mass)
+#define PID_DEFAULT_KP 3.5f
+#define PID_DEFAULT_KI 0.05f
+#define PID_DEFAULT_KD 1.2f
+
 // =============================================================================
 // Helper Macros
 // =============================================================================
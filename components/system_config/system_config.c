@@ -36,6 +36,7 @@ const system_config_t SYSTEM_CONFIG = {
         .temp_task_timeout_sec = 3,           // Temp control task must update within 3 seconds
         .sensor_timeout_sec = 30,             // Maximum time without sensor reading
         .sensor_validation_timeout_sec = 10,  // Sensor timeout for cycle validation
+        .settings_save_delay_sec = 5,         // Coalesce settings edits into one NVS write
     },
     .temperature = {
         .hysteresis_celsius = 5.0f,           // ±5°C hysteresis for PID control
@@ -50,12 +51,99 @@ const system_config_t SYSTEM_CONFIG = {
     .sensor = {
         .retry_count = 3,                     // 3 retry attempts for sensor reads
         .retry_delay_ms = 500,                // 500ms delay between retries
+        .nist_linearization = true,           // Chip's linear conversion is off by ~3°C at 200-250°C
     },
     .heat_up = {
         .min_temp_change_celsius = 0.5f,      // 0.5°C minimum change for ETA calculation
         .min_elapsed_time_sec = 10,           // 10 second minimum for ETA calculation
         .min_heating_rate = 0.01f,            // 0.01°C/s minimum heating rate
     },
+    .pause = {
+        .keep_warm_drop_celsius = 30.0f,      // Hold 30°C below target while paused
+        .resume_ramp_rate = 1.0f,             // 1°C/s setpoint ramp after unpause
+        .default_heating_rate = 0.5f,         // 0.5°C/s until a rate has been measured
+    },
+    .cascade = {
+        .core_gain_celsius = 60.0f,           // Element runs ~60°C above the platen face at full power
+        .core_time_constant_sec = 15.0f,      // Element-to-face lag
+        .max_core_excess_celsius = 40.0f,     // Limit stored heat to avoid open-press overshoot
+    },
+    .smith = {
+        .model_gain = 2.0f,                   // ~200°C rise at full power if left to settle
+        .time_constant_sec = 400.0f,          // Platen mass lag
+        .dead_time_sec = 20.0f,               // Element to thermocouple delay
+        .mismatch_limit_celsius = 5.0f,       // Model off by more than 5°C -> plain PID
+        .mismatch_hold_sec = 30.0f,           // Ignore short disturbances (press close)
+        .ident_max_start_celsius = 60.0f,     // Only learn from a cold start
+    },
+    .observer = {
+        .heater_watts = 2200.0f,              // 2200W/230V element
+        .capacity_j_per_celsius = 4400.0f,    // ~0.5°C/s at full power from cold
+        .loss_w_per_celsius = 8.0f,           // ~1100W held at 160°C
+        .observer_gain = 0.05f,               // Smooths thermocouple quantization
+        .compensation_fraction = 0.8f,        // Leave the rest to the PID integral
+    },
+    .power_map = {
+        .settle_band_celsius = 1.0f,          // Tighter than the ready band
+        .settle_time_sec = 120,               // Several heater-to-sensor delays
+        .learn_weight = 0.3f,                 // A few settled periods to converge
+    },
+    .preboost = {
+        .boost_celsius = 3.0f,                // Inside the ±5°C ready band
+        .lead_sec = 20,                       // About the element-to-surface delay
+        .min_samples = 4,                     // A few presses into the job
+        .max_spread_sec = 15,                 // Steady production pace
+        .max_interval_sec = 120,              // Longer is a break
+    },
+    .ready_gate = {
+        .enabled = true,
+        .max_deficit_celsius = 5.0f,          // Never earlier than 10°C below target
+        .slope_window_sec = 5.0f,             // Averages out thermocouple steps
+    },
+    .shuttle = {
+        .enabled = false,                     // Single lower platen
+    },
+    .pacing = {
+        .handling_sec = 20,                   // Unload, lay out and close one shirt
+        .window_min = 15,                     // Long enough to smooth out single shirts
+    },
+    .job_link = {
+        .enabled = true,
+        .uart_port = 1,                       // UART0 is the ESP-IDF console
+        .tx_pin = 41,                         // Free on the S3 module, off the strapping pins
+        .rx_pin = 42,
+        .baud_rate = 115200,
+    },
+    .preheat = {
+        .margin_sec = 300,                    // Approach, soak and a little slack
+        .abandon_sec = 3600,                  // Shift did not start
+        .min_learn_rise = 40.0f,              // Real warm-ups, not top-ups
+        .learn_weight = 0.3f,                 // Follows seasons, ignores one odd morning
+    },
+    .wear = {
+        .cycle_hysteresis = 2.0f,             // Above thermocouple noise
+        .reference_range = 100.0f,            // Cold start to pressing temperature, roughly
+        .damage_exponent = 2.0f,              // Coffin-Manson for ductile metals
+        .element_rated_cycles = 20000,        // Sheathed element, conservative
+        .platen_rated_cycles = 200000,        // Cast aluminium platen
+        .ssr_rated_switches = 1000000,        // Zero-cross SSR, derated
+        .service_percent = 90,                // Time to order parts
+        .save_interval_sec = 900,             // 15 minutes
+    },
+    .heater_health = {
+        .min_rise = 60.0f,                    // Enough of a ramp to separate power from losses
+        .settle_sec = 120,                    // A couple of minutes of holding
+        .power_drop_percent = 15.0f,          // Warm-ups noticeably slower
+        .loss_rise_percent = 30.0f,           // Insulation or platen contact degrading
+    },
+    .surface_cal = {
+        .first_setpoint = 120.0f,             // Below the lowest transfer temperature
+        .setpoint_step = 30.0f,               // 120, 150, 180, 210°C
+        .points = 4,
+        .settle_band = 1.0f,                  // ±1°C around the setpoint
+        .settle_sec = 300,                    // The surface lags the thermocouple by minutes
+        .max_correction = 25.0f,              // More than this is a typo or a loose probe
+    },
     .simulation = {
         .enabled = false,                     // Set to true to enable simulation mode
     },
@@ -126,6 +214,12 @@ bool system_config_validate(void)
         return false;
     }
 
+    if (SYSTEM_CONFIG.timing.settings_save_delay_sec > 60)
+    {
+        validation_error = "Invalid settings_save_delay_sec (must be 0-60)";
+        return false;
+    }
+
     // Validate temperature thresholds
     if (SYSTEM_CONFIG.temperature.hysteresis_celsius <= 0.0f ||
         SYSTEM_CONFIG.temperature.hysteresis_celsius > 50.0f)
@@ -221,6 +315,195 @@ bool system_config_validate(void)
         return false;
     }
 
+    // Validate pause keep-warm configuration
+    if (SYSTEM_CONFIG.pause.keep_warm_drop_celsius < 0.0f ||
+        SYSTEM_CONFIG.pause.keep_warm_drop_celsius > 150.0f)
+    {
+        validation_error = "Invalid pause keep_warm_drop_celsius (must be 0-150)";
+        return false;
+    }
+
+    if (SYSTEM_CONFIG.pause.resume_ramp_rate <= 0.0f ||
+        SYSTEM_CONFIG.pause.resume_ramp_rate > 10.0f)
+    {
+        validation_error = "Invalid pause resume_ramp_rate (must be 0-10)";
+        return false;
+    }
+
+    if (SYSTEM_CONFIG.pause.default_heating_rate <= 0.0f ||
+        SYSTEM_CONFIG.pause.default_heating_rate > 10.0f)
+    {
+        validation_error = "Invalid pause default_heating_rate (must be 0-10)";
+        return false;
+    }
+
+    // Validate cascade heater-core model
+    if (SYSTEM_CONFIG.cascade.core_gain_celsius <= 0.0f ||
+        SYSTEM_CONFIG.cascade.core_gain_celsius > 200.0f)
+    {
+        validation_error = "Invalid cascade core_gain_celsius (must be 0-200)";
+        return false;
+    }
+
+    if (SYSTEM_CONFIG.cascade.core_time_constant_sec < 1.0f ||
+        SYSTEM_CONFIG.cascade.core_time_constant_sec > 600.0f)
+    {
+        validation_error = "Invalid cascade core_time_constant_sec (must be 1-600)";
+        return false;
+    }
+
+    if (SYSTEM_CONFIG.cascade.max_core_excess_celsius <= 0.0f ||
+        SYSTEM_CONFIG.cascade.max_core_excess_celsius > 100.0f)
+    {
+        validation_error = "Invalid cascade max_core_excess_celsius (must be 0-100)";
+        return false;
+    }
+
+    // Validate Smith predictor model
+    if (SYSTEM_CONFIG.smith.model_gain <= 0.0f ||
+        SYSTEM_CONFIG.smith.model_gain > 10.0f)
+    {
+        validation_error = "Invalid smith model_gain (must be 0-10)";
+        return false;
+    }
+
+    if (SYSTEM_CONFIG.smith.time_constant_sec < 1.0f ||
+        SYSTEM_CONFIG.smith.time_constant_sec > 3600.0f)
+    {
+        validation_error = "Invalid smith time_constant_sec (must be 1-3600)";
+        return false;
+    }
+
+    if (SYSTEM_CONFIG.smith.dead_time_sec < 0.0f ||
+        SYSTEM_CONFIG.smith.dead_time_sec > 120.0f)
+    {
+        validation_error = "Invalid smith dead_time_sec (must be 0-120)";
+        return false;
+    }
+
+    if (SYSTEM_CONFIG.smith.mismatch_limit_celsius <= 0.0f ||
+        SYSTEM_CONFIG.smith.mismatch_hold_sec < 0.0f)
+    {
+        validation_error = "Invalid smith mismatch limits";
+        return false;
+    }
+
+    // Validate disturbance observer
+    if (SYSTEM_CONFIG.observer.heater_watts <= 0.0f ||
+        SYSTEM_CONFIG.observer.capacity_j_per_celsius <= 0.0f ||
+        SYSTEM_CONFIG.observer.loss_w_per_celsius < 0.0f)
+    {
+        validation_error = "Invalid observer heat balance parameters";
+        return false;
+    }
+
+    if (SYSTEM_CONFIG.observer.observer_gain <= 0.0f ||
+        SYSTEM_CONFIG.observer.observer_gain > 1.0f ||
+        SYSTEM_CONFIG.observer.compensation_fraction < 0.0f ||
+        SYSTEM_CONFIG.observer.compensation_fraction > 1.0f)
+    {
+        validation_error = "Invalid observer gains (must be 0-1)";
+        return false;
+    }
+
+    // Validate holding power map
+    if (SYSTEM_CONFIG.power_map.settle_band_celsius <= 0.0f ||
+        SYSTEM_CONFIG.power_map.settle_time_sec == 0)
+    {
+        validation_error = "Invalid power map settle criteria";
+        return false;
+    }
+
+    if (SYSTEM_CONFIG.power_map.learn_weight <= 0.0f ||
+        SYSTEM_CONFIG.power_map.learn_weight > 1.0f)
+    {
+        validation_error = "Invalid power map learn weight (must be 0-1)";
+        return false;
+    }
+
+    // Validate pre-boost (must not push the press out of its ready band)
+    if (SYSTEM_CONFIG.preboost.boost_celsius <= 0.0f ||
+        SYSTEM_CONFIG.preboost.boost_celsius >= SYSTEM_CONFIG.temperature.hysteresis_celsius)
+    {
+        validation_error = "Invalid preboost boost_celsius (must be below hysteresis)";
+        return false;
+    }
+
+    if (SYSTEM_CONFIG.preboost.min_samples < 2 ||
+        SYSTEM_CONFIG.preboost.min_samples > 16 ||  // PRESS_PREDICTOR_HISTORY
+        SYSTEM_CONFIG.preboost.max_interval_sec == 0)
+    {
+        validation_error = "Invalid preboost sample limits";
+        return false;
+    }
+
+    // Validate ready gate
+    if (SYSTEM_CONFIG.ready_gate.max_deficit_celsius < 0.0f ||
+        SYSTEM_CONFIG.ready_gate.max_deficit_celsius > 20.0f ||
+        SYSTEM_CONFIG.ready_gate.slope_window_sec < 1.0f)
+    {
+        validation_error = "Invalid ready gate limits";
+        return false;
+    }
+
+    // Validate pacing (window must fit the one-hour throughput ring)
+    if (SYSTEM_CONFIG.pacing.handling_sec < 1 || SYSTEM_CONFIG.pacing.handling_sec > 600 ||
+        SYSTEM_CONFIG.pacing.window_min < 1 || SYSTEM_CONFIG.pacing.window_min > 60)
+    {
+        validation_error = "Invalid pacing limits";
+        return false;
+    }
+
+    // Validate job link
+    if (SYSTEM_CONFIG.job_link.uart_port > 2 ||
+        SYSTEM_CONFIG.job_link.baud_rate < 9600 || SYSTEM_CONFIG.job_link.baud_rate > 921600 ||
+        (SYSTEM_CONFIG.job_link.uart_port != 0 &&
+         (SYSTEM_CONFIG.job_link.tx_pin < 0 || SYSTEM_CONFIG.job_link.rx_pin < 0)))
+    {
+        validation_error = "Invalid job link port settings";
+        return false;
+    }
+
+    // Validate pre-heat
+    if (SYSTEM_CONFIG.preheat.abandon_sec < 60 || SYSTEM_CONFIG.preheat.min_learn_rise < 10.0f ||
+        SYSTEM_CONFIG.preheat.learn_weight <= 0.0f || SYSTEM_CONFIG.preheat.learn_weight > 1.0f)
+    {
+        validation_error = "Invalid pre-heat limits";
+        return false;
+    }
+
+    // Validate wear tracking
+    if (SYSTEM_CONFIG.wear.cycle_hysteresis <= 0.0f || SYSTEM_CONFIG.wear.reference_range <= 0.0f ||
+        SYSTEM_CONFIG.wear.damage_exponent < 1.0f || SYSTEM_CONFIG.wear.element_rated_cycles == 0 ||
+        SYSTEM_CONFIG.wear.platen_rated_cycles == 0 || SYSTEM_CONFIG.wear.ssr_rated_switches == 0 ||
+        SYSTEM_CONFIG.wear.service_percent == 0 || SYSTEM_CONFIG.wear.save_interval_sec < 60)
+    {
+        validation_error = "Invalid wear limits";
+        return false;
+    }
+
+    // Validate heater health
+    if (SYSTEM_CONFIG.heater_health.min_rise < 20.0f || SYSTEM_CONFIG.heater_health.settle_sec < 30 ||
+        SYSTEM_CONFIG.heater_health.power_drop_percent <= 0.0f ||
+        SYSTEM_CONFIG.heater_health.loss_rise_percent <= 0.0f)
+    {
+        validation_error = "Invalid heater health limits";
+        return false;
+    }
+
+    // Validate surface calibration; the last setpoint must stay below the safety limit
+    if (SYSTEM_CONFIG.surface_cal.first_setpoint < 50.0f || SYSTEM_CONFIG.surface_cal.setpoint_step < 10.0f ||
+        SYSTEM_CONFIG.surface_cal.points == 0 ||
+        SYSTEM_CONFIG.surface_cal.first_setpoint +
+            SYSTEM_CONFIG.surface_cal.setpoint_step * (SYSTEM_CONFIG.surface_cal.points - 1) >=
+            SYSTEM_CONFIG.safety.max_temperature_celsius ||
+        SYSTEM_CONFIG.surface_cal.settle_band <= 0.0f || SYSTEM_CONFIG.surface_cal.settle_sec < 60 ||
+        SYSTEM_CONFIG.surface_cal.max_correction <= 0.0f)
+    {
+        validation_error = "Invalid surface calibration setpoints";
+        return false;
+    }
+
     return true;
 }
 
@@ -262,6 +545,8 @@ void system_config_print(void)
              SYSTEM_CONFIG.timing.sensor_timeout_sec);
     ESP_LOGI(TAG, "  sensor_validation_timeout_sec: %lu",
              SYSTEM_CONFIG.timing.sensor_validation_timeout_sec);
+    ESP_LOGI(TAG, "  settings_save_delay_sec: %lu",
+             SYSTEM_CONFIG.timing.settings_save_delay_sec);
 
     ESP_LOGI(TAG, "Temperature Thresholds:");
     ESP_LOGI(TAG, "  hysteresis_celsius: %.1f",
@@ -286,6 +571,8 @@ void system_config_print(void)
              SYSTEM_CONFIG.sensor.retry_count);
     ESP_LOGI(TAG, "  retry_delay_ms: %lu",
              SYSTEM_CONFIG.sensor.retry_delay_ms);
+    ESP_LOGI(TAG, "  nist_linearization: %s",
+             SYSTEM_CONFIG.sensor.nist_linearization ? "ENABLED" : "DISABLED");
 
     ESP_LOGI(TAG, "Heat-up Display:");
     ESP_LOGI(TAG, "  min_temp_change_celsius: %.2f",
@@ -295,6 +582,86 @@ void system_config_print(void)
     ESP_LOGI(TAG, "  min_heating_rate: %.3f",
              SYSTEM_CONFIG.heat_up.min_heating_rate);
 
+    ESP_LOGI(TAG, "Pause Keep-warm:");
+    ESP_LOGI(TAG, "  keep_warm_drop_celsius: %.1f",
+             SYSTEM_CONFIG.pause.keep_warm_drop_celsius);
+    ESP_LOGI(TAG, "  resume_ramp_rate: %.2f",
+             SYSTEM_CONFIG.pause.resume_ramp_rate);
+    ESP_LOGI(TAG, "  default_heating_rate: %.2f",
+             SYSTEM_CONFIG.pause.default_heating_rate);
+
+    ESP_LOGI(TAG, "Cascade Control:");
+    ESP_LOGI(TAG, "  core_gain_celsius: %.1f",
+             SYSTEM_CONFIG.cascade.core_gain_celsius);
+    ESP_LOGI(TAG, "  core_time_constant_sec: %.1f",
+             SYSTEM_CONFIG.cascade.core_time_constant_sec);
+    ESP_LOGI(TAG, "  max_core_excess_celsius: %.1f",
+             SYSTEM_CONFIG.cascade.max_core_excess_celsius);
+
+    ESP_LOGI(TAG, "Smith Predictor:");
+    ESP_LOGI(TAG, "  model_gain: %.2f", SYSTEM_CONFIG.smith.model_gain);
+    ESP_LOGI(TAG, "  time_constant_sec: %.0f", SYSTEM_CONFIG.smith.time_constant_sec);
+    ESP_LOGI(TAG, "  dead_time_sec: %.0f", SYSTEM_CONFIG.smith.dead_time_sec);
+    ESP_LOGI(TAG, "  mismatch_limit_celsius: %.1f (hold %.0fs)",
+             SYSTEM_CONFIG.smith.mismatch_limit_celsius, SYSTEM_CONFIG.smith.mismatch_hold_sec);
+    ESP_LOGI(TAG, "  ident_max_start_celsius: %.0f", SYSTEM_CONFIG.smith.ident_max_start_celsius);
+
+    ESP_LOGI(TAG, "Disturbance Observer:");
+    ESP_LOGI(TAG, "  heater_watts: %.0f", SYSTEM_CONFIG.observer.heater_watts);
+    ESP_LOGI(TAG, "  capacity_j_per_celsius: %.0f", SYSTEM_CONFIG.observer.capacity_j_per_celsius);
+    ESP_LOGI(TAG, "  loss_w_per_celsius: %.1f", SYSTEM_CONFIG.observer.loss_w_per_celsius);
+    ESP_LOGI(TAG, "  observer_gain: %.2f", SYSTEM_CONFIG.observer.observer_gain);
+    ESP_LOGI(TAG, "  compensation_fraction: %.2f", SYSTEM_CONFIG.observer.compensation_fraction);
+
+    ESP_LOGI(TAG, "Holding Power Map:");
+    ESP_LOGI(TAG, "  settle_band_celsius: %.1f", SYSTEM_CONFIG.power_map.settle_band_celsius);
+    ESP_LOGI(TAG, "  settle_time_sec: %u", SYSTEM_CONFIG.power_map.settle_time_sec);
+    ESP_LOGI(TAG, "  learn_weight: %.2f", SYSTEM_CONFIG.power_map.learn_weight);
+
+    ESP_LOGI(TAG, "Press Pre-boost:");
+    ESP_LOGI(TAG, "  boost_celsius: %.1f (lead %us)",
+             SYSTEM_CONFIG.preboost.boost_celsius, SYSTEM_CONFIG.preboost.lead_sec);
+    ESP_LOGI(TAG, "  min_samples: %u", SYSTEM_CONFIG.preboost.min_samples);
+    ESP_LOGI(TAG, "  max_spread_sec: %u", SYSTEM_CONFIG.preboost.max_spread_sec);
+    ESP_LOGI(TAG, "  max_interval_sec: %u", SYSTEM_CONFIG.preboost.max_interval_sec);
+
+    ESP_LOGI(TAG, "Predictive Ready Gate: %s", SYSTEM_CONFIG.ready_gate.enabled ? "ENABLED" : "DISABLED");
+    ESP_LOGI(TAG, "  max_deficit_celsius: %.1f", SYSTEM_CONFIG.ready_gate.max_deficit_celsius);
+    ESP_LOGI(TAG, "  slope_window_sec: %.0f", SYSTEM_CONFIG.ready_gate.slope_window_sec);
+
+    ESP_LOGI(TAG, "Shuttle Press: %s", SYSTEM_CONFIG.shuttle.enabled ? "ENABLED" : "DISABLED");
+
+    ESP_LOGI(TAG, "Pacing: handling %us per press, %u min window",
+             SYSTEM_CONFIG.pacing.handling_sec, SYSTEM_CONFIG.pacing.window_min);
+
+    ESP_LOGI(TAG, "Job Link: %s (UART%u TX %d RX %d, %lu baud)", SYSTEM_CONFIG.job_link.enabled ? "ENABLED" : "DISABLED",
+             SYSTEM_CONFIG.job_link.uart_port, SYSTEM_CONFIG.job_link.tx_pin,
+             SYSTEM_CONFIG.job_link.rx_pin, SYSTEM_CONFIG.job_link.baud_rate);
+
+    ESP_LOGI(TAG, "Scheduled Pre-heat: margin %us, abandon after %us",
+             SYSTEM_CONFIG.preheat.margin_sec, SYSTEM_CONFIG.preheat.abandon_sec);
+    ESP_LOGI(TAG, "  min_learn_rise: %.0f, learn_weight: %.2f",
+             SYSTEM_CONFIG.preheat.min_learn_rise, SYSTEM_CONFIG.preheat.learn_weight);
+
+    ESP_LOGI(TAG, "Wear: hysteresis %.1f°C, reference %.0f°C, exponent %.1f",
+             SYSTEM_CONFIG.wear.cycle_hysteresis, SYSTEM_CONFIG.wear.reference_range,
+             SYSTEM_CONFIG.wear.damage_exponent);
+    ESP_LOGI(TAG, "  rated: element %lu, platen %lu cycles, SSR %lu switches; service at %u%%",
+             SYSTEM_CONFIG.wear.element_rated_cycles, SYSTEM_CONFIG.wear.platen_rated_cycles,
+             SYSTEM_CONFIG.wear.ssr_rated_switches, SYSTEM_CONFIG.wear.service_percent);
+
+    ESP_LOGI(TAG, "Heater Health: fit heat-ups over %.0f°C, settle %us",
+             SYSTEM_CONFIG.heater_health.min_rise, SYSTEM_CONFIG.heater_health.settle_sec);
+    ESP_LOGI(TAG, "  alert at power -%.0f%% or losses +%.0f%%",
+             SYSTEM_CONFIG.heater_health.power_drop_percent, SYSTEM_CONFIG.heater_health.loss_rise_percent);
+
+    ESP_LOGI(TAG, "Surface Calibration: %u setpoints from %.0f°C every %.0f°C",
+             SYSTEM_CONFIG.surface_cal.points, SYSTEM_CONFIG.surface_cal.first_setpoint,
+             SYSTEM_CONFIG.surface_cal.setpoint_step);
+    ESP_LOGI(TAG, "  settle ±%.1f°C for %us, reject corrections over %.0f°C",
+             SYSTEM_CONFIG.surface_cal.settle_band, SYSTEM_CONFIG.surface_cal.settle_sec,
+             SYSTEM_CONFIG.surface_cal.max_correction);
+
     ESP_LOGI(TAG, "Simulation Mode: %s",
              SYSTEM_CONFIG.simulation.enabled ? "ENABLED" : "DISABLED");
 
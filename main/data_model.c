@@ -11,6 +11,10 @@ bool validate_print_run(const print_run_t *run)
         return false;
     if (run->type != SINGLE_SIDED && run->type != DOUBLE_SIDED)
         return false;
+    if (run->next_side != FRONT && run->next_side != BACK)
+        return false;
+    if (run->type == SINGLE_SIDED && run->next_side == BACK)
+        return false;
     return true;
 }
 
@@ -18,7 +22,9 @@ bool validate_pressing_cycle(const pressing_cycle_t *cycle)
 {
     if (!cycle)
         return false;
-    if (cycle->stage1_duration == 0 || cycle->stage2_duration == 0)
+    if (cycle->stage_count == 0 || cycle->stage_count > CYCLE_MAX_STAGES)
+        return false;
+    if (cycle->stage >= cycle->stage_count || cycle->program >= CYCLE_PROGRAM_COUNT)
         return false;
     if (cycle->side != FRONT && cycle->side != BACK)
         return false;
@@ -37,5 +43,23 @@ bool validate_settings(const settings_t *settings)
         return false;
     if (settings->stage1_default == 0 || settings->stage2_default == 0)
         return false;
+    if (settings->back_stage1_default == 0 || settings->back_stage2_default == 0)
+        return false;
+    if (settings->station_b_stage1_default == 0 || settings->station_b_stage2_default == 0)
+        return false;
+    if (settings->back_temp_offset < -30.0f || settings->back_temp_offset > 30.0f)
+        return false;
+    if (settings->keep_warm_drop < 0.0f || settings->keep_warm_drop > 150.0f)
+        return false;
+    if (settings->ramp_rate < 0.0f || settings->ramp_rate > 10.0f)
+        return false;
+    if (settings->soak_time > 600)
+        return false;
+    if (settings->cycle_program >= CYCLE_PROGRAM_COUNT)
+        return false;
+    if (settings->outer_kp < 0.0f || settings->outer_ki < 0.0f || settings->outer_kd < 0.0f)
+        return false;
+    if (settings->inner_kp < 0.0f || settings->inner_ki < 0.0f || settings->inner_kd < 0.0f)
+        return false;
     return true;
 }
@@ -26,6 +26,7 @@ extern settings_t settings;
 extern print_run_t print_run;
 extern pressing_cycle_t current_cycle;
 extern float current_temperature;
+extern float current_sensor_temperature;
 extern float last_valid_temperature;
 
 // Pressing cycle state management
@@ -113,12 +114,310 @@ bool has_reached_target_temp_once(void);
  * Heat press is ready when:
  * 1. Target temperature has been reached at least once since boot, AND
  * 2. Heating switch is connected (heating is active), AND
- * 3. Current temperature is within ±5°C of target temperature
+ * 3. Current temperature is within ±5°C of target temperature, or the
+ *    ready gate predicts it will stay within that band for the whole
+ *    stage 1 of the next cycle
  *
  * @return true if heat press is ready for pressing operations
  */
 bool is_heat_press_ready(void);
 
+/**
+ * @brief Check if the press is ready only on the ready gate's prediction
+ *
+ * @return true if ready while the reading is still outside ±5°C of target
+ */
+bool is_ready_by_prediction(void);
+
+/**
+ * @brief Get the shirt side for the current or next job cycle
+ *
+ * Double-sided jobs alternate FRONT and BACK; free press mode and
+ * single-sided jobs always return FRONT.
+ *
+ * @return Side being pressed, or the side the next cycle will press
+ */
+shirt_side_t get_active_side(void);
+
+/**
+ * @brief Get the target temperature for the active shirt side
+ *
+ * @return settings.target_temp, plus settings.back_temp_offset on the back side
+ */
+float get_active_target_temp(void);
+
+/**
+ * @brief Check if pause keep-warm is holding temperature
+ *
+ * @return true while paused with settings.keep_warm_drop > 0
+ */
+bool is_keep_warm_active(void);
+
+/**
+ * @brief Get the setpoint the controller is currently tracking
+ *
+ * Differs from get_active_target_temp() while paused (keep-warm) and
+ * while ramping back to target after unpause.
+ *
+ * @return Control setpoint in °C
+ */
+float get_control_setpoint(void);
+
+/**
+ * @brief Predict how long until the press is ready again
+ *
+ * Based on the measured heating rate, limited by the resume ramp rate.
+ *
+ * @return Estimated seconds to reach the ready band (0 = ready now)
+ */
+uint32_t get_resume_ready_eta(void);
+
+/**
+ * @brief Check if a ramp/soak setpoint profile is running
+ *
+ * The press is not reported ready until the profile has finished.
+ *
+ * @return true while a heat-up or resume profile is active
+ */
+bool is_setpoint_profile_active(void);
+
+/**
+ * @brief Get the thermal load estimated by the disturbance observer
+ *
+ * Equivalent heater power being drawn by unmeasured loads (garment,
+ * lower pad, draughts), beyond the normal loss to ambient.
+ *
+ * @return Load in watts (positive = heat drawn from the platen)
+ */
+float get_estimated_load_watts(void);
+
+/**
+ * @brief Get the peak load observed during the last completed press
+ *
+ * @return Load in watts, 0 before the first press
+ */
+float get_last_press_load_watts(void);
+
+/**
+ * @brief Shuttle press station state, for display
+ */
+typedef struct
+{
+    bool cycle_active;       ///< Cycle in progress on the station
+    const char *next_stage;  ///< Stage it is running or waiting for (NULL when idle)
+    uint16_t presses;        ///< Cycles completed on the station this run
+} station_summary_t;
+
+/**
+ * @brief Get the shuttle press station under the heated platen
+ *
+ * @return 0 for station A, 1 for station B (always 0 on a single press)
+ */
+uint8_t get_platen_station(void);
+
+/**
+ * @brief Summarize a shuttle press station
+ *
+ * @param station 0 for A, 1 for B
+ * @param[out] summary Station state
+ * @return false if the station does not exist
+ */
+bool get_station_summary(uint8_t station, station_summary_t *summary);
+
+/**
+ * @brief Check for a running scheduled pre-heat
+ *
+ * @param[out] ready_minute Local ready time, minutes after midnight (may be NULL)
+ * @return true while the Heat Up screen was started by the schedule
+ */
+bool get_scheduled_preheat(uint16_t *ready_minute);
+
+/**
+ * @brief Set the wall clock and local time offset
+ *
+ * The offset is persisted with the pre-heat schedule. Call from the UI task.
+ *
+ * @param utc Seconds since the epoch
+ * @param utc_offset_min Local time minus UTC (minutes)
+ */
+void set_wall_clock(int64_t utc, int16_t utc_offset_min);
+
+/**
+ * @brief Get the local time offset used by the pre-heat schedule
+ *
+ * @return Local time minus UTC (minutes)
+ */
+int16_t get_utc_offset(void);
+
+/**
+ * @brief Set and persist a weekday's scheduled ready time
+ *
+ * Call from the UI task.
+ *
+ * @param weekday 0 = Sunday
+ * @param ready_minute Minutes after local midnight, or PREHEAT_DAY_OFF
+ */
+void set_preheat_ready_time(uint8_t weekday, uint16_t ready_minute);
+
+/**
+ * @brief Get a weekday's scheduled ready time
+ *
+ * @param weekday 0 = Sunday
+ * @return Minutes after local midnight, or PREHEAT_DAY_OFF
+ */
+uint16_t get_preheat_ready_time(uint8_t weekday);
+
+/**
+ * @brief Get the job ticket loaded into the print run
+ *
+ * Tickets come from the shop system over the serial link. Call from the
+ * UI task.
+ *
+ * @param[out] queued Tickets waiting behind the active one (may be NULL)
+ * @return Ticket id, or NULL when the print run was set up by hand
+ */
+const char *get_active_job_ticket(uint8_t *queued);
+
+/**
+ * @brief Copy the heater wear counters
+ *
+ * SSR switching and on time, and the thermal cycle histograms of the
+ * element and platen. Thread-safe.
+ *
+ * @param[out] wear Counters
+ * @return false if wear is NULL
+ */
+bool get_wear_stats(wear_stats_t *wear);
+
+/**
+ * @brief Fraction of a part's rated life used
+ *
+ * SSR: switches against its rated switches. Element and platen: thermal
+ * cycle damage against their rated cycles at the reference range.
+ * Thread-safe.
+ *
+ * @return Life used (%), may exceed 100
+ */
+float get_wear_life_used(wear_part_t part);
+
+/**
+ * @brief Heater power and losses from warm-up fits against their baseline
+ *
+ * Thread-safe.
+ *
+ * @param[out] trend Latest figures and change; trend->valid is false
+ *             until the baseline is established
+ * @return false if trend is NULL
+ */
+bool get_heater_trend(heater_trend_t *trend);
+
+/**
+ * @brief Clear a part's wear counters after it has been replaced
+ *
+ * Clearing the element also starts a new heater health series.
+ */
+void reset_wear(wear_part_t part);
+
+/**
+ * @brief Dump the wear counters and cycle histograms to the console
+ */
+void log_wear_report(void);
+
+/**
+ * @brief Start the surface calibration procedure
+ *
+ * The controller holds each configured setpoint in turn; once the reading
+ * has settled the technician enters the reference probe reading with
+ * record_surface_cal_point(). The correction table is suspended while the
+ * procedure runs. Call from the UI task.
+ *
+ * @return false while pressing, auto-tuning or in emergency shutdown
+ */
+bool start_surface_calibration(void);
+
+/**
+ * @brief Abandon the procedure and keep the table in force
+ */
+void cancel_surface_calibration(void);
+
+/**
+ * @brief Copy the procedure progress
+ *
+ * Thread-safe.
+ *
+ * @param[out] status Progress; status->active is false when no procedure runs
+ * @return false if status is NULL
+ */
+bool get_surface_cal_status(surface_cal_status_t *status);
+
+/**
+ * @brief Record the probe reading at the current setpoint and move on
+ *
+ * @param probe_celsius Reference probe reading on the platen surface (°C)
+ * @return false if not settled yet or the probe differs from the reading
+ *         by more than SURFACE_CAL_MAX_CORRECTION
+ */
+bool record_surface_cal_point(float probe_celsius);
+
+/**
+ * @brief Replace the correction table with the points recorded and save it
+ *
+ * Ends the procedure.
+ *
+ * @return false if no point was recorded
+ */
+bool finish_surface_calibration(void);
+
+/**
+ * @brief Copy the correction table in force
+ *
+ * Thread-safe.
+ *
+ * @param[out] calibration Table, count 0 when readings are not corrected
+ * @return false if calibration is NULL
+ */
+bool get_surface_calibration(surface_calibration_t *calibration);
+
+/**
+ * @brief Remove the correction table (readings are used as measured)
+ */
+void clear_surface_calibration(void);
+
+/**
+ * @brief Copy the session and shift time accounting tallies
+ *
+ * Thread-safe snapshot for the shift report screen.
+ *
+ * @param session Destination for the session tally (may be NULL)
+ * @param shift Destination for the shift tally (may be NULL)
+ */
+void get_session_report(session_tally_t *session, session_tally_t *shift);
+
+/**
+ * @brief Pace over the last minutes against the active job
+ *
+ * Compares the shirts finished in the window with the job's planned takt
+ * time (stage time plus a handling allowance per press) and names the
+ * press or the operator as the limit when behind. Thread-safe.
+ *
+ * @param minutes Window length (minutes, shortened to the data available)
+ * @param[out] status Window figures and limit
+ * @return false if status is NULL
+ */
+bool get_pace_status(uint8_t minutes, pace_status_t *status);
+
+/**
+ * @brief Dump the shift and session reports to the console
+ */
+void log_session_report(void);
+
+/**
+ * @brief End the current shift and start a new one
+ *
+ * The finished shift report is dumped to the console first.
+ */
+void start_new_shift(void);
+
 /**
  * @brief Cleanup and shutdown all system components
  *
@@ -18,9 +18,9 @@ typedef enum
     UI_STATE_FREE_PRESS,         // NEW: Free press mode
     UI_STATE_PROFILES_MENU,      // NEW: Material profiles menu
     UI_STATE_PRESSING_ACTIVE,
-    UI_STATE_STAGE1_DONE,        // NEW: Stage 1 done message
-    UI_STATE_STAGE2_READY,       // NEW: Ready for Stage 2
-    UI_STATE_STAGE2_DONE,        // NEW: Stage 2 done message
+    UI_STATE_STAGE_DONE,         // Stage done, waiting for the press to open
+    UI_STATE_STAGE_READY,        // Press open, ready for the next stage
+    UI_STATE_LAST_STAGE_DONE,    // Last stage done, open to complete
     UI_STATE_CYCLE_COMPLETE,     // NEW: Show statistics after cycle
     UI_STATE_SETTINGS_MENU,
     UI_STATE_TIMERS_MENU,        // Timers submenu
@@ -34,10 +34,16 @@ typedef enum
     UI_STATE_STATS_TEMPERATURE,  // Temperature statistics view
     UI_STATE_STATS_EVENTS,       // Events statistics view
     UI_STATE_STATS_KPIS,         // KPIs statistics view
+    UI_STATE_STATS_SHIFT,        // Shift/session time report
+    UI_STATE_STATS_PACE,         // Rolling throughput and pacing
+    UI_STATE_STATS_WEAR,         // Heater and SSR wear
     UI_STATE_AUTOTUNE,           // NEW: Auto-tune PID state
     UI_STATE_AUTOTUNE_COMPLETE,  // NEW: Auto-tune results display
+    UI_STATE_SURFACE_CAL,        // Surface calibration procedure
+    UI_STATE_SURFACE_CAL_DONE,   // Surface calibration results, save or discard
     UI_STATE_RESET_STATS,        // NEW: Reset statistics state
     UI_STATE_HEAT_UP,            // NEW: Heat up mode
+    UI_STATE_PAUSED,             // Pause/keep-warm screen
     UI_STATE_ERROR
 } ui_state_t;
 
@@ -68,6 +74,11 @@ typedef enum
 {
     TIMER_STAGE1,
     TIMER_STAGE2,
+    TIMER_BACK_STAGE1,   // Back side of double-sided shirts
+    TIMER_BACK_STAGE2,   // Back side of double-sided shirts
+    TIMER_STATION_B_STAGE1, // Shuttle press station B
+    TIMER_STATION_B_STAGE2, // Shuttle press station B
+    TIMER_PROGRAM,       // Cycle program built from the timers above
     TIMER_COUNT
 } timer_item_t;
 
@@ -75,6 +86,9 @@ typedef enum
 typedef enum
 {
     TEMP_TARGET_TEMP,
+    TEMP_BACK_OFFSET,    // Back side offset for double-sided shirts
+    TEMP_KEEP_WARM,      // Drop below target held while paused
+    TEMP_SURFACE_CAL,    // Multi-point surface calibration
     TEMP_PID_CONTROL,
     TEMP_COUNT
 } temp_item_t;
@@ -86,6 +100,12 @@ typedef enum
     PID_KP,
     PID_KI,
     PID_KD,
+    PID_ADAPTIVE,        // Continuous self-tuning on/off
+    PID_CASCADE,         // Cascade (heater core + surface) control on/off
+    PID_SMITH,           // Smith predictor dead-time compensation on/off
+    PID_LOAD_COMP,       // Disturbance observer feedforward on/off
+    PID_POWER_FF,        // Learned holding power feedforward on/off
+    PID_PREBOOST,        // Pre-boost before the predicted press close on/off
     PID_COUNT
 } pid_item_t;
 
@@ -96,6 +116,9 @@ typedef enum
     STATS_TEMPERATURE,
     STATS_EVENTS,
     STATS_KPIS,
+    STATS_SHIFT,
+    STATS_PACE,
+    STATS_WEAR,
     STATS_COUNT
 } stats_item_t;
 
@@ -117,6 +140,7 @@ typedef enum
 typedef bool (*ui_autotune_start_fn)(float target_temp);
 typedef bool (*ui_autotune_is_running_fn)(void);
 typedef uint8_t (*ui_autotune_get_progress_fn)(void);
+typedef bool (*ui_autotune_get_ranking_fn)(uint8_t rank, const char **rule_name, float *score);
 typedef const statistics_t* (*ui_get_statistics_fn)(void);
 typedef uint32_t (*ui_get_warmup_time_fn)(void);
 
@@ -125,6 +149,7 @@ typedef struct {
     ui_autotune_start_fn start_autotune;
     ui_autotune_is_running_fn is_autotuning;
     ui_autotune_get_progress_fn get_autotune_progress;
+    ui_autotune_get_ranking_fn get_autotune_ranking;
     ui_get_statistics_fn get_statistics;
     ui_get_warmup_time_fn get_warmup_time;
 } ui_callbacks_t;
@@ -144,6 +169,7 @@ void ui_set_state(ui_state_t state);
 void ui_select_menu_item(menu_item_t item);
 menu_item_t ui_get_selected_item(void);
 void ui_adjust_value(int8_t delta);
+bool ui_is_timer_item_shown(timer_item_t item);
 
 // Free press mode
 bool ui_is_free_press_mode(void);
@@ -152,6 +178,17 @@ void ui_update_free_press_timing(uint32_t elapsed_time);
 uint32_t ui_get_free_press_run_start_time(void);
 void ui_set_free_press_run_start_time(uint32_t start_time);
 
+// Heat-up started by the firmware (scheduled pre-heat)
+void ui_enter_heat_up(void);
+
+// Material profiles (index into the Profiles menu)
+int ui_find_material_profile(const char *name);
+bool ui_apply_material_profile(uint8_t profile);
+
+// Pause handling (pause button is polled by the UI, acted on by main)
+bool ui_consume_pause_request(void);
+void ui_show_pause_screen(bool paused);
+
 // Display update
 void ui_update_display(void);
 
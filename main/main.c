@@ -20,6 +20,9 @@
 
 #include <stdio.h>
 #include <string.h>
+#include <math.h>
+#include <time.h>
+#include <sys/time.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/semphr.h"
@@ -39,6 +42,23 @@
 #include "ui_state.h"
 #include "main.h"
 #include "pid_autotune.h"     // NEW: Auto-tune support
+#include "setpoint_profile.h" // Ramp/soak setpoint profiles
+#include "pid_adaptive.h"     // Continuous self-tuning between presses
+#include "pid_cascade.h"      // Heater core / surface cascade control
+#include "pid_smith.h"        // Dead-time compensation
+#include "disturbance_observer.h" // Unmeasured thermal load estimate
+#include "power_map.h"        // Learned holding power feedforward
+#include "press_predictor.h"  // Press close rhythm for pre-boost
+#include "cycle_engine.h"     // Table-driven pressing cycle stages
+#include "ready_gate.h"       // Predictive readiness for the next cycle
+#include "session_accounting.h" // Session/shift time accounting
+#include "throughput.h"       // Rolling throughput and operator pacing
+#include "job_link.h"         // Job tickets from the shop system
+#include "shuttle_station.h"  // Shuttle press station switching
+#include "preheat_schedule.h" // Weekday pre-heat schedule
+#include "heater_wear.h"      // Heater wear counters and health trend
+#include "surface_cal.h"      // Multi-point surface temperature correction
+#include "settings_events.h"  // Settings change notifications
 #include "system_config.h"    // components/system_config/include/ - System configuration
 
 static const char *TAG = "main";
@@ -52,14 +72,16 @@ settings_t settings;              ///< Global settings configuration
 print_run_t print_run;            ///< Current print run data
 pressing_cycle_t current_cycle;   ///< Current pressing cycle state
 statistics_t statistics;          ///< Comprehensive statistics tracking
-float current_temperature = 0.0f; ///< Current temperature reading (°C)
+float current_temperature = 0.0f; ///< Current temperature reading (°C), surface-corrected
+float current_sensor_temperature = DEFAULT_TEMPERATURE; ///< Thermocouple reading before the surface correction (°C)
 
 // Pressing cycle state management
 bool pressing_active = false;        ///< Whether a pressing cycle is currently active
 uint32_t run_start_time = 0;         ///< Timestamp when the first cycle of the run started
 uint32_t cycle_start_time = 0;       ///< Timestamp when current cycle started
 uint32_t stage_start_time = 0;       ///< Timestamp when current stage started
-cycle_status_t current_stage = IDLE; ///< Current cycle stage
+cycle_status_t current_stage = IDLE; ///< ACTIVE while a stage is timing
+cycle_engine_t cycle_engine;         ///< Stages of the current cycle
 
 // Temperature tracking for debugging
 uint32_t system_start_time = 0;      ///< Timestamp when system started (for heat-up tracking)
@@ -91,11 +113,93 @@ bool system_healthy = true;                     ///< Overall system health statu
 static bool last_press_state = false;   ///< Previous reed switch state
 static bool heating_was_on = false;     ///< Previous heating state for hysteresis
 bool pause_mode = false;                ///< System pause mode flag (extern in main.h)
+static bool pause_keep_warm = false;    ///< Press was heating when pause was entered (keep-warm allowed)
 static uint32_t state_transition_time = 0; ///< Time when UI state transitioned (for timed messages)
 
+// Active PID setpoint (tracks per-side target temperature for double-sided runs)
+static float applied_pid_setpoint = 0.0f; ///< Setpoint last pushed to the PID controller
+
+// Setpoint profile engine (owned by the temperature control task)
+typedef enum
+{
+    SP_RUN_NONE,     ///< No profile running
+    SP_RUN_HEAT_UP,  ///< Heat-up ramp/soak from the material profile
+    SP_RUN_RESUME    ///< Ramp back to target after a keep-warm pause
+} sp_run_purpose_t;
+
+static sp_runner_t setpoint_runner;                     ///< Ramp/soak profile runner
+static sp_run_purpose_t setpoint_run_purpose = SP_RUN_NONE; ///< Why the runner is active
+static bool resume_profile_requested = false;           ///< Set on unpause, consumed by control task
+static bool heat_up_profile_restart = false;            ///< Heat-up profile edited while running
+
+// Pause keep-warm
+static float heating_rate_estimate = 0.0f; ///< Measured full-power heating rate (°C/s, 0 = unknown)
+
 // Auto-tune state (NEW)
 static autotune_context_t g_autotune_ctx;  ///< Auto-tune context
 static bool is_autotuning = false;         ///< Auto-tune in progress flag
+static bool autotune_cascade = false;      ///< Tuning the cascade loops (inner, then outer)
+static cascade_loop_t autotune_loop = CASCADE_LOOP_INNER; ///< Cascade loop under test
+static float autotune_target = 0.0f;       ///< Auto-tune target temperature (°C)
+
+// Cascade control (owned by the temperature control task)
+static pid_cascade_t g_cascade;            ///< Inner core loop + outer surface loop
+static bool cascade_active = false;        ///< g_cascade is controlling the heater
+
+// Smith predictor (owned by the temperature control task)
+static pid_smith_t g_smith;                ///< FOPDT model and delay line
+static smith_identifier_t g_smith_ident;   ///< Cold heat-up step response identifier
+static bool smith_running = false;         ///< g_smith is being stepped
+static bool smith_model_identified = false; ///< Model refined from a heat-up this boot
+
+// Disturbance observer (owned by the temperature control task)
+static disturbance_observer_t g_observer;  ///< Platen heat balance / load estimate
+static bool observer_running = false;      ///< g_observer has been initialized
+static bool observer_press_running = false; ///< A press is being watched for its peak load
+static float press_peak_load = 0.0f;       ///< Highest load seen in the running press (W)
+static float last_press_load = 0.0f;       ///< Peak load of the last completed press (W)
+
+// Holding power map (learned in settings.power_map)
+static bool integral_preload_pending = false; ///< Mode entered, preload the integral at the next step
+static float settle_setpoint = 0.0f;       ///< Setpoint of the settled period being averaged (°C)
+static float settle_power_sum = 0.0f;      ///< Heater power summed over the settled period (%*s)
+static uint16_t settle_seconds = 0;        ///< Length of the settled period so far (s)
+
+// Press close prediction (predictor owned by the temperature control task)
+static press_predictor_t g_press_predictor; ///< Open-to-close rhythm of the current job
+static uint32_t press_opened_time = 0;     ///< Last opening after a cycle (s), set by the UI task
+static uint32_t press_closed_time = 0;     ///< Last close that started a cycle (s), set by the UI task
+static bool press_predictor_reset_requested = false; ///< New job started, set by the UI task
+static float press_preboost = 0.0f;        ///< Setpoint boost ahead of the predicted close (°C)
+
+// Predictive readiness (updated by the temperature control task)
+static float reading_slope = 0.0f;         ///< Smoothed temperature slope (°C/s)
+static bool ready_predicted = false;       ///< Next stage 1 dwell predicted within tolerance
+
+// Adaptive tuning (owned by the temperature control task)
+static pid_adaptive_t g_adaptive;           ///< Self-tuning state
+static bool adaptive_cycle_running = false; ///< A pressing cycle is being measured
+
+// Session accounting (protected by statistics_mutex)
+static session_tally_t session_tally;        ///< Time breakdown since boot / last stats reset
+static session_tally_t shift_tally;          ///< Time breakdown for the current operator shift
+static uint32_t last_accounting_time = 0;    ///< Last time accounted (seconds since boot)
+static throughput_t g_throughput;            ///< Last hour of presses and time, per minute
+
+// Scheduled pre-heat (owned by the UI task)
+static preheat_schedule_t preheat_schedule;  ///< Weekday ready times and learned heat-up rate, persisted
+static int64_t preheat_ready_utc = 0;        ///< Ready time of the running pre-heat (0 = none)
+static int64_t preheat_handled_utc = 0;      ///< Last ready time a pre-heat was started for
+static int64_t preheat_blocked_utc = 0;      ///< Last ready time an interlock was reported for
+static uint32_t warmup_start_time = 0;       ///< Heat-up being measured (seconds since boot, 0 = none)
+static float warmup_start_temp = 0.0f;       ///< Temperature the measured heat-up started from
+
+// Surface calibration (table and procedure protected by statistics_mutex)
+static surface_calibration_t surface_cal;    ///< Correction applied to every reading, persisted
+static surface_calibration_t surface_cal_new; ///< Table being built by the procedure
+static surface_cal_status_t surface_cal_run; ///< Procedure progress
+static float surface_cal_reading_sum = 0.0f; ///< Uncorrected readings summed while settled
+static uint16_t surface_cal_reading_count = 0; ///< Readings in surface_cal_reading_sum
 
 // Thread safety - Mutexes for shared data
 static SemaphoreHandle_t statistics_mutex = NULL;  ///< Mutex for statistics access
@@ -122,6 +226,7 @@ void complete_pressing_cycle(void); ///< Complete current cycle and update stati
 // Safety and Error Handling Functions
 void emergency_shutdown_system(const char *reason); ///< Emergency shutdown with safety actions
 bool check_system_safety(void);                     ///< Check overall system safety status
+static bool is_over_temperature(float temperature); ///< Check the maximum temperature limit
 bool read_temperature_safe(float *temperature);     ///< Read temperature with retry logic
 void reset_error_state(void);                       ///< Reset error state when safe
 bool validate_cycle_safety(void);                   ///< Validate conditions for starting cycle
@@ -133,11 +238,42 @@ void handle_pause_button(void);                     ///< Handle pause button pre
 void control_heating_with_hysteresis(float pid_output); ///< Control heating with hysteresis logic
 bool has_reached_target_temp_once(void);            ///< Check if target temp was reached at least once since boot
 bool is_heat_press_ready(void);                     ///< Check if heat press is ready for pressing (includes heating active)
+shirt_side_t get_active_side(void);                 ///< Side being pressed (or pressed next) in the current job
+static void build_cycle_definition(shirt_side_t side, cycle_definition_t *definition); ///< Stages for a side
+float get_active_target_temp(void);                 ///< Target temperature for the active side
+static void sync_pid_setpoint(void);                ///< Push control setpoint to the PID controller
+bool is_keep_warm_active(void);                     ///< Check if pause keep-warm is holding temperature
+float get_control_setpoint(void);                   ///< Setpoint the controller is currently tracking
+static void update_setpoint_profile(bool in_heat_up_mode); ///< Start/stop/advance ramp-soak profiles
+static void update_heating_rate_estimate(float output); ///< Learn full-power heating rate for ETAs
+static void update_adaptive_tuning(void);            ///< Measure presses and adjust PID gains between them
+static void adaptive_tuning_load(void);              ///< Resume adaptive tuning from its saved record
+static void adaptive_tuning_save(void);              ///< Save the adaptive tuning reference and audit trail
+static void apply_settings_changes(void);            ///< Apply published settings edits to the controller
+static void sync_cascade_mode(void);                 ///< Switch between single-loop and cascade control
+static void update_smith_predictor(void);            ///< Step the dead-time model and refine it on cold heat-ups
+static void update_load_observer(void);              ///< Estimate unmeasured thermal load and track it per press
+static void apply_power_feedforward(void);           ///< Feed forward / preload the learned holding power
+static void update_power_map(bool controlling);      ///< Learn holding power from settled periods
+static void update_press_preboost(uint32_t now);     ///< Boost the setpoint ahead of the predicted press close
+static void update_ready_prediction(void);           ///< Predict whether the next stage 1 stays in tolerance
+static void update_platen_station(void);            ///< Follow the platen to another station's press load
+uint32_t get_resume_ready_eta(void);                ///< Predict seconds until ready after unpause
+bool is_setpoint_profile_active(void);              ///< Check if a ramp/soak profile is running
+static time_category_t classify_session_time(void); ///< Classify the current second for session accounting
+static void update_session_accounting(uint32_t now); ///< Account elapsed time to session and shift
+static void preheat_init(void);                     ///< Restore the pre-heat schedule
+static void update_preheat(uint32_t now);           ///< Start scheduled pre-heats, learn heat-up times
+static void surface_cal_load(void);                 ///< Restore the surface correction table
+static float correct_surface_temperature(float reading); ///< Apply the surface correction table
+static bool is_surface_cal_holding(void);           ///< Surface calibration is holding a setpoint
+static void update_surface_calibration(void);       ///< Wait for the calibration setpoint to settle
 
 // PID Autotune Functions
 bool start_pid_autotune(float target_temp);         ///< Start PID auto-tune process
 bool is_pid_autotuning(void);                       ///< Check if auto-tune is in progress
 uint8_t get_autotune_progress(void);                ///< Get auto-tune progress percentage
+bool get_autotune_ranking_entry(uint8_t rank, const char **rule_name, float *score); ///< Simulated tuning rule ranking
 
 // Thread-safe statistics access helpers
 static inline void stats_lock(void) { xSemaphoreTake(statistics_mutex, portMAX_DELAY); }
@@ -190,6 +326,7 @@ void app_main(void)
         emergency_shutdown_system("Mutex creation failure");
         return;
     }
+    settings_events_init();
 
     // Initialize defaults first
     init_defaults();
@@ -258,6 +395,7 @@ void app_main(void)
         .output_min = 0.0f,
         .output_max = 100.0f};
     pid_init(pid_config);
+    applied_pid_setpoint = settings.target_temp;
 
     // Initialize user interface
     ui_init(&settings, &print_run);
@@ -267,11 +405,20 @@ void app_main(void)
         .start_autotune = start_pid_autotune,
         .is_autotuning = is_pid_autotuning,
         .get_autotune_progress = get_autotune_progress,
+        .get_autotune_ranking = get_autotune_ranking_entry,
         .get_statistics = ui_callback_get_statistics,
         .get_warmup_time = ui_callback_get_warmup_time
     };
     ui_register_callbacks(&ui_callbacks);
 
+    heater_wear_init();
+    surface_cal_load();
+    adaptive_tuning_load();
+
+    // Job tickets and pre-heat schedule from the shop system (not needed to press safely)
+    preheat_init();
+    job_link_init();
+
     // Initialize safety state - start with all safety systems engaged
     emergency_shutdown = false;
     sensor_error_count = 0;
@@ -363,8 +510,32 @@ void ui_task(void *pvParameters)
             startup_screen_time = 0;
         }
 
+        // Job tickets from the shop system, scheduled pre-heat
+        if (!emergency_shutdown)
+        {
+            job_link_poll();
+            update_preheat(current_time);
+            current_ui_state = ui_get_current_state();
+        }
+
+        // Shuttle press: the platen has moved to the other station
+        if (SHUTTLE_ENABLED && !last_press_state)
+        {
+            uint8_t other = (get_platen_station() + 1) % STATION_COUNT;
+            bool pressing_screen = current_ui_state == UI_STATE_START_PRESSING ||
+                                   current_ui_state == UI_STATE_FREE_PRESS ||
+                                   current_ui_state == UI_STATE_PRESSING_ACTIVE ||
+                                   current_ui_state == UI_STATE_STAGE_READY ||
+                                   current_ui_state == UI_STATE_CYCLE_COMPLETE;
+            if (pressing_screen && controls_is_station_closed(other))
+            {
+                switch_station(other, current_time);
+                current_ui_state = ui_get_current_state();
+            }
+        }
+
         // Monitor press state changes for cycle control
-        bool current_press_state = controls_is_press_closed();
+        bool current_press_state = controls_is_station_closed(get_platen_station());
 
         // Safety interlock: only allow pressing if all safety checks pass and not paused
         bool safety_ok = check_system_safety() && !emergency_shutdown && !pause_mode;
@@ -374,14 +545,15 @@ void ui_task(void *pvParameters)
             ESP_LOGI(TAG, "Press closed detected. UI state: %d, pressing_active: %d, current_stage: %d",
                      current_ui_state, pressing_active, current_stage);
 
-            // Check if we're in READY state waiting for Stage 2
-            if (current_ui_state == UI_STATE_STAGE2_READY && pressing_active)
+            // Check if we're in READY state waiting for the next stage
+            if (current_ui_state == UI_STATE_STAGE_READY && pressing_active)
             {
-                // Start Stage 2
-                ESP_LOGI(TAG, "Press closed - starting Stage 2");
-                current_stage = STAGE2;
-                stage_start_time = esp_timer_get_time() / 1000000;
-                current_cycle.status = STAGE2;
+                cycle_engine_press_closed(&cycle_engine, current_time);
+                ESP_LOGI(TAG, "Press closed - starting stage %u", cycle_engine.stage + 1);
+                current_stage = ACTIVE;
+                stage_start_time = current_time;
+                current_cycle.stage = cycle_engine.stage;
+                current_cycle.status = ACTIVE;
                 ui_set_state(UI_STATE_PRESSING_ACTIVE);
                 state_transition_time = current_time;
             }
@@ -390,6 +562,7 @@ void ui_task(void *pvParameters)
             {
                 press_safety_locked = false; // Release safety lock for validated cycle
                 start_pressing_cycle();
+                press_closed_time = current_time;
                 ui_set_state(UI_STATE_PRESSING_ACTIVE);
                 state_transition_time = current_time;
                 ESP_LOGI(TAG, "Starting next cycle from cycle complete");
@@ -399,6 +572,7 @@ void ui_task(void *pvParameters)
             {
                 press_safety_locked = false; // Release safety lock for validated cycle
                 start_pressing_cycle();
+                press_closed_time = current_time;
                 ui_set_state(UI_STATE_PRESSING_ACTIVE); // Transition UI to pressing active state
                 state_transition_time = current_time;
                 ESP_LOGI(TAG, "Press cycle started with all safety checks passed");
@@ -415,33 +589,40 @@ void ui_task(void *pvParameters)
         else if (!current_press_state && last_press_state)
         {
             // Press opened
-            if (current_ui_state == UI_STATE_STAGE1_DONE)
+            if (current_ui_state == UI_STATE_STAGE_DONE)
             {
                 // Transition from DONE to READY when press opens
-                ui_set_state(UI_STATE_STAGE2_READY);
+                cycle_engine_press_opened(&cycle_engine, current_time);
+                ui_set_state(UI_STATE_STAGE_READY);
                 state_transition_time = current_time;
                 ESP_LOGI(TAG, "Press opened - transitioning to READY state");
             }
             else if (pressing_active)
             {
-                if (current_stage == STAGE1)
+                cycle_phase_t phase = cycle_engine_press_opened(&cycle_engine, current_time);
+                if (phase == CYCLE_PHASE_READY)
                 {
-                    // Stage 1 early release - finish stage 1 and go to READY
-                    ESP_LOGI(TAG, "Stage 1 early release detected");
+                    // Early release - finish the stage and wait for the next close
                     current_stage = IDLE;
                     current_cycle.status = IDLE;
-                    ui_set_state(UI_STATE_STAGE2_READY);
+                    ui_set_state(UI_STATE_STAGE_READY);
                     state_transition_time = current_time;
                 }
-                else if (current_stage == STAGE2)
+                else if (phase == CYCLE_PHASE_COMPLETE)
                 {
-                    // Stage 2 early release or normal completion - complete the cycle
-                    ESP_LOGI(TAG, "Stage 2 press opened - completing cycle");
+                    // Last stage early release or normal completion - complete the cycle
+                    ESP_LOGI(TAG, "Last stage press opened - completing cycle");
                     complete_pressing_cycle();
                     press_safety_locked = true; // Re-engage safety lock
                     state_transition_time = current_time;
                 }
             }
+
+            // Opened with no cycle running: the next close loads a fresh garment
+            if (!pressing_active)
+            {
+                press_opened_time = current_time;
+            }
         }
 
         last_press_state = current_press_state;
@@ -474,6 +655,12 @@ void temp_control_task(void *pvParameters)
     {
         temp_control_task_last_run = esp_timer_get_time() / 1000000;
 
+        // Account the elapsed second before anything can skip the loop body
+        update_session_accounting(temp_control_task_last_run);
+
+        // Apply settings edited since the last step; save once edits settle
+        apply_settings_changes();
+
         // Emergency shutdown check - immediate safety response
         if (emergency_shutdown)
         {
@@ -493,33 +680,81 @@ void temp_control_task(void *pvParameters)
             // Log temperature to console
             ESP_LOGI(TAG, "Temperature: %.2f°C", current_temperature);
 
+            // Follow the heater core with the power applied over the last second
+            if (cascade_active)
+            {
+                pid_cascade_track(&g_cascade, current_temperature, heating_get_power(), 1.0f);
+            }
+            update_smith_predictor();
+            update_load_observer();
+            update_platen_station();
+            update_ready_prediction();
+            update_wear(temp_control_task_last_run, cascade_active ? &g_cascade : NULL);
+            update_surface_calibration();
+
             // Check if auto-tuning is in progress
             if (is_autotuning)
             {
-                // Run auto-tune update
-                float autotune_output = pid_autotune_update(&g_autotune_ctx, current_temperature);
+                // Run auto-tune update (cascade tests watch the loop under test)
+                float autotune_input = autotune_cascade ?
+                    pid_cascade_autotune_input(&g_cascade, autotune_loop, current_temperature) :
+                    current_temperature;
+                float autotune_output = pid_autotune_update(&g_autotune_ctx, autotune_input);
 
                 // Check if auto-tune is complete
                 if (pid_autotune_is_complete(&g_autotune_ctx))
                 {
                     autotune_result_t result;
-                    if (pid_autotune_get_result(&g_autotune_ctx, &result))
+                    if (autotune_cascade && autotune_loop == CASCADE_LOOP_INNER &&
+                        pid_autotune_get_result(&g_autotune_ctx, &result))
                     {
-                        // Apply new PID parameters
-                        settings.pid_kp = result.kp;
-                        settings.pid_ki = result.ki;
-                        settings.pid_kd = result.kd;
-
-                        // Update PID controller with new parameters
-                        pid_config_t new_pid_config = {
-                            .kp = result.kp,
-                            .ki = result.ki,
-                            .kd = result.kd,
-                            .setpoint = settings.target_temp,
-                            .output_min = 0.0f,
-                            .output_max = 100.0f
-                        };
-                        pid_init(new_pid_config);
+                        // Inner loop tuned - relay the outer loop with the inner loop closed
+                        pid_cascade_apply_autotune(&g_cascade, CASCADE_LOOP_INNER, &result);
+                        settings.inner_kp = result.kp;
+                        settings.inner_ki = result.ki;
+                        settings.inner_kd = result.kd;
+
+                        autotune_loop = CASCADE_LOOP_OUTER;
+                        pid_autotune_init(&g_autotune_ctx,
+                                          pid_cascade_autotune_config(CASCADE_LOOP_OUTER, autotune_target),
+                                          TUNING_RULE_TYREUS_LUYBEN);
+                        pid_autotune_start(&g_autotune_ctx);
+                        ESP_LOGI(TAG, "Cascade inner loop tuned, tuning outer loop");
+                    }
+                    else if (pid_autotune_get_result(&g_autotune_ctx, &result))
+                    {
+                        if (autotune_cascade)
+                        {
+                            // Outer loop gains in core °C per surface °C, kept apart
+                            // from the single-loop gains (% power per °C)
+                            pid_cascade_apply_autotune(&g_cascade, CASCADE_LOOP_OUTER, &result);
+                            settings.outer_kp = result.kp;
+                            settings.outer_ki = result.ki;
+                            settings.outer_kd = result.kd;
+                        }
+                        else
+                        {
+                            // The balanced relay centre is the power that holds the target
+                            power_map_learn(&settings.power_map, autotune_target,
+                                            DEFAULT_TEMPERATURE, result.relay_bias);
+
+                            // Apply new PID parameters
+                            settings.pid_kp = result.kp;
+                            settings.pid_ki = result.ki;
+                            settings.pid_kd = result.kd;
+
+                            // Update PID controller with new parameters
+                            pid_config_t new_pid_config = {
+                                .kp = result.kp,
+                                .ki = result.ki,
+                                .kd = result.kd,
+                                .setpoint = settings.target_temp,
+                                .output_min = 0.0f,
+                                .output_max = 100.0f
+                            };
+                            pid_init(new_pid_config);
+                            applied_pid_setpoint = settings.target_temp;
+                        }
 
                         // Save new settings
                         save_persistent_data();
@@ -544,6 +779,11 @@ void temp_control_task(void *pvParameters)
                         heating_set_power(0);
                     }
                 }
+                else if (autotune_cascade)
+                {
+                    // Relay drives power (inner test) or the core setpoint (outer test)
+                    heating_set_power((uint8_t)pid_cascade_autotune_output(&g_cascade, autotune_loop, autotune_output));
+                }
                 else
                 {
                     // Apply auto-tune output (relay feedback)
@@ -555,25 +795,66 @@ void temp_control_task(void *pvParameters)
                 // Normal operation: update pressing cycle timing
                 update_pressing_cycle();
 
+                // Score the press and adjust gains once it has finished
+                update_adaptive_tuning();
+
                 // Check if we're in Heat Up mode
                 ui_state_t current_ui_state = ui_get_current_state();
                 bool in_heat_up_mode = (current_ui_state == UI_STATE_HEAT_UP);
 
+                // Keep-warm holds a reduced setpoint while paused; ramp/soak
+                // profiles shape the setpoint during heat-up and after unpause
+                update_setpoint_profile(in_heat_up_mode);
+                update_press_preboost(temp_control_task_last_run);
+                bool holding_temp = is_keep_warm_active() || sp_runner_is_active(&setpoint_runner) ||
+                                    (press_preboost > 0.0f) || is_surface_cal_holding();
+
                 // Control heating when:
                 // 1. Pressing is active, not paused, and safety checks pass, OR
-                // 2. In Heat Up mode and safety checks pass
+                // 2. A shuttle station is waiting for the platen to return, OR
+                // 3. In Heat Up mode and safety checks pass, OR
+                // 4. Keep-warm, a setpoint profile or surface calibration is holding temperature
                 if ((pressing_active && !press_safety_locked && check_system_safety() && !pause_mode) ||
-                    (in_heat_up_mode && check_system_safety()))
+                    (is_parked_cycle_active() && check_system_safety() && !pause_mode) ||
+                    (in_heat_up_mode && check_system_safety()) ||
+                    (holding_temp && check_system_safety()))
                 {
-                    // Update PID controller with current temperature
-                    float output = pid_update(current_temperature);
+                    // Follow the control setpoint (side target, keep-warm or ramp)
+                    sync_pid_setpoint();
+                    apply_power_feedforward();
+
+                    // Update PID controller (or cascade) with current temperature;
+                    // the Smith predictor removes dead time from the single loop
+                    float output;
+                    if (cascade_active)
+                    {
+                        output = pid_cascade_update(&g_cascade, current_temperature);
+                    }
+                    else if (smith_running)
+                    {
+                        output = pid_update(pid_smith_feedback(&g_smith, current_temperature));
+                    }
+                    else
+                    {
+                        output = pid_update(current_temperature);
+                    }
+
+                    // Answer an observed load now rather than after the integral winds up
+                    if (settings.load_compensation)
+                    {
+                        output = CLAMP(output + dob_compensation(&g_observer, OBSERVER_COMPENSATION),
+                                       0.0f, 100.0f);
+                    }
+                    update_heating_rate_estimate(output);
+                    update_power_map(true);
+                    update_heater_health(temp_control_task_last_run, true, applied_pid_setpoint);
 
-                    ESP_LOGI(TAG, "Heat Up: PID output=%.1f%%, pressing=%d, heat_up=%d",
-                             output, pressing_active, in_heat_up_mode);
+                    ESP_LOGI(TAG, "Heat Up: PID output=%.1f%%, pressing=%d, heat_up=%d, hold=%d",
+                             output, pressing_active, in_heat_up_mode, holding_temp);
 
-                    // In Heat Up mode, apply PID directly without hysteresis
-                    // During pressing, use hysteresis for stability
-                    if (in_heat_up_mode)
+                    // In Heat Up mode and while holding temperature, apply PID directly
+                    // without hysteresis. During pressing, use hysteresis for stability
+                    if (in_heat_up_mode || holding_temp)
                     {
                         heating_set_power((uint8_t)output);
                     }
@@ -588,11 +869,13 @@ void temp_control_task(void *pvParameters)
                     ESP_LOGD(TAG, "Heating off: pressing=%d, locked=%d, safety=%d, pause=%d, heat_up=%d",
                              pressing_active, press_safety_locked, check_system_safety(), pause_mode, in_heat_up_mode);
                     heating_set_power(0);
+                    update_power_map(false);
+                    update_heater_health(temp_control_task_last_run, false, applied_pid_setpoint);
                 }
             }
 
             // Critical safety check: emergency shutdown if temperature exceeds limit
-            if (current_temperature > MAX_TEMPERATURE)
+            if (is_over_temperature(current_temperature))
             {
                 emergency_shutdown_system("Temperature exceeded maximum safe limit");
 
@@ -638,12 +921,34 @@ void init_defaults(void)
     // PID defaults optimized for 2200W/230V heat press with high thermal mass
     // These conservative values minimize overshoot for safety
     // Use auto-tune for optimal tuning to your specific heat press
-    settings.pid_kp = 3.5f;   // Higher proportional gain for better response to error
-    settings.pid_ki = 0.05f;  // Lower integral gain to prevent overshoot with high thermal mass
-    settings.pid_kd = 1.2f;   // Higher derivative gain to dampen oscillations
+    settings.pid_kp = PID_DEFAULT_KP; // Higher proportional gain for better response to error
+    settings.pid_ki = PID_DEFAULT_KI; // Lower integral gain to prevent overshoot with high thermal mass
+    settings.pid_kd = PID_DEFAULT_KD; // Higher derivative gain to dampen oscillations
 
     settings.stage1_default = 15;
     settings.stage2_default = 5;
+    settings.back_stage1_default = 15;
+    settings.back_stage2_default = 5;
+    settings.station_b_stage1_default = 15;
+    settings.station_b_stage2_default = 5;
+    settings.back_temp_offset = 0.0f;
+    settings.keep_warm_drop = PAUSE_KEEP_WARM_DROP;
+    settings.ramp_rate = 0.0f;  // Step to target until a material profile sets a ramp
+    settings.soak_time = 0;
+    settings.adaptive_tuning = false;  // Opt-in: gains only change when the operator asks
+    settings.cascade_enabled = false;
+    settings.outer_kp = PID_DEFAULT_KP;  // Surface loop: replaced by a cascade auto-tune
+    settings.outer_ki = PID_DEFAULT_KI;
+    settings.outer_kd = PID_DEFAULT_KD;
+    settings.inner_kp = 2.0f;   // Heater core loop: fast, mostly proportional
+    settings.inner_ki = 0.1f;
+    settings.inner_kd = 0.0f;
+    settings.smith_enabled = false;
+    settings.load_compensation = false;
+    settings.power_feedforward = false;
+    settings.press_preboost = false;
+    power_map_init(&settings.power_map);  // Learned from settled periods and auto-tune
+    settings.cycle_program = 0;  // Two stages from the stage timers
 
     // Default print run
     print_run.id = 1;
@@ -653,6 +958,12 @@ void init_defaults(void)
     print_run.time_elapsed = 0;
     print_run.shirts_completed = 0;
     print_run.avg_time_per_shirt = 0;
+    print_run.next_side = FRONT;
+    print_run.front_presses = 0;
+    print_run.back_presses = 0;
+    print_run.front_press_time = 0;
+    print_run.back_press_time = 0;
+    print_run.manual = false;
 
     // Reset run timing
     run_start_time = 0;
@@ -660,6 +971,12 @@ void init_defaults(void)
     // Initialize statistics to zero
     memset(&statistics, 0, sizeof(statistics_t));
     statistics.session_start_time = esp_timer_get_time() / 1000000;
+
+    // Session and first shift start now
+    session_tally_reset(&session_tally, statistics.session_start_time);
+    session_tally_reset(&shift_tally, statistics.session_start_time);
+    throughput_reset(&g_throughput, statistics.session_start_time);
+    last_accounting_time = statistics.session_start_time;
 }
 
 void load_persistent_data(void)
@@ -704,6 +1021,12 @@ void load_persistent_data(void)
             print_run.time_elapsed = 0;
             print_run.shirts_completed = 0;
             print_run.avg_time_per_shirt = 0;
+            print_run.next_side = FRONT;
+            print_run.front_presses = 0;
+            print_run.back_presses = 0;
+            print_run.front_press_time = 0;
+            print_run.back_press_time = 0;
+            print_run.manual = false;
             run_start_time = 0;
         }
         else if (print_run.shirts_completed > 0 && print_run.time_elapsed > 0)
@@ -721,6 +1044,11 @@ void load_persistent_data(void)
     settings.target_temp = 140.0f;
     settings.stage1_default = 15;
     settings.stage2_default = 5;
+    settings.back_stage1_default = 15;
+    settings.back_stage2_default = 5;
+    settings.station_b_stage1_default = 15;
+    settings.station_b_stage2_default = 5;
+    settings.back_temp_offset = 0.0f;
     ESP_LOGI(TAG, "System initialized with Cotton profile (140°C, 15s/5s)");
 }
 
@@ -754,7 +1082,8 @@ void start_pressing_cycle(void)
     if (!pressing_active && !emergency_shutdown && validate_cycle_safety())
     {
         pressing_active = true;
-        current_stage = STAGE1;
+        integral_preload_pending = true;
+        current_stage = ACTIVE;
         cycle_start_time = esp_timer_get_time() / 1000000; // seconds
         stage_start_time = cycle_start_time;
 
@@ -764,6 +1093,9 @@ void start_pressing_cycle(void)
             if (ui_get_free_press_run_start_time() == 0)
             {
                 ui_set_free_press_run_start_time(cycle_start_time);
+                press_predictor_reset_requested = true;
+                reset_station_cycles();
+                reset_station_presses();
             }
         }
         else
@@ -771,18 +1103,46 @@ void start_pressing_cycle(void)
             if (run_start_time == 0)
             {
                 run_start_time = cycle_start_time;
+                press_predictor_reset_requested = true;
+                reset_station_cycles();
+                reset_station_presses();
+            }
+        }
+
+        // Double-sided jobs alternate front/back; the shirt id stays the same for both sides
+        shirt_side_t side = get_active_side();
+        if (ui_is_free_press_mode())
+        {
+            current_cycle.shirt_id = 0;
+        }
+        else if (!SHUTTLE_ENABLED)
+        {
+            current_cycle.shirt_id = print_run.progress + 1;
+        }
+        else if (side != BACK)
+        {
+            // The other station may hold the next unfinished shirt
+            const station_context_t *other = get_parked_station((get_platen_station() + 1) % STATION_COUNT);
+            bool other_holds_shirt = other->pressing_active || other->next_side == BACK;
+            current_cycle.shirt_id = print_run.progress + 1;
+            if (other_holds_shirt && other->cycle.shirt_id == current_cycle.shirt_id)
+            {
+                current_cycle.shirt_id++;
             }
         }
+        current_cycle.side = side;
 
-        current_cycle.shirt_id = ui_is_free_press_mode() ? 0 : (print_run.progress + 1);
-        current_cycle.side = FRONT; // Always start with front
-        current_cycle.stage1_duration = settings.stage1_default;
-        current_cycle.stage2_duration = settings.stage2_default;
+        cycle_definition_t definition;
+        build_cycle_definition(current_cycle.side, &definition);
+        current_cycle.program = settings.cycle_program;
+        current_cycle.stage = 0;
+        current_cycle.stage_count = definition.stage_count;
         current_cycle.start_time = cycle_start_time;
-        current_cycle.status = STAGE1;
+        current_cycle.status = ACTIVE;
 
         // Validate cycle configuration before starting
-        if (!validate_pressing_cycle(&current_cycle))
+        if (!validate_pressing_cycle(&current_cycle) ||
+            !cycle_engine_start(&cycle_engine, &definition, cycle_start_time))
         {
             ESP_LOGE(TAG, "Pressing cycle configuration validation failed");
             pressing_active = false;
@@ -790,7 +1150,13 @@ void start_pressing_cycle(void)
             return;
         }
 
-        ESP_LOGI(TAG, "Started pressing cycle for shirt %d with safety validation", current_cycle.shirt_id);
+        ESP_LOGI(TAG, "Started pressing cycle for shirt %d (%s side, %s, %u stages) with safety validation",
+                 current_cycle.shirt_id, current_cycle.side == BACK ? "back" : "front",
+                 cycle_program_name(current_cycle.program), current_cycle.stage_count);
+        if (SHUTTLE_ENABLED)
+        {
+            ESP_LOGI(TAG, "Station %c", 'A' + get_platen_station());
+        }
     }
     else if (emergency_shutdown)
     {
@@ -809,7 +1175,6 @@ void update_pressing_cycle(void)
 
     uint32_t current_time = esp_timer_get_time() / 1000000;
     uint32_t cycle_elapsed = current_time - cycle_start_time;
-    uint32_t stage_elapsed = current_time - stage_start_time;
 
     // Safety check: maximum cycle time protection
     if (cycle_elapsed > MAX_CYCLE_TIME)
@@ -820,28 +1185,44 @@ void update_pressing_cycle(void)
     }
 
     // Safety check: ensure temperature is within safe range during pressing
-    if (current_temperature > (settings.target_temp + TEMP_PRESSING_MAX_OFFSET))
+    float stage_offset = fmaxf(cycle_engine_setpoint_offset(&cycle_engine), 0.0f);
+    if (current_temperature > (get_active_target_temp() + stage_offset + TEMP_PRESSING_MAX_OFFSET))
     {
         ESP_LOGE(TAG, "Cycle aborted - temperature too high during pressing (%.1f°C)", current_temperature);
         emergency_shutdown_system("Temperature exceeded safe limits during pressing cycle");
         return;
     }
 
-    if (current_stage == STAGE1 && stage_elapsed >= current_cycle.stage1_duration)
+    if (cycle_engine.phase != CYCLE_PHASE_RUNNING)
+    {
+        return;
+    }
+
+    uint8_t stage = cycle_engine.stage;
+    cycle_phase_t phase = cycle_engine_update(&cycle_engine, current_time, current_temperature,
+                                              get_active_target_temp());
+
+    if (phase == CYCLE_PHASE_STAGE_DONE)
     {
-        // Stage 1 complete - show DONE message
+        // Stage complete - show DONE message until the press opens
         current_stage = IDLE;
         current_cycle.status = IDLE;
-        ui_set_state(UI_STATE_STAGE1_DONE);
+        ui_set_state(UI_STATE_STAGE_DONE);
         state_transition_time = current_time;
-        ESP_LOGI(TAG, "Stage 1 complete - showing DONE message");
+        ESP_LOGI(TAG, "Stage %u complete - showing DONE message", stage + 1);
     }
-    else if (current_stage == STAGE2 && stage_elapsed >= current_cycle.stage2_duration)
+    else if (phase == CYCLE_PHASE_LAST_DONE)
     {
-        // Stage 2 complete - show DONE message until press opens
-        ui_set_state(UI_STATE_STAGE2_DONE);
+        // Last stage complete - show DONE message until the press opens
+        ui_set_state(UI_STATE_LAST_STAGE_DONE);
         state_transition_time = current_time;
-        ESP_LOGI(TAG, "Stage 2 complete - showing DONE message");
+        ESP_LOGI(TAG, "Stage %u complete - showing DONE message", stage + 1);
+    }
+    else if (cycle_engine.stage != stage)
+    {
+        // Next stage followed on with the press closed
+        stage_start_time = current_time;
+        current_cycle.stage = cycle_engine.stage;
     }
 }
 
@@ -854,6 +1235,11 @@ void complete_pressing_cycle(void)
 
         // Update cycle completion
         current_cycle.status = COMPLETE;
+        count_station_press();
+
+        // A double-sided shirt only counts once its back side is done
+        bool double_sided_job = !ui_is_free_press_mode() && print_run.type == DOUBLE_SIDED;
+        bool shirt_finished = !(double_sided_job && current_cycle.side == FRONT);
 
         // Update statistics - total presses (thread-safe)
         stats_lock();
@@ -861,11 +1247,28 @@ void complete_pressing_cycle(void)
         statistics.presses_since_pid_tune++;
 
         // Track temperature stability
-        float temp_error = current_temperature - settings.target_temp;
+        float temp_error = current_temperature - get_active_target_temp();
         if (temp_error >= -5.0f && temp_error <= 5.0f)
         {
             statistics.presses_in_tolerance++;
         }
+
+        // Per-side throughput for double-sided jobs
+        if (double_sided_job && current_cycle.side == FRONT)
+        {
+            statistics.front_presses++;
+            statistics.front_press_time += cycle_duration;
+        }
+        else if (double_sided_job && current_cycle.side == BACK)
+        {
+            statistics.back_presses++;
+            statistics.back_press_time += cycle_duration;
+            statistics.double_sided_shirts++;
+        }
+
+        session_tally_add_press(&session_tally, shirt_finished);
+        session_tally_add_press(&shift_tally, shirt_finished);
+        throughput_add_press(&g_throughput, current_time, shirt_finished);
         stats_unlock();
 
         // Check if we're in free press mode
@@ -887,8 +1290,28 @@ void complete_pressing_cycle(void)
         else
         {
             // Job-tracked mode - update print run
-            print_run.shirts_completed++;
-            print_run.progress = print_run.shirts_completed;
+            if (print_run.type == DOUBLE_SIDED)
+            {
+                if (current_cycle.side == FRONT)
+                {
+                    print_run.front_presses++;
+                    print_run.front_press_time += cycle_duration;
+                    print_run.next_side = BACK;
+                }
+                else
+                {
+                    print_run.back_presses++;
+                    print_run.back_press_time += cycle_duration;
+                    print_run.next_side = FRONT;
+                }
+            }
+
+            if (shirt_finished)
+            {
+                print_run.shirts_completed++;
+                print_run.progress = print_run.shirts_completed;
+                job_link_report_shirt();
+            }
 
             // Update total elapsed time from run start (includes time between shirts)
             if (run_start_time > 0)
@@ -905,13 +1328,15 @@ void complete_pressing_cycle(void)
             // Save progress
             save_persistent_data();
 
-            ESP_LOGI(TAG, "Completed pressing cycle for shirt %d in %d seconds",
-                     current_cycle.shirt_id, cycle_duration);
+            ESP_LOGI(TAG, "Completed pressing cycle for shirt %d (%s side) in %d seconds",
+                     current_cycle.shirt_id, current_cycle.side == BACK ? "back" : "front",
+                     cycle_duration);
         }
 
         // Reset cycle state
         pressing_active = false;
         current_stage = IDLE;
+        cycle_engine.phase = CYCLE_PHASE_IDLE;
         cycle_start_time = 0;
         stage_start_time = 0;
 
@@ -1014,6 +1439,7 @@ void emergency_shutdown_system(const char *reason)
     pressing_active = false;
     press_safety_locked = true;
     pause_mode = false; // Clear pause mode
+    cancel_surface_calibration(); // Do not resume holding a calibration setpoint after recovery
 
     // Turn off all LED indicators
     controls_set_led_green(false);
@@ -1021,6 +1447,8 @@ void emergency_shutdown_system(const char *reason)
 
     // Reset cycle state
     current_stage = IDLE;
+    cycle_engine.phase = CYCLE_PHASE_IDLE;
+    reset_station_cycles();
     cycle_start_time = 0;
     stage_start_time = 0;
     run_start_time = 0;
@@ -1029,10 +1457,26 @@ void emergency_shutdown_system(const char *reason)
     ESP_LOGE(TAG, "Emergency shutdown complete - system locked for safety");
 }
 
+/**
+ * @brief Check the maximum temperature limit
+ *
+ * The thermocouple reading itself is checked as well: the surface
+ * correction lowers the temperature (the surface runs cooler than the
+ * casting), so the corrected value alone would let the casting run past
+ * MAX_TEMPERATURE.
+ *
+ * @param temperature Surface-corrected temperature (°C)
+ * @return true if either reading is above MAX_TEMPERATURE
+ */
+static bool is_over_temperature(float temperature)
+{
+    return temperature > MAX_TEMPERATURE || current_sensor_temperature > MAX_TEMPERATURE;
+}
+
 bool check_system_safety(void)
 {
     // Check temperature within safe range
-    if (current_temperature > MAX_TEMPERATURE)
+    if (is_over_temperature(current_temperature))
     {
         return false;
     }
@@ -1066,6 +1510,9 @@ bool read_temperature_safe(float *temperature)
     {
         if (sensor_read_temperature(temperature))
         {
+            // Safety limits use the thermocouple, control and readiness the surface
+            current_sensor_temperature = *temperature;
+            *temperature = correct_surface_temperature(*temperature);
             last_valid_temperature = *temperature;
             return true;
         }
@@ -1145,7 +1592,7 @@ bool validate_cycle_safety(void)
     }
 
     // Check temperature is reasonable for starting a cycle
-    if (current_temperature > (settings.target_temp + TEMP_CYCLE_START_MAX_OFFSET))
+    if (current_temperature > (get_active_target_temp() + TEMP_CYCLE_START_MAX_OFFSET))
     {
         ESP_LOGW(TAG, "Cycle safety: temperature too high to start cycle (%.1f°C)", current_temperature);
         return false;
@@ -1225,11 +1672,20 @@ bool is_heat_press_ready(void)
         return false;
     }
 
-    // Check if current temperature is within ±5°C of target
-    float temp_lower_bound = settings.target_temp - TEMP_HYSTERESIS;
-    float temp_upper_bound = settings.target_temp + TEMP_HYSTERESIS;
+    // Not ready while a ramp/soak profile is still shaping the setpoint
+    if (sp_runner_is_active(&setpoint_runner))
+    {
+        return false;
+    }
+
+    // Check if current temperature is within ±5°C of target, or is
+    // predicted to hold within it for the whole next stage 1
+    float target = get_active_target_temp();
+    float temp_lower_bound = target - TEMP_HYSTERESIS;
+    float temp_upper_bound = target + TEMP_HYSTERESIS;
 
-    if (current_temperature < temp_lower_bound || current_temperature > temp_upper_bound)
+    if ((current_temperature < temp_lower_bound || current_temperature > temp_upper_bound) &&
+        !ready_predicted)
     {
         return false;
     }
@@ -1238,204 +1694,1696 @@ bool is_heat_press_ready(void)
 }
 
 /**
- * @brief Update LED indicators based on system state
+ * @brief Check if the press is ready only because of the ready gate
  *
- * Controls the green LED (temperature ready) and blue LED (pause mode)
- * according to current system conditions.
+ * True when the press is ready while the temperature is still outside the
+ * target band, i.e. the ready gate predicted the first stage will stay in
+ * tolerance. The UI uses it to flag an early ready.
+ *
+ * @return true if ready on prediction rather than on temperature
  */
-void update_led_indicators(void)
+bool is_ready_by_prediction(void)
 {
-    // Green LED: Temperature is within range of target (ready for pressing)
-    bool temp_ready = (current_temperature >= (settings.target_temp - 5.0f)) &&
-                      (current_temperature <= (settings.target_temp + 5.0f)) &&
-                      !emergency_shutdown;
-    controls_set_led_green(temp_ready);
+    float target = get_active_target_temp();
+    return ready_predicted && is_heat_press_ready() &&
+           (current_temperature < target - TEMP_HYSTERESIS || current_temperature > target + TEMP_HYSTERESIS);
+}
 
-    // Track time to reach target temperature for the first time (for PID debugging)
-    if (!target_temp_reached && temp_ready && system_start_time > 0)
+/**
+ * @brief Get the shirt side for the current or next job cycle
+ *
+ * While a cycle is running this is the side being pressed; otherwise it is
+ * the side the next cycle will press. Free press mode and single-sided jobs
+ * always press the front.
+ *
+ * @return FRONT or BACK
+ */
+shirt_side_t get_active_side(void)
+{
+    if (ui_is_free_press_mode() || print_run.type != DOUBLE_SIDED)
     {
-        uint32_t current_time = esp_timer_get_time() / 1000000;
-        time_to_target_temp = current_time - system_start_time;
-        target_temp_reached = true;
+        return FRONT;
+    }
 
-        // Update warmup statistics (thread-safe)
-        stats_lock();
-        statistics.total_warmup_time += time_to_target_temp;
-        statistics.warmup_count++;
-        statistics.avg_warmup_time = (float)statistics.total_warmup_time / statistics.warmup_count;
-        float avg_warmup = statistics.avg_warmup_time; // Copy for logging
-        stats_unlock();
+    return pressing_active ? current_cycle.side : print_run.next_side;
+}
 
-        ESP_LOGI(TAG, "Target temperature reached in %lu seconds (avg: %.1fs)",
-                 time_to_target_temp, avg_warmup);
-    }
+/**
+ * @brief Build the cycle stages for a shirt side
+ *
+ * The selected program (settings.cycle_program) takes its main and
+ * finishing press times from the side's stage timers, or from station B's
+ * on a shuttle press with the platen over station B.
+ *
+ * @param side Shirt side
+ * @param[out] definition Cycle definition
+ */
+static void build_cycle_definition(shirt_side_t side, cycle_definition_t *definition)
+{
+    uint16_t press_time = (side == BACK) ? settings.back_stage1_default : settings.stage1_default;
+    uint16_t finish_time = (side == BACK) ? settings.back_stage2_default : settings.stage2_default;
 
-    // Set target_temp_reached_once flag when temperature reaches target for the first time
-    // This flag persists throughout the session (doesn't reset if temperature drops)
-    // Reset if profile target temperature has changed since last time
-    if (temp_ready)
+    // Shuttle station B has its own timers (back sides share the back timers)
+    if (SHUTTLE_ENABLED && get_platen_station() == 1 && side != BACK)
     {
-        // Check if profile target temperature has changed
-        if (target_temp_reached_once && settings.target_temp != profile_target_temp_when_reached)
-        {
-            target_temp_reached_once = false;
-            profile_target_temp_when_reached = 0.0f;
-            ESP_LOGI(TAG, "Profile target temp changed (%.1f -> %.1f) - resetting heat press ready state",
-                     profile_target_temp_when_reached, settings.target_temp);
-        }
-
-        // Set flag when reaching target for the first time (or after profile change)
-        if (!target_temp_reached_once)
-        {
-            target_temp_reached_once = true;
-            profile_target_temp_when_reached = settings.target_temp;
-            ESP_LOGI(TAG, "Heat press ready state: target temperature %.1f°C reached for first time",
-                     settings.target_temp);
-        }
+        press_time = settings.station_b_stage1_default;
+        finish_time = settings.station_b_stage2_default;
     }
 
-    // Blue LED: System is in pause mode
-    controls_set_led_blue(pause_mode);
+    if (!cycle_program_build(settings.cycle_program, press_time, finish_time, definition))
+    {
+        cycle_program_build(0, press_time, finish_time, definition);
+    }
 }
 
 /**
- * @brief Handle pause button press
+ * @brief Get the target temperature for the active shirt side
  *
- * Toggles pause mode when the pause button is pressed.
- * Pause mode prevents new cycles from starting and disables heating.
+ * The back side of a double-sided shirt may run at a different temperature
+ * (settings.back_temp_offset) than the front.
+ *
+ * @return Target temperature in °C
  */
-void handle_pause_button(void)
+float get_active_target_temp(void)
 {
-    button_event_t button = controls_get_button_event();
-    if (button == BUTTON_PAUSE)
+    if (get_active_side() == BACK)
     {
-        pause_mode = !pause_mode;
-        if (pause_mode)
-        {
-            ESP_LOGI(TAG, "Pause mode activated");
-            // Turn off heating when paused
-            heating_set_power(0);
-        }
-        else
-        {
-            ESP_LOGI(TAG, "Pause mode deactivated");
-        }
+        return settings.target_temp + settings.back_temp_offset;
     }
+
+    return settings.target_temp;
 }
 
 /**
- * @brief Control heating with hysteresis logic
+ * @brief Check if pause keep-warm is holding temperature
  *
- * Applies hysteresis to PID output to prevent rapid on/off cycling
- * near the setpoint temperature.
+ * Only a press that was heating (or had reached target) when pause was
+ * entered is kept warm; pausing an idle cold press leaves the heater off.
  *
- * @param pid_output PID controller output (0-100%)
+ * @return true while paused with a nonzero keep-warm drop configured
  */
-void control_heating_with_hysteresis(float pid_output)
+bool is_keep_warm_active(void)
 {
-    // Turn heating ON when temperature is below (target - hysteresis)
-    if (!heating_was_on && current_temperature < (settings.target_temp - TEMP_HYSTERESIS))
+    return pause_mode && pause_keep_warm && settings.keep_warm_drop > 0.0f;
+}
+
+/**
+ * @brief Get the setpoint the controller is currently tracking
+ *
+ * This is the active side's target, except while paused (keep-warm
+ * setpoint, target minus settings.keep_warm_drop), while a ramp/soak
+ * profile is running and while surface calibration holds one of its
+ * setpoints. A running cycle always uses the full target.
+ *
+ * @return Control setpoint in °C
+ */
+float get_control_setpoint(void)
+{
+    float target = get_active_target_temp();
+
+    if (is_surface_cal_holding())
     {
-        heating_was_on = true;
+        return surface_cal_run.setpoint;
     }
-    // Turn heating OFF when temperature is above (target + hysteresis)
-    else if (heating_was_on && current_temperature > (settings.target_temp + TEMP_HYSTERESIS))
+    if (pressing_active && !pause_mode)
     {
-        heating_was_on = false;
+        return target + cycle_engine_setpoint_offset(&cycle_engine);
     }
-
-    // Set heating power based on PID output and hysteresis state
-    if (heating_was_on)
+    if (is_keep_warm_active())
     {
-        heating_set_power((uint8_t)pid_output);
+        float keep_warm = target - settings.keep_warm_drop;
+        return (keep_warm > 0.0f) ? keep_warm : 0.0f;
     }
-    else
+    if (sp_runner_is_active(&setpoint_runner))
     {
-        heating_set_power(0);
+        return setpoint_runner.setpoint;
     }
+    return target + press_preboost;
 }
 
-// =============================================================================
-// PID Auto-Tune Functions
-// =============================================================================
+/**
+ * @brief Check if a ramp/soak setpoint profile is running
+ *
+ * @return true while a heat-up or resume profile is active
+ */
+bool is_setpoint_profile_active(void)
+{
+    return sp_runner_is_active(&setpoint_runner);
+}
 
 /**
- * @brief Start PID auto-tuning process
+ * @brief Start, stop and advance ramp/soak setpoint profiles
  *
- * Initializes and starts the PID auto-tuning procedure using the relay
- * feedback method. The system will oscillate around the target temperature
- * to determine optimal PID parameters.
+ * Called once per control period from the temperature control task, which
+ * owns the profile runner. Two profiles are used:
+ * - Heat-up: entering Heat Up mode ramps at settings.ramp_rate and soaks
+ *   settings.soak_time at target (both set by the material profile).
+ * - Resume: after a keep-warm pause, ramp back at PAUSE_RESUME_RAMP_RATE
+ *   and wait until the temperature is inside the ready band.
+ * A running cycle or pause always cancels the profile.
  *
- * @param target_temp Target temperature for auto-tuning
- * @return true if auto-tune started successfully, false otherwise
+ * @param in_heat_up_mode Whether the UI is in Heat Up mode
  */
-bool start_pid_autotune(float target_temp)
+static void update_setpoint_profile(bool in_heat_up_mode)
 {
-    // Safety checks before starting auto-tune
-    if (emergency_shutdown)
+    static bool was_in_heat_up_mode = false;
+    sp_profile_t profile;
+
+    if (pressing_active || pause_mode)
     {
-        ESP_LOGW(TAG, "Cannot start auto-tune: emergency shutdown active");
-        return false;
+        sp_runner_stop(&setpoint_runner);
     }
-
-    if (pressing_active)
+    else if (resume_profile_requested)
     {
-        ESP_LOGW(TAG, "Cannot start auto-tune: pressing cycle active");
-        return false;
+        resume_profile_requested = false;
+        sp_profile_clear(&profile);
+        sp_profile_add_ramp(&profile, 0.0f, PAUSE_RESUME_RAMP_RATE);
+        sp_profile_add_soak(&profile, 0.0f, 0, TEMP_HYSTERESIS);
+        sp_runner_start(&setpoint_runner, &profile, current_temperature);
+        setpoint_run_purpose = SP_RUN_RESUME;
+        integral_preload_pending = true;
     }
-
-    if (is_autotuning)
+    else if (in_heat_up_mode && (!was_in_heat_up_mode || heat_up_profile_restart))
     {
-        ESP_LOGW(TAG, "Auto-tune already in progress");
-        return false;
+        if (!was_in_heat_up_mode)
+        {
+            integral_preload_pending = true;
+        }
+        heat_up_profile_restart = false;
+        sp_profile_clear(&profile);
+        if (settings.ramp_rate > 0.0f)
+        {
+            sp_profile_add_ramp(&profile, 0.0f, settings.ramp_rate);
+        }
+        if (settings.soak_time > 0)
+        {
+            sp_profile_add_soak(&profile, 0.0f, settings.soak_time, TEMP_HYSTERESIS);
+        }
+        sp_runner_start(&setpoint_runner, &profile, current_temperature);
+        setpoint_run_purpose = SP_RUN_HEAT_UP;
     }
-
-    // Configure auto-tune with conservative settings for heat press
-    autotune_config_t config = {
-        .setpoint = target_temp,
-        .output_step = 50.0f,           // 50% power step for relay
-        .noise_band = 2.0f,             // 2°C noise band
-        .max_cycles = 5,                // Observe 5 oscillation cycles
-        .timeout_seconds = 1800,        // 30 minute timeout
-        .initial_output = 0.0f          // Start with heating off
-    };
-
-    // Initialize auto-tune context with Tyreus-Luyben rule (conservative, minimal overshoot)
-    pid_autotune_init(&g_autotune_ctx, config, TUNING_RULE_TYREUS_LUYBEN);
-
-    // Start auto-tune
-    if (!pid_autotune_start(&g_autotune_ctx))
+    else if (!in_heat_up_mode && setpoint_run_purpose == SP_RUN_HEAT_UP)
     {
-        ESP_LOGE(TAG, "Failed to start auto-tune");
-        return false;
+        // Heat Up mode was left before the profile finished
+        sp_runner_stop(&setpoint_runner);
     }
+    was_in_heat_up_mode = in_heat_up_mode;
 
-    is_autotuning = true;
-    ESP_LOGI(TAG, "PID auto-tune started with target temperature %.1f°C", target_temp);
-    ESP_LOGI(TAG, "Using Tyreus-Luyben tuning rule for minimal overshoot");
-
-    return true;
+    if (sp_runner_is_active(&setpoint_runner))
+    {
+        // Control period is 1 s
+        sp_runner_step(&setpoint_runner, get_active_target_temp(), current_temperature, 1.0f);
+    }
+    if (!sp_runner_is_active(&setpoint_runner))
+    {
+        setpoint_run_purpose = SP_RUN_NONE;
+    }
 }
 
 /**
- * @brief Cancel ongoing PID auto-tuning
+ * @brief Learn the full-power heating rate
  *
- * Safely cancels the auto-tuning process and returns to normal operation.
+ * Samples the temperature rise per control period while the heater runs
+ * at (nearly) full power and smooths it, so resume ETAs reflect this
+ * press rather than a fixed guess.
+ *
+ * @param output PID output applied this period (%)
  */
-void cancel_pid_autotune(void)
+static void update_heating_rate_estimate(float output)
 {
-    if (is_autotuning)
+    static float last_temp = 0.0f;
+    static bool last_full_power = false;
+
+    bool full_power = (output >= 90.0f);
+    if (full_power && last_full_power)
     {
-        is_autotuning = false;
-        heating_set_power(0);  // Turn off heating
-        ESP_LOGI(TAG, "PID auto-tune cancelled by user");
+        float rate = current_temperature - last_temp; // °C per 1 s period
+        if (rate > 0.0f)
+        {
+            heating_rate_estimate = (heating_rate_estimate > 0.0f) ?
+                                    0.9f * heating_rate_estimate + 0.1f * rate : rate;
+        }
     }
+    last_temp = current_temperature;
+    last_full_power = full_power;
 }
 
 /**
- * @brief Check if PID auto-tuning is in progress
+ * @brief Predict seconds until the press is ready again after unpause
  *
- * @return true if auto-tuning is active, false otherwise
+ * Uses the measured full-power heating rate (PAUSE_DEFAULT_HEATING_RATE
+ * until one is known), limited by the resume ramp rate.
+ *
+ * @return Estimated seconds to reach the ready band, 0 if already there
+ */
+uint32_t get_resume_ready_eta(void)
+{
+    float ready_temp = get_active_target_temp() - TEMP_HYSTERESIS;
+    if (current_temperature >= ready_temp)
+    {
+        return 0;
+    }
+
+    float rate = (heating_rate_estimate > 0.0f) ? heating_rate_estimate : PAUSE_DEFAULT_HEATING_RATE;
+    if (rate > PAUSE_RESUME_RAMP_RATE)
+    {
+        rate = PAUSE_RESUME_RAMP_RATE;
+    }
+    return (uint32_t)((ready_temp - current_temperature) / rate);
+}
+
+/**
+ * @brief Measure pressing cycles and adapt the PID gains between them
+ *
+ * Called once per control step. While a press is running, the tracking
+ * error is fed to the adaptive tuner; when a press completes normally the
+ * tuner may propose new gains (or roll back a trial), which are applied to
+ * the running controller bumplessly and saved. Aborted presses are not
+ * scored.
+ *
+ * The tuner's state is restored at boot (adaptive_tuning_load()), so the
+ * settings gains only differ from the tuner's after a manual edit or a
+ * relay autotune. That, and nothing else, re-anchors the bounds - even
+ * while adaptation is switched off, so it later starts from the
+ * operator's choice.
+ */
+static void update_adaptive_tuning(void)
+{
+    if (settings.pid_kp != g_adaptive.gains.kp ||
+        settings.pid_ki != g_adaptive.gains.ki ||
+        settings.pid_kd != g_adaptive.gains.kd)
+    {
+        pid_gains_t gains = {
+            .kp = settings.pid_kp,
+            .ki = settings.pid_ki,
+            .kd = settings.pid_kd};
+        pid_adaptive_init(&g_adaptive, gains);
+        adaptive_cycle_running = false;
+        adaptive_tuning_save();
+        ESP_LOGI(TAG, "Adaptive tuning anchored at Kp=%.3f Ki=%.4f Kd=%.3f",
+                 gains.kp, gains.ki, gains.kd);
+    }
+
+    if (!settings.adaptive_tuning)
+    {
+        adaptive_cycle_running = false;
+        return;
+    }
+
+    if (pressing_active)
+    {
+        if (!adaptive_cycle_running)
+        {
+            pid_adaptive_begin_cycle(&g_adaptive);
+            adaptive_cycle_running = true;
+        }
+        if (!pause_mode)
+        {
+            pid_adaptive_sample(&g_adaptive, get_control_setpoint(), current_temperature, 1.0f);
+        }
+        return;
+    }
+
+    if (!adaptive_cycle_running)
+    {
+        return;
+    }
+    adaptive_cycle_running = false;
+
+    if (current_cycle.status != COMPLETE)
+    {
+        ESP_LOGD(TAG, "Adaptive tuning: aborted cycle not scored");
+        return;
+    }
+
+    pid_gains_t new_gains;
+    uint8_t audit_head = g_adaptive.audit_head;
+    if (pid_adaptive_end_cycle(&g_adaptive, &new_gains))
+    {
+        settings.pid_kp = new_gains.kp;
+        settings.pid_ki = new_gains.ki;
+        settings.pid_kd = new_gains.kd;
+        settings_publish_change(SETTINGS_CHANGE_PID_GAINS);
+
+        // Settings first: a save cut short between the two leaves gains
+        // the record still bounds (see pid_adaptive_restore())
+        save_persistent_data();
+    }
+    if (g_adaptive.audit_head != audit_head)
+    {
+        adaptive_tuning_save();
+    }
+}
+
+/**
+ * @brief Resume adaptive tuning from its saved record
+ *
+ * Called once at startup, after the settings are loaded. Without a valid
+ * record (first start, or the record does not bound the loaded gains)
+ * adaptation is anchored at the settings gains.
+ */
+static void adaptive_tuning_load(void)
+{
+    pid_gains_t gains = {
+        .kp = settings.pid_kp,
+        .ki = settings.pid_ki,
+        .kd = settings.pid_kd};
+    adaptive_record_t record;
+
+    if (storage_load_adaptive_record(&record) == ESP_OK &&
+        pid_adaptive_restore(&g_adaptive, &record, gains))
+    {
+        return;
+    }
+
+    pid_adaptive_init(&g_adaptive, gains);
+    adaptive_tuning_save();
+    ESP_LOGI(TAG, "Adaptive tuning anchored at Kp=%.3f Ki=%.4f Kd=%.3f",
+             gains.kp, gains.ki, gains.kd);
+}
+
+/**
+ * @brief Save the adaptive tuning reference and audit trail
+ *
+ * Called whenever the audit log gains an entry, not per cycle, to spare
+ * the flash. Cycle counts after the last entry are lost on a reboot.
+ */
+static void adaptive_tuning_save(void)
+{
+    adaptive_record_t record;
+    pid_adaptive_export(&g_adaptive, &record);
+    if (storage_save_adaptive_record(&record) != ESP_OK)
+    {
+        ESP_LOGW(TAG, "Failed to save adaptive tuning record");
+    }
+}
+
+/**
+ * @brief Apply settings edits to the running controller
+ *
+ * Called at the start of every control step. The UI publishes typed
+ * change events after editing settings; here they reach the controller
+ * without re-initializing it:
+ * - target changes move the setpoint bumplessly (integral kept)
+ * - gain changes rescale the integral so the output does not jump
+ * - heat-up shape changes restart a running heat-up profile
+ * Stage timers are read when the next cycle starts. The NVS write is
+ * deferred until edits have been quiet for SETTINGS_SAVE_DELAY_SEC.
+ */
+static void apply_settings_changes(void)
+{
+    uint32_t changes = settings_consume_changes();
+
+    sync_cascade_mode();
+
+    if (changes & SETTINGS_CHANGE_TARGET)
+    {
+        sync_pid_setpoint();
+        ESP_LOGI(TAG, "Target change applied: control setpoint %.1f°C", applied_pid_setpoint);
+    }
+
+    if (changes & SETTINGS_CHANGE_PID_GAINS)
+    {
+        pid_set_gains(settings.pid_kp, settings.pid_ki, settings.pid_kd);
+        if (cascade_active)
+        {
+            pid_cascade_set_gains(&g_cascade, CASCADE_LOOP_OUTER, settings.outer_kp, settings.outer_ki, settings.outer_kd);
+            pid_cascade_set_gains(&g_cascade, CASCADE_LOOP_INNER, settings.inner_kp, settings.inner_ki, settings.inner_kd);
+        }
+    }
+
+    if ((changes & SETTINGS_CHANGE_HEAT_UP) && setpoint_run_purpose == SP_RUN_HEAT_UP)
+    {
+        heat_up_profile_restart = true;
+    }
+
+    if (settings_save_due())
+    {
+        save_persistent_data();
+    }
+}
+
+/**
+ * @brief Run the Smith predictor model
+ *
+ * Called every control step, heating or not, so the model and its delay
+ * line follow the real heater power. The model starts from the configured
+ * FOPDT parameters when the predictor is switched on, and is refined once
+ * per boot from a full-power heat-up that starts from a cold platen.
+ */
+static void update_smith_predictor(void)
+{
+    if (!settings.smith_enabled)
+    {
+        smith_running = false;
+        g_smith_ident.active = false;
+        return;
+    }
+
+    if (!smith_running)
+    {
+        fopdt_model_t model = {
+            .gain = SMITH_MODEL_GAIN,
+            .time_constant = SMITH_TIME_CONSTANT,
+            .dead_time = SMITH_DEAD_TIME};
+        pid_smith_init(&g_smith, model, 1.0f);
+        smith_running = true;
+    }
+
+    float power = heating_get_power();
+    pid_smith_step(&g_smith, current_temperature, power);
+
+    if (g_smith_ident.active)
+    {
+        smith_identify_sample(&g_smith_ident, current_temperature, power, 1.0f);
+        if (!g_smith_ident.active)
+        {
+            // Full power ended - use the response if enough of it was seen
+            fopdt_model_t model;
+            if (smith_identify_result(&g_smith_ident, SMITH_MODEL_GAIN, &model))
+            {
+                pid_smith_set_model(&g_smith, model);
+                smith_model_identified = true;
+                ESP_LOGI(TAG, "Smith model identified from heat-up: dead time %.0fs, tau %.0fs",
+                         model.dead_time, model.time_constant);
+            }
+        }
+    }
+    else if (!smith_model_identified && power >= 90.0f &&
+             current_temperature < SMITH_IDENT_MAX_START_TEMP)
+    {
+        smith_identify_begin(&g_smith_ident, current_temperature);
+    }
+}
+
+/**
+ * @brief Update the thermal load estimate
+ *
+ * Runs every control step whether or not load compensation is enabled,
+ * so the estimate is always available as a diagnostic. The heat balance
+ * uses the Smith predictor's configured dead time, so heater power changes
+ * are not booked as load. While a press is active the peak load is
+ * tracked; it is kept as the garment's load once the cycle completes.
+ */
+static void update_load_observer(void)
+{
+    if (!observer_running)
+    {
+        thermal_model_t model = {
+            .heater_watts = OBSERVER_HEATER_WATTS,
+            .capacity = OBSERVER_CAPACITY,
+            .loss_coefficient = OBSERVER_LOSS_COEFFICIENT,
+            .ambient = DEFAULT_TEMPERATURE,
+            .dead_time = SMITH_DEAD_TIME,
+            .observer_gain = OBSERVER_GAIN};
+        dob_init(&g_observer, model, 1.0f);
+        observer_running = true;
+    }
+
+    dob_update(&g_observer, current_temperature, heating_get_power());
+    float load = dob_get_load_watts(&g_observer);
+
+    if (pressing_active)
+    {
+        if (!observer_press_running)
+        {
+            press_peak_load = load;
+            observer_press_running = true;
+        }
+        else if (load > press_peak_load)
+        {
+            press_peak_load = load;
+        }
+        return;
+    }
+
+    if (observer_press_running)
+    {
+        observer_press_running = false;
+        if (current_cycle.status == COMPLETE)
+        {
+            last_press_load = press_peak_load;
+            set_station_press_load(press_peak_load);
+            ESP_LOGI(TAG, "Press load: peak %.0fW", last_press_load);
+        }
+    }
+}
+
+/**
+ * @brief Apply the holding power map to the controller
+ *
+ * Feeds the holding power for the control setpoint forward when enabled
+ * and, once after a mode entry, preloads the integral for it. Without a
+ * learned value the heat balance guess is only used when it is also fed
+ * forward, in which case the preload just clears the old integral.
+ */
+static void apply_power_feedforward(void)
+{
+    float hold_power;
+    bool learned = power_map_lookup(&settings.power_map, applied_pid_setpoint,
+                                    DEFAULT_TEMPERATURE, &hold_power);
+    float feedforward = settings.power_feedforward ? hold_power : 0.0f;
+
+    // Re-applied every step: controller re-initialization clears it
+    pid_set_feedforward(feedforward);
+    if (cascade_active)
+    {
+        pid_cascade_set_feedforward(&g_cascade, feedforward);
+    }
+
+    if (integral_preload_pending)
+    {
+        integral_preload_pending = false;
+        if (learned || settings.power_feedforward)
+        {
+            pid_preload(hold_power);
+            if (cascade_active)
+            {
+                pid_cascade_preload(&g_cascade, hold_power);
+            }
+            ESP_LOGI(TAG, "Integral preloaded for %.1f%% at %.1f°C (%s)",
+                     hold_power, applied_pid_setpoint, learned ? "learned" : "estimated");
+        }
+    }
+}
+
+/**
+ * @brief Learn holding power from settled periods
+ *
+ * Averages the applied heater power while the temperature stays within
+ * POWER_MAP_SETTLE_BAND of an unchanged setpoint with no press closed,
+ * and learns one map update every POWER_MAP_SETTLE_TIME_SEC. The map is
+ * saved with the next deferred settings write.
+ *
+ * @param controlling The controller drove the heater this step
+ */
+static void update_power_map(bool controlling)
+{
+    float setpoint = applied_pid_setpoint;
+    bool settled = controlling && !pressing_active &&
+                   setpoint == settle_setpoint &&
+                   fabsf(current_temperature - setpoint) <= POWER_MAP_SETTLE_BAND;
+
+    if (!settled)
+    {
+        settle_setpoint = setpoint;
+        settle_power_sum = 0.0f;
+        settle_seconds = 0;
+        return;
+    }
+
+    // Control period is 1 s
+    settle_power_sum += heating_get_power();
+    settle_seconds++;
+    if (settle_seconds >= POWER_MAP_SETTLE_TIME_SEC)
+    {
+        power_map_learn(&settings.power_map, setpoint, DEFAULT_TEMPERATURE,
+                        settle_power_sum / settle_seconds);
+        settings_publish_change(SETTINGS_CHANGE_LEARNED);
+        settle_power_sum = 0.0f;
+        settle_seconds = 0;
+    }
+}
+
+/**
+ * @brief Boost the setpoint ahead of the predicted press close
+ *
+ * Replays the reed switch events recorded by the UI task into the press
+ * predictor, then takes its boost while the press is open between
+ * cycles. The boost also keeps the controller running in that gap.
+ *
+ * @param now Current time (s)
+ */
+static void update_press_preboost(uint32_t now)
+{
+    static uint32_t seen_open_time = 0;
+    static uint32_t seen_close_time = 0;
+
+    if (press_predictor_reset_requested)
+    {
+        press_predictor_reset_requested = false;
+        press_predictor_reset(&g_press_predictor);
+        ESP_LOGI(TAG, "New job: press rhythm reset");
+    }
+
+    uint32_t open_time = press_opened_time;
+    uint32_t close_time = press_closed_time;
+    bool opened = (open_time != seen_open_time);
+    bool closed = (close_time != seen_close_time);
+    seen_open_time = open_time;
+    seen_close_time = close_time;
+
+    // Both since the last step: replay them in the order they happened
+    if (opened && closed && close_time < open_time)
+    {
+        press_predictor_on_close(&g_press_predictor, close_time);
+        press_predictor_on_open(&g_press_predictor, open_time);
+    }
+    else
+    {
+        if (opened)
+        {
+            press_predictor_on_open(&g_press_predictor, open_time);
+        }
+        if (closed)
+        {
+            press_predictor_on_close(&g_press_predictor, close_time);
+        }
+    }
+
+    bool allowed = settings.press_preboost && !pressing_active && !pause_mode &&
+                   target_temp_reached_once;
+    press_preboost = allowed ? press_predictor_boost(&g_press_predictor, now) : 0.0f;
+}
+
+/**
+ * @brief Predict whether the next stage 1 stays in tolerance
+ *
+ * Tracks the reading slope and runs the ready gate for the active side's
+ * stage 1 dwell. Needs a measured press load, so the first press of a
+ * session always waits for the reading itself.
+ */
+static void update_ready_prediction(void)
+{
+    static float last_temperature = 0.0f;
+    static bool have_last = false;
+
+    // Control period is 1 s
+    if (have_last)
+    {
+        float delta = current_temperature - last_temperature;
+        reading_slope += (delta - reading_slope) / READY_GATE_SLOPE_WINDOW;
+    }
+    last_temperature = current_temperature;
+    have_last = true;
+
+    float target = get_active_target_temp();
+    if (!READY_GATE_ENABLED || pressing_active || last_press_load <= 0.0f ||
+        current_temperature < target - TEMP_HYSTERESIS - READY_GATE_MAX_DEFICIT)
+    {
+        ready_predicted = false;
+        return;
+    }
+
+    // The gate covers the first stage of the next cycle
+    cycle_definition_t definition;
+    build_cycle_definition(get_active_side(), &definition);
+    const cycle_stage_t first_stage = definition.stages[0];
+    target += first_stage.setpoint_offset;
+
+    float hold_power;
+    power_map_lookup(&settings.power_map, target, DEFAULT_TEMPERATURE, &hold_power);
+
+    ready_gate_input_t input = {
+        .temperature = current_temperature,
+        .slope = reading_slope,
+        .hold_power = hold_power,
+        .kp = settings.pid_kp,
+        .load_watts = last_press_load,
+        .target = target,
+        .tolerance = TEMP_HYSTERESIS,
+        .dwell = first_stage.duration};
+    ready_gate_result_t result;
+
+    bool predicted = ready_gate_predict(&input, &result) && result.ready;
+    if (predicted != ready_predicted)
+    {
+        ESP_LOGI(TAG, "Ready gate: stage 1 predicted %.1f-%.1f°C at %.1f°C (%.2f°C/s) - %s",
+                 result.min_temp, result.max_temp, current_temperature, reading_slope,
+                 predicted ? "ready" : "not ready");
+    }
+    ready_predicted = predicted;
+}
+
+float get_estimated_load_watts(void)
+{
+    return observer_running ? dob_get_load_watts(&g_observer) : 0.0f;
+}
+
+float get_last_press_load_watts(void)
+{
+    return last_press_load;
+}
+
+// =============================================================================
+// Scheduled Pre-heat
+// =============================================================================
+
+static void save_preheat_schedule(void)
+{
+    if (storage_save_preheat_schedule(&preheat_schedule) != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Pre-heat schedule not saved");
+    }
+}
+
+static void preheat_init(void)
+{
+    if (storage_load_preheat_schedule(&preheat_schedule) != ESP_OK ||
+        !preheat_schedule_validate(&preheat_schedule))
+    {
+        preheat_schedule_init(&preheat_schedule);
+    }
+
+    int64_t utc = (int64_t)time(NULL);
+    int64_t ready;
+    if (!preheat_clock_valid(utc))
+    {
+        ESP_LOGI(TAG, "Wall clock not set - scheduled pre-heat waits for CLOCK from the host");
+    }
+    else if (preheat_next_ready(&preheat_schedule, utc, &ready))
+    {
+        ESP_LOGI(TAG, "Next scheduled ready time in %lld min", (long long)((ready - utc) / 60));
+    }
+}
+
+/**
+ * @brief Learn heat-up time per °C from heat-ups that start cold
+ *
+ * Any heat-up counts, scheduled or from the Heat Up menu. The measurement
+ * is dropped if the operator leaves the screen or heating is switched off
+ * before the press is ready.
+ */
+static void update_warmup_learning(uint32_t now, ui_state_t state)
+{
+    if (state != UI_STATE_HEAT_UP || !heating_is_active())
+    {
+        warmup_start_time = 0;
+        return;
+    }
+
+    if (warmup_start_time == 0)
+    {
+        if (current_temperature < settings.target_temp - PREHEAT_MIN_LEARN_RISE)
+        {
+            warmup_start_time = now;
+            warmup_start_temp = current_temperature;
+        }
+        return;
+    }
+
+    if (is_heat_press_ready())
+    {
+        float rise = current_temperature - warmup_start_temp;
+        uint32_t seconds = now - warmup_start_time;
+        warmup_start_time = 0;
+        if (rise >= PREHEAT_MIN_LEARN_RISE)
+        {
+            preheat_learn(&preheat_schedule, seconds, rise, PREHEAT_LEARN_WEIGHT);
+            save_preheat_schedule();
+            ESP_LOGI(TAG, "Heat-up learned: %.0f°C in %lus, now %.1f s/°C",
+                     rise, seconds, preheat_schedule.warmup_sec_per_degree);
+        }
+    }
+}
+
+/**
+ * @brief Heat-up time per °C before one has been learned
+ *
+ * This boot's average warm-up if there is one, otherwise the configured
+ * default heating rate.
+ */
+static float fallback_warmup_rate(void)
+{
+    float rise = settings.target_temp - DEFAULT_TEMPERATURE;
+
+    stats_lock();
+    float avg_warmup = (statistics.warmup_count > 0) ? statistics.avg_warmup_time : 0.0f;
+    stats_unlock();
+
+    if (avg_warmup > 0.0f && rise > 0.0f)
+    {
+        return avg_warmup / rise;
+    }
+    return 1.0f / PAUSE_DEFAULT_HEATING_RATE;
+}
+
+/**
+ * @brief Start heating early enough to be ready at the scheduled time
+ *
+ * Called from the UI task. A pre-heat is an ordinary Heat Up started by
+ * the firmware, so heating stays under the same safety checks. It only
+ * starts from the main menu (nobody is using the press) with the heating
+ * switch on, no fault and no pause; otherwise it keeps trying until the
+ * ready time. If the Heat Up screen is still untouched PREHEAT_ABANDON_SEC
+ * after the ready time, heating stops.
+ */
+static void update_preheat(uint32_t now)
+{
+    static uint32_t last_check = 0;
+    if (now == last_check)
+    {
+        return;
+    }
+    last_check = now;
+
+    ui_state_t state = ui_get_current_state();
+    update_warmup_learning(now, state);
+
+    int64_t utc = (int64_t)time(NULL);
+    if (preheat_ready_utc != 0)
+    {
+        if (state != UI_STATE_HEAT_UP)
+        {
+            ESP_LOGI(TAG, "Pre-heat handed over to the operator");
+            preheat_ready_utc = 0;
+        }
+        else if (utc > preheat_ready_utc + PREHEAT_ABANDON_SEC)
+        {
+            ESP_LOGW(TAG, "Nobody came to the pre-heated press - heating off");
+            ui_set_state(UI_STATE_MAIN_MENU);
+            preheat_ready_utc = 0;
+        }
+        return;
+    }
+
+    int64_t ready;
+    if (!preheat_clock_valid(utc) || !preheat_next_ready(&preheat_schedule, utc, &ready) ||
+        ready == preheat_handled_utc)
+    {
+        return;
+    }
+
+    uint32_t lead = preheat_lead_seconds(&preheat_schedule, current_temperature, settings.target_temp,
+                                         fallback_warmup_rate(), PREHEAT_MARGIN_SEC);
+    if (utc + lead < ready)
+    {
+        return;
+    }
+
+    bool interlocks_ok = state == UI_STATE_MAIN_MENU && controls_is_heating_switch_on() &&
+                         check_system_safety() && system_healthy && !pause_mode;
+    if (!interlocks_ok)
+    {
+        if (preheat_blocked_utc != ready)
+        {
+            preheat_blocked_utc = ready;
+            ESP_LOGW(TAG, "Pre-heat due but held off (screen %d, heating switch %s, safety %s, pause %d)",
+                     state, controls_is_heating_switch_on() ? "on" : "off",
+                     check_system_safety() ? "ok" : "fault", pause_mode);
+        }
+        return;
+    }
+
+    preheat_handled_utc = ready;
+    preheat_ready_utc = ready;
+    ui_enter_heat_up();
+    ESP_LOGI(TAG, "Scheduled pre-heat started, %lld s before ready time (lead %lu s)",
+             (long long)(ready - utc), lead);
+}
+
+void set_wall_clock(int64_t utc, int16_t utc_offset_min)
+{
+    struct timeval clock = {.tv_sec = (time_t)utc, .tv_usec = 0};
+    settimeofday(&clock, NULL);
+    preheat_schedule.utc_offset_min = utc_offset_min;
+    save_preheat_schedule();
+    ESP_LOGI(TAG, "Wall clock set (UTC%+d min)", utc_offset_min);
+}
+
+int16_t get_utc_offset(void)
+{
+    return preheat_schedule.utc_offset_min;
+}
+
+void set_preheat_ready_time(uint8_t weekday, uint16_t ready_minute)
+{
+    if (weekday >= PREHEAT_DAYS)
+    {
+        return;
+    }
+    preheat_schedule.ready_minute[weekday] = ready_minute;
+    save_preheat_schedule();
+}
+
+uint16_t get_preheat_ready_time(uint8_t weekday)
+{
+    return (weekday < PREHEAT_DAYS) ? preheat_schedule.ready_minute[weekday] : PREHEAT_DAY_OFF;
+}
+
+bool get_scheduled_preheat(uint16_t *ready_minute)
+{
+    if (preheat_ready_utc == 0)
+    {
+        return false;
+    }
+    if (ready_minute != NULL)
+    {
+        preheat_local_time(&preheat_schedule, preheat_ready_utc, NULL, ready_minute);
+    }
+    return true;
+}
+
+// =============================================================================
+// Surface Calibration
+// =============================================================================
+
+static void log_surface_calibration(const surface_calibration_t *calibration)
+{
+    if (calibration->count == 0)
+    {
+        ESP_LOGI(TAG, "Surface calibration: none, readings used as measured");
+        return;
+    }
+
+    ESP_LOGI(TAG, "Surface calibration (day %lu): as found %.1f°C, interpolation %.1f°C",
+             calibration->day, calibration->as_found_max, calibration->interpolation_max);
+    for (uint8_t i = 0; i < calibration->count; i++)
+    {
+        const surface_cal_point_t *point = &calibration->points[i];
+        ESP_LOGI(TAG, "  %.1f°C reads %.1f°C on the surface (%+.1f, as found %+.1f)",
+                 point->sensor_celsius, point->surface_celsius,
+                 point->surface_celsius - point->sensor_celsius, point->as_found);
+    }
+}
+
+static void surface_cal_load(void)
+{
+    if (storage_load_surface_calibration(&surface_cal) != ESP_OK || !surface_cal_validate(&surface_cal))
+    {
+        surface_cal_clear(&surface_cal);
+    }
+    log_surface_calibration(&surface_cal);
+}
+
+/**
+ * @brief Correct a reading to the platen surface temperature
+ *
+ * Called by read_temperature_safe() for every reading. While the
+ * procedure runs readings are passed through uncorrected, since the new
+ * table is built from them.
+ */
+static float correct_surface_temperature(float reading)
+{
+    stats_lock();
+    float corrected = surface_cal_run.active ? reading : surface_cal_apply(&surface_cal, reading);
+    stats_unlock();
+    return corrected;
+}
+
+static bool is_surface_cal_holding(void)
+{
+    return surface_cal_run.active && surface_cal_run.point < surface_cal_run.points;
+}
+
+/**
+ * @brief Start waiting for the reading to settle again (statistics_mutex held)
+ */
+static void restart_surface_cal_settling(void)
+{
+    surface_cal_run.settled = false;
+    surface_cal_run.settle_remaining = SURFACE_CAL_SETTLE_SEC;
+    surface_cal_reading_sum = 0.0f;
+    surface_cal_reading_count = 0;
+}
+
+/**
+ * @brief Track settling at the calibration setpoint
+ *
+ * The reading has to stay within SURFACE_CAL_SETTLE_BAND of the setpoint
+ * for SURFACE_CAL_SETTLE_SEC, since the surface lags the thermocouple.
+ * From then on the readings are averaged until the probe reading is
+ * entered. Called once per second by the temperature control task.
+ */
+static void update_surface_calibration(void)
+{
+    stats_lock();
+    if (is_surface_cal_holding())
+    {
+        if (fabsf(current_temperature - surface_cal_run.setpoint) > SURFACE_CAL_SETTLE_BAND)
+        {
+            restart_surface_cal_settling();
+        }
+        else if (surface_cal_run.settle_remaining > 0)
+        {
+            surface_cal_run.settle_remaining--;
+        }
+        else if (surface_cal_reading_count < UINT16_MAX)
+        {
+            surface_cal_reading_sum += current_temperature;
+            surface_cal_reading_count++;
+            surface_cal_run.reading = surface_cal_reading_sum / surface_cal_reading_count;
+            surface_cal_run.settled = true;
+        }
+    }
+    stats_unlock();
+}
+
+bool start_surface_calibration(void)
+{
+    if (pressing_active || is_autotuning || emergency_shutdown)
+    {
+        ESP_LOGW(TAG, "Surface calibration not started: press busy");
+        return false;
+    }
+
+    stats_lock();
+    memset(&surface_cal_run, 0, sizeof(surface_cal_run));
+    surface_cal_clear(&surface_cal_new);
+    surface_cal_run.active = true;
+    surface_cal_run.points = (SURFACE_CAL_SETPOINT_COUNT < SURFACE_CAL_POINTS) ?
+                             SURFACE_CAL_SETPOINT_COUNT : SURFACE_CAL_POINTS;
+    surface_cal_run.setpoint = SURFACE_CAL_FIRST_SETPOINT;
+    restart_surface_cal_settling();
+    stats_unlock();
+
+    ESP_LOGI(TAG, "Surface calibration started: %u setpoints from %.0f°C",
+             surface_cal_run.points, SURFACE_CAL_FIRST_SETPOINT);
+    return true;
+}
+
+void cancel_surface_calibration(void)
+{
+    stats_lock();
+    bool was_active = surface_cal_run.active;
+    memset(&surface_cal_run, 0, sizeof(surface_cal_run));
+    stats_unlock();
+
+    if (was_active)
+    {
+        ESP_LOGI(TAG, "Surface calibration abandoned, previous table kept");
+    }
+}
+
+bool get_surface_cal_status(surface_cal_status_t *status)
+{
+    if (status == NULL)
+    {
+        return false;
+    }
+
+    stats_lock();
+    *status = surface_cal_run;
+    stats_unlock();
+    return true;
+}
+
+bool record_surface_cal_point(float probe_celsius)
+{
+    stats_lock();
+    float reading = surface_cal_run.reading;
+    uint8_t point = surface_cal_run.point;
+    bool accepted = is_surface_cal_holding() && surface_cal_run.settled &&
+                    fabsf(probe_celsius - reading) <= SURFACE_CAL_MAX_CORRECTION &&
+                    surface_cal_add_point(&surface_cal_new, &surface_cal, reading, probe_celsius);
+    if (accepted)
+    {
+        // Keep the residuals current for the results screen
+        surface_cal_finish(&surface_cal_new, 0);
+        surface_cal_run.as_found_max = surface_cal_new.as_found_max;
+        surface_cal_run.interpolation_max = surface_cal_new.interpolation_max;
+
+        surface_cal_run.point++;
+        surface_cal_run.setpoint += SURFACE_CAL_SETPOINT_STEP;
+        restart_surface_cal_settling();
+    }
+    stats_unlock();
+
+    if (!accepted)
+    {
+        ESP_LOGW(TAG, "Surface calibration point rejected: probe %.1f°C, reading %.1f°C", probe_celsius, reading);
+        return false;
+    }
+    ESP_LOGI(TAG, "Surface calibration point %u: reading %.1f°C, probe %.1f°C", point + 1, reading, probe_celsius);
+    return true;
+}
+
+bool finish_surface_calibration(void)
+{
+    int64_t utc = (int64_t)time(NULL);
+    uint32_t day = preheat_clock_valid(utc) ? (uint32_t)(utc / PREHEAT_SECONDS_PER_DAY) : 0;
+
+    stats_lock();
+    bool complete = surface_cal_run.active && surface_cal_new.count > 0;
+    if (complete)
+    {
+        surface_cal_finish(&surface_cal_new, day);
+        surface_cal = surface_cal_new;
+        memset(&surface_cal_run, 0, sizeof(surface_cal_run));
+    }
+    surface_calibration_t calibration = surface_cal;
+    stats_unlock();
+
+    if (!complete)
+    {
+        return false;
+    }
+
+    if (storage_save_surface_calibration(&calibration) != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Surface calibration not saved, in force until restart");
+    }
+    log_surface_calibration(&calibration);
+    return true;
+}
+
+bool get_surface_calibration(surface_calibration_t *calibration)
+{
+    if (calibration == NULL)
+    {
+        return false;
+    }
+
+    stats_lock();
+    *calibration = surface_cal;
+    stats_unlock();
+    return true;
+}
+
+void clear_surface_calibration(void)
+{
+    stats_lock();
+    surface_cal_clear(&surface_cal);
+    surface_calibration_t calibration = surface_cal;
+    stats_unlock();
+
+    storage_save_surface_calibration(&calibration);
+    ESP_LOGI(TAG, "Surface calibration cleared, readings used as measured");
+}
+
+// =============================================================================
+// Shuttle Press Stations
+// =============================================================================
+
+/**
+ * @brief Follow the platen to another station
+ *
+ * Each station has its own lower platen and pad, so the ready gate uses
+ * the last press load measured on the station under the platen.
+ */
+static void update_platen_station(void)
+{
+    static uint8_t last_station = 0;
+
+    uint8_t station = get_platen_station();
+    if (station == last_station)
+    {
+        return;
+    }
+
+    last_station = station;
+    if (get_station_press_load(station) > 0.0f)
+    {
+        last_press_load = get_station_press_load(station);
+    }
+    ESP_LOGI(TAG, "Controller following station %c (last press load %.0fW)", 'A' + station, last_press_load);
+}
+
+/**
+ * @brief Push the control setpoint to the PID controller
+ *
+ * Called from the temperature control task before each PID update so the
+ * controller follows front/back side, keep-warm and resume ramp changes
+ * without being re-initialized.
+ */
+static void sync_pid_setpoint(void)
+{
+    float target = get_control_setpoint();
+    if (target != applied_pid_setpoint)
+    {
+        pid_set_setpoint(target);
+        if (cascade_active)
+        {
+            pid_cascade_set_setpoint(&g_cascade, target);
+        }
+        applied_pid_setpoint = target;
+    }
+}
+
+/**
+ * @brief Switch between single-loop and cascade control
+ *
+ * Follows settings.cascade_enabled. The cascade starts fresh (core
+ * estimate seeded from the surface) each time it is switched on, using
+ * outer_k* for the surface loop and inner_k* for the heater core loop. Not
+ * switched while auto-tune is running.
+ */
+static void sync_cascade_mode(void)
+{
+    if (is_autotuning || settings.cascade_enabled == cascade_active)
+    {
+        return;
+    }
+
+    if (settings.cascade_enabled)
+    {
+        pid_config_t outer_config = {
+            .kp = settings.outer_kp,
+            .ki = settings.outer_ki,
+            .kd = settings.outer_kd,
+            .setpoint = applied_pid_setpoint};
+        pid_config_t inner_config = {
+            .kp = settings.inner_kp,
+            .ki = settings.inner_ki,
+            .kd = settings.inner_kd};
+        pid_cascade_init(&g_cascade, outer_config, inner_config);
+        ESP_LOGI(TAG, "Cascade control enabled");
+    }
+    else
+    {
+        ESP_LOGI(TAG, "Cascade control disabled, single loop in use");
+    }
+    cascade_active = settings.cascade_enabled;
+}
+
+/**
+ * @brief Classify what the press is doing right now
+ *
+ * Faults take precedence over pause, pause over pressing. When idle, time
+ * before the first time at temperature since boot is heating up; later time
+ * off temperature is waiting for temperature (recovery after a press,
+ * setpoint change, heating switched off).
+ *
+ * @return Time category for the current second
+ */
+static time_category_t classify_session_time(void)
+{
+    if (emergency_shutdown || !system_healthy)
+    {
+        return TIME_FAULT;
+    }
+    if (pause_mode)
+    {
+        return TIME_PAUSED;
+    }
+    if (pressing_active)
+    {
+        return TIME_PRESSING;
+    }
+    if (!target_temp_reached_once)
+    {
+        return TIME_HEATING_UP;
+    }
+    if (!is_heat_press_ready())
+    {
+        return TIME_WAITING_TEMP;
+    }
+    return TIME_READY_IDLE;
+}
+
+/**
+ * @brief Map a session time category onto the pacing categories
+ *
+ * Within a cycle only a running stage is press time; the press standing
+ * open between stages waits on the operator.
+ */
+static pace_category_t classify_pace_time(time_category_t category)
+{
+    switch (category)
+    {
+    case TIME_PRESSING:
+        return (cycle_engine.phase == CYCLE_PHASE_RUNNING) ? PACE_PRESSING : PACE_HANDLING;
+    case TIME_READY_IDLE:
+        return PACE_HANDLING;
+    case TIME_WAITING_TEMP:
+        return PACE_RECOVERY;
+    default:
+        return PACE_OFF;
+    }
+}
+
+/**
+ * @brief Account time elapsed since the last call
+ *
+ * Called once per control loop iteration. The whole interval is booked to
+ * the category the press is in now, so a late loop iteration loses no time.
+ * Also keeps the legacy operating/idle totals in statistics_t current and
+ * feeds the rolling throughput ring.
+ *
+ * @param now Current time in seconds since boot
+ */
+static void update_session_accounting(uint32_t now)
+{
+    if (now <= last_accounting_time)
+    {
+        return;
+    }
+
+    uint32_t elapsed = now - last_accounting_time;
+    last_accounting_time = now;
+    time_category_t category = classify_session_time();
+
+    stats_lock();
+    session_tally_add_time(&session_tally, category, elapsed);
+    session_tally_add_time(&shift_tally, category, elapsed);
+    throughput_add_time(&g_throughput, now, classify_pace_time(category), elapsed);
+    statistics.total_operating_time = session_tally_total_seconds(&session_tally);
+    statistics.total_idle_time = session_tally.seconds[TIME_READY_IDLE];
+    stats_unlock();
+}
+
+/**
+ * @brief Copy the current session and shift tallies
+ *
+ * @param session Destination for the session tally (may be NULL)
+ * @param shift Destination for the shift tally (may be NULL)
+ */
+void get_session_report(session_tally_t *session, session_tally_t *shift)
+{
+    stats_lock();
+    if (session != NULL)
+    {
+        *session = session_tally;
+    }
+    if (shift != NULL)
+    {
+        *shift = shift_tally;
+    }
+    stats_unlock();
+}
+
+/**
+ * @brief Stage time of a cycle definition (s)
+ */
+static uint16_t cycle_definition_seconds(const cycle_definition_t *definition)
+{
+    uint32_t total = 0;
+    for (uint8_t i = 0; i < definition->stage_count; i++)
+    {
+        total += definition->stages[i].duration;
+    }
+    return (total > UINT16_MAX) ? UINT16_MAX : (uint16_t)total;
+}
+
+/**
+ * @brief Pace over the last minutes against the active job
+ *
+ * The plan is the selected program's stage time plus PACING_HANDLING_SEC
+ * per press. A double-sided job takes two presses per shirt, planned at
+ * the average of its front and back cycles. On a shuttle press the
+ * operator loads one station while the other presses, so per press the
+ * longer of the two counts instead of their sum.
+ *
+ * @param minutes Window length (minutes)
+ * @param[out] status Window figures and limit
+ * @return false if status is NULL
+ */
+bool get_pace_status(uint8_t minutes, pace_status_t *status)
+{
+    if (!status)
+    {
+        return false;
+    }
+
+    cycle_definition_t definition;
+    pace_plan_t plan = {
+        .handling_sec = PACING_HANDLING_SEC,
+        .presses_per_shirt = 1,
+        .overlapped = SHUTTLE_ENABLED};
+
+    if (!ui_is_free_press_mode() && print_run.type == DOUBLE_SIDED)
+    {
+        build_cycle_definition(FRONT, &definition);
+        uint32_t front = cycle_definition_seconds(&definition);
+        build_cycle_definition(BACK, &definition);
+        uint32_t back = cycle_definition_seconds(&definition);
+        plan.press_sec = (uint16_t)((front + back + 1) / 2);
+        plan.presses_per_shirt = 2;
+    }
+    else
+    {
+        build_cycle_definition(get_active_side(), &definition);
+        plan.press_sec = cycle_definition_seconds(&definition);
+    }
+
+    uint32_t now = esp_timer_get_time() / 1000000;
+    stats_lock();
+    throughput_pace(&g_throughput, now, minutes, &plan, status);
+    stats_unlock();
+    return true;
+}
+
+/**
+ * @brief Dump the shift and session reports to the console
+ */
+void log_session_report(void)
+{
+    session_tally_t session;
+    session_tally_t shift;
+    get_session_report(&session, &shift);
+
+    session_tally_log("Shift", &shift);
+    session_tally_log("Session", &session);
+}
+
+/**
+ * @brief End the current shift and start a new one
+ *
+ * The finished shift is dumped to the console before it is cleared.
+ * Session totals are not affected.
+ */
+void start_new_shift(void)
+{
+    session_tally_t finished;
+    uint32_t now = esp_timer_get_time() / 1000000;
+
+    stats_lock();
+    finished = shift_tally;
+    session_tally_reset(&shift_tally, now);
+    stats_unlock();
+
+    session_tally_log("Shift (ended)", &finished);
+    ESP_LOGI(TAG, "New shift started");
+}
+
+/**
+ * @brief Update LED indicators based on system state
+ *
+ * Controls the green LED (temperature ready) and blue LED (pause mode)
+ * according to current system conditions.
+ */
+void update_led_indicators(void)
+{
+    // Green LED: Temperature is within range of target (ready for pressing)
+    float target = get_active_target_temp();
+    bool temp_ready = (current_temperature >= (target - 5.0f)) &&
+                      (current_temperature <= (target + 5.0f)) &&
+                      !emergency_shutdown;
+    controls_set_led_green(temp_ready);
+
+    // Track time to reach target temperature for the first time (for PID debugging)
+    if (!target_temp_reached && temp_ready && system_start_time > 0)
+    {
+        uint32_t current_time = esp_timer_get_time() / 1000000;
+        time_to_target_temp = current_time - system_start_time;
+        target_temp_reached = true;
+
+        // Update warmup statistics (thread-safe)
+        stats_lock();
+        statistics.total_warmup_time += time_to_target_temp;
+        statistics.warmup_count++;
+        statistics.avg_warmup_time = (float)statistics.total_warmup_time / statistics.warmup_count;
+        float avg_warmup = statistics.avg_warmup_time; // Copy for logging
+        stats_unlock();
+
+        ESP_LOGI(TAG, "Target temperature reached in %lu seconds (avg: %.1fs)",
+                 time_to_target_temp, avg_warmup);
+    }
+
+    // Set target_temp_reached_once flag when temperature reaches target for the first time
+    // This flag persists throughout the session (doesn't reset if temperature drops)
+    // Reset if profile target temperature has changed since last time
+    if (temp_ready)
+    {
+        // Check if profile target temperature has changed
+        if (target_temp_reached_once && settings.target_temp != profile_target_temp_when_reached)
+        {
+            target_temp_reached_once = false;
+            profile_target_temp_when_reached = 0.0f;
+            ESP_LOGI(TAG, "Profile target temp changed (%.1f -> %.1f) - resetting heat press ready state",
+                     profile_target_temp_when_reached, settings.target_temp);
+        }
+
+        // Set flag when reaching target for the first time (or after profile change)
+        if (!target_temp_reached_once)
+        {
+            target_temp_reached_once = true;
+            profile_target_temp_when_reached = settings.target_temp;
+            ESP_LOGI(TAG, "Heat press ready state: target temperature %.1f°C reached for first time",
+                     settings.target_temp);
+        }
+    }
+
+    // Blue LED: System is in pause mode
+    controls_set_led_blue(pause_mode);
+}
+
+/**
+ * @brief Handle pause button press
+ *
+ * Toggles pause mode when the pause button is pressed.
+ * Pause mode prevents new cycles from starting. With a keep-warm drop
+ * configured and the press already heating, the controller holds a
+ * reduced setpoint while paused and ramps back to target on unpause;
+ * otherwise heating is disabled.
+ */
+void handle_pause_button(void)
+{
+    // The UI task polls the buttons and hands pause presses over
+    if (ui_consume_pause_request())
+    {
+        pause_mode = !pause_mode;
+        if (pause_mode)
+        {
+            resume_profile_requested = false;
+            pause_keep_warm = target_temp_reached_once || heating_get_power() > 0 ||
+                              ui_get_current_state() == UI_STATE_HEAT_UP;
+            if (is_keep_warm_active())
+            {
+                ESP_LOGI(TAG, "Pause mode activated - keeping warm at %.1f°C",
+                         get_control_setpoint());
+            }
+            else
+            {
+                ESP_LOGI(TAG, "Pause mode activated");
+                // Turn off heating when paused
+                heating_set_power(0);
+            }
+            if (!pressing_active)
+            {
+                ui_show_pause_screen(true);
+            }
+        }
+        else
+        {
+            // Ramp back from wherever the temperature is now
+            if (settings.keep_warm_drop > 0.0f && target_temp_reached_once)
+            {
+                resume_profile_requested = true;
+            }
+            ESP_LOGI(TAG, "Pause mode deactivated - ready in ~%lu s", get_resume_ready_eta());
+            ui_show_pause_screen(false);
+        }
+    }
+}
+
+/**
+ * @brief Control heating with hysteresis logic
+ *
+ * Applies hysteresis to PID output to prevent rapid on/off cycling
+ * near the setpoint temperature.
+ *
+ * @param pid_output PID controller output (0-100%)
+ */
+void control_heating_with_hysteresis(float pid_output)
+{
+    float target = get_active_target_temp();
+
+    // Turn heating ON when temperature is below (target - hysteresis)
+    if (!heating_was_on && current_temperature < (target - TEMP_HYSTERESIS))
+    {
+        heating_was_on = true;
+    }
+    // Turn heating OFF when temperature is above (target + hysteresis)
+    else if (heating_was_on && current_temperature > (target + TEMP_HYSTERESIS))
+    {
+        heating_was_on = false;
+    }
+
+    // Set heating power based on PID output and hysteresis state
+    if (heating_was_on)
+    {
+        heating_set_power((uint8_t)pid_output);
+    }
+    else
+    {
+        heating_set_power(0);
+    }
+}
+
+// =============================================================================
+// PID Auto-Tune Functions
+// =============================================================================
+
+/**
+ * @brief Start PID auto-tuning process
+ *
+ * Initializes and starts the PID auto-tuning procedure using the relay
+ * feedback method. The system will oscillate around the target temperature
+ * to determine optimal PID parameters.
+ *
+ * @param target_temp Target temperature for auto-tuning
+ * @return true if auto-tune started successfully, false otherwise
+ */
+bool start_pid_autotune(float target_temp)
+{
+    // Safety checks before starting auto-tune
+    if (emergency_shutdown)
+    {
+        ESP_LOGW(TAG, "Cannot start auto-tune: emergency shutdown active");
+        return false;
+    }
+
+    if (pressing_active)
+    {
+        ESP_LOGW(TAG, "Cannot start auto-tune: pressing cycle active");
+        return false;
+    }
+
+    if (is_autotuning)
+    {
+        ESP_LOGW(TAG, "Auto-tune already in progress");
+        return false;
+    }
+
+    // Configure auto-tune with conservative settings for heat press
+    autotune_config_t config = {
+        .setpoint = target_temp,
+        .output_step = 50.0f,           // 50% power step for relay
+        .noise_band = 2.0f,             // 2°C noise band
+        .max_cycles = 5,                // Observe 5 oscillation cycles
+        .timeout_seconds = 1800,        // 30 minute timeout
+        .initial_output = 0.0f,         // Start with heating off
+        .select_rule = true             // Simulate every rule on the fitted model, apply the best
+    };
+
+    // Cascade: tune the heater core loop first, then the surface loop
+    autotune_cascade = cascade_active;
+    autotune_loop = CASCADE_LOOP_INNER;
+    autotune_target = target_temp;
+    if (autotune_cascade)
+    {
+        pid_cascade_set_setpoint(&g_cascade, target_temp);
+        config = pid_cascade_autotune_config(CASCADE_LOOP_INNER, target_temp);
+    }
+
+    // Tyreus-Luyben (conservative, minimal overshoot) unless simulation picks another rule;
+    // the cascade loops always use it
+    pid_autotune_init(&g_autotune_ctx, config, TUNING_RULE_TYREUS_LUYBEN);
+
+    // Start auto-tune
+    if (!pid_autotune_start(&g_autotune_ctx))
+    {
+        ESP_LOGE(TAG, "Failed to start auto-tune");
+        return false;
+    }
+
+    is_autotuning = true;
+    ESP_LOGI(TAG, "PID auto-tune started with target temperature %.1f°C", target_temp);
+    ESP_LOGI(TAG, "Tuning rule: %s", config.select_rule ? "best by simulation" : "Tyreus-Luyben");
+
+    return true;
+}
+
+/**
+ * @brief Cancel ongoing PID auto-tuning
+ *
+ * Safely cancels the auto-tuning process and returns to normal operation.
+ */
+void cancel_pid_autotune(void)
+{
+    if (is_autotuning)
+    {
+        is_autotuning = false;
+        heating_set_power(0);  // Turn off heating
+        ESP_LOGI(TAG, "PID auto-tune cancelled by user");
+    }
+}
+
+/**
+ * @brief Check if PID auto-tuning is in progress
+ *
+ * @return true if auto-tuning is active, false otherwise
  */
 bool is_pid_autotuning(void)
 {
@@ -1457,6 +3405,33 @@ uint8_t get_autotune_progress(void)
     return pid_autotune_get_progress(&g_autotune_ctx);
 }
 
+/**
+ * @brief Get one entry of the simulated tuning rule ranking
+ *
+ * @param rank 0 = best (the applied rule)
+ * @param rule_name Receives the short rule name (may be NULL)
+ * @param score Receives the simulated cost, lower is better (may be NULL)
+ * @return true if the entry exists
+ */
+bool get_autotune_ranking_entry(uint8_t rank, const char **rule_name, float *score)
+{
+    rule_ranking_t ranking;
+    if (is_autotuning || !pid_autotune_get_ranking(&g_autotune_ctx, &ranking) || rank >= ranking.count)
+    {
+        return false;
+    }
+
+    if (rule_name)
+    {
+        *rule_name = pid_autotune_rule_name(ranking.entries[rank].rule);
+    }
+    if (score)
+    {
+        *score = ranking.entries[rank].score;
+    }
+    return true;
+}
+
 /**
  * @brief System-wide cleanup function
  *
@@ -1484,6 +3459,9 @@ void system_cleanup(void)
         ESP_LOGW(TAG, "Heating deinit failed: %s", esp_err_to_name(ret));
     }
 
+    // Close the job link (tickets are already persisted)
+    job_link_deinit();
+
     // Step 3: Deinitialize controls (buttons, rotary encoder, LEDs)
     ret = controls_deinit();
     if (ret != ESP_OK)
@@ -1507,6 +3485,7 @@ void system_cleanup(void)
 
     // Step 6: Save any pending data to storage
     save_persistent_data();
+    save_wear_stats();
 
     // Step 7: Clean up FreeRTOS resources
     if (statistics_mutex != NULL)
@@ -1555,7 +3534,7 @@ bool attempt_emergency_recovery(void)
     }
 
     // Validation 3: Check temperature is within safe range
-    if (temp < TEMP_CYCLE_START_MIN || temp > MAX_TEMPERATURE)
+    if (temp < TEMP_CYCLE_START_MIN || is_over_temperature(temp))
     {
         ESP_LOGW(TAG, "Recovery blocked: Temperature %.1f°C out of safe range [%.1f, %.1f]",
                  temp, TEMP_CYCLE_START_MIN, MAX_TEMPERATURE);
@@ -1594,6 +3573,9 @@ void reset_all_statistics(void)
     stats_lock();
     memset(&statistics, 0, sizeof(statistics_t));
     statistics.session_start_time = esp_timer_get_time() / 1000000;
+    session_tally_reset(&session_tally, statistics.session_start_time);
+    session_tally_reset(&shift_tally, statistics.session_start_time);
+    throughput_reset(&g_throughput, statistics.session_start_time);
     stats_unlock();
     ESP_LOGI(TAG, "All statistics reset");
 }
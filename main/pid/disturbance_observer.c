@@ -0,0 +1,110 @@
+/**
+ * @file disturbance_observer.c
+ * @brief Thermal load observer implementation
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#include "disturbance_observer.h"
+#include "system_config.h"
+#include "esp_log.h"
+#include <string.h>
+
+static const char *TAG = "dob";
+
+// =============================================================================
+// Internal Helpers
+// =============================================================================
+
+static uint16_t delay_steps_for(const disturbance_observer_t *dob)
+{
+    float steps = dob->model.dead_time / dob->dt + 0.5f;
+    if (steps < 0.0f)
+    {
+        steps = 0.0f;
+    }
+    if (steps > DOB_MAX_DELAY_STEPS - 1)
+    {
+        ESP_LOGW(TAG, "Dead time %.0fs exceeds %d steps, truncated",
+                 dob->model.dead_time, DOB_MAX_DELAY_STEPS - 1);
+        steps = DOB_MAX_DELAY_STEPS - 1;
+    }
+    return (uint16_t)steps;
+}
+
+// =============================================================================
+// Public Interface
+// =============================================================================
+
+void dob_init(disturbance_observer_t *dob, thermal_model_t model, float dt)
+{
+    if (!dob)
+    {
+        return;
+    }
+
+    memset(dob, 0, sizeof(disturbance_observer_t));
+    dob->model = model;
+    dob->dt = (dt > 0.0f) ? dt : 1.0f;
+    dob->delay_steps = delay_steps_for(dob);
+
+    ESP_LOGI(TAG, "Observer: %.0fW heater, C=%.0fJ/°C, G=%.1fW/°C, dead time %u steps, L=%.2f",
+             model.heater_watts, model.capacity, model.loss_coefficient,
+             dob->delay_steps, model.observer_gain);
+}
+
+void dob_update(disturbance_observer_t *dob, float measurement, float applied_power)
+{
+    if (!dob || dob->model.capacity <= 0.0f)
+    {
+        return;
+    }
+
+    if (!dob->primed)
+    {
+        // Assume the power before the first step held for a dead time
+        for (uint16_t i = 0; i < DOB_MAX_DELAY_STEPS; i++)
+        {
+            dob->power_history[i] = applied_power;
+        }
+        dob->last_measurement = measurement;
+        dob->primed = true;
+        return;
+    }
+
+    // Delay line: the power written delay_steps ago reaches the reading now
+    dob->power_history[dob->head] = applied_power;
+    uint16_t read = (dob->head + DOB_MAX_DELAY_STEPS - dob->delay_steps) % DOB_MAX_DELAY_STEPS;
+    float delayed_power = dob->power_history[read];
+    dob->head = (dob->head + 1) % DOB_MAX_DELAY_STEPS;
+
+    // Predict where the step should have ended with the current estimate
+    float dt = dob->dt;
+    float heat_in = dob->model.heater_watts * (delayed_power / 100.0f);
+    float heat_lost = dob->model.loss_coefficient * (dob->last_measurement - dob->model.ambient);
+    float predicted = dob->last_measurement +
+                      (heat_in - heat_lost - dob->load_watts) * dt / dob->model.capacity;
+
+    // Measured below predicted means something drew more heat than modelled
+    float error = measurement - predicted;
+    dob->load_watts -= dob->model.observer_gain * error * dob->model.capacity / dt;
+    dob->load_watts = CLAMP(dob->load_watts, -dob->model.heater_watts, dob->model.heater_watts);
+
+    dob->last_measurement = measurement;
+}
+
+float dob_get_load_watts(const disturbance_observer_t *dob)
+{
+    return dob ? dob->load_watts : 0.0f;
+}
+
+float dob_compensation(const disturbance_observer_t *dob, float fraction)
+{
+    if (!dob || dob->model.heater_watts <= 0.0f)
+    {
+        return 0.0f;
+    }
+
+    return fraction * dob->load_watts / dob->model.heater_watts * 100.0f;
+}
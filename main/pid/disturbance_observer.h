@@ -0,0 +1,108 @@
+/**
+ * @file disturbance_observer.h
+ * @brief Thermal load (disturbance) observer
+ *
+ * The PID only sees an unmeasured load - a thick garment, a cold lower
+ * pad, a draught - once it has already pulled the platen off setpoint.
+ * The observer runs a lumped heat balance of the platen,
+ *
+ *     C * dT/dt = P_heater * u - G * (T - T_ambient) - P_load
+ *
+ * and attributes the gap between the predicted and measured temperature
+ * to P_load, the equivalent load power in watts.
+ *
+ * Heater output reaches the thermocouple only after the dead time, so
+ * the balance is driven with the power applied one dead time earlier
+ * (kept in a delay line). Comparing the reading with the same step's
+ * power would book every power change as a load for the length of the
+ * dead time, and feed that phantom load straight back. The estimate is fed
+ * forward as extra heater output so a load change is answered within a
+ * few control steps instead of waiting for the integral to wind up, and
+ * doubles as a live "how much heat is this garment taking" signal.
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#ifndef DISTURBANCE_OBSERVER_H
+#define DISTURBANCE_OBSERVER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// =============================================================================
+// Type Definitions
+// =============================================================================
+
+#define DOB_MAX_DELAY_STEPS 120 ///< Longest dead time handled, in control steps
+
+/**
+ * @brief Platen heat balance parameters
+ */
+typedef struct
+{
+    float heater_watts;      ///< Heater power at 100% (W)
+    float capacity;          ///< Platen heat capacity (J/°C)
+    float loss_coefficient;  ///< Loss to ambient (W/°C)
+    float ambient;           ///< Ambient temperature (°C)
+    float dead_time;         ///< Heater-to-thermocouple delay (s)
+    float observer_gain;     ///< Fraction of each step's prediction error taken as load (0-1)
+} thermal_model_t;
+
+/**
+ * @brief Observer state
+ */
+typedef struct
+{
+    thermal_model_t model;
+    float dt;               ///< Control step (s)
+    uint16_t delay_steps;   ///< Dead time in steps
+    float power_history[DOB_MAX_DELAY_STEPS]; ///< Past applied power (%, delay line)
+    uint16_t head;          ///< Next write position in power_history
+    float last_measurement; ///< Temperature at the start of the step (°C)
+    float load_watts;       ///< Estimated load power (W, positive = heat drawn)
+    bool primed;            ///< last_measurement and the delay line have been seeded
+} disturbance_observer_t;
+
+// =============================================================================
+// Function Prototypes
+// =============================================================================
+
+/**
+ * @brief Initialize the observer
+ *
+ * @param dob Observer state
+ * @param model Heat balance parameters
+ * @param dt Control step (s)
+ */
+void dob_init(disturbance_observer_t *dob, thermal_model_t model, float dt);
+
+/**
+ * @brief Update the load estimate with one control step
+ *
+ * Call every control step, heating or not, before the new output is
+ * applied.
+ *
+ * @param dob Observer state
+ * @param measurement Measured temperature at the end of the step (°C)
+ * @param applied_power Heater power during the step that just ended (%)
+ */
+void dob_update(disturbance_observer_t *dob, float measurement, float applied_power);
+
+/**
+ * @brief Get the estimated load
+ *
+ * @return Load power in watts (positive = heat drawn from the platen)
+ */
+float dob_get_load_watts(const disturbance_observer_t *dob);
+
+/**
+ * @brief Heater output that cancels the estimated load
+ *
+ * @param dob Observer state
+ * @param fraction Share of the load to compensate (0-1)
+ * @return Output to add to the PID output (%, may be negative)
+ */
+float dob_compensation(const disturbance_observer_t *dob, float fraction);
+
+#endif // DISTURBANCE_OBSERVER_H
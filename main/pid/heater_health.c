@@ -0,0 +1,247 @@
+/**
+ * @file heater_health.c
+ * @brief Heater degradation trend implementation
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#include "heater_health.h"
+#include <math.h>
+#include <string.h>
+
+#define HEATER_FIT_MIN_BLOCKS 6         ///< Fewer points are not fitted
+#define HEATER_FIT_MAX_CORRELATION 0.95 ///< Power and rise must not move together more than this (r^2)
+#define HEATER_TREND_MIN_SPAN_DAYS 7    ///< Shorter dated spans give no slope
+
+// =============================================================================
+// Warm-up Fit
+// =============================================================================
+
+void heater_fit_start(heater_fit_t *fit, float capacity, float ambient, float temperature)
+{
+    if (!fit)
+    {
+        return;
+    }
+
+    memset(fit, 0, sizeof(heater_fit_t));
+    fit->capacity = capacity;
+    fit->ambient = ambient;
+    fit->start_temp = temperature;
+    fit->max_temp = temperature;
+    fit->block_start_temp = temperature;
+}
+
+void heater_fit_add(heater_fit_t *fit, float temperature, float applied_power, float dt)
+{
+    if (!fit || dt <= 0.0f)
+    {
+        return;
+    }
+
+    if (temperature > fit->max_temp)
+    {
+        fit->max_temp = temperature;
+    }
+
+    fit->block_power_sum += (applied_power / 100.0f) * dt;
+    fit->block_temp_sum += temperature * dt;
+    fit->block_seconds += (uint16_t)dt;
+    if (fit->block_seconds < HEATER_FIT_BLOCK_SEC)
+    {
+        return;
+    }
+
+    // One regression point per block: y = C * dT/dt against u and the rise above ambient
+    float seconds = (float)fit->block_seconds;
+    double u = fit->block_power_sum / seconds;
+    double d = fit->block_temp_sum / seconds - fit->ambient;
+    double y = fit->capacity * (temperature - fit->block_start_temp) / seconds;
+
+    fit->s_uu += u * u;
+    fit->s_ud += u * d;
+    fit->s_dd += d * d;
+    fit->s_uy += u * y;
+    fit->s_dy += d * y;
+    fit->blocks++;
+
+    fit->block_start_temp = temperature;
+    fit->block_power_sum = 0.0f;
+    fit->block_temp_sum = 0.0f;
+    fit->block_seconds = 0;
+}
+
+bool heater_fit_solve(const heater_fit_t *fit, float *heater_watts, float *loss_coefficient)
+{
+    if (!fit || !heater_watts || !loss_coefficient || fit->blocks < HEATER_FIT_MIN_BLOCKS)
+    {
+        return false;
+    }
+
+    // Power and rise must have moved independently, or P and G trade off against each other
+    double scale = fit->s_uu * fit->s_dd;
+    double det = scale - fit->s_ud * fit->s_ud;
+    if (scale <= 0.0 || det < (1.0 - HEATER_FIT_MAX_CORRELATION) * scale)
+    {
+        return false;
+    }
+
+    double watts = (fit->s_uy * fit->s_dd - fit->s_ud * fit->s_dy) / det;
+    double loss = (fit->s_ud * fit->s_uy - fit->s_uu * fit->s_dy) / det;
+    if (!isfinite(watts) || !isfinite(loss) || watts <= 0.0 || loss < 0.0)
+    {
+        return false;
+    }
+
+    *heater_watts = (float)watts;
+    *loss_coefficient = (float)loss;
+    return true;
+}
+
+// =============================================================================
+// Series
+// =============================================================================
+
+void heater_health_init(heater_health_t *health)
+{
+    if (health)
+    {
+        memset(health, 0, sizeof(heater_health_t));
+    }
+}
+
+bool heater_health_validate(const heater_health_t *health)
+{
+    if (!health || health->count > HEATER_HEALTH_POINTS ||
+        !isfinite(health->baseline_watts) || health->baseline_watts < 0.0f ||
+        !isfinite(health->baseline_loss) || health->baseline_loss < 0.0f)
+    {
+        return false;
+    }
+
+    for (uint8_t i = 0; i < health->count; i++)
+    {
+        const heater_health_point_t *point = &health->points[i];
+        if (point->fits == 0 || !isfinite(point->heater_watts) || point->heater_watts <= 0.0f ||
+            !isfinite(point->loss_coefficient) || point->loss_coefficient < 0.0f)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void heater_health_add(heater_health_t *health, uint32_t day, float heater_watts, float loss_coefficient)
+{
+    if (!health)
+    {
+        return;
+    }
+
+    heater_health_point_t *last = (health->count > 0) ? &health->points[health->count - 1] : NULL;
+    bool merge = last && ((day != 0) ? (last->day == day) :
+                                       (last->day == 0 && last->fits < HEATER_HEALTH_MERGE_FITS));
+    if (merge)
+    {
+        float weight = 1.0f / (last->fits + 1);
+        last->heater_watts += weight * (heater_watts - last->heater_watts);
+        last->loss_coefficient += weight * (loss_coefficient - last->loss_coefficient);
+        if (last->fits < UINT16_MAX)
+        {
+            last->fits++;
+        }
+        return;
+    }
+
+    // The first points are complete once a later one starts: they become the baseline
+    if (health->baseline_watts <= 0.0f && health->count >= HEATER_HEALTH_BASELINE_POINTS)
+    {
+        float watts = 0.0f;
+        float loss = 0.0f;
+        for (uint8_t i = 0; i < HEATER_HEALTH_BASELINE_POINTS; i++)
+        {
+            watts += health->points[i].heater_watts;
+            loss += health->points[i].loss_coefficient;
+        }
+        health->baseline_watts = watts / HEATER_HEALTH_BASELINE_POINTS;
+        health->baseline_loss = loss / HEATER_HEALTH_BASELINE_POINTS;
+    }
+
+    if (health->count == HEATER_HEALTH_POINTS)
+    {
+        memmove(&health->points[0], &health->points[1],
+                (HEATER_HEALTH_POINTS - 1) * sizeof(heater_health_point_t));
+        health->count--;
+    }
+
+    heater_health_point_t *point = &health->points[health->count++];
+    point->day = day;
+    point->fits = 1;
+    point->heater_watts = heater_watts;
+    point->loss_coefficient = loss_coefficient;
+}
+
+void heater_health_trend(const heater_health_t *health, heater_trend_t *trend)
+{
+    if (!trend)
+    {
+        return;
+    }
+
+    memset(trend, 0, sizeof(heater_trend_t));
+    if (!health || health->count == 0)
+    {
+        return;
+    }
+
+    uint8_t recent = (health->count < HEATER_HEALTH_RECENT_POINTS) ? health->count : HEATER_HEALTH_RECENT_POINTS;
+    for (uint8_t i = health->count - recent; i < health->count; i++)
+    {
+        trend->recent_watts += health->points[i].heater_watts;
+        trend->recent_loss += health->points[i].loss_coefficient;
+    }
+    trend->recent_watts /= recent;
+    trend->recent_loss /= recent;
+
+    if (health->baseline_watts > 0.0f)
+    {
+        trend->valid = true;
+        trend->watts_change_percent = 100.0f * (trend->recent_watts / health->baseline_watts - 1.0f);
+        if (health->baseline_loss > 0.0f)
+        {
+            trend->loss_change_percent = 100.0f * (trend->recent_loss / health->baseline_loss - 1.0f);
+        }
+    }
+
+    // Least-squares slope of the heater power over the dated points
+    double n = 0.0, sx = 0.0, sy = 0.0, sxx = 0.0, sxy = 0.0;
+    uint32_t first_day = 0;
+    uint32_t last_day = 0;
+    for (uint8_t i = 0; i < health->count; i++)
+    {
+        const heater_health_point_t *point = &health->points[i];
+        if (point->day == 0)
+        {
+            continue;
+        }
+        if (first_day == 0)
+        {
+            first_day = point->day;
+        }
+        last_day = point->day;
+
+        double x = (double)point->day - (double)first_day;
+        n += 1.0;
+        sx += x;
+        sy += point->heater_watts;
+        sxx += x * x;
+        sxy += x * point->heater_watts;
+    }
+
+    double denominator = n * sxx - sx * sx;
+    if (n >= 3.0 && (double)last_day - (double)first_day >= HEATER_TREND_MIN_SPAN_DAYS && denominator > 0.0)
+    {
+        trend->watts_per_month = (float)(30.0 * (n * sxy - sx * sy) / denominator);
+    }
+}
@@ -0,0 +1,129 @@
+/**
+ * @file heater_health.h
+ * @brief Heater degradation trend from warm-up fits
+ *
+ * A heating element loses output over months (oxidized resistance wire,
+ * a failing SSR or a loose terminal), and a platen loses heat faster as
+ * its insulation or mounting degrades. Both show up as slower warm-ups
+ * long before anyone notices.
+ *
+ * Each warm-up from cold, together with the settled hold that follows,
+ * is fitted to the same lumped heat balance the disturbance observer
+ * uses,
+ *
+ *     C * dT/dt = P * u - G * (T - T_ambient)
+ *
+ * with the capacity C taken from the configuration, by least squares
+ * over HEATER_FIT_BLOCK_SEC blocks (averaging the 1 s samples keeps
+ * thermocouple noise out of dT/dt). The rising part separates P from G
+ * and the settled part pins their ratio. The result is the effective
+ * heater power P at 100% and the loss coefficient G.
+ *
+ * Fits are merged into one point per day and kept in a short persisted
+ * series. The first HEATER_HEALTH_BASELINE_POINTS points become the
+ * baseline, and the trend compares the latest points against it.
+ *
+ * The functions here operate on caller-owned state and do no locking;
+ * the caller serializes access.
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#ifndef HEATER_HEALTH_H
+#define HEATER_HEALTH_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "data_model.h"  // components/storage/include/ - heater_health_t, heater_trend_t
+
+#define HEATER_FIT_BLOCK_SEC 10          ///< Samples averaged per regression point
+#define HEATER_HEALTH_BASELINE_POINTS 3  ///< Points averaged into the baseline
+#define HEATER_HEALTH_RECENT_POINTS 3    ///< Latest points averaged for the trend
+#define HEATER_HEALTH_MERGE_FITS 4       ///< Fits merged into one undated point (clock not set)
+
+/**
+ * @brief Running least-squares fit of one warm-up
+ */
+typedef struct
+{
+    float capacity;          ///< Platen heat capacity (J/°C)
+    float ambient;           ///< Ambient temperature (°C)
+    float start_temp;        ///< Temperature the fit started at (°C)
+    float max_temp;          ///< Highest temperature seen (°C)
+
+    // Block being averaged
+    float block_start_temp;
+    float block_power_sum;   ///< Power (0-1) summed over the block
+    float block_temp_sum;    ///< Temperature summed over the block
+    uint16_t block_seconds;
+
+    // Normal equation sums for y = P*u - G*d
+    double s_uu, s_ud, s_dd, s_uy, s_dy;
+    uint16_t blocks;
+} heater_fit_t;
+
+// =============================================================================
+// Function Prototypes
+// =============================================================================
+
+/**
+ * @brief Start a fit
+ *
+ * @param fit Fit state
+ * @param capacity Platen heat capacity (J/°C)
+ * @param ambient Ambient temperature (°C)
+ * @param temperature Temperature now (°C)
+ */
+void heater_fit_start(heater_fit_t *fit, float capacity, float ambient, float temperature);
+
+/**
+ * @brief Add one control step
+ *
+ * @param fit Fit state
+ * @param temperature Temperature at the end of the step (°C)
+ * @param applied_power Heater power during the step (%)
+ * @param dt Step length (s)
+ */
+void heater_fit_add(heater_fit_t *fit, float temperature, float applied_power, float dt);
+
+/**
+ * @brief Solve the fit
+ *
+ * @param fit Fit state
+ * @param[out] heater_watts Effective heater power at 100% (W)
+ * @param[out] loss_coefficient Loss to ambient (W/°C)
+ * @return false if the data cannot separate power from losses
+ */
+bool heater_fit_solve(const heater_fit_t *fit, float *heater_watts, float *loss_coefficient);
+
+/**
+ * @brief Reset to an empty series with no baseline
+ */
+void heater_health_init(heater_health_t *health);
+
+/**
+ * @brief Check a loaded series for corruption
+ */
+bool heater_health_validate(const heater_health_t *health);
+
+/**
+ * @brief Add a fit to the series
+ *
+ * Merged into the last point if it has the same day (or, undated, fewer
+ * than HEATER_HEALTH_MERGE_FITS fits); otherwise a new point is added,
+ * dropping the oldest when full.
+ *
+ * @param health Series
+ * @param day Days since 1970 (UTC), 0 if the wall clock is not set
+ * @param heater_watts Fitted heater power (W)
+ * @param loss_coefficient Fitted loss coefficient (W/°C)
+ */
+void heater_health_add(heater_health_t *health, uint32_t day, float heater_watts, float loss_coefficient);
+
+/**
+ * @brief Compare the latest points with the baseline
+ */
+void heater_health_trend(const heater_health_t *health, heater_trend_t *trend);
+
+#endif // HEATER_HEALTH_H
@@ -0,0 +1,334 @@
+/**
+ * @file pid_adaptive.c
+ * @brief Continuous self-tuning implementation
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#include "pid_adaptive.h"
+#include "system_config.h"
+#include "esp_log.h"
+#include <string.h>
+#include <math.h>
+
+static const char *TAG = "pid_adaptive";
+
+static const char *change_names[] = {
+    "detune",
+    "stiffen",
+    "accept",
+    "rollback",
+    "anchor"
+};
+
+// =============================================================================
+// Internal Helpers
+// =============================================================================
+
+static float bound_gain(float value, float reference)
+{
+    return CLAMP(value, reference * ADAPTIVE_MIN_SCALE, reference * ADAPTIVE_MAX_SCALE);
+}
+
+static void record_change(pid_adaptive_t *ad, adaptive_change_t change,
+                          pid_gains_t from, pid_gains_t to, float score)
+{
+    adaptive_audit_entry_t *entry = &ad->audit[ad->audit_head];
+    entry->cycle = ad->cycles;
+    entry->change = change;
+    entry->from = from;
+    entry->to = to;
+    entry->score = score;
+
+    ad->audit_head = (ad->audit_head + 1) % ADAPTIVE_AUDIT_SIZE;
+    if (ad->audit_count < ADAPTIVE_AUDIT_SIZE)
+    {
+        ad->audit_count++;
+    }
+
+    ESP_LOGI(TAG, "Cycle %lu %s (score %.2f): Kp %.3f->%.3f Ki %.4f->%.4f Kd %.3f->%.3f",
+             ad->cycles, change_names[change], score,
+             from.kp, to.kp, from.ki, to.ki, from.kd, to.kd);
+}
+
+static bool gains_valid(pid_gains_t gains)
+{
+    return isfinite(gains.kp) && isfinite(gains.ki) && isfinite(gains.kd) &&
+           gains.kp >= 0.0f && gains.ki >= 0.0f && gains.kd >= 0.0f;
+}
+
+static bool gains_in_bounds(pid_gains_t gains, pid_gains_t reference)
+{
+    return bound_gain(gains.kp, reference.kp) == gains.kp &&
+           bound_gain(gains.ki, reference.ki) == gains.ki &&
+           bound_gain(gains.kd, reference.kd) == gains.kd;
+}
+
+static void reset_window(pid_adaptive_t *ad)
+{
+    ad->window_cycles = 0;
+    ad->window_score = 0.0f;
+    ad->window_sag = 0.0f;
+    ad->window_overshoot = 0.0f;
+    ad->window_crossings = 0;
+}
+
+// =============================================================================
+// Public Interface
+// =============================================================================
+
+void pid_adaptive_init(pid_adaptive_t *ad, pid_gains_t gains)
+{
+    if (!ad)
+    {
+        return;
+    }
+
+    // Keep the audit trail across restarts
+    adaptive_audit_entry_t audit[ADAPTIVE_AUDIT_SIZE];
+    uint8_t audit_count = ad->audit_count;
+    uint8_t audit_head = ad->audit_head;
+    uint32_t cycles = ad->cycles;
+    pid_gains_t previous = ad->gains;
+    memcpy(audit, ad->audit, sizeof(audit));
+
+    memset(ad, 0, sizeof(pid_adaptive_t));
+    ad->reference = gains;
+    ad->baseline = gains;
+    ad->gains = gains;
+
+    memcpy(ad->audit, audit, sizeof(audit));
+    ad->audit_count = audit_count;
+    ad->audit_head = audit_head;
+    ad->cycles = cycles;
+
+    record_change(ad, ADAPTIVE_CHANGE_ANCHOR, previous, gains, 0.0f);
+}
+
+void pid_adaptive_export(const pid_adaptive_t *ad, adaptive_record_t *record)
+{
+    if (!ad || !record)
+    {
+        return;
+    }
+
+    memset(record, 0, sizeof(adaptive_record_t));
+    record->reference = ad->reference;
+    record->baseline = ad->baseline;
+    record->gains = ad->gains;
+    record->baseline_score = ad->baseline_score;
+    record->trial_active = ad->trial_active;
+    record->cycles = ad->cycles;
+    memcpy(record->audit, ad->audit, sizeof(record->audit));
+    record->audit_count = ad->audit_count;
+    record->audit_head = ad->audit_head;
+}
+
+bool pid_adaptive_restore(pid_adaptive_t *ad, const adaptive_record_t *record, pid_gains_t gains)
+{
+    if (!ad || !record)
+    {
+        return false;
+    }
+
+    if (!gains_valid(record->reference) || !gains_valid(record->baseline) ||
+        !gains_valid(record->gains) || !isfinite(record->baseline_score) ||
+        record->audit_count > ADAPTIVE_AUDIT_SIZE || record->audit_head >= ADAPTIVE_AUDIT_SIZE ||
+        !gains_in_bounds(record->baseline, record->reference) ||
+        !gains_in_bounds(record->gains, record->reference))
+    {
+        ESP_LOGW(TAG, "Saved record invalid");
+        return false;
+    }
+    for (uint8_t i = 0; i < ADAPTIVE_AUDIT_SIZE; i++)
+    {
+        if (record->audit[i].change >= ADAPTIVE_CHANGE_COUNT)
+        {
+            ESP_LOGW(TAG, "Saved audit log invalid");
+            return false;
+        }
+    }
+
+    if (!gains_valid(gains) || !gains_in_bounds(gains, record->reference))
+    {
+        ESP_LOGW(TAG, "Gains Kp %.3f Ki %.4f Kd %.3f outside the saved bounds",
+                 gains.kp, gains.ki, gains.kd);
+        return false;
+    }
+
+    memset(ad, 0, sizeof(pid_adaptive_t));
+    ad->reference = record->reference;
+    ad->baseline = record->baseline;
+    ad->gains = record->gains;
+    ad->baseline_score = record->baseline_score;
+    ad->trial_active = record->trial_active;
+    ad->cycles = record->cycles;
+    memcpy(ad->audit, record->audit, sizeof(ad->audit));
+    ad->audit_count = record->audit_count;
+    ad->audit_head = record->audit_head;
+
+    if (gains.kp != ad->gains.kp || gains.ki != ad->gains.ki || gains.kd != ad->gains.kd)
+    {
+        // Save cut short: carry on from the gains actually running
+        ESP_LOGW(TAG, "Running gains differ from the record, taking them as the baseline");
+        ad->gains = gains;
+        ad->baseline = gains;
+        ad->trial_active = false;
+    }
+
+    ESP_LOGI(TAG, "Resumed around Kp=%.3f Ki=%.4f Kd=%.3f (%lu cycles)",
+             ad->reference.kp, ad->reference.ki, ad->reference.kd, ad->cycles);
+    return true;
+}
+
+void pid_adaptive_begin_cycle(pid_adaptive_t *ad)
+{
+    if (!ad)
+    {
+        return;
+    }
+
+    memset(&ad->cycle, 0, sizeof(ad->cycle));
+    ad->last_sign = 0;
+}
+
+void pid_adaptive_sample(pid_adaptive_t *ad, float setpoint, float measurement, float dt)
+{
+    if (!ad || dt <= 0.0f)
+    {
+        return;
+    }
+
+    float error = measurement - setpoint;
+    adaptive_cycle_metrics_t *m = &ad->cycle;
+
+    if (-error > m->sag)
+    {
+        m->sag = -error;
+    }
+    if (error > m->overshoot)
+    {
+        m->overshoot = error;
+    }
+
+    // Count crossings between the upper and lower edges of the noise band
+    int8_t sign = 0;
+    if (error > ADAPTIVE_NOISE_BAND)
+    {
+        sign = 1;
+    }
+    else if (error < -ADAPTIVE_NOISE_BAND)
+    {
+        sign = -1;
+    }
+    if (sign != 0)
+    {
+        if (ad->last_sign != 0 && sign != ad->last_sign && m->crossings < UINT8_MAX)
+        {
+            m->crossings++;
+        }
+        ad->last_sign = sign;
+    }
+
+    m->abs_error_sum += (error >= 0.0f ? error : -error) * dt;
+    m->duration += dt;
+}
+
+bool pid_adaptive_end_cycle(pid_adaptive_t *ad, pid_gains_t *new_gains)
+{
+    if (!ad || !new_gains || ad->cycle.duration <= 0.0f)
+    {
+        return false;
+    }
+
+    float score = ad->cycle.abs_error_sum / ad->cycle.duration;
+    ad->cycles++;
+
+    ad->window_score += score;
+    ad->window_sag += ad->cycle.sag;
+    ad->window_overshoot += ad->cycle.overshoot;
+    ad->window_crossings += ad->cycle.crossings;
+    ad->window_cycles++;
+
+    ESP_LOGD(TAG, "Cycle %lu: sag=%.1f overshoot=%.1f crossings=%u score=%.2f",
+             ad->cycles, ad->cycle.sag, ad->cycle.overshoot, ad->cycle.crossings, score);
+
+    if (ad->window_cycles < ADAPTIVE_WINDOW_CYCLES)
+    {
+        return false;
+    }
+
+    float mean_score = ad->window_score / ad->window_cycles;
+    float mean_sag = ad->window_sag / ad->window_cycles;
+    float mean_overshoot = ad->window_overshoot / ad->window_cycles;
+    float mean_crossings = (float)ad->window_crossings / ad->window_cycles;
+    reset_window(ad);
+
+    // Judge a running trial against the baseline it replaced
+    if (ad->trial_active)
+    {
+        ad->trial_active = false;
+
+        if (mean_score > ad->baseline_score * (1.0f + ADAPTIVE_ROLLBACK_MARGIN))
+        {
+            record_change(ad, ADAPTIVE_CHANGE_ROLLBACK, ad->gains, ad->baseline, mean_score);
+            ad->gains = ad->baseline;
+            *new_gains = ad->gains;
+            return true;
+        }
+
+        record_change(ad, ADAPTIVE_CHANGE_ACCEPT, ad->baseline, ad->gains, mean_score);
+        ad->baseline = ad->gains;
+        ad->baseline_score = mean_score;
+        return false;
+    }
+
+    // Baseline window complete - propose one bounded step
+    ad->baseline_score = mean_score;
+    pid_gains_t proposed = ad->gains;
+    adaptive_change_t change;
+
+    if (mean_crossings >= ADAPTIVE_OSCILLATION_LIMIT || mean_overshoot > ADAPTIVE_OVERSHOOT_LIMIT)
+    {
+        proposed.kp *= (1.0f - ADAPTIVE_STEP);
+        proposed.ki *= (1.0f - ADAPTIVE_STEP);
+        change = ADAPTIVE_CHANGE_DETUNE;
+    }
+    else if (mean_sag > ADAPTIVE_SAG_LIMIT)
+    {
+        proposed.kp *= (1.0f + ADAPTIVE_STEP);
+        proposed.ki *= (1.0f + ADAPTIVE_STEP);
+        change = ADAPTIVE_CHANGE_STIFFEN;
+    }
+    else
+    {
+        return false; // Performing well - leave the gains alone
+    }
+
+    proposed.kp = bound_gain(proposed.kp, ad->reference.kp);
+    proposed.ki = bound_gain(proposed.ki, ad->reference.ki);
+    proposed.kd = bound_gain(proposed.kd, ad->reference.kd);
+
+    if (proposed.kp == ad->gains.kp && proposed.ki == ad->gains.ki && proposed.kd == ad->gains.kd)
+    {
+        return false; // Already at the bound
+    }
+
+    record_change(ad, change, ad->gains, proposed, mean_score);
+    ad->gains = proposed;
+    ad->trial_active = true;
+    *new_gains = proposed;
+    return true;
+}
+
+const adaptive_audit_entry_t *pid_adaptive_get_audit(const pid_adaptive_t *ad, uint8_t index)
+{
+    if (!ad || index >= ad->audit_count)
+    {
+        return NULL;
+    }
+
+    uint8_t slot = (ad->audit_head + ADAPTIVE_AUDIT_SIZE - 1 - index) % ADAPTIVE_AUDIT_SIZE;
+    return &ad->audit[slot];
+}
@@ -0,0 +1,170 @@
+/**
+ * @file pid_adaptive.h
+ * @brief Continuous self-tuning between pressing cycles
+ *
+ * Watches closed-loop performance during normal presses and nudges the
+ * PID gains between cycles, without the downtime of a relay autotune.
+ *
+ * Each pressing cycle is scored from the samples fed in during the cycle:
+ * - sag: deepest drop below setpoint (cold platen load)
+ * - overshoot: highest rise above setpoint during recovery
+ * - oscillation: setpoint crossings outside the noise band
+ * - mean absolute error (the cycle score, lower is better)
+ *
+ * After a baseline of ADAPTIVE_WINDOW_CYCLES cycles, one bounded step
+ * (at most ADAPTIVE_STEP per gain) is proposed and run as a trial for the
+ * same number of cycles. A trial that scores worse than the baseline by
+ * more than ADAPTIVE_ROLLBACK_MARGIN is rolled back. Gains never leave
+ * [ADAPTIVE_MIN_SCALE, ADAPTIVE_MAX_SCALE] of the reference gains (the
+ * gains last set by the operator or a relay autotune). Every change is
+ * kept in a small audit log and written to the console.
+ *
+ * The reference, the gains and the audit log are persisted as an
+ * adaptive_record_t (see pid_adaptive_export()), so the bound holds
+ * across reboots instead of being re-anchored on the adapted gains at
+ * every start. Only the half-measured window is lost on a reboot.
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#ifndef PID_ADAPTIVE_H
+#define PID_ADAPTIVE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "data_model.h"  // components/storage/include/ - pid_gains_t, adaptive_record_t
+
+// =============================================================================
+// Tuning Limits
+// =============================================================================
+
+#define ADAPTIVE_WINDOW_CYCLES 3       ///< Cycles per baseline/trial window
+#define ADAPTIVE_STEP 0.10f            ///< Max relative change per adjustment
+#define ADAPTIVE_MIN_SCALE 0.5f        ///< Lowest gain relative to reference
+#define ADAPTIVE_MAX_SCALE 2.0f        ///< Highest gain relative to reference
+#define ADAPTIVE_ROLLBACK_MARGIN 0.10f ///< Trial may score up to 10% worse
+#define ADAPTIVE_NOISE_BAND 1.0f       ///< Errors inside this band are noise (°C)
+#define ADAPTIVE_SAG_LIMIT 8.0f        ///< Sag that calls for more gain (°C)
+#define ADAPTIVE_OVERSHOOT_LIMIT 3.0f  ///< Overshoot that calls for less gain (°C)
+#define ADAPTIVE_OSCILLATION_LIMIT 4   ///< Crossings per cycle that mean ringing
+
+// =============================================================================
+// Type Definitions
+// =============================================================================
+
+/**
+ * @brief Performance of one pressing cycle
+ */
+typedef struct
+{
+    float sag;          ///< Deepest drop below setpoint (°C, >= 0)
+    float overshoot;    ///< Highest rise above setpoint (°C, >= 0)
+    uint8_t crossings;  ///< Setpoint crossings outside the noise band
+    float abs_error_sum;///< Sum of |error| * dt (°C·s)
+    float duration;     ///< Sampled time (s)
+} adaptive_cycle_metrics_t;
+
+/**
+ * @brief Adaptive tuner state
+ */
+typedef struct
+{
+    pid_gains_t reference;   ///< Gains adaptation is bounded around
+    pid_gains_t baseline;    ///< Last known-good gains (rollback target)
+    pid_gains_t gains;       ///< Gains currently in use
+    float baseline_score;    ///< Mean score of the baseline window
+
+    // Current cycle
+    adaptive_cycle_metrics_t cycle;
+    int8_t last_sign;        ///< Sign of the last error outside the noise band
+
+    // Current window
+    bool trial_active;       ///< Window is evaluating proposed gains
+    uint8_t window_cycles;
+    float window_score;
+    float window_sag;
+    float window_overshoot;
+    uint16_t window_crossings;
+
+    // Bookkeeping
+    uint32_t cycles;
+    adaptive_audit_entry_t audit[ADAPTIVE_AUDIT_SIZE];
+    uint8_t audit_count;
+    uint8_t audit_head;
+} pid_adaptive_t;
+
+// =============================================================================
+// Function Prototypes
+// =============================================================================
+
+/**
+ * @brief (Re)start adaptation around the given gains
+ *
+ * Call when the gains are set from outside (manual edit, relay autotune)
+ * so the bounds follow the operator's choice, and on a first start with
+ * no valid record. Not on every boot: restore the record instead. The
+ * audit log is kept and the new reference is logged as an anchor entry.
+ *
+ * @param ad Adaptive tuner state
+ * @param gains Reference gains
+ */
+void pid_adaptive_init(pid_adaptive_t *ad, pid_gains_t gains);
+
+/**
+ * @brief Copy the persisted part of the state into a record
+ *
+ * @param ad Adaptive tuner state
+ * @param[out] record Record to save
+ */
+void pid_adaptive_export(const pid_adaptive_t *ad, adaptive_record_t *record);
+
+/**
+ * @brief Resume adaptation from a saved record
+ *
+ * The gains in force may differ from the record's if a save was cut
+ * short. Gains inside the record's bounds become the new baseline (a
+ * running trial is dropped); gains outside them mean the record is not
+ * theirs and the caller must re-anchor with pid_adaptive_init().
+ *
+ * @param ad Adaptive tuner state
+ * @param record Saved record
+ * @param gains Gains the controller is running with
+ * @return false if the record is invalid or does not bound the gains
+ */
+bool pid_adaptive_restore(pid_adaptive_t *ad, const adaptive_record_t *record, pid_gains_t gains);
+
+/**
+ * @brief Begin measuring a pressing cycle
+ */
+void pid_adaptive_begin_cycle(pid_adaptive_t *ad);
+
+/**
+ * @brief Feed one control step of the running cycle
+ *
+ * @param ad Adaptive tuner state
+ * @param setpoint Setpoint for this step (°C)
+ * @param measurement Measured temperature (°C)
+ * @param dt Step length (s)
+ */
+void pid_adaptive_sample(pid_adaptive_t *ad, float setpoint, float measurement, float dt);
+
+/**
+ * @brief Finish a cycle and possibly adjust the gains
+ *
+ * @param ad Adaptive tuner state
+ * @param[out] new_gains Gains to apply if the function returns true
+ * @return true if the gains changed and must be applied to the controller
+ */
+bool pid_adaptive_end_cycle(pid_adaptive_t *ad, pid_gains_t *new_gains);
+
+/**
+ * @brief Get an audit log entry
+ *
+ * @param ad Adaptive tuner state
+ * @param index 0 = most recent
+ * @return Entry, or NULL if index is beyond the logged entries
+ */
+const adaptive_audit_entry_t *pid_adaptive_get_audit(const pid_adaptive_t *ad, uint8_t index);
+
+#endif // PID_ADAPTIVE_H
@@ -10,13 +10,21 @@
  */
 
 #include "pid_autotune.h"
+#include "pid_rule_select.h"
 #include "esp_log.h"
 #include "esp_timer.h"
+#include "system_config.h"
 #include <math.h>
 #include <string.h>
 
 static const char *TAG = "pid_autotune";
 
+#define AUTOTUNE_MIN_CYCLES 3            ///< Cycles before early completion is considered
+#define AUTOTUNE_RESULT_CYCLES 2         ///< Most recent cycles averaged for Ku/Tu
+#define AUTOTUNE_BALANCE_TOLERANCE 0.1f  ///< Max |duty - 0.5| for a balanced cycle
+#define AUTOTUNE_AGREEMENT 0.05f         ///< Max relative change between the last two cycles
+#define AUTOTUNE_MIN_RELAY 5.0f          ///< Smallest relay half-swing / bias margin (%)
+
 // =============================================================================
 // Tuning Rule Coefficients
 // =============================================================================
@@ -53,28 +61,86 @@ static uint32_t get_time_sec(void)
     return esp_timer_get_time() / 1000000;
 }
 
-static float calculate_amplitude(const float *peaks, uint8_t count)
+/**
+ * @brief Ultimate gain of one cycle
+ *
+ * Describing function of a relay with half-swing d, duty D and hysteresis
+ * e (the noise band): the fundamental of the output has amplitude
+ * (4d/pi) * sin(pi*D), and the hysteresis shifts the switching points so
+ * the effective input amplitude is sqrt(a^2 - e^2):
+ *
+ *     Ku = 4d * sin(pi*D) / (pi * sqrt(a^2 - e^2))
+ *
+ * For a balanced relay without hysteresis this is the usual 4d / (pi*a).
+ */
+static float cycle_ultimate_gain(const autotune_context_t *ctx, uint8_t i)
 {
-    if (count < 2) return 0.0f;
+    float amplitude = ctx->cycle_amplitude[i];
+    float band = ctx->config.noise_band;
+    if (amplitude > band)
+    {
+        amplitude = sqrtf(amplitude * amplitude - band * band);
+    }
 
-    float sum = 0.0f;
-    for (uint8_t i = 0; i < count - 1; i++)
+    return (4.0f * ctx->cycle_relay[i] * sinf(M_PI * ctx->cycle_duty[i])) / (M_PI * amplitude);
+}
+
+/**
+ * @brief Check whether the last two cycles are balanced and agree
+ */
+static bool cycles_converged(const autotune_context_t *ctx)
+{
+    if (ctx->cycle_count < AUTOTUNE_MIN_CYCLES)
     {
-        sum += fabsf(peaks[i + 1] - peaks[i]);
+        return false;
     }
-    return sum / (count - 1);
+
+    uint8_t last = ctx->cycle_count - 1;
+    float period_change = fabsf(ctx->cycle_period[last] - ctx->cycle_period[last - 1]) / ctx->cycle_period[last];
+    float amplitude_change = fabsf(ctx->cycle_amplitude[last] - ctx->cycle_amplitude[last - 1]) /
+                             ctx->cycle_amplitude[last];
+
+    return fabsf(ctx->cycle_duty[last] - 0.5f) <= AUTOTUNE_BALANCE_TOLERANCE &&
+           period_change <= AUTOTUNE_AGREEMENT &&
+           amplitude_change <= AUTOTUNE_AGREEMENT;
 }
 
-static float calculate_period(const uint32_t *timestamps, uint8_t count)
+/**
+ * @brief Record a finished cycle and re-centre the relay
+ *
+ * Moves the bias by d * (t_high - t_low) / period: a relay that has to
+ * stay high longer than low is centred too low, and vice versa.
+ */
+static void finish_cycle(autotune_context_t *ctx, uint32_t now)
 {
-    if (count < 2) return 0.0f;
+    uint32_t period = now - ctx->cycle_start_sec;
+    float amplitude = (ctx->cycle_max - ctx->cycle_min) / 2.0f;
+    if (period == 0 || amplitude <= 0.0f)
+    {
+        return;
+    }
+
+    float duty = (float)ctx->high_time_sec / (float)period;
 
-    uint32_t sum = 0;
-    for (uint8_t i = 0; i < count - 1; i++)
+    if (ctx->cycle_count < AUTOTUNE_MAX_CYCLES)
     {
-        sum += (timestamps[i + 1] - timestamps[i]);
+        uint8_t i = ctx->cycle_count++;
+        ctx->cycle_amplitude[i] = amplitude;
+        ctx->cycle_period[i] = (float)period;
+        ctx->cycle_duty[i] = duty;
+        ctx->cycle_relay[i] = ctx->relay_amplitude;
     }
-    return (float)sum / (count - 1);
+
+    float low_time = (float)(period - ctx->high_time_sec);
+    ctx->relay_bias += ctx->relay_amplitude * ((float)ctx->high_time_sec - low_time) / (float)period;
+    ctx->relay_bias = CLAMP(ctx->relay_bias, AUTOTUNE_MIN_RELAY, 100.0f - AUTOTUNE_MIN_RELAY);
+
+    // Keep the configured swing where it fits between 0 and 100%
+    ctx->relay_amplitude = fminf(ctx->relay_amplitude_max,
+                                 fminf(ctx->relay_bias, 100.0f - ctx->relay_bias));
+
+    ESP_LOGI(TAG, "Cycle %u: period %lus, amplitude %.2f°C, duty %.2f -> bias %.1f%% +/- %.1f%%",
+             ctx->cycle_count, period, amplitude, duty, ctx->relay_bias, ctx->relay_amplitude);
 }
 
 // =============================================================================
@@ -124,11 +190,16 @@ bool pid_autotune_start(autotune_context_t *ctx)
     ctx->state = AUTOTUNE_STATE_RELAY_STEP_UP;
     ctx->start_time_sec = get_time_sec();
     ctx->relay_output_high = true;
-    ctx->peak_count = 0;
-    ctx->peak_index = 0;
-    ctx->just_changed = false;
-    ctx->is_peak_detected = false;
-    ctx->running_output = ctx->config.initial_output;
+    ctx->cycle_started = false;
+    ctx->cycle_count = 0;
+
+    // Same first swing as a plain relay (initial +/- step, clipped at 0-100%)
+    float high = fminf(ctx->config.initial_output + ctx->config.output_step, 100.0f);
+    float low = fmaxf(ctx->config.initial_output - ctx->config.output_step, 0.0f);
+    ctx->relay_bias = (high + low) / 2.0f;
+    ctx->relay_amplitude = (high - low) / 2.0f;
+    ctx->relay_amplitude_max = ctx->relay_amplitude;
+    ctx->running_output = high;
 
     ESP_LOGI(TAG, "Auto-tune started");
     return true;
@@ -183,51 +254,59 @@ float pid_autotune_update(autotune_context_t *ctx, float input)
             }
         }
 
-        // Switch relay and detect peaks
+        // Track the extremes of the running cycle
+        if (ctx->cycle_started)
+        {
+            ctx->cycle_max = fmaxf(ctx->cycle_max, input);
+            ctx->cycle_min = fminf(ctx->cycle_min, input);
+        }
+
+        // Switch relay; a full cycle runs from one low-to-high switch to the next
         if (should_switch)
         {
             ctx->relay_output_high = !ctx->relay_output_high;
-            ctx->just_changed = true;
-
             uint32_t now = get_time_sec();
 
-            // Store peak value and timestamp
-            if (ctx->peak_count < 10)
+            if (!ctx->relay_output_high)
             {
-                if (ctx->relay_output_high)
-                {
-                    // Just switched to high, so we found a low peak
-                    ctx->peak_low[ctx->peak_count] = input;
-                }
-                else
+                ctx->high_time_sec = now - ctx->cycle_start_sec;
+                ctx->state = ctx->cycle_started ? AUTOTUNE_STATE_MEASURE_PERIOD : AUTOTUNE_STATE_RELAY_STEP_DOWN;
+            }
+            else
+            {
+                if (ctx->cycle_started)
                 {
-                    // Just switched to low, so we found a high peak
-                    ctx->peak_high[ctx->peak_count] = input;
+                    finish_cycle(ctx, now);
                 }
 
-                ctx->peak_timestamps[ctx->peak_count] = now;
-                ctx->peak_count++;
-
-                ESP_LOGD(TAG, "Peak %d detected: %.2f°C at %lu sec",
-                         ctx->peak_count, input, now);
+                ctx->cycle_started = true;
+                ctx->cycle_start_sec = now;
+                ctx->cycle_max = input;
+                ctx->cycle_min = input;
+                ctx->state = AUTOTUNE_STATE_MEASURE_PERIOD;
             }
 
+            ESP_LOGD(TAG, "Relay %s at %.2f°C, %lu sec",
+                     ctx->relay_output_high ? "high" : "low", input, now);
+
             // Check if we have enough data
-            if (ctx->peak_count >= ctx->config.max_cycles)
+            uint32_t max_cycles = CLAMP(ctx->config.max_cycles, AUTOTUNE_RESULT_CYCLES, AUTOTUNE_MAX_CYCLES);
+            if (cycles_converged(ctx) || ctx->cycle_count >= max_cycles)
             {
                 ctx->state = AUTOTUNE_STATE_CALCULATING;
-                ESP_LOGI(TAG, "Enough peaks collected, calculating parameters");
+                ESP_LOGI(TAG, "%u cycles collected%s, calculating parameters",
+                         ctx->cycle_count, cycles_converged(ctx) ? " (converged)" : "");
             }
         }
 
         // Calculate output
         if (ctx->relay_output_high)
         {
-            ctx->running_output = ctx->config.initial_output + ctx->config.output_step;
+            ctx->running_output = ctx->relay_bias + ctx->relay_amplitude;
         }
         else
         {
-            ctx->running_output = ctx->config.initial_output - ctx->config.output_step;
+            ctx->running_output = ctx->relay_bias - ctx->relay_amplitude;
         }
 
         // Clamp output
@@ -240,15 +319,23 @@ float pid_autotune_update(autotune_context_t *ctx, float input)
 
     case AUTOTUNE_STATE_CALCULATING:
     {
-        // Calculate ultimate gain and period from collected data
-
-        // Calculate amplitude (average peak-to-peak)
-        float amplitude_high = calculate_amplitude(ctx->peak_high, ctx->peak_count);
-        float amplitude_low = calculate_amplitude(ctx->peak_low, ctx->peak_count);
-        float amplitude = (amplitude_high + amplitude_low) / 2.0f;
+        // Calculate ultimate gain and period from the most recent
+        // (best balanced) cycles
+        if (ctx->cycle_count < AUTOTUNE_RESULT_CYCLES)
+        {
+            ESP_LOGE(TAG, "Not enough oscillation cycles: %u", ctx->cycle_count);
+            ctx->state = AUTOTUNE_STATE_FAILED;
+            return 0.0f;
+        }
 
-        // Calculate period (average time between peaks)
-        float period = calculate_period(ctx->peak_timestamps, ctx->peak_count);
+        float amplitude = 0.0f;
+        float period = 0.0f;
+        float ku = 0.0f;
+        for (uint8_t i = ctx->cycle_count - AUTOTUNE_RESULT_CYCLES; i < ctx->cycle_count; i++)
+        {
+            amplitude += ctx->cycle_amplitude[i] / AUTOTUNE_RESULT_CYCLES;
+            period += ctx->cycle_period[i] / AUTOTUNE_RESULT_CYCLES;
+        }
 
         if (amplitude < 0.1f || period < 1.0f)
         {
@@ -258,22 +345,23 @@ float pid_autotune_update(autotune_context_t *ctx, float input)
             return 0.0f;
         }
 
-        // Calculate ultimate gain: Ku = 4 * d / (π * a)
-        // where d is relay amplitude and a is oscillation amplitude
-        float relay_amplitude = ctx->config.output_step;
-        float ku = (4.0f * relay_amplitude) / (M_PI * amplitude);
+        // Ku from the fundamental of the applied (possibly asymmetric) relay
+        for (uint8_t i = ctx->cycle_count - AUTOTUNE_RESULT_CYCLES; i < ctx->cycle_count; i++)
+        {
+            ku += cycle_ultimate_gain(ctx, i) / AUTOTUNE_RESULT_CYCLES;
+        }
 
-        // Get tuning rule coefficients
-        tuning_coefficients_t coeffs = tuning_rules[ctx->rule];
+        // Let simulation on the fitted model pick the rule if asked to
+        if (ctx->config.select_rule &&
+            pid_rule_select(ku, period, ctx->config.setpoint, &ctx->ranking))
+        {
+            ctx->rule = ctx->ranking.entries[0].rule;
+            ESP_LOGI(TAG, "Rule selected by simulation: %s", pid_autotune_rule_name(ctx->rule));
+        }
 
         // Calculate PID parameters
-        float kp = ku * coeffs.kp_factor;
-        float ti = period / coeffs.ti_factor;  // Integral time
-        float td = period * coeffs.td_factor;  // Derivative time
-
-        // Convert to PID gains
-        float ki = kp / ti;
-        float kd = kp * td;
+        float kp, ki, kd;
+        pid_autotune_rule_gains(ctx->rule, ku, period, &kp, &ki, &kd);
 
         // Store results
         ctx->result.kp = kp;
@@ -281,7 +369,8 @@ float pid_autotune_update(autotune_context_t *ctx, float input)
         ctx->result.kd = kd;
         ctx->result.ultimate_gain = ku;
         ctx->result.ultimate_period = period;
-        ctx->result.cycles_observed = ctx->peak_count;
+        ctx->result.cycles_observed = ctx->cycle_count;
+        ctx->result.relay_bias = ctx->relay_bias;
         ctx->result.final_state = AUTOTUNE_STATE_COMPLETE;
 
         ctx->state = AUTOTUNE_STATE_COMPLETE;
@@ -289,6 +378,7 @@ float pid_autotune_update(autotune_context_t *ctx, float input)
         ESP_LOGI(TAG, "Auto-tune complete!");
         ESP_LOGI(TAG, "  Ultimate gain (Ku): %.3f", ku);
         ESP_LOGI(TAG, "  Ultimate period (Tu): %.1f seconds", period);
+        ESP_LOGI(TAG, "  Balanced relay bias: %.1f%%", ctx->relay_bias);
         ESP_LOGI(TAG, "  Calculated Kp: %.3f", kp);
         ESP_LOGI(TAG, "  Calculated Ki: %.3f", ki);
         ESP_LOGI(TAG, "  Calculated Kd: %.3f", kd);
@@ -300,6 +390,50 @@ float pid_autotune_update(autotune_context_t *ctx, float input)
     return 0.0f;
 }
 
+void pid_autotune_rule_gains(tuning_rule_t rule, float ku, float tu,
+                             float *kp, float *ki, float *kd)
+{
+    if (!kp || !ki || !kd) return;
+
+    if (rule >= TUNING_RULE_COUNT)
+    {
+        rule = TUNING_RULE_TYREUS_LUYBEN;
+    }
+
+    // Get tuning rule coefficients
+    tuning_coefficients_t coeffs = tuning_rules[rule];
+
+    // Calculate PID parameters
+    float ti = tu / coeffs.ti_factor;  // Integral time
+    float td = tu * coeffs.td_factor;  // Derivative time
+
+    // Convert to PID gains
+    *kp = ku * coeffs.kp_factor;
+    *ki = *kp / ti;
+    *kd = *kp * td;
+}
+
+const char *pid_autotune_rule_name(tuning_rule_t rule)
+{
+    static const char *names[] = {
+        [TUNING_RULE_ZIEGLER_NICHOLS_CLASSIC] = "ZN",
+        [TUNING_RULE_ZIEGLER_NICHOLS_PESSEN] = "Pessen",
+        [TUNING_RULE_ZIEGLER_NICHOLS_SOME_OVERSHOOT] = "ZN-SO",
+        [TUNING_RULE_ZIEGLER_NICHOLS_NO_OVERSHOOT] = "ZN-NO",
+        [TUNING_RULE_TYREUS_LUYBEN] = "TL",
+    };
+
+    return (rule < TUNING_RULE_COUNT) ? names[rule] : "?";
+}
+
+bool pid_autotune_get_ranking(const autotune_context_t *ctx, rule_ranking_t *ranking)
+{
+    if (!ctx || !ranking || ctx->ranking.count == 0) return false;
+
+    *ranking = ctx->ranking;
+    return true;
+}
+
 bool pid_autotune_is_complete(const autotune_context_t *ctx)
 {
     if (!ctx) return false;
@@ -373,9 +507,10 @@ uint8_t pid_autotune_get_progress(const autotune_context_t *ctx)
     case AUTOTUNE_STATE_RELAY_STEP_UP:
     case AUTOTUNE_STATE_RELAY_STEP_DOWN:
     case AUTOTUNE_STATE_MEASURE_PERIOD:
-        // Progress based on peaks collected
+        // Progress based on cycles collected
         if (ctx->config.max_cycles == 0) return 50;
-        return (ctx->peak_count * 90) / ctx->config.max_cycles;
+        if (ctx->cycle_count >= ctx->config.max_cycles) return 90;
+        return (ctx->cycle_count * 90) / ctx->config.max_cycles;
 
     case AUTOTUNE_STATE_CALCULATING:
         return 95;
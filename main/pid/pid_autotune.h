@@ -12,6 +12,16 @@
  * 3. Measures ultimate gain (Ku) and period (Tu)
  * 4. Calculates PID parameters using Ziegler-Nichols rules
  *
+ * Heating is strongly asymmetric (2200W up, passive cooling down), so a
+ * relay centred on a fixed output gives lopsided oscillations. After every
+ * cycle the relay centre (bias) is moved toward equal high and low
+ * half-periods, and Ku is computed from the fundamental of the relay
+ * waveform actually applied, which corrects for any remaining asymmetry.
+ * The test ends early once two consecutive balanced cycles agree.
+ *
+ * With rule selection enabled, step 4 first simulates every rule against
+ * a model fitted to Ku/Tu and uses the best-scoring one (pid_rule_select.h).
+ *
  * @author Insta Retrofit Development Team
  * @date 2025
  */
@@ -27,6 +37,8 @@
 // Type Definitions
 // =============================================================================
 
+#define AUTOTUNE_MAX_CYCLES 10   ///< Full oscillation cycles recorded
+
 /**
  * @brief Auto-tune state machine states
  */
@@ -49,9 +61,10 @@ typedef struct
     float setpoint;              ///< Target temperature for tuning (°C)
     float output_step;           ///< Relay output step size (0-100%)
     float noise_band;            ///< Noise band to ignore (°C)
-    uint32_t max_cycles;         ///< Maximum oscillation cycles to observe
+    uint32_t max_cycles;         ///< Maximum full oscillation cycles to observe
     uint32_t timeout_seconds;    ///< Maximum tuning time (safety)
     float initial_output;        ///< Starting output level (%)
+    bool select_rule;            ///< Pick the rule by simulation (single loop only)
 } autotune_config_t;
 
 /**
@@ -65,6 +78,7 @@ typedef struct
     float ultimate_gain;         ///< Measured ultimate gain (Ku)
     float ultimate_period;       ///< Measured ultimate period (Tu) in seconds
     uint32_t cycles_observed;    ///< Number of oscillation cycles observed
+    float relay_bias;            ///< Balanced relay centre: output that holds the setpoint (%)
     autotune_state_t final_state;///< Final state of auto-tune
 } autotune_result_t;
 
@@ -78,8 +92,33 @@ typedef enum
     TUNING_RULE_ZIEGLER_NICHOLS_SOME_OVERSHOOT, ///< Some overshoot variant
     TUNING_RULE_ZIEGLER_NICHOLS_NO_OVERSHOOT,   ///< No overshoot variant
     TUNING_RULE_TYREUS_LUYBEN,           ///< Tyreus-Luyben: Conservative
+    TUNING_RULE_COUNT                    ///< Number of rules
 } tuning_rule_t;
 
+/**
+ * @brief Simulated performance of one tuning rule
+ */
+typedef struct
+{
+    tuning_rule_t rule;
+    float kp;
+    float ki;
+    float kd;
+    float overshoot;             ///< Worst overshoot on heat-up (°C)
+    float settle_time;           ///< Worst time to stay within the settle band (s)
+    float recovery_iae;          ///< Worst integral error after a load step (°C*s)
+    float score;                 ///< Weighted cost, lower is better
+} rule_score_t;
+
+/**
+ * @brief Rules ranked best first
+ */
+typedef struct
+{
+    rule_score_t entries[TUNING_RULE_COUNT];
+    uint8_t count;               ///< 0 = no ranking (selection off or failed)
+} rule_ranking_t;
+
 /**
  * @brief Auto-tune context structure
  *
@@ -97,22 +136,30 @@ typedef struct
     uint32_t start_time_sec;
     bool relay_output_high;
 
-    // Oscillation detection
-    float peak_high[10];         ///< Buffer for peak highs
-    float peak_low[10];          ///< Buffer for peak lows
-    uint32_t peak_timestamps[10];///< Timestamps of peaks
-    uint8_t peak_count;
-    uint8_t peak_index;
+    // Relay
+    float relay_bias;            ///< Relay centre output (%), balanced every cycle
+    float relay_amplitude;       ///< Relay half-swing d (%)
+    float relay_amplitude_max;   ///< Configured half-swing
+    bool cycle_started;          ///< A cycle (low-to-high switch) is being timed
+    uint32_t cycle_start_sec;    ///< Time of the low-to-high switch
+    uint32_t high_time_sec;      ///< Output-high time of the running cycle
+    float cycle_max;             ///< Highest input in the running cycle
+    float cycle_min;             ///< Lowest input in the running cycle
+
+    // Completed cycles
+    float cycle_amplitude[AUTOTUNE_MAX_CYCLES]; ///< Half peak-to-peak (°C)
+    float cycle_period[AUTOTUNE_MAX_CYCLES];    ///< Period (s)
+    float cycle_duty[AUTOTUNE_MAX_CYCLES];      ///< Output-high share of the period
+    float cycle_relay[AUTOTUNE_MAX_CYCLES];     ///< Relay half-swing used (%)
+    uint8_t cycle_count;
 
     // Measurement state
     float last_input;
-    bool just_changed;
-    uint32_t last_change_time_sec;
-    bool is_peak_detected;
     float running_output;
 
     // Results
     autotune_result_t result;
+    rule_ranking_t ranking;      ///< Simulated rule ranking (select_rule only)
 
 } autotune_context_t;
 
@@ -219,6 +266,33 @@ autotune_state_t pid_autotune_get_state(const autotune_context_t *ctx);
  */
 uint8_t pid_autotune_get_progress(const autotune_context_t *ctx);
 
+/**
+ * @brief Compute PID gains for a tuning rule
+ *
+ * @param rule Tuning rule
+ * @param ku Ultimate gain
+ * @param tu Ultimate period (s)
+ * @param[out] kp Proportional gain
+ * @param[out] ki Integral gain
+ * @param[out] kd Derivative gain
+ */
+void pid_autotune_rule_gains(tuning_rule_t rule, float ku, float tu,
+                             float *kp, float *ki, float *kd);
+
+/**
+ * @brief Short rule name for the display (max 6 characters)
+ */
+const char *pid_autotune_rule_name(tuning_rule_t rule);
+
+/**
+ * @brief Get the simulated rule ranking of the last run
+ *
+ * @param ctx Pointer to auto-tune context
+ * @param ranking Pointer to structure to receive the ranking
+ * @return true if a ranking is available
+ */
+bool pid_autotune_get_ranking(const autotune_context_t *ctx, rule_ranking_t *ranking);
+
 /**
  * @brief Create default auto-tune configuration
  *
@@ -0,0 +1,149 @@
+/**
+ * @file pid_batch.c
+ * @brief Batched plant/controller simulation implementation
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#include "pid_batch.h"
+#include "esp_log.h"
+#include <string.h>
+
+static const char *TAG = "pid_batch";
+
+void pid_batch_init(pid_batch_t *batch, float dt, float setpoint, float output_min, float output_max)
+{
+    if (!batch)
+    {
+        return;
+    }
+
+    memset(batch, 0, sizeof(pid_batch_t));
+    batch->dt = (dt > 0.0f) ? dt : 1.0f;
+    batch->dt_q16 = Q16_FROM_FLOAT(batch->dt);
+    batch->setpoint = setpoint;
+    batch->output_min = Q16_FROM_FLOAT(output_min);
+    batch->output_max = Q16_FROM_FLOAT(output_max);
+}
+
+int pid_batch_add_lane(pid_batch_t *batch, const batch_plant_t *plant, float kp, float ki, float kd)
+{
+    if (!batch || !plant || batch->count >= PID_BATCH_MAX_LANES || plant->capacity <= 0.0f)
+    {
+        return -1;
+    }
+
+    uint16_t lane = batch->count++;
+
+    float delay = plant->dead_time / batch->dt + 0.5f;
+    if (delay >= PID_BATCH_MAX_DELAY_STEPS)
+    {
+        ESP_LOGW(TAG, "Lane %u: dead time %.0fs truncated to %d steps",
+                 lane, plant->dead_time, PID_BATCH_MAX_DELAY_STEPS - 1);
+        delay = PID_BATCH_MAX_DELAY_STEPS - 1;
+    }
+    batch->delay_steps[lane] = (delay > 0.0f) ? (uint16_t)delay : 0;
+
+    batch->temperature[lane] = plant->initial_temp;
+    batch->heater_watts[lane] = plant->heater_watts;
+    batch->capacity[lane] = plant->capacity;
+    batch->loss_coefficient[lane] = plant->loss_coefficient;
+    batch->ambient[lane] = plant->ambient;
+    batch->peak_temp[lane] = plant->initial_temp;
+
+    // Plant has been sitting at its initial temperature
+    for (int row = 0; row < PID_BATCH_MAX_DELAY_STEPS; row++)
+    {
+        batch->history[row][lane] = plant->initial_temp;
+    }
+
+    batch->kp[lane] = Q16_FROM_FLOAT(kp);
+    batch->ki[lane] = Q16_FROM_FLOAT(ki);
+    batch->kd_dt[lane] = Q16_FROM_FLOAT(kd / batch->dt);
+    batch->integral_limit[lane] = Q16_FROM_FLOAT(PID_FIXED_INTEGRAL_LIMIT(ki, q16_to_float(batch->output_max)));
+
+    return lane;
+}
+
+void pid_batch_set_setpoint(pid_batch_t *batch, float setpoint)
+{
+    if (batch)
+    {
+        batch->setpoint = setpoint;
+    }
+}
+
+void pid_batch_step(pid_batch_t *batch)
+{
+    if (!batch)
+    {
+        return;
+    }
+
+    const uint16_t n = batch->count;
+    const float dt = batch->dt;
+    const float setpoint = batch->setpoint;
+    const q16_t setpoint_q16 = Q16_FROM_FLOAT(setpoint);
+    const q16_t dt_q16 = batch->dt_q16;
+    const q16_t output_min = batch->output_min;
+    const q16_t output_max = batch->output_max;
+
+    // Record this step's temperatures, then read each lane's delayed one
+    float *row = batch->history[batch->head];
+    for (uint16_t i = 0; i < n; i++)
+    {
+        row[i] = batch->temperature[i];
+    }
+    for (uint16_t i = 0; i < n; i++)
+    {
+        uint16_t read = (batch->head + PID_BATCH_MAX_DELAY_STEPS - batch->delay_steps[i]) % PID_BATCH_MAX_DELAY_STEPS;
+        batch->measured[i] = batch->history[read][i];
+    }
+
+    // Controllers - same law as pid_fixed_update()
+    for (uint16_t i = 0; i < n; i++)
+    {
+        q16_t error = setpoint_q16 - Q16_FROM_FLOAT(batch->measured[i]);
+        batch->output[i] = pid_fixed_law(&batch->integral[i], &batch->prev_error[i], error,
+                                         batch->kp[i], batch->ki[i], dt_q16, batch->kd_dt[i],
+                                         output_min, output_max, batch->integral_limit[i]);
+    }
+
+    // Plants and figures of merit
+    for (uint16_t i = 0; i < n; i++)
+    {
+        float temperature = pid_batch_plant_step(batch->temperature[i], q16_to_float(batch->output[i]),
+                                                 batch->heater_watts[i], batch->loss_coefficient[i],
+                                                 batch->ambient[i], batch->load_watts[i],
+                                                 batch->capacity[i], dt);
+        batch->temperature[i] = temperature;
+
+        float deviation = setpoint - temperature;
+        batch->iae[i] += ((deviation < 0.0f) ? -deviation : deviation) * dt;
+        batch->peak_temp[i] = (temperature > batch->peak_temp[i]) ? temperature : batch->peak_temp[i];
+    }
+
+    batch->head = (batch->head + 1) % PID_BATCH_MAX_DELAY_STEPS;
+}
+
+void pid_batch_run(pid_batch_t *batch, uint32_t steps)
+{
+    for (uint32_t s = 0; s < steps; s++)
+    {
+        pid_batch_step(batch);
+    }
+}
+
+bool pid_batch_get_result(const pid_batch_t *batch, int lane, batch_result_t *result)
+{
+    if (!batch || !result || lane < 0 || lane >= batch->count)
+    {
+        return false;
+    }
+
+    result->iae = batch->iae[lane];
+    result->peak_temp = batch->peak_temp[lane];
+    result->final_temp = batch->temperature[lane];
+    return true;
+}
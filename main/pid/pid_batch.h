@@ -0,0 +1,189 @@
+/**
+ * @file pid_batch.h
+ * @brief Batched plant/controller simulation for tuning sweeps
+ *
+ * Runs many independent (plant, PID) pairs in lockstep. Every per-lane
+ * quantity is stored in its own array (structure of arrays). The loops in
+ * pid_batch_step() therefore run straight down contiguous memory and the
+ * compiler can auto-vectorize them. Comparing thousands of candidate
+ * gains against a spread of plants takes seconds on a host.
+ *
+ * The controller in each lane is pid_fixed_law(), the same inline code as
+ * the fixed-point PID kernel. A lane's outputs are bit-identical to a
+ * pid_fixed_t driven with the same measurements. The plant is the
+ * simulation-mode heat balance (see sensors.c) with an added transport
+ * delay and an external load:
+ *
+ *     C * dT/dt = P_max * u - k * (T - T_ambient) - P_load
+ *
+ * Capacity is fixed at build time (PID_BATCH_MAX_LANES) because the
+ * firmware does not allocate dynamically. Host builds can raise it on the
+ * compiler command line.
+ *
+ * Validation covers pid_fixed only: test_pid_batch_matches_scalar checks
+ * lanes against pid_fixed_update(). The float pid_controller_update() the
+ * firmware runs is NOT covered by the batch. It is only compared with
+ * pid_fixed on one step response (test_pid_fixed_matches_float, within
+ * 0.5%), so confirm gains picked from a sweep on the float controller
+ * before shipping them. The repo has no host sweep target; a sweep needs
+ * its own driver around pid_batch_run().
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#ifndef PID_BATCH_H
+#define PID_BATCH_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "pid_fixed.h"
+
+// =============================================================================
+// Configuration
+// =============================================================================
+
+#ifndef PID_BATCH_MAX_LANES
+#define PID_BATCH_MAX_LANES 32      ///< Lanes per batch (override for host sweeps)
+#endif
+
+#ifndef PID_BATCH_MAX_DELAY_STEPS
+#define PID_BATCH_MAX_DELAY_STEPS 32 ///< Longest plant dead time, in steps
+#endif
+
+// =============================================================================
+// Type Definitions
+// =============================================================================
+
+/**
+ * @brief Plant parameters for one lane
+ */
+typedef struct
+{
+    float heater_watts;      ///< Heater power at 100% (W)
+    float capacity;          ///< Heat capacity (J/°C)
+    float loss_coefficient;  ///< Loss to ambient (W/°C)
+    float ambient;           ///< Ambient temperature (°C)
+    float dead_time;         ///< Heater-to-thermocouple delay (s)
+    float initial_temp;      ///< Starting temperature (°C)
+} batch_plant_t;
+
+/**
+ * @brief Per-lane figures of merit
+ */
+typedef struct
+{
+    float iae;               ///< Integral of |setpoint - temperature| (°C*s)
+    float peak_temp;         ///< Highest temperature reached (°C)
+    float final_temp;        ///< Temperature after the last step (°C)
+} batch_result_t;
+
+/**
+ * @brief Batch state (structure of arrays)
+ *
+ * Large - keep it static, not on a task stack.
+ */
+typedef struct
+{
+    uint16_t count;                         ///< Lanes in use
+    uint16_t head;                          ///< Delay line write row
+    float dt;                               ///< Step (s)
+    float setpoint;                         ///< Common setpoint (°C)
+    q16_t dt_q16;
+    q16_t output_min;
+    q16_t output_max;
+
+    // Plant
+    float temperature[PID_BATCH_MAX_LANES];
+    float heater_watts[PID_BATCH_MAX_LANES];
+    float capacity[PID_BATCH_MAX_LANES];
+    float loss_coefficient[PID_BATCH_MAX_LANES];
+    float ambient[PID_BATCH_MAX_LANES];
+    float load_watts[PID_BATCH_MAX_LANES];  ///< External load, set by the caller between steps
+    uint16_t delay_steps[PID_BATCH_MAX_LANES];
+    float history[PID_BATCH_MAX_DELAY_STEPS][PID_BATCH_MAX_LANES]; ///< Past temperatures, row per step
+    float measured[PID_BATCH_MAX_LANES];    ///< Delayed temperature seen by the controller
+
+    // Controller
+    q16_t kp[PID_BATCH_MAX_LANES];
+    q16_t ki[PID_BATCH_MAX_LANES];
+    q16_t kd_dt[PID_BATCH_MAX_LANES];
+    q16_t integral_limit[PID_BATCH_MAX_LANES];
+    q16_t integral[PID_BATCH_MAX_LANES];
+    q16_t prev_error[PID_BATCH_MAX_LANES];
+    q16_t output[PID_BATCH_MAX_LANES];
+
+    // Figures of merit
+    float iae[PID_BATCH_MAX_LANES];
+    float peak_temp[PID_BATCH_MAX_LANES];
+} pid_batch_t;
+
+// =============================================================================
+// Plant Model
+// =============================================================================
+
+/**
+ * @brief Advance one plant by one step
+ *
+ * Same term order as sensor_sim_update_temperature(), so a scalar
+ * reference gives the same floats on the same compiler.
+ *
+ * @param temperature Current temperature (°C)
+ * @param power Heater output (%)
+ * @return Temperature after the step (°C)
+ */
+static inline float pid_batch_plant_step(float temperature, float power, float heater_watts,
+                                         float loss_coefficient, float ambient, float load_watts,
+                                         float capacity, float dt)
+{
+    float heating_input = (power / 100.0f) * heater_watts;
+    float heat_loss = loss_coefficient * (temperature - ambient);
+    float net_heat_flow = heating_input - heat_loss - load_watts;
+    return temperature + (net_heat_flow * dt) / capacity;
+}
+
+// =============================================================================
+// Function Prototypes
+// =============================================================================
+
+/**
+ * @brief Clear the batch
+ *
+ * @param batch Batch state
+ * @param dt Step (s)
+ * @param setpoint Initial setpoint (°C)
+ * @param output_min Lower output limit (%)
+ * @param output_max Upper output limit (%)
+ */
+void pid_batch_init(pid_batch_t *batch, float dt, float setpoint, float output_min, float output_max);
+
+/**
+ * @brief Add a (plant, gains) lane
+ *
+ * @return Lane index, or -1 if the batch is full
+ */
+int pid_batch_add_lane(pid_batch_t *batch, const batch_plant_t *plant, float kp, float ki, float kd);
+
+/**
+ * @brief Change the common setpoint (takes effect on the next step)
+ */
+void pid_batch_set_setpoint(pid_batch_t *batch, float setpoint);
+
+/**
+ * @brief Advance every lane by one step
+ */
+void pid_batch_step(pid_batch_t *batch);
+
+/**
+ * @brief Advance every lane by several steps
+ */
+void pid_batch_run(pid_batch_t *batch, uint32_t steps);
+
+/**
+ * @brief Read a lane's figures of merit
+ *
+ * @return false if the lane does not exist
+ */
+bool pid_batch_get_result(const pid_batch_t *batch, int lane, batch_result_t *result);
+
+#endif // PID_BATCH_H
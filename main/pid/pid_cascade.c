@@ -0,0 +1,269 @@
+/**
+ * @file pid_cascade.c
+ * @brief Cascade temperature control implementation
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#include "pid_cascade.h"
+#include "system_config.h"
+#include "esp_log.h"
+
+static const char *TAG = "pid_cascade";
+
+// =============================================================================
+// Internal Helpers
+// =============================================================================
+
+/**
+ * @brief Outer relay output (%) to core setpoint offset (°C) scale
+ *
+ * The outer relay test maps 0-100% onto -max..+max core excess.
+ */
+static float outer_relay_scale(void)
+{
+    return (2.0f * CASCADE_MAX_CORE_EXCESS) / 100.0f;
+}
+
+static void set_core_setpoint(pid_cascade_t *cascade, float core_setpoint)
+{
+    cascade->core_setpoint = CLAMP(core_setpoint,
+                                   cascade->surface_setpoint - CASCADE_MAX_CORE_EXCESS,
+                                   cascade->surface_setpoint + CASCADE_MAX_CORE_EXCESS);
+    cascade->inner.config.setpoint = cascade->core_setpoint;
+}
+
+// =============================================================================
+// Public Interface
+// =============================================================================
+
+void pid_cascade_init(pid_cascade_t *cascade, pid_config_t outer_config, pid_config_t inner_config)
+{
+    if (!cascade)
+    {
+        return;
+    }
+
+    outer_config.output_min = -CASCADE_MAX_CORE_EXCESS;
+    outer_config.output_max = CASCADE_MAX_CORE_EXCESS;
+    inner_config.setpoint = outer_config.setpoint;
+    inner_config.output_min = 0.0f;
+    inner_config.output_max = 100.0f;
+
+    pid_controller_init(&cascade->outer, outer_config);
+    pid_controller_init(&cascade->inner, inner_config);
+
+    cascade->surface_setpoint = outer_config.setpoint;
+    cascade->core_setpoint = outer_config.setpoint;
+    cascade->core_estimate = 0.0f;
+    cascade->core_measured = false;
+    cascade->initialized = false;
+
+    ESP_LOGI(TAG, "Cascade initialized: outer Kp=%.2f Ki=%.3f Kd=%.2f, inner Kp=%.2f Ki=%.3f Kd=%.2f",
+             outer_config.kp, outer_config.ki, outer_config.kd,
+             inner_config.kp, inner_config.ki, inner_config.kd);
+}
+
+void pid_cascade_set_setpoint(pid_cascade_t *cascade, float setpoint)
+{
+    if (!cascade)
+    {
+        return;
+    }
+
+    cascade->surface_setpoint = setpoint;
+    pid_controller_set_setpoint(&cascade->outer, setpoint, false);
+}
+
+void pid_cascade_set_gains(pid_cascade_t *cascade, cascade_loop_t loop,
+                           float kp, float ki, float kd)
+{
+    if (!cascade)
+    {
+        return;
+    }
+
+    pid_controller_t *pid = (loop == CASCADE_LOOP_INNER) ? &cascade->inner : &cascade->outer;
+    pid_controller_set_gains(pid, kp, ki, kd);
+}
+
+void pid_cascade_set_feedforward(pid_cascade_t *cascade, float feedforward)
+{
+    if (!cascade)
+    {
+        return;
+    }
+
+    // Holding power is a heater output, so it belongs to the inner loop
+    pid_controller_set_feedforward(&cascade->inner, feedforward);
+}
+
+void pid_cascade_preload(pid_cascade_t *cascade, float hold_output)
+{
+    if (!cascade)
+    {
+        return;
+    }
+
+    pid_controller_preload(&cascade->inner, hold_output);
+}
+
+void pid_cascade_track(pid_cascade_t *cascade, float surface_temp, float applied_power, float dt)
+{
+    if (!cascade || dt <= 0.0f)
+    {
+        return;
+    }
+
+    if (!cascade->initialized)
+    {
+        // Cold start: element and face are at the same temperature
+        cascade->core_estimate = surface_temp;
+        cascade->initialized = true;
+        return;
+    }
+
+    if (cascade->core_measured)
+    {
+        cascade->core_measured = false;
+        return;
+    }
+
+    // First-order lag toward the steady core temperature for this power
+    float steady_core = surface_temp + CASCADE_CORE_GAIN * (applied_power / 100.0f);
+    float alpha = dt / CASCADE_CORE_TIME_CONSTANT;
+    if (alpha > 1.0f)
+    {
+        alpha = 1.0f;
+    }
+    cascade->core_estimate += alpha * (steady_core - cascade->core_estimate);
+}
+
+void pid_cascade_set_core_measurement(pid_cascade_t *cascade, float core_temp)
+{
+    if (!cascade)
+    {
+        return;
+    }
+
+    cascade->core_estimate = core_temp;
+    cascade->core_measured = true;
+    cascade->initialized = true;
+}
+
+float pid_cascade_update(pid_cascade_t *cascade, float surface_temp)
+{
+    if (!cascade)
+    {
+        return 0.0f;
+    }
+
+    if (!cascade->initialized)
+    {
+        pid_cascade_track(cascade, surface_temp, 0.0f, 1.0f);
+    }
+
+    // Outer loop: surface error -> core setpoint
+    float core_offset = pid_controller_update(&cascade->outer, surface_temp);
+    set_core_setpoint(cascade, cascade->surface_setpoint + core_offset);
+
+    // Inner loop: core error -> heater power
+    float output = pid_controller_update(&cascade->inner, cascade->core_estimate);
+
+    ESP_LOGD(TAG, "Surface %.1f/%.1f°C, core %.1f/%.1f°C, output %.1f%%",
+             surface_temp, cascade->surface_setpoint,
+             cascade->core_estimate, cascade->core_setpoint, output);
+
+    return output;
+}
+
+float pid_cascade_get_core_temp(const pid_cascade_t *cascade)
+{
+    return cascade ? cascade->core_estimate : 0.0f;
+}
+
+float pid_cascade_get_core_setpoint(const pid_cascade_t *cascade)
+{
+    return cascade ? cascade->core_setpoint : 0.0f;
+}
+
+// =============================================================================
+// Auto-Tune Path
+// =============================================================================
+
+autotune_config_t pid_cascade_autotune_config(cascade_loop_t loop, float setpoint)
+{
+    autotune_config_t config = {
+        .setpoint = setpoint,
+        .output_step = 50.0f,
+        .noise_band = 2.0f,
+        .max_cycles = 5,
+        .timeout_seconds = 1800,
+        .initial_output = 0.0f
+    };
+
+    if (loop == CASCADE_LOOP_INNER)
+    {
+        // Core responds fast and cleanly - tighter band, shorter test
+        config.noise_band = 1.0f;
+        config.timeout_seconds = 900;
+    }
+    else
+    {
+        // Relay the core setpoint between -max and +max excess
+        config.initial_output = 50.0f;
+    }
+
+    return config;
+}
+
+float pid_cascade_autotune_input(const pid_cascade_t *cascade, cascade_loop_t loop, float surface_temp)
+{
+    if (!cascade || loop == CASCADE_LOOP_OUTER)
+    {
+        return surface_temp;
+    }
+
+    return cascade->core_estimate;
+}
+
+float pid_cascade_autotune_output(pid_cascade_t *cascade, cascade_loop_t loop, float relay_output)
+{
+    if (!cascade)
+    {
+        return 0.0f;
+    }
+
+    if (loop == CASCADE_LOOP_INNER)
+    {
+        return relay_output;
+    }
+
+    // Outer test: relay drives the core setpoint, inner loop stays closed
+    float offset = relay_output * outer_relay_scale() - CASCADE_MAX_CORE_EXCESS;
+    set_core_setpoint(cascade, cascade->surface_setpoint + offset);
+    return pid_controller_update(&cascade->inner, cascade->core_estimate);
+}
+
+void pid_cascade_apply_autotune(pid_cascade_t *cascade, cascade_loop_t loop, autotune_result_t *result)
+{
+    if (!cascade || !result)
+    {
+        return;
+    }
+
+    if (loop == CASCADE_LOOP_OUTER)
+    {
+        float scale = outer_relay_scale();
+        result->kp *= scale;
+        result->ki *= scale;
+        result->kd *= scale;
+    }
+
+    pid_cascade_set_gains(cascade, loop, result->kp, result->ki, result->kd);
+
+    ESP_LOGI(TAG, "%s loop tuned: Kp=%.3f Ki=%.4f Kd=%.3f",
+             (loop == CASCADE_LOOP_INNER) ? "Inner" : "Outer",
+             result->kp, result->ki, result->kd);
+}
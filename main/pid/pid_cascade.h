@@ -0,0 +1,183 @@
+/**
+ * @file pid_cascade.h
+ * @brief Cascade temperature control (heater core / platen surface)
+ *
+ * Splits the single heater loop into two PID controllers:
+ * - inner loop: drives heater power to hold an estimated heater-core
+ *   temperature; fast, so it reacts within seconds when a cold garment
+ *   pulls heat out of the platen
+ * - outer loop: sets the inner (core) setpoint from the surface error;
+ *   slow, tuned for the platen mass
+ *
+ * The press has a single thermocouple on the platen, so the core
+ * temperature is estimated with a first-order model anchored to the
+ * measured surface temperature: the core relaxes toward
+ * surface + CASCADE_CORE_GAIN * power with time constant
+ * CASCADE_CORE_TIME_CONSTANT. If a second sensor is fitted, its reading
+ * can be fed in instead with pid_cascade_set_core_measurement().
+ *
+ * The core setpoint is limited to the surface setpoint
+ * ± CASCADE_MAX_CORE_EXCESS, which bounds the heat stored in the element
+ * and keeps an open press from overshooting.
+ *
+ * Each loop keeps its own pid_controller_t and can be relay-tuned on its
+ * own (inner first, then outer with the inner loop closed) through the
+ * pid_cascade_autotune_*() helpers.
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#ifndef PID_CASCADE_H
+#define PID_CASCADE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "pid_controller.h"
+#include "pid_autotune.h"
+
+// =============================================================================
+// Type Definitions
+// =============================================================================
+
+/**
+ * @brief Cascade loop selector
+ */
+typedef enum
+{
+    CASCADE_LOOP_INNER, ///< Heater core loop (core temperature -> power)
+    CASCADE_LOOP_OUTER  ///< Surface loop (surface temperature -> core setpoint)
+} cascade_loop_t;
+
+/**
+ * @brief Cascade controller state
+ */
+typedef struct
+{
+    pid_controller_t outer;   ///< Surface loop; output is the core setpoint offset (°C)
+    pid_controller_t inner;   ///< Core loop; output is heater power (%)
+    float surface_setpoint;   ///< Surface target (°C)
+    float core_estimate;      ///< Estimated (or measured) core temperature (°C)
+    float core_setpoint;      ///< Inner loop setpoint from the outer loop (°C)
+    bool core_measured;       ///< core_estimate comes from a sensor this step
+    bool initialized;         ///< Core estimate has been seeded
+} pid_cascade_t;
+
+// =============================================================================
+// Function Prototypes
+// =============================================================================
+
+/**
+ * @brief Initialize the cascade controller
+ *
+ * @param cascade Cascade state
+ * @param outer_config Outer loop gains and surface setpoint (output limits are set here)
+ * @param inner_config Inner loop gains (setpoint and output limits are set here)
+ */
+void pid_cascade_init(pid_cascade_t *cascade, pid_config_t outer_config, pid_config_t inner_config);
+
+/**
+ * @brief Change the surface setpoint (bumpless)
+ */
+void pid_cascade_set_setpoint(pid_cascade_t *cascade, float setpoint);
+
+/**
+ * @brief Change one loop's gains (bumpless, integral rescaled)
+ */
+void pid_cascade_set_gains(pid_cascade_t *cascade, cascade_loop_t loop,
+                           float kp, float ki, float kd);
+
+/**
+ * @brief Set the inner loop feedforward (heater power, %)
+ */
+void pid_cascade_set_feedforward(pid_cascade_t *cascade, float feedforward);
+
+/**
+ * @brief Preload the inner loop integral for a known holding power
+ */
+void pid_cascade_preload(pid_cascade_t *cascade, float hold_output);
+
+/**
+ * @brief Advance the core model by one control step
+ *
+ * Call every control step, heating or not, with the power actually
+ * applied during the step so the estimate follows the element as it
+ * cools.
+ *
+ * @param cascade Cascade state
+ * @param surface_temp Measured surface temperature (°C)
+ * @param applied_power Heater power during the last step (%)
+ * @param dt Step length (s)
+ */
+void pid_cascade_track(pid_cascade_t *cascade, float surface_temp, float applied_power, float dt);
+
+/**
+ * @brief Use a measured core temperature for the next update
+ *
+ * For presses fitted with a second sensor near the element.
+ */
+void pid_cascade_set_core_measurement(pid_cascade_t *cascade, float core_temp);
+
+/**
+ * @brief Run both loops and calculate heater power
+ *
+ * @param cascade Cascade state
+ * @param surface_temp Measured surface temperature (°C)
+ * @return Heater power (0-100%)
+ */
+float pid_cascade_update(pid_cascade_t *cascade, float surface_temp);
+
+/**
+ * @brief Get the estimated core temperature
+ */
+float pid_cascade_get_core_temp(const pid_cascade_t *cascade);
+
+/**
+ * @brief Get the inner loop setpoint chosen by the outer loop
+ */
+float pid_cascade_get_core_setpoint(const pid_cascade_t *cascade);
+
+/**
+ * @brief Get the relay test configuration for one loop
+ *
+ * The inner loop is relayed directly on heater power around the core
+ * estimate. The outer loop relays the core setpoint between its limits
+ * (the 0-100% relay output is mapped onto ± CASCADE_MAX_CORE_EXCESS)
+ * with the inner loop closed.
+ *
+ * @param loop Loop to tune
+ * @param setpoint Surface target (°C)
+ * @return Auto-tune configuration
+ */
+autotune_config_t pid_cascade_autotune_config(cascade_loop_t loop, float setpoint);
+
+/**
+ * @brief Process variable the relay test of a loop should watch
+ *
+ * @return Core estimate for the inner loop, surface temperature for the outer
+ */
+float pid_cascade_autotune_input(const pid_cascade_t *cascade, cascade_loop_t loop, float surface_temp);
+
+/**
+ * @brief Convert a relay output into heater power
+ *
+ * @param cascade Cascade state
+ * @param loop Loop being tuned
+ * @param relay_output Auto-tune relay output (0-100%)
+ * @return Heater power (0-100%)
+ */
+float pid_cascade_autotune_output(pid_cascade_t *cascade, cascade_loop_t loop, float relay_output);
+
+/**
+ * @brief Convert relay-test gains into the loop's units and apply them
+ *
+ * Outer-loop relay gains are in %/°C; they are scaled to core °C per
+ * surface °C. The result is written back with the scaled values.
+ *
+ * @param cascade Cascade state
+ * @param loop Loop that was tuned
+ * @param[in,out] result Auto-tune result
+ */
+void pid_cascade_apply_autotune(pid_cascade_t *cascade, cascade_loop_t loop, autotune_result_t *result);
+
+#endif // PID_CASCADE_H
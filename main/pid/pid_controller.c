@@ -13,6 +13,22 @@
 
 static const char *TAG = "pid_controller";
 
+/**
+ * @brief Clamp the integral so Ki * integral stays within +/- output_max
+ *
+ * With Ki = 0 the accumulator does not reach the output and keeps the
+ * output_max bound in °C*s.
+ */
+static void pid_clamp_integral(pid_controller_t *pid)
+{
+    float integral_limit = pid->config.output_max;
+    if (pid->config.ki > 0.0f)
+    {
+        integral_limit /= pid->config.ki;
+    }
+    pid->integral = CLAMP(pid->integral, -integral_limit, integral_limit);
+}
+
 void pid_controller_init(pid_controller_t *pid, pid_config_t config)
 {
     if (!pid)
@@ -26,6 +42,7 @@ void pid_controller_init(pid_controller_t *pid, pid_config_t config)
     pid->prev_error = 0.0f;
     pid->last_update_us = esp_timer_get_time();
     pid->last_output = 0.0f;
+    pid->feedforward = 0.0f;
 
     ESP_LOGI(TAG, "PID controller initialized: Kp=%.2f, Ki=%.2f, Kd=%.2f, setpoint=%.1f°C",
              config.kp, config.ki, config.kd, config.setpoint);
@@ -62,37 +79,36 @@ float pid_controller_update(pid_controller_t *pid, float measurement)
     // Proportional term
     float p_term = pid->config.kp * error;
 
-    // Integral term with anti-windup protection
-    pid->integral += error * dt;
+    // Derivative term (with derivative on measurement to avoid kick)
+    float derivative = (error - pid->prev_error) / dt;
+    float d_term = pid->config.kd * derivative;
+    pid->prev_error = error;
 
-    // Clamp integral to prevent windup
-    float integral_limit = pid->config.output_max;
-    if (pid->integral > integral_limit)
-    {
-        pid->integral = integral_limit;
-    }
-    else if (pid->integral < -integral_limit)
+    // Integral term with anti-windup protection: conditional integration
+    // holds the integral while the output is saturated and the error would
+    // drive it further in, so a full-power heat-up does not wind it up
+    float integral = pid->integral + error * dt;
+    float unclamped = p_term + pid->config.ki * integral + d_term + pid->feedforward;
+    bool winding_up = (unclamped > pid->config.output_max && error > 0.0f) ||
+                      (unclamped < pid->config.output_min && error < 0.0f);
+    if (!winding_up)
     {
-        pid->integral = -integral_limit;
+        pid->integral = integral;
     }
+    pid_clamp_integral(pid);
 
     float i_term = pid->config.ki * pid->integral;
 
-    // Derivative term (with derivative on measurement to avoid kick)
-    float derivative = (error - pid->prev_error) / dt;
-    float d_term = pid->config.kd * derivative;
-    pid->prev_error = error;
-
     // Calculate total output
-    float output = p_term + i_term + d_term;
+    float output = p_term + i_term + d_term + pid->feedforward;
 
     // Clamp output to configured limits
     output = CLAMP(output, pid->config.output_min, pid->config.output_max);
 
     pid->last_output = output;
 
-    ESP_LOGD(TAG, "PID update: temp=%.2f°C, error=%.2f, P=%.2f, I=%.2f, D=%.2f, output=%.2f",
-             measurement, error, p_term, i_term, d_term, output);
+    ESP_LOGD(TAG, "PID update: temp=%.2f°C, error=%.2f, P=%.2f, I=%.2f, D=%.2f, FF=%.2f, output=%.2f",
+             measurement, error, p_term, i_term, d_term, pid->feedforward, output);
 
     return output;
 }
@@ -132,6 +148,66 @@ void pid_controller_set_setpoint(pid_controller_t *pid, float new_setpoint, bool
     }
 }
 
+void pid_controller_set_gains(pid_controller_t *pid, float kp, float ki, float kd)
+{
+    if (!pid)
+    {
+        ESP_LOGE(TAG, "NULL PID controller pointer");
+        return;
+    }
+
+    // Keep Ki * integral constant across the change (bumpless transfer)
+    if (ki > 0.0f)
+    {
+        pid->integral *= pid->config.ki / ki;
+    }
+    else
+    {
+        pid->integral = 0.0f;
+    }
+
+    ESP_LOGI(TAG, "PID gains changed: Kp=%.3f Ki=%.4f Kd=%.3f", kp, ki, kd);
+
+    pid->config.kp = kp;
+    pid->config.ki = ki;
+    pid->config.kd = kd;
+    pid_clamp_integral(pid);
+}
+
+void pid_controller_set_feedforward(pid_controller_t *pid, float feedforward)
+{
+    if (!pid)
+    {
+        ESP_LOGE(TAG, "NULL PID controller pointer");
+        return;
+    }
+
+    pid->feedforward = feedforward;
+}
+
+void pid_controller_preload(pid_controller_t *pid, float hold_output)
+{
+    if (!pid)
+    {
+        ESP_LOGE(TAG, "NULL PID controller pointer");
+        return;
+    }
+
+    if (pid->config.ki > 0.0f)
+    {
+        pid->integral = (hold_output - pid->feedforward) / pid->config.ki;
+        pid_clamp_integral(pid);
+    }
+    else
+    {
+        pid->integral = 0.0f;
+    }
+    pid->prev_error = 0.0f;
+
+    ESP_LOGI(TAG, "PID integral preloaded for %.1f%% hold (I=%.1f, FF=%.1f)",
+             hold_output, pid->config.ki * pid->integral, pid->feedforward);
+}
+
 float pid_controller_get_output(const pid_controller_t *pid)
 {
     if (!pid)
@@ -34,6 +34,7 @@ typedef struct
     float prev_error;        ///< Previous error for derivative
     uint64_t last_update_us; ///< Last update timestamp (microseconds)
     float last_output;       ///< Last calculated output
+    float feedforward;       ///< Static term added before output clamping
 } pid_controller_t;
 
 // =============================================================================
@@ -55,8 +56,11 @@ void pid_controller_init(pid_controller_t *pid, pid_config_t config);
  * @brief Update PID controller and calculate output
  *
  * Implements the PID control algorithm with anti-windup protection
- * and output clamping. Should be called periodically at a consistent
- * rate for optimal performance.
+ * and output clamping. Anti-windup is conditional integration: the
+ * integral is held while the output is saturated and the error would
+ * drive it further in. The integral term (Ki * integral) is also bounded
+ * to +/- output_max. Should be called periodically at a consistent rate
+ * for optimal performance.
  *
  * @param pid Pointer to PID controller structure
  * @param measurement Current process variable (temperature)
@@ -86,6 +90,44 @@ void pid_controller_reset(pid_controller_t *pid);
  */
 void pid_controller_set_setpoint(pid_controller_t *pid, float new_setpoint, bool reset_integral);
 
+/**
+ * @brief Change PID gains without a bump in output
+ *
+ * Rescales the integral accumulator by old Ki / new Ki so the integral
+ * term (Ki * integral) is unchanged at the moment of the switch.
+ *
+ * @param pid Pointer to PID controller structure
+ * @param kp New proportional gain
+ * @param ki New integral gain
+ * @param kd New derivative gain
+ */
+void pid_controller_set_gains(pid_controller_t *pid, float kp, float ki, float kd);
+
+/**
+ * @brief Set the feedforward term
+ *
+ * Added to P + I + D before the output is clamped, so the loop only has
+ * to correct what the feedforward gets wrong. Kept across resets and
+ * setpoint changes; pass 0 to remove it.
+ *
+ * @param pid Pointer to PID controller structure
+ * @param feedforward Output added every update
+ */
+void pid_controller_set_feedforward(pid_controller_t *pid, float feedforward);
+
+/**
+ * @brief Preload the integral for a known holding output
+ *
+ * Sets the integral so that, at zero error, I + feedforward equals
+ * hold_output. Use on mode entry instead of letting the integral wind up
+ * from wherever the previous mode left it. The anti-windup limit is in
+ * output space, so any hold_output within the output range is reached.
+ *
+ * @param pid Pointer to PID controller structure
+ * @param hold_output Output expected to hold the setpoint
+ */
+void pid_controller_preload(pid_controller_t *pid, float hold_output);
+
 /**
  * @brief Get current PID output
  *
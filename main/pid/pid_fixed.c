@@ -0,0 +1,80 @@
+/**
+ * @file pid_fixed.c
+ * @brief Fixed-point PID setup (the kernel itself is inline in the header)
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#include "pid_fixed.h"
+#include "esp_log.h"
+#include <string.h>
+
+static const char *TAG = "pid_fixed";
+
+void pid_fixed_init(pid_fixed_t *pid, pid_config_t config, float dt)
+{
+    if (!pid)
+    {
+        ESP_LOGE(TAG, "NULL PID controller pointer");
+        return;
+    }
+
+    if (dt <= 0.0f)
+    {
+        dt = PID_FIXED_PRODUCTION_DT;
+    }
+
+    memset(pid, 0, sizeof(pid_fixed_t));
+    pid->setpoint = Q16_FROM_FLOAT(config.setpoint);
+    pid->dt = Q16_FROM_FLOAT(dt);
+    pid->output_min = Q16_FROM_FLOAT(config.output_min);
+    pid->output_max = Q16_FROM_FLOAT(config.output_max);
+    pid->kp = Q16_FROM_FLOAT(config.kp);
+    pid->ki = Q16_FROM_FLOAT(config.ki);
+    pid->kd_dt = Q16_FROM_FLOAT(config.kd / dt);
+    pid->integral_limit = Q16_FROM_FLOAT(PID_FIXED_INTEGRAL_LIMIT(config.ki, config.output_max));
+
+    ESP_LOGI(TAG, "Fixed-point PID initialized: Kp=%.2f, Ki=%.3f, Kd=%.2f, dt=%.3fs, setpoint=%.1f°C",
+             config.kp, config.ki, config.kd, dt, config.setpoint);
+}
+
+void pid_fixed_set_gains(pid_fixed_t *pid, float kp, float ki, float kd)
+{
+    if (!pid)
+    {
+        ESP_LOGE(TAG, "NULL PID controller pointer");
+        return;
+    }
+
+    // Keep Ki * integral constant across the change (bumpless transfer)
+    q16_t new_ki = Q16_FROM_FLOAT(ki);
+    pid->integral_limit = Q16_FROM_FLOAT(PID_FIXED_INTEGRAL_LIMIT(ki, q16_to_float(pid->output_max)));
+    if (new_ki > 0)
+    {
+        int64_t integral = ((int64_t)pid->state.integral * pid->ki) / new_ki;
+        pid->state.integral = q16_clamp(integral, -pid->integral_limit, pid->integral_limit);
+    }
+    else
+    {
+        pid->state.integral = 0;
+    }
+
+    pid->kp = Q16_FROM_FLOAT(kp);
+    pid->ki = new_ki;
+    pid->kd_dt = Q16_FROM_FLOAT(kd / q16_to_float(pid->dt));
+
+    ESP_LOGI(TAG, "Fixed-point PID gains changed: Kp=%.3f Ki=%.4f Kd=%.3f", kp, ki, kd);
+}
+
+void pid_fixed_reset(pid_fixed_t *pid)
+{
+    if (!pid)
+    {
+        ESP_LOGE(TAG, "NULL PID controller pointer");
+        return;
+    }
+
+    pid->state.integral = 0;
+    pid->state.prev_error = 0;
+}
@@ -0,0 +1,254 @@
+/**
+ * @file pid_fixed.h
+ * @brief Fixed-point (Q16.16) PID kernel
+ *
+ * pid_controller_update() works in float, reads the timer and formats a
+ * debug log on every call. That is fine at 1 Hz on one platen, but not for
+ * a 10-100 Hz loop or several zones. This kernel:
+ * - works in Q16.16 integer arithmetic (no FPU state, same result on
+ *   every target)
+ * - runs at a fixed step, so there is no timer read and no divide
+ * - folds Ki*dt and Kd/dt into the gains up front
+ * - clamps without branches
+ * - does no logging
+ *
+ * The control law matches pid_controller_update(): derivative on error,
+ * integral term (Ki * integral) clamped to +/- output_max, output clamped
+ * to the limits.
+ *
+ * PID_FIXED_DEFINE() generates a controller with its gains and limits as
+ * compile-time constants. The compiler then folds them into the
+ * instruction stream. pid_fixed_update() is the run-time-gain variant
+ * for gains edited from the menu.
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#ifndef PID_FIXED_H
+#define PID_FIXED_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "heating_contract.h"  // components/heating/include/ - For pid_config_t
+#include "system_config.h"    // components/system_config/include/ - Default gains
+
+// =============================================================================
+// Q16.16 Arithmetic
+// =============================================================================
+
+typedef int32_t q16_t; ///< Signed Q16.16 fixed-point value (range +/-32768, step 1.5e-5)
+
+#define Q16_SHIFT 16
+#define Q16_ONE ((q16_t)1 << Q16_SHIFT)
+
+/**
+ * @brief Convert a float to Q16.16, rounding to nearest
+ *
+ * Constant arguments are folded at compile time.
+ */
+#define Q16_FROM_FLOAT(x) ((q16_t)((x) * 65536.0f + (((x) >= 0.0f) ? 0.5f : -0.5f)))
+
+static inline float q16_to_float(q16_t value)
+{
+    return (float)value / 65536.0f;
+}
+
+/**
+ * @brief Q16.16 product, kept in 64 bits so the caller can sum terms unclamped
+ */
+static inline int64_t q16_mul(q16_t a, q16_t b)
+{
+    return ((int64_t)a * b) >> Q16_SHIFT;
+}
+
+/**
+ * @brief Clamp to [lo, hi] without branches
+ *
+ * Uses the sign of the difference as a mask (arithmetic right shift of a
+ * negative value, as GCC and Clang implement it).
+ */
+static inline q16_t q16_clamp(int64_t value, q16_t lo, q16_t hi)
+{
+    int64_t below = value - lo;
+    value -= below & (below >> 63);   // max(value, lo)
+    int64_t above = hi - value;
+    value += above & (above >> 63);   // min(value, hi)
+    return (q16_t)value;
+}
+
+/**
+ * @brief Integral limit (°C*s) that keeps Ki * integral within +/- output_max
+ *
+ * Capped at the Q16.16 range for very small Ki. With Ki = 0 the bound is
+ * output_max, as in pid_controller_update(). Constant arguments give a
+ * constant result.
+ */
+#define PID_FIXED_INTEGRAL_LIMIT(ki, output_max)                              \
+    (((ki) > 0.0f) ? (((output_max) / (ki) < 32767.0f) ? (output_max) / (ki) : 32767.0f) \
+                   : (output_max))
+
+// =============================================================================
+// Type Definitions
+// =============================================================================
+
+/**
+ * @brief Fixed-point PID state
+ */
+typedef struct
+{
+    q16_t integral;   ///< Integral of error (°C*s)
+    q16_t prev_error; ///< Error at the previous step (°C)
+} pid_fixed_state_t;
+
+/**
+ * @brief Fixed-point PID with run-time gains
+ *
+ * The derivative gain is stored pre-divided by the step (kd_dt = Kd/dt).
+ */
+typedef struct
+{
+    pid_fixed_state_t state;
+    q16_t setpoint;
+    q16_t kp;
+    q16_t ki;
+    q16_t dt;
+    q16_t kd_dt;
+    q16_t output_min;
+    q16_t output_max;
+    q16_t integral_limit; ///< PID_FIXED_INTEGRAL_LIMIT() of ki and output_max
+} pid_fixed_t;
+
+// =============================================================================
+// Kernel
+// =============================================================================
+
+/**
+ * @brief The control law on separate state words
+ *
+ * Shared by pid_fixed_kernel() and the batched simulator (pid_batch),
+ * which keeps integral and previous error in separate arrays. Both give
+ * bit-identical results.
+ *
+ * @param integral Integral of error, updated in place
+ * @param prev_error Previous error, updated in place
+ * @param integral_limit Anti-windup bound on the integral (PID_FIXED_INTEGRAL_LIMIT())
+ * @return Clamped output
+ *
+ * The integral is held while the output is saturated and the error would
+ * drive it further in (conditional integration).
+ */
+static inline __attribute__((always_inline)) q16_t pid_fixed_law(q16_t *integral, q16_t *prev_error, q16_t error,
+                                                                   q16_t kp, q16_t ki, q16_t dt, q16_t kd_dt,
+                                                                   q16_t output_min, q16_t output_max,
+                                                                   q16_t integral_limit)
+{
+    int64_t pd = q16_mul(kp, error) + q16_mul(kd_dt, error - *prev_error);
+    *prev_error = error;
+
+    // Conditional integration, as in pid_controller_update()
+    q16_t integral_next = q16_clamp((int64_t)*integral + q16_mul(error, dt), -integral_limit, integral_limit);
+    int64_t unclamped = pd + q16_mul(ki, integral_next);
+    bool winding_up = (unclamped > output_max && error > 0) || (unclamped < output_min && error < 0);
+    if (!winding_up)
+    {
+        *integral = integral_next;
+    }
+
+    int64_t output = pd + q16_mul(ki, *integral);
+
+    return q16_clamp(output, output_min, output_max);
+}
+
+/**
+ * @brief One PID step
+ *
+ * Always inlined so constant gains from PID_FIXED_DEFINE() are folded in.
+ *
+ * @param state Integral and previous error
+ * @param error Setpoint - measurement (°C)
+ * @param kp Proportional gain
+ * @param ki Integral gain
+ * @param dt Step (s)
+ * @param kd_dt Derivative gain divided by the step
+ * @param output_min Lower output limit
+ * @param output_max Upper output limit
+ * @param integral_limit Anti-windup bound on the integral (PID_FIXED_INTEGRAL_LIMIT())
+ * @return Clamped output
+ */
+static inline __attribute__((always_inline)) q16_t pid_fixed_kernel(pid_fixed_state_t *state, q16_t error,
+                                                                      q16_t kp, q16_t ki, q16_t dt, q16_t kd_dt,
+                                                                      q16_t output_min, q16_t output_max,
+                                                                      q16_t integral_limit)
+{
+    return pid_fixed_law(&state->integral, &state->prev_error, error,
+                         kp, ki, dt, kd_dt, output_min, output_max, integral_limit);
+}
+
+/**
+ * @brief Define a controller with compile-time gains and limits
+ *
+ * Expands to `static inline q16_t <name>_update(pid_fixed_state_t *state,
+ * q16_t setpoint, q16_t measurement)`. All numeric arguments must be
+ * constant expressions.
+ */
+#define PID_FIXED_DEFINE(name, kp, ki, kd, dt, output_min, output_max)                          \
+    static inline q16_t name##_update(pid_fixed_state_t *state, q16_t setpoint, q16_t measurement) \
+    {                                                                                           \
+        return pid_fixed_kernel(state, setpoint - measurement,                                  \
+                                Q16_FROM_FLOAT(kp), Q16_FROM_FLOAT(ki), Q16_FROM_FLOAT(dt),     \
+                                Q16_FROM_FLOAT((kd) / (dt)),                                    \
+                                Q16_FROM_FLOAT(output_min), Q16_FROM_FLOAT(output_max),        \
+                                Q16_FROM_FLOAT(PID_FIXED_INTEGRAL_LIMIT(ki, output_max)));      \
+    }
+
+/**
+ * @brief Production configuration: default gains, 0-100% output
+ *
+ * Step is PID_MIN_UPDATE_INTERVAL_MS, the fastest rate the float
+ * controller accepts.
+ */
+#define PID_FIXED_PRODUCTION_DT (PID_MIN_UPDATE_INTERVAL_MS / 1000.0f)
+PID_FIXED_DEFINE(pid_fixed_production, PID_DEFAULT_KP, PID_DEFAULT_KI, PID_DEFAULT_KD,
+                 PID_FIXED_PRODUCTION_DT, 0.0f, 100.0f)
+
+/**
+ * @brief One step of a run-time-gain controller
+ *
+ * @param pid Controller
+ * @param measurement Process variable (°C, Q16.16)
+ * @return Clamped output (Q16.16)
+ */
+static inline q16_t pid_fixed_update(pid_fixed_t *pid, q16_t measurement)
+{
+    return pid_fixed_kernel(&pid->state, pid->setpoint - measurement,
+                            pid->kp, pid->ki, pid->dt, pid->kd_dt,
+                            pid->output_min, pid->output_max, pid->integral_limit);
+}
+
+// =============================================================================
+// Function Prototypes
+// =============================================================================
+
+/**
+ * @brief Initialize a run-time-gain controller from a float configuration
+ *
+ * @param pid Controller
+ * @param config Gains, setpoint and limits
+ * @param dt Fixed step (s)
+ */
+void pid_fixed_init(pid_fixed_t *pid, pid_config_t config, float dt);
+
+/**
+ * @brief Change gains without a bump in output
+ *
+ * Rescales the integral like pid_controller_set_gains().
+ */
+void pid_fixed_set_gains(pid_fixed_t *pid, float kp, float ki, float kd);
+
+/**
+ * @brief Clear the integral and previous error
+ */
+void pid_fixed_reset(pid_fixed_t *pid);
+
+#endif // PID_FIXED_H
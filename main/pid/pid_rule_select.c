@@ -0,0 +1,225 @@
+/**
+ * @file pid_rule_select.c
+ * @brief Tuning rule selection implementation
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#include "pid_rule_select.h"
+#include "pid_batch.h"
+#include "system_config.h"
+#include "esp_log.h"
+#include <math.h>
+#include <string.h>
+
+static const char *TAG = "pid_rule_select";
+
+#define RULE_PLANT_VARIANTS 3          ///< Nominal, more dead time, more gain
+#define RULE_SETTLE_BAND 2.0f          ///< Settled when within this of setpoint (°C)
+#define RULE_LOAD_FRACTION 0.2f        ///< Load step as a share of heater power
+#define RULE_WEIGHT_OVERSHOOT 2.0f     ///< Cost per °C of overshoot
+#define RULE_WEIGHT_SETTLE (1.0f / 60.0f)   ///< Cost per second to settle
+#define RULE_WEIGHT_RECOVERY (1.0f / 60.0f) ///< Cost per °C*s of load recovery error
+
+// Scratch batch - too large for the control task stack
+static pid_batch_t rule_batch;
+static float rule_last_unsettled[PID_BATCH_MAX_LANES]; ///< Last time outside the settle band (s)
+static float rule_heat_up_iae[PID_BATCH_MAX_LANES];    ///< IAE before the load step (°C*s)
+
+// =============================================================================
+// Internal Helpers
+// =============================================================================
+
+/**
+ * @brief Plant variant for robustness checks
+ */
+static fopdt_model_t plant_variant(fopdt_model_t model, int variant)
+{
+    switch (variant)
+    {
+    case 1:
+        model.dead_time *= 1.3f;      // Thermocouple further from the element
+        model.time_constant *= 0.8f;
+        break;
+    case 2:
+        model.gain *= 1.3f;           // Hotter element / better insulated
+        break;
+    default:
+        break;
+    }
+    return model;
+}
+
+/**
+ * @brief Express an FOPDT model as the batch simulator's heat balance
+ *
+ * With a loss coefficient of 1 W/°C the steady rise is heater_watts/100
+ * per % and the time constant equals the capacity.
+ */
+static batch_plant_t plant_from_model(fopdt_model_t model)
+{
+    batch_plant_t plant = {
+        .heater_watts = model.gain * 100.0f,
+        .capacity = model.time_constant,
+        .loss_coefficient = 1.0f,
+        .ambient = DEFAULT_TEMPERATURE,
+        .dead_time = model.dead_time,
+        .initial_temp = DEFAULT_TEMPERATURE};
+    return plant;
+}
+
+static void sort_ranking(rule_ranking_t *ranking)
+{
+    for (uint8_t i = 1; i < ranking->count; i++)
+    {
+        rule_score_t entry = ranking->entries[i];
+        int j = i - 1;
+        while (j >= 0 && ranking->entries[j].score > entry.score)
+        {
+            ranking->entries[j + 1] = ranking->entries[j];
+            j--;
+        }
+        ranking->entries[j + 1] = entry;
+    }
+}
+
+// =============================================================================
+// Public Interface
+// =============================================================================
+
+bool pid_rule_fit_model(float ku, float tu, float gain, fopdt_model_t *model)
+{
+    if (!model)
+    {
+        return false;
+    }
+
+    float loop_gain = ku * gain;
+    if (tu <= 0.0f || loop_gain <= 1.0f)
+    {
+        model->gain = SMITH_MODEL_GAIN;
+        model->time_constant = SMITH_TIME_CONSTANT;
+        model->dead_time = SMITH_DEAD_TIME;
+        ESP_LOGW(TAG, "No FOPDT fits Ku=%.3f with gain %.2f, using configured model", ku, gain);
+        return false;
+    }
+
+    // |G(jw)| = K / sqrt(1 + (w*tau)^2) = 1/Ku  and  atan(w*tau) + w*L = pi
+    float wu = 2.0f * (float)M_PI / tu;
+    model->gain = gain;
+    model->time_constant = sqrtf(loop_gain * loop_gain - 1.0f) / wu;
+    model->dead_time = ((float)M_PI - atanf(wu * model->time_constant)) / wu;
+
+    ESP_LOGI(TAG, "Fitted model: K=%.2f°C/%%, tau=%.0fs, dead time=%.1fs",
+             model->gain, model->time_constant, model->dead_time);
+    return true;
+}
+
+bool pid_rule_select(float ku, float tu, float setpoint, rule_ranking_t *ranking)
+{
+    if (!ranking || ku <= 0.0f || tu <= 0.0f)
+    {
+        return false;
+    }
+
+    memset(ranking, 0, sizeof(rule_ranking_t));
+
+    fopdt_model_t model;
+    pid_rule_fit_model(ku, tu, SMITH_MODEL_GAIN, &model);
+
+    // Coarser steps for long dead times so the delay line still covers them
+    float longest_delay = plant_variant(model, 1).dead_time;
+    float dt = ceilf(longest_delay / (PID_BATCH_MAX_DELAY_STEPS - 1));
+    if (dt < 1.0f)
+    {
+        dt = 1.0f;
+    }
+
+    // Heat-up window, then a load step of the same kind as a press
+    float heat_up_time = CLAMP(10.0f * tu, 600.0f, 3600.0f);
+    float recovery_time = CLAMP(5.0f * tu, 300.0f, 1800.0f);
+    uint32_t heat_up_steps = (uint32_t)(heat_up_time / dt);
+    uint32_t recovery_steps = (uint32_t)(recovery_time / dt);
+
+    pid_batch_init(&rule_batch, dt, setpoint, 0.0f, 100.0f);
+    for (int rule = 0; rule < TUNING_RULE_COUNT; rule++)
+    {
+        float kp, ki, kd;
+        pid_autotune_rule_gains((tuning_rule_t)rule, ku, tu, &kp, &ki, &kd);
+        for (int variant = 0; variant < RULE_PLANT_VARIANTS; variant++)
+        {
+            batch_plant_t plant = plant_from_model(plant_variant(model, variant));
+            if (pid_batch_add_lane(&rule_batch, &plant, kp, ki, kd) < 0)
+            {
+                ESP_LOGE(TAG, "Simulation batch too small");
+                return false;
+            }
+        }
+
+        rule_score_t *entry = &ranking->entries[rule];
+        entry->rule = (tuning_rule_t)rule;
+        entry->kp = kp;
+        entry->ki = ki;
+        entry->kd = kd;
+    }
+    ranking->count = TUNING_RULE_COUNT;
+
+    // Heat-up: note the last time each lane was outside the settle band
+    const uint16_t lanes = rule_batch.count;
+    for (uint16_t i = 0; i < lanes; i++)
+    {
+        rule_last_unsettled[i] = 0.0f;
+    }
+    for (uint32_t step = 1; step <= heat_up_steps; step++)
+    {
+        pid_batch_step(&rule_batch);
+        for (uint16_t i = 0; i < lanes; i++)
+        {
+            if (fabsf(setpoint - rule_batch.temperature[i]) > RULE_SETTLE_BAND)
+            {
+                rule_last_unsettled[i] = step * dt;
+            }
+        }
+    }
+
+    // Load step
+    for (uint16_t i = 0; i < lanes; i++)
+    {
+        rule_heat_up_iae[i] = rule_batch.iae[i];
+        rule_batch.load_watts[i] = RULE_LOAD_FRACTION * rule_batch.heater_watts[i];
+    }
+    pid_batch_run(&rule_batch, recovery_steps);
+
+    // Worst case over the plant variants
+    for (int rule = 0; rule < TUNING_RULE_COUNT; rule++)
+    {
+        rule_score_t *entry = &ranking->entries[rule];
+        for (int variant = 0; variant < RULE_PLANT_VARIANTS; variant++)
+        {
+            int lane = rule * RULE_PLANT_VARIANTS + variant;
+            float overshoot = rule_batch.peak_temp[lane] - setpoint;
+            float recovery = rule_batch.iae[lane] - rule_heat_up_iae[lane];
+
+            entry->overshoot = fmaxf(entry->overshoot, fmaxf(overshoot, 0.0f));
+            entry->settle_time = fmaxf(entry->settle_time, rule_last_unsettled[lane]);
+            entry->recovery_iae = fmaxf(entry->recovery_iae, recovery);
+        }
+
+        entry->score = RULE_WEIGHT_OVERSHOOT * entry->overshoot +
+                       RULE_WEIGHT_SETTLE * entry->settle_time +
+                       RULE_WEIGHT_RECOVERY * entry->recovery_iae;
+    }
+
+    sort_ranking(ranking);
+
+    for (uint8_t i = 0; i < ranking->count; i++)
+    {
+        const rule_score_t *entry = &ranking->entries[i];
+        ESP_LOGI(TAG, "%u. %-6s score %.1f: overshoot %.1f°C, settle %.0fs, load IAE %.0f°C*s",
+                 i + 1, pid_autotune_rule_name(entry->rule), entry->score,
+                 entry->overshoot, entry->settle_time, entry->recovery_iae);
+    }
+
+    return true;
+}
@@ -0,0 +1,63 @@
+/**
+ * @file pid_rule_select.h
+ * @brief Tuning rule selection by simulation
+ *
+ * A relay test gives the ultimate gain Ku and period Tu. Which tuning
+ * rule turns those into the best gains depends on the press, so instead
+ * of applying a fixed rule this module:
+ * 1. fits a first-order-plus-dead-time model to Ku/Tu and the configured
+ *    steady-state gain (SMITH_MODEL_GAIN)
+ * 2. simulates every rule from a cold start to the setpoint, followed by
+ *    a load step standing in for a garment, on the nominal model and two
+ *    harder variants (more dead time, more gain)
+ * 3. scores each rule on its worst-case overshoot, settling time and
+ *    load recovery, and ranks them
+ *
+ * The simulations run on the batched PID simulator (pid_batch.h).
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#ifndef PID_RULE_SELECT_H
+#define PID_RULE_SELECT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "pid_autotune.h"
+#include "pid_smith.h"  // fopdt_model_t
+
+// =============================================================================
+// Function Prototypes
+// =============================================================================
+
+/**
+ * @brief Fit an FOPDT model to the relay test result
+ *
+ * Solves |G(jwu)| = 1/Ku and arg G(jwu) = -pi for the time constant and
+ * dead time, given the steady-state gain. Falls back to the configured
+ * Smith model when Ku * gain <= 1, for which no FOPDT fits.
+ *
+ * @param ku Ultimate gain (%/°C)
+ * @param tu Ultimate period (s)
+ * @param gain Steady-state gain (°C/%)
+ * @param[out] model Fitted model
+ * @return true if fitted, false if the fallback was used
+ */
+bool pid_rule_fit_model(float ku, float tu, float gain, fopdt_model_t *model);
+
+/**
+ * @brief Simulate and rank every tuning rule
+ *
+ * Runs on the caller's task. Takes a few milliseconds; it only runs once
+ * per auto-tune.
+ *
+ * @param ku Ultimate gain (%/°C)
+ * @param tu Ultimate period (s)
+ * @param setpoint Tuning target (°C)
+ * @param[out] ranking Rules ranked best first
+ * @return true if a ranking was produced
+ */
+bool pid_rule_select(float ku, float tu, float setpoint, rule_ranking_t *ranking);
+
+#endif // PID_RULE_SELECT_H
@@ -0,0 +1,223 @@
+/**
+ * @file pid_smith.c
+ * @brief Smith predictor implementation
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#include "pid_smith.h"
+#include "system_config.h"
+#include "esp_log.h"
+#include <string.h>
+
+static const char *TAG = "pid_smith";
+
+#define SMITH_RESIDUAL_MEAN_ALPHA 0.01f ///< Slow average: ambient and loss offset
+#define SMITH_MISMATCH_ALPHA 0.05f      ///< Fast average: model tracking error
+#define SMITH_IDENT_RISE 0.5f           ///< Rise that ends the dead time (°C)
+#define SMITH_IDENT_WINDOW 10.0f        ///< Slope measurement window (s)
+#define SMITH_IDENT_MIN_SLOPE_TIME 60.0f ///< Slope observation needed after the dead time (s)
+#define SMITH_IDENT_FULL_POWER 90.0f    ///< Power considered full (%)
+
+// =============================================================================
+// Internal Helpers
+// =============================================================================
+
+static uint16_t delay_steps_for(const pid_smith_t *smith)
+{
+    float steps = smith->model.dead_time / smith->dt + 0.5f;
+    if (steps < 0.0f)
+    {
+        steps = 0.0f;
+    }
+    if (steps > SMITH_MAX_DELAY_STEPS)
+    {
+        ESP_LOGW(TAG, "Dead time %.0fs exceeds %d steps, truncated",
+                 smith->model.dead_time, SMITH_MAX_DELAY_STEPS);
+        steps = SMITH_MAX_DELAY_STEPS;
+    }
+    return (uint16_t)steps;
+}
+
+// =============================================================================
+// Predictor
+// =============================================================================
+
+void pid_smith_init(pid_smith_t *smith, fopdt_model_t model, float dt)
+{
+    if (!smith)
+    {
+        return;
+    }
+
+    memset(smith, 0, sizeof(pid_smith_t));
+    smith->dt = (dt > 0.0f) ? dt : 1.0f;
+    pid_smith_set_model(smith, model);
+}
+
+void pid_smith_set_model(pid_smith_t *smith, fopdt_model_t model)
+{
+    if (!smith)
+    {
+        return;
+    }
+
+    if (model.time_constant < smith->dt)
+    {
+        model.time_constant = smith->dt;
+    }
+
+    smith->model = model;
+    smith->delay_steps = delay_steps_for(smith);
+
+    ESP_LOGI(TAG, "Model: K=%.3f°C/%%, tau=%.0fs, dead time=%.0fs (%u steps)",
+             model.gain, model.time_constant, model.dead_time, smith->delay_steps);
+}
+
+void pid_smith_step(pid_smith_t *smith, float measurement, float applied_power)
+{
+    if (!smith)
+    {
+        return;
+    }
+
+    // Undelayed FOPDT response (temperature rise due to the heater)
+    float alpha = smith->dt / smith->model.time_constant;
+    smith->undelayed += alpha * (smith->model.gain * applied_power - smith->undelayed);
+
+    // Delay line: the value written delay_steps ago is the delayed output
+    smith->history[smith->head] = smith->undelayed;
+    uint16_t read = (smith->head + SMITH_MAX_DELAY_STEPS - smith->delay_steps) % SMITH_MAX_DELAY_STEPS;
+    smith->delayed = smith->history[read];
+    smith->head = (smith->head + 1) % SMITH_MAX_DELAY_STEPS;
+
+    // Residual = ambient + unmodelled losses; watch how much it wanders
+    float residual = measurement - smith->delayed;
+    if (!smith->primed)
+    {
+        smith->residual_mean = residual;
+        smith->primed = true;
+    }
+    smith->residual_mean += SMITH_RESIDUAL_MEAN_ALPHA * (residual - smith->residual_mean);
+
+    float deviation = residual - smith->residual_mean;
+    if (deviation < 0.0f)
+    {
+        deviation = -deviation;
+    }
+    smith->mismatch += SMITH_MISMATCH_ALPHA * (deviation - smith->mismatch);
+
+    // Fall back when the model stops tracking; resume with hysteresis
+    if (smith->mismatch > SMITH_MISMATCH_LIMIT)
+    {
+        smith->mismatch_time += smith->dt;
+        if (!smith->fallback && smith->mismatch_time >= SMITH_MISMATCH_HOLD_SEC)
+        {
+            smith->fallback = true;
+            ESP_LOGW(TAG, "Model mismatch %.1f°C - falling back to plain PID", smith->mismatch);
+        }
+    }
+    else
+    {
+        smith->mismatch_time = 0.0f;
+        if (smith->fallback && smith->mismatch < SMITH_MISMATCH_LIMIT / 2.0f)
+        {
+            smith->fallback = false;
+            ESP_LOGI(TAG, "Model tracking again (mismatch %.1f°C) - prediction resumed", smith->mismatch);
+        }
+    }
+}
+
+float pid_smith_feedback(const pid_smith_t *smith, float measurement)
+{
+    if (!smith || smith->fallback)
+    {
+        return measurement;
+    }
+
+    return measurement + smith->undelayed - smith->delayed;
+}
+
+bool pid_smith_is_active(const pid_smith_t *smith)
+{
+    return smith && !smith->fallback;
+}
+
+float pid_smith_get_mismatch(const pid_smith_t *smith)
+{
+    return smith ? smith->mismatch : 0.0f;
+}
+
+// =============================================================================
+// Identification
+// =============================================================================
+
+void smith_identify_begin(smith_identifier_t *id, float start_temp)
+{
+    if (!id)
+    {
+        return;
+    }
+
+    memset(id, 0, sizeof(smith_identifier_t));
+    id->start_temp = start_temp;
+    id->active = true;
+}
+
+void smith_identify_sample(smith_identifier_t *id, float temperature, float applied_power, float dt)
+{
+    if (!id || !id->active)
+    {
+        return;
+    }
+
+    if (applied_power < SMITH_IDENT_FULL_POWER)
+    {
+        id->active = false;
+        return;
+    }
+
+    id->elapsed += dt;
+
+    if (id->dead_time <= 0.0f)
+    {
+        if (temperature - id->start_temp >= SMITH_IDENT_RISE)
+        {
+            id->dead_time = id->elapsed;
+            id->window_temp = temperature;
+            id->window_time = 0.0f;
+        }
+        return;
+    }
+
+    id->window_time += dt;
+    if (id->window_time >= SMITH_IDENT_WINDOW)
+    {
+        float slope = (temperature - id->window_temp) / id->window_time;
+        if (slope > id->max_slope)
+        {
+            id->max_slope = slope;
+        }
+        id->window_temp = temperature;
+        id->window_time = 0.0f;
+    }
+}
+
+bool smith_identify_result(const smith_identifier_t *id, float gain, fopdt_model_t *model)
+{
+    if (!id || !model || id->dead_time <= 0.0f || id->max_slope <= 0.0f)
+    {
+        return false;
+    }
+
+    if (id->elapsed - id->dead_time < SMITH_IDENT_MIN_SLOPE_TIME)
+    {
+        return false;
+    }
+
+    model->gain = gain;
+    model->dead_time = id->dead_time;
+    model->time_constant = (gain * 100.0f) / id->max_slope;
+    return true;
+}
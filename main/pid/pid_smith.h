@@ -0,0 +1,175 @@
+/**
+ * @file pid_smith.h
+ * @brief Smith predictor for platen and thermocouple dead time
+ *
+ * Heat from the element takes a while to reach the thermocouple, so a
+ * plain PID sees the effect of its output late and has to run
+ * conservative gains. The Smith predictor runs a first-order-plus-dead-
+ * time (FOPDT) model of the press next to the controller and feeds back
+ *
+ *     measurement + model(undelayed) - model(delayed)
+ *
+ * so the PID acts on a prediction of where the platen is heading rather
+ * than where it was one dead time ago.
+ *
+ * The model is only as good as its parameters, so the predictor watches
+ * the residual between the measurement and the delayed model output. If
+ * the residual keeps varying by more than SMITH_MISMATCH_LIMIT for
+ * SMITH_MISMATCH_HOLD_SEC it falls back to plain feedback, and resumes
+ * once the model tracks again.
+ *
+ * Model parameters come from the system configuration and can be
+ * refined from a cold heat-up with the step-response identifier.
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#ifndef PID_SMITH_H
+#define PID_SMITH_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// =============================================================================
+// Type Definitions
+// =============================================================================
+
+#define SMITH_MAX_DELAY_STEPS 120 ///< Longest dead time handled, in control steps
+
+/**
+ * @brief First-order-plus-dead-time process model
+ */
+typedef struct
+{
+    float gain;          ///< Steady temperature rise per % power (°C/%)
+    float time_constant; ///< Lag time constant (s)
+    float dead_time;     ///< Transport delay (s)
+} fopdt_model_t;
+
+/**
+ * @brief Smith predictor state
+ */
+typedef struct
+{
+    fopdt_model_t model;
+    float dt;                              ///< Control step (s)
+    uint16_t delay_steps;                  ///< Dead time in steps
+    float undelayed;                       ///< Model output without dead time (°C rise)
+    float history[SMITH_MAX_DELAY_STEPS];  ///< Past undelayed outputs (delay line)
+    uint16_t head;                         ///< Next write position in history
+    float delayed;                         ///< Model output delayed by dead time (°C rise)
+
+    // Model mismatch monitoring
+    float residual_mean;                   ///< Slow average of measurement - delayed model
+    float mismatch;                        ///< Fast average of |residual - residual_mean| (°C)
+    float mismatch_time;                   ///< Time the mismatch has been over the limit (s)
+    bool fallback;                         ///< Prediction disabled, plain feedback in use
+    bool primed;                           ///< residual_mean has been seeded
+} pid_smith_t;
+
+/**
+ * @brief Step-response identifier state
+ *
+ * Watches a full-power heat-up from a cold, settled platen.
+ */
+typedef struct
+{
+    float start_temp;    ///< Temperature when full power was applied (°C)
+    float elapsed;       ///< Time since full power was applied (s)
+    float dead_time;     ///< Time until the first clear rise (s, 0 = not yet)
+    float window_temp;   ///< Temperature at the start of the slope window (°C)
+    float window_time;   ///< Time in the slope window (s)
+    float max_slope;     ///< Steepest rise seen (°C/s)
+    bool active;
+} smith_identifier_t;
+
+// =============================================================================
+// Predictor
+// =============================================================================
+
+/**
+ * @brief Initialize the predictor
+ *
+ * @param smith Predictor state
+ * @param model Process model
+ * @param dt Control step (s)
+ */
+void pid_smith_init(pid_smith_t *smith, fopdt_model_t model, float dt);
+
+/**
+ * @brief Replace the process model (history is kept)
+ */
+void pid_smith_set_model(pid_smith_t *smith, fopdt_model_t model);
+
+/**
+ * @brief Advance the model by one control step
+ *
+ * Call every control step, heating or not, with the power applied
+ * during the step.
+ *
+ * @param smith Predictor state
+ * @param measurement Measured temperature (°C)
+ * @param applied_power Heater power during the step (%)
+ */
+void pid_smith_step(pid_smith_t *smith, float measurement, float applied_power);
+
+/**
+ * @brief Get the value the PID should use as its measurement
+ *
+ * @param smith Predictor state
+ * @param measurement Measured temperature (°C)
+ * @return Dead-time compensated feedback, or the measurement while in fallback
+ */
+float pid_smith_feedback(const pid_smith_t *smith, float measurement);
+
+/**
+ * @brief Check if prediction is in use (not fallen back)
+ */
+bool pid_smith_is_active(const pid_smith_t *smith);
+
+/**
+ * @brief Get the current model mismatch (°C)
+ */
+float pid_smith_get_mismatch(const pid_smith_t *smith);
+
+// =============================================================================
+// Identification
+// =============================================================================
+
+/**
+ * @brief Start identifying from a full-power heat-up
+ *
+ * @param id Identifier state
+ * @param start_temp Temperature when full power is applied (°C)
+ */
+void smith_identify_begin(smith_identifier_t *id, float start_temp);
+
+/**
+ * @brief Feed one control step of the heat-up
+ *
+ * Identification stops (without a result) if the power drops below 90%.
+ *
+ * @param id Identifier state
+ * @param temperature Measured temperature (°C)
+ * @param applied_power Heater power during the step (%)
+ * @param dt Step length (s)
+ */
+void smith_identify_sample(smith_identifier_t *id, float temperature, float applied_power, float dt);
+
+/**
+ * @brief Derive a model from the observed heat-up
+ *
+ * Dead time is the delay to the first clear rise; the time constant
+ * follows from the steepest rise and the configured steady-state gain
+ * (tau = gain * power / slope), since a heat-up is cut off long before
+ * it would settle at full power.
+ *
+ * @param id Identifier state
+ * @param gain Steady-state gain to assume (°C/%)
+ * @param[out] model Identified model
+ * @return true if enough of the response was seen
+ */
+bool smith_identify_result(const smith_identifier_t *id, float gain, fopdt_model_t *model);
+
+#endif // PID_SMITH_H
@@ -0,0 +1,195 @@
+/**
+ * @file power_map.c
+ * @brief Holding power map implementation
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#include "power_map.h"
+#include "system_config.h"
+#include "esp_log.h"
+#include <math.h>
+#include <string.h>
+
+static const char *TAG = "power_map";
+
+#define POWER_MAP_MIN_RISE 10.0f     ///< Points closer to ambient than this are not scaled (°C)
+#define POWER_MAP_MIN_WEIGHT 0.1f    ///< Smaller interpolation weights leave a point alone
+
+// =============================================================================
+// Internal Helpers
+// =============================================================================
+
+static float point_temp(int point)
+{
+    return point * POWER_MAP_SPACING;
+}
+
+/**
+ * @brief Carry a holding power to another temperature
+ *
+ * Losses are proportional to the rise above ambient.
+ *
+ * @return Scaled power, or -1 if either temperature is too close to ambient
+ */
+static float scale_hold_power(float hold_power, float from_temp, float to_temp, float ambient)
+{
+    float from_rise = from_temp - ambient;
+    float to_rise = to_temp - ambient;
+    if (from_rise < POWER_MAP_MIN_RISE || to_rise < POWER_MAP_MIN_RISE)
+    {
+        return -1.0f;
+    }
+    return hold_power * to_rise / from_rise;
+}
+
+/**
+ * @brief Holding power at one point, learned or carried from the nearest learned point
+ *
+ * @return Power (%), or -1 if nothing usable is learned
+ */
+static float point_hold_power(const power_map_t *map, int point, float ambient)
+{
+    if (map->samples[point] > 0)
+    {
+        return map->hold_power[point];
+    }
+
+    for (int distance = 1; distance < POWER_MAP_POINTS; distance++)
+    {
+        for (int side = -1; side <= 1; side += 2)
+        {
+            int source = point + side * distance;
+            if (source < 0 || source >= POWER_MAP_POINTS || map->samples[source] == 0)
+            {
+                continue;
+            }
+            float scaled = scale_hold_power(map->hold_power[source], point_temp(source),
+                                            point_temp(point), ambient);
+            if (scaled >= 0.0f)
+            {
+                return scaled;
+            }
+        }
+    }
+    return -1.0f;
+}
+
+/**
+ * @brief Bracketing points and the interpolation fraction toward the upper one
+ */
+static int bracket(float setpoint, float *fraction)
+{
+    float position = setpoint / POWER_MAP_SPACING;
+    int lower = (int)floorf(position);
+    if (lower < 0)
+    {
+        lower = 0;
+    }
+    else if (lower > POWER_MAP_POINTS - 2)
+    {
+        lower = POWER_MAP_POINTS - 2;
+    }
+    *fraction = CLAMP(position - lower, 0.0f, 1.0f);
+    return lower;
+}
+
+// =============================================================================
+// Public Interface
+// =============================================================================
+
+void power_map_init(power_map_t *map)
+{
+    if (map)
+    {
+        memset(map, 0, sizeof(power_map_t));
+    }
+}
+
+float power_map_model_estimate(float setpoint, float ambient)
+{
+    float hold_power = 100.0f * OBSERVER_LOSS_COEFFICIENT * (setpoint - ambient) / OBSERVER_HEATER_WATTS;
+    return CLAMP(hold_power, 0.0f, 100.0f);
+}
+
+bool power_map_lookup(const power_map_t *map, float setpoint, float ambient, float *hold_power)
+{
+    if (!hold_power)
+    {
+        return false;
+    }
+
+    *hold_power = power_map_model_estimate(setpoint, ambient);
+    if (!map || setpoint <= ambient)
+    {
+        return false;
+    }
+
+    float fraction;
+    int lower = bracket(setpoint, &fraction);
+    float lower_power = point_hold_power(map, lower, ambient);
+    float upper_power = point_hold_power(map, lower + 1, ambient);
+
+    // A neighbour near ambient cannot be scaled; lean on the other one
+    if (lower_power < 0.0f && upper_power < 0.0f)
+    {
+        return false;
+    }
+    if (lower_power < 0.0f)
+    {
+        lower_power = (point_temp(lower) <= ambient) ? 0.0f :
+                      upper_power * (point_temp(lower) - ambient) / (point_temp(lower + 1) - ambient);
+    }
+    if (upper_power < 0.0f)
+    {
+        upper_power = lower_power;
+    }
+
+    *hold_power = CLAMP(lower_power + fraction * (upper_power - lower_power), 0.0f, 100.0f);
+    return true;
+}
+
+void power_map_learn(power_map_t *map, float setpoint, float ambient, float hold_power)
+{
+    if (!map || hold_power < 0.0f || hold_power > 100.0f)
+    {
+        return;
+    }
+
+    float fraction;
+    int lower = bracket(setpoint, &fraction);
+
+    for (int i = 0; i < 2; i++)
+    {
+        int point = lower + i;
+        float weight = (i == 0) ? (1.0f - fraction) : fraction;
+        if (weight < POWER_MAP_MIN_WEIGHT)
+        {
+            continue;
+        }
+
+        float target = scale_hold_power(hold_power, setpoint, point_temp(point), ambient);
+        if (target < 0.0f)
+        {
+            continue;
+        }
+        target = CLAMP(target, 0.0f, 100.0f);
+
+        if (map->samples[point] == 0)
+        {
+            map->hold_power[point] = target;
+        }
+        else
+        {
+            map->hold_power[point] += POWER_MAP_LEARN_WEIGHT * weight * (target - map->hold_power[point]);
+        }
+        if (map->samples[point] < UINT8_MAX)
+        {
+            map->samples[point]++;
+        }
+
+        ESP_LOGI(TAG, "%.0f°C: holding power %.1f%% (%u samples)",
+                 point_temp(point), map->hold_power[point], map->samples[point]);
+    }
+}
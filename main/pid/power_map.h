@@ -0,0 +1,77 @@
+/**
+ * @file power_map.h
+ * @brief Learned steady-state holding power versus setpoint
+ *
+ * Once the platen has settled at a setpoint, the heater power needed to
+ * hold it is a property of the press and the room, not of the control
+ * loop. This module learns that power at fixed points (power_map_t, one
+ * every POWER_MAP_SPACING °C) from settled periods and interpolates
+ * between them. The result is used two ways:
+ * - as a static feedforward term, so the PID only corrects what the map
+ *   gets wrong instead of holding the setpoint with proportional droop
+ * - to preload the integral on mode entry (heat-up, cycle start, resume),
+ *   so the loop does not start from a stale or empty integral
+ *
+ * A settled average at one setpoint updates the two points either side,
+ * weighted by distance. Losses to ambient grow with the temperature
+ * rise, so the average is scaled by (T_point - ambient) / (T - ambient)
+ * before it is blended in. Points that have not been learned yet are
+ * filled the same way from the nearest learned point, and with no
+ * learned point at all the observer heat balance gives a first guess.
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#ifndef POWER_MAP_H
+#define POWER_MAP_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "data_model.h"  // components/storage/include/ - power_map_t
+
+// =============================================================================
+// Function Prototypes
+// =============================================================================
+
+/**
+ * @brief Clear every learned point
+ *
+ * @param map Holding power map
+ */
+void power_map_init(power_map_t *map);
+
+/**
+ * @brief Heat balance estimate of the holding power
+ *
+ * loss_coefficient * (setpoint - ambient) / heater_watts, from the
+ * observer configuration.
+ *
+ * @param setpoint Temperature to hold (°C)
+ * @param ambient Room temperature (°C)
+ * @return Holding power (0-100%)
+ */
+float power_map_model_estimate(float setpoint, float ambient);
+
+/**
+ * @brief Look up the holding power for a setpoint
+ *
+ * @param map Holding power map
+ * @param setpoint Temperature to hold (°C)
+ * @param ambient Room temperature (°C)
+ * @param[out] hold_power Holding power (0-100%); the heat balance estimate if nothing is learned
+ * @return true if the value comes from learned points
+ */
+bool power_map_lookup(const power_map_t *map, float setpoint, float ambient, float *hold_power);
+
+/**
+ * @brief Learn from a settled period
+ *
+ * @param map Holding power map
+ * @param setpoint Temperature held (°C)
+ * @param ambient Room temperature (°C)
+ * @param hold_power Average heater power over the period (%)
+ */
+void power_map_learn(power_map_t *map, float setpoint, float ambient, float hold_power);
+
+#endif // POWER_MAP_H
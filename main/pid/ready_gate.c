@@ -0,0 +1,69 @@
+/**
+ * @file ready_gate.c
+ * @brief Predictive readiness implementation
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#include "ready_gate.h"
+#include "pid_batch.h"      // pid_batch_plant_step()
+#include "system_config.h"
+
+#define READY_GATE_STEP 1.0f          ///< Simulation step (s)
+#define READY_GATE_MAX_DELAY 64       ///< Longest dead time simulated (steps)
+#define READY_GATE_MAX_DWELL 600.0f   ///< Longest dwell simulated (s)
+
+bool ready_gate_predict(const ready_gate_input_t *input, ready_gate_result_t *result)
+{
+    if (!input || !result)
+    {
+        return false;
+    }
+
+    result->min_temp = input->temperature;
+    result->max_temp = input->temperature;
+    result->ready = false;
+
+    if (input->dwell <= 0.0f || input->dwell > READY_GATE_MAX_DWELL || input->tolerance <= 0.0f)
+    {
+        return false;
+    }
+
+    int delay = (int)(SMITH_DEAD_TIME / READY_GATE_STEP + 0.5f);
+    if (delay >= READY_GATE_MAX_DELAY)
+    {
+        delay = READY_GATE_MAX_DELAY - 1;
+    }
+
+    // The reading shows the surface as it was one dead time ago
+    float surface = input->temperature + input->slope * delay * READY_GATE_STEP;
+    float history[READY_GATE_MAX_DELAY];
+    float min_temp = surface;
+    float max_temp = surface;
+
+    int steps = (int)(input->dwell / READY_GATE_STEP + 0.5f);
+    for (int step = 0; step < steps; step++)
+    {
+        // Until the dead time has passed the reading follows its present course.
+        // Record first so a zero dead time reads this step's surface.
+        history[step % READY_GATE_MAX_DELAY] = surface;
+        float measured = (step < delay) ?
+                         input->temperature + input->slope * step * READY_GATE_STEP :
+                         history[(step - delay) % READY_GATE_MAX_DELAY];
+
+        float power = CLAMP(input->hold_power + input->kp * (input->target - measured), 0.0f, 100.0f);
+        surface = pid_batch_plant_step(surface, power, OBSERVER_HEATER_WATTS, OBSERVER_LOSS_COEFFICIENT,
+                                       DEFAULT_TEMPERATURE, input->load_watts, OBSERVER_CAPACITY,
+                                       READY_GATE_STEP);
+
+        min_temp = (surface < min_temp) ? surface : min_temp;
+        max_temp = (surface > max_temp) ? surface : max_temp;
+    }
+
+    result->min_temp = min_temp;
+    result->max_temp = max_temp;
+    result->ready = (min_temp >= input->target - input->tolerance) &&
+                    (max_temp <= input->target + input->tolerance);
+    return true;
+}
@@ -0,0 +1,73 @@
+/**
+ * @file ready_gate.h
+ * @brief Predictive readiness for the next pressing cycle
+ *
+ * The plain ready check wants the reading inside target ± TEMP_HYSTERESIS.
+ * After a sag that holds the operator back until the thermocouple has
+ * crawled back, even though the heater has been at full power for a while
+ * and the surface, which the thermocouple trails by the dead time, is
+ * already there.
+ *
+ * This gate predicts the surface temperature over the whole stage 1 dwell
+ * of the next cycle and reports ready if it stays within tolerance:
+ * - the surface now is the reading extrapolated along its slope by the
+ *   thermocouple dead time
+ * - the dwell is simulated on the observer heat balance (the same one the
+ *   batched simulator uses) with the press closed on the last measured
+ *   press load from t = 0
+ * - the controller is approximated as holding power plus its proportional
+ *   term on the delayed reading
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#ifndef READY_GATE_H
+#define READY_GATE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// =============================================================================
+// Type Definitions
+// =============================================================================
+
+/**
+ * @brief Press and controller state the prediction starts from
+ */
+typedef struct
+{
+    float temperature;   ///< Latest reading (°C)
+    float slope;         ///< Smoothed reading slope (°C/s)
+    float hold_power;    ///< Power that holds the target (%)
+    float kp;            ///< Proportional gain of the running controller (%/°C)
+    float load_watts;    ///< Load while the press is closed (W)
+    float target;        ///< Stage target (°C)
+    float tolerance;     ///< Allowed deviation from the target (°C)
+    float dwell;         ///< Stage 1 duration (s)
+} ready_gate_input_t;
+
+/**
+ * @brief Prediction over the dwell
+ */
+typedef struct
+{
+    float min_temp;      ///< Lowest predicted surface temperature (°C)
+    float max_temp;      ///< Highest predicted surface temperature (°C)
+    bool ready;          ///< Whole dwell within target ± tolerance
+} ready_gate_result_t;
+
+// =============================================================================
+// Function Prototypes
+// =============================================================================
+
+/**
+ * @brief Predict the surface temperature over the next stage 1 dwell
+ *
+ * @param input Starting state
+ * @param[out] result Predicted range and verdict
+ * @return false if the input cannot be used (result not ready)
+ */
+bool ready_gate_predict(const ready_gate_input_t *input, ready_gate_result_t *result);
+
+#endif // READY_GATE_H
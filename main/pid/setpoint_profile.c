@@ -0,0 +1,141 @@
+/**
+ * @file setpoint_profile.c
+ * @brief Ramp/soak setpoint profile engine implementation
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#include "setpoint_profile.h"
+#include "esp_log.h"
+#include <string.h>
+
+static const char *TAG = "sp_profile";
+
+void sp_profile_clear(sp_profile_t *profile)
+{
+    if (!profile)
+    {
+        return;
+    }
+
+    memset(profile, 0, sizeof(sp_profile_t));
+}
+
+bool sp_profile_add_ramp(sp_profile_t *profile, float target_offset, float rate)
+{
+    if (!profile || profile->count >= SP_PROFILE_MAX_SEGMENTS)
+    {
+        ESP_LOGW(TAG, "Cannot add ramp segment (profile full)");
+        return false;
+    }
+
+    sp_segment_t *seg = &profile->segments[profile->count++];
+    seg->type = SP_SEGMENT_RAMP;
+    seg->target_offset = target_offset;
+    seg->rate = rate;
+    seg->duration_sec = 0;
+    seg->holdback = 0.0f;
+    return true;
+}
+
+bool sp_profile_add_soak(sp_profile_t *profile, float target_offset,
+                         uint16_t duration_sec, float holdback)
+{
+    if (!profile || profile->count >= SP_PROFILE_MAX_SEGMENTS)
+    {
+        ESP_LOGW(TAG, "Cannot add soak segment (profile full)");
+        return false;
+    }
+
+    sp_segment_t *seg = &profile->segments[profile->count++];
+    seg->type = SP_SEGMENT_SOAK;
+    seg->target_offset = target_offset;
+    seg->rate = 0.0f;
+    seg->duration_sec = duration_sec;
+    seg->holdback = holdback;
+    return true;
+}
+
+void sp_runner_start(sp_runner_t *runner, const sp_profile_t *profile, float start_setpoint)
+{
+    if (!runner || !profile)
+    {
+        return;
+    }
+
+    runner->profile = *profile;
+    runner->index = 0;
+    runner->setpoint = start_setpoint;
+    runner->soak_elapsed = 0.0f;
+    runner->active = (profile->count > 0);
+
+    ESP_LOGI(TAG, "Profile started: %d segments from %.1f°C", profile->count, start_setpoint);
+}
+
+void sp_runner_stop(sp_runner_t *runner)
+{
+    if (runner)
+    {
+        runner->active = false;
+    }
+}
+
+float sp_runner_step(sp_runner_t *runner, float base_target, float measurement, float dt)
+{
+    if (!runner || !runner->active)
+    {
+        return base_target;
+    }
+
+    const sp_segment_t *seg = &runner->profile.segments[runner->index];
+    float seg_target = base_target + seg->target_offset;
+    bool segment_done = false;
+
+    if (seg->type == SP_SEGMENT_RAMP)
+    {
+        float step = (seg->rate > 0.0f) ? seg->rate * dt : 0.0f;
+        float diff = seg_target - runner->setpoint;
+
+        if (step <= 0.0f || (diff >= 0.0f ? diff <= step : -diff <= step))
+        {
+            runner->setpoint = seg_target;
+            segment_done = true;
+        }
+        else
+        {
+            runner->setpoint += (diff > 0.0f) ? step : -step;
+        }
+    }
+    else // SP_SEGMENT_SOAK
+    {
+        runner->setpoint = seg_target;
+
+        float error = measurement - seg_target;
+        bool in_band = (seg->holdback <= 0.0f) ||
+                       (error >= -seg->holdback && error <= seg->holdback);
+        if (in_band)
+        {
+            runner->soak_elapsed += dt;
+            segment_done = (runner->soak_elapsed >= seg->duration_sec);
+        }
+    }
+
+    if (segment_done)
+    {
+        runner->index++;
+        runner->soak_elapsed = 0.0f;
+        if (runner->index >= runner->profile.count)
+        {
+            runner->active = false;
+            ESP_LOGI(TAG, "Profile complete at %.1f°C", runner->setpoint);
+        }
+    }
+
+    return runner->setpoint;
+}
+
+bool sp_runner_is_active(const sp_runner_t *runner)
+{
+    return runner && runner->active;
+}
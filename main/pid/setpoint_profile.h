@@ -0,0 +1,134 @@
+/**
+ * @file setpoint_profile.h
+ * @brief Ramp/soak setpoint profile engine
+ *
+ * A profile is a short list of segments that shape the PID setpoint over
+ * time instead of stepping it: ramps move the setpoint toward a target at
+ * a fixed rate, soaks hold it for a duration. Segment targets are offsets
+ * from a base target supplied on every step, so one profile shape works
+ * for any material temperature and follows setpoint edits mid-run.
+ *
+ * Evaluation is O(1) per control step with no allocation; the runner owns
+ * a copy of its profile.
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#ifndef SETPOINT_PROFILE_H
+#define SETPOINT_PROFILE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// =============================================================================
+// Type Definitions
+// =============================================================================
+
+#define SP_PROFILE_MAX_SEGMENTS 6
+
+/**
+ * @brief Segment types
+ */
+typedef enum
+{
+    SP_SEGMENT_RAMP, ///< Move setpoint toward the segment target at a fixed rate
+    SP_SEGMENT_SOAK  ///< Hold setpoint at the segment target for a duration
+} sp_segment_type_t;
+
+/**
+ * @brief One profile segment
+ */
+typedef struct
+{
+    sp_segment_type_t type;
+    float target_offset;   ///< Segment target relative to the base target (°C)
+    float rate;            ///< Ramp rate (°C/s); <= 0 steps immediately (ramps only)
+    uint16_t duration_sec; ///< Hold time (s) (soaks only)
+    float holdback;        ///< Soak timer only runs while |PV - SP| <= holdback (0 = always)
+} sp_segment_t;
+
+/**
+ * @brief Setpoint profile (sequence of segments)
+ */
+typedef struct
+{
+    sp_segment_t segments[SP_PROFILE_MAX_SEGMENTS];
+    uint8_t count;
+} sp_profile_t;
+
+/**
+ * @brief Profile runner state
+ */
+typedef struct
+{
+    sp_profile_t profile; ///< Profile being run (copied on start)
+    uint8_t index;        ///< Current segment
+    float setpoint;       ///< Current setpoint (°C)
+    float soak_elapsed;   ///< Time counted in the current soak (s)
+    bool active;          ///< Runner is executing a profile
+} sp_runner_t;
+
+// =============================================================================
+// Function Prototypes
+// =============================================================================
+
+/**
+ * @brief Clear all segments from a profile
+ */
+void sp_profile_clear(sp_profile_t *profile);
+
+/**
+ * @brief Append a ramp segment
+ *
+ * @param profile Profile to extend
+ * @param target_offset Ramp end point relative to the base target (°C)
+ * @param rate Ramp rate in °C/s (<= 0 steps immediately)
+ * @return true if added, false if the profile is full
+ */
+bool sp_profile_add_ramp(sp_profile_t *profile, float target_offset, float rate);
+
+/**
+ * @brief Append a soak segment
+ *
+ * @param profile Profile to extend
+ * @param target_offset Soak temperature relative to the base target (°C)
+ * @param duration_sec Hold time in seconds (0 = just wait for holdback)
+ * @param holdback Band around the setpoint the measurement must be in
+ *                 for the soak timer to run (0 = timer always runs)
+ * @return true if added, false if the profile is full
+ */
+bool sp_profile_add_soak(sp_profile_t *profile, float target_offset,
+                         uint16_t duration_sec, float holdback);
+
+/**
+ * @brief Start running a profile
+ *
+ * @param runner Runner state
+ * @param profile Profile to run (copied)
+ * @param start_setpoint Setpoint to ramp from, usually the current temperature
+ */
+void sp_runner_start(sp_runner_t *runner, const sp_profile_t *profile, float start_setpoint);
+
+/**
+ * @brief Stop the runner
+ */
+void sp_runner_stop(sp_runner_t *runner);
+
+/**
+ * @brief Advance the profile by one control step
+ *
+ * @param runner Runner state
+ * @param base_target Target the segment offsets are relative to (°C)
+ * @param measurement Current temperature (°C), used for soak holdback
+ * @param dt Time since the previous step (s)
+ * @return Setpoint for this step; base_target once the profile has finished
+ */
+float sp_runner_step(sp_runner_t *runner, float base_target, float measurement, float dt);
+
+/**
+ * @brief Check if a profile is running
+ */
+bool sp_runner_is_active(const sp_runner_t *runner);
+
+#endif // SETPOINT_PROFILE_H
@@ -98,6 +98,17 @@ void enter_heat_up_mode(ui_state_t return_to)
     ESP_LOGI(TAG, "Entering heat-up mode, will return to state: %d", return_to);
 }
 
+/**
+ * @brief Start a heat-up from outside the menus (scheduled pre-heat)
+ *
+ * The Heat Up screen stays up once the press is ready, as when Heat Up is
+ * selected from the main menu.
+ */
+void ui_enter_heat_up(void)
+{
+    enter_heat_up_mode(UI_STATE_HEAT_UP);
+}
+
 // =============================================================================
 // Statistics Reset Functions
 // =============================================================================
@@ -128,6 +139,12 @@ void reset_print_run_stats(void)
         current_run->time_elapsed = 0;
         current_run->shirts_completed = 0;
         current_run->avg_time_per_shirt = 0;
+        current_run->next_side = FRONT;
+        current_run->front_presses = 0;
+        current_run->back_presses = 0;
+        current_run->front_press_time = 0;
+        current_run->back_press_time = 0;
+        current_run->manual = false; // Done with the hand-set job: queued tickets may load
     }
 }
 
@@ -12,6 +12,10 @@
 #include "heating_contract.h"
 #include "controls_contract.h"
 #include "system_config.h"  // components/system_config/include/
+#include "session_accounting.h"  // Shift report formatting
+#include "cycle_engine.h"  // Pressing cycle stages
+#include "throughput.h"  // Pace limit names
+#include "rainflow.h"  // Wear cycle totals
 
 #include "esp_log.h"
 #include "esp_timer.h"
@@ -20,6 +24,7 @@
 
 #include <stdio.h>
 #include <string.h>
+#include <time.h>
 
 static const char *TAG = "ui_renderers";
 
@@ -60,6 +65,10 @@ extern int pid_selected_index;
 extern bool pid_edit_mode;
 extern float pid_staged_value;
 
+extern float surface_cal_probe_value;
+extern int surface_cal_probe_point;
+extern bool surface_cal_clear_armed;
+
 extern bool free_press_mode;
 extern uint16_t free_press_count;
 extern uint32_t free_press_time_elapsed;
@@ -67,6 +76,7 @@ extern uint32_t free_press_avg_time;
 
 extern int profile_selected_index;
 extern int stats_selected_index;
+extern bool shift_report_show_session;
 
 extern int reset_stats_selected_index;
 extern uint32_t reset_stats_press_start_time;
@@ -95,6 +105,7 @@ extern const char *stats_menu_items[];
 extern pressing_cycle_t current_cycle;
 extern uint32_t stage_start_time;
 extern cycle_status_t current_stage;
+extern cycle_engine_t cycle_engine;
 extern uint32_t system_start_time;
 extern print_run_t print_run;
 
@@ -108,6 +119,70 @@ void perform_all_stats_reset(void);
 void render_reset_countdown(uint32_t elapsed_ms);
 void render_reset_stats_menu(void);
 
+// =============================================================================
+// Rendering Helpers
+// =============================================================================
+
+/**
+ * @brief Readiness line for the press-waiting screens
+ *
+ * "Ready (predicted)" means the reading is still outside the ready band
+ * but stage 1 is predicted to stay within it.
+ */
+static const char *ready_status_text(void)
+{
+    if (!is_heat_press_ready())
+    {
+        return "Waiting for temp";
+    }
+    return is_ready_by_prediction() ? "Ready (predicted)" : "Ready";
+}
+
+/**
+ * @brief Shuttle press station line, e.g. "Stn A | B: Stage 2"
+ *
+ * Names the station under the platen and what the other one is waiting
+ * for ("Load" when it has no cycle in progress).
+ */
+static void format_station_line(char *buffer, size_t size)
+{
+    uint8_t platen = get_platen_station();
+    uint8_t other = (platen + 1) % STATION_COUNT;
+    station_summary_t summary;
+
+    if (!get_station_summary(other, &summary))
+    {
+        buffer[0] = '\0';
+        return;
+    }
+    snprintf(buffer, size, "Stn %c | %c: %s", 'A' + platen, 'A' + other,
+             summary.next_stage ? summary.next_stage : "Load");
+}
+
+/**
+ * @brief Pacing line, e.g. "Takt 52/45s Operator"
+ *
+ * Actual against target seconds per shirt over the configured window,
+ * and what is holding the pace back ("--" before the first shirt).
+ */
+static void format_pace_line(char *buffer, size_t size)
+{
+    pace_status_t pace;
+
+    if (!get_pace_status(PACING_WINDOW_MIN, &pace))
+    {
+        buffer[0] = '\0';
+        return;
+    }
+    if (pace.shirts == 0)
+    {
+        snprintf(buffer, size, "Takt --/%us", pace.target_takt);
+        return;
+    }
+    snprintf(buffer, size, "Takt %u/%us %s", pace.actual_takt, pace.target_takt,
+             throughput_limit_name(pace.limit));
+}
+
 // =============================================================================
 // Rendering Function Implementations
 // =============================================================================
@@ -229,13 +304,38 @@ void render_timers_menu(void)
 {
     char line[21];
 
+    // Station B timers are hidden unless the press is a shuttle press
+    uint8_t shown = 0;
+    for (uint8_t i = 0; i < TIMER_COUNT; i++)
+    {
+        shown += ui_is_timer_item_shown(i) ? 1 : 0;
+    }
+
+    // More than four items do not fit double-spaced on the 8-row display
+    uint8_t row_step = (shown > 4) ? 1 : 2;
+    uint8_t row = 0;
+
     display_clear();
 
     for (uint8_t i = 0; i < TIMER_COUNT; i++)
     {
+        if (!ui_is_timer_item_shown(i))
+        {
+            continue;
+        }
+
         bool is_selected = (i == timer_selected_index);
         bool is_editing = is_selected && timer_edit_mode;
 
+        if (i == TIMER_PROGRAM)
+        {
+            snprintf(line, sizeof(line), "%c %-8s %8s", is_selected ? '>' : ' ', timer_menu_items[i],
+                     cycle_program_name(current_settings->cycle_program));
+            display_text(0, row, line);
+            row += row_step;
+            continue;
+        }
+
         int value;
         if (is_editing)
         {
@@ -243,7 +343,27 @@ void render_timers_menu(void)
         }
         else
         {
-            value = (i == TIMER_STAGE1) ? current_settings->stage1_default : current_settings->stage2_default;
+            switch (i)
+            {
+            case TIMER_STAGE1:
+                value = current_settings->stage1_default;
+                break;
+            case TIMER_STAGE2:
+                value = current_settings->stage2_default;
+                break;
+            case TIMER_BACK_STAGE1:
+                value = current_settings->back_stage1_default;
+                break;
+            case TIMER_BACK_STAGE2:
+                value = current_settings->back_stage2_default;
+                break;
+            case TIMER_STATION_B_STAGE1:
+                value = current_settings->station_b_stage1_default;
+                break;
+            default: // TIMER_STATION_B_STAGE2
+                value = current_settings->station_b_stage2_default;
+                break;
+            }
         }
 
         if (is_editing)
@@ -258,7 +378,8 @@ void render_timers_menu(void)
         {
             snprintf(line, sizeof(line), "  %-8s   %3ds ", timer_menu_items[i], value);
         }
-        display_text(0, i * 2, line);
+        display_text(0, row, line);
+        row += row_step;
     }
 
     display_flush();
@@ -298,6 +419,9 @@ void render_temperature_menu(void)
 
     char line[21];
 
+    // More than four items do not fit double-spaced on the 8-row display
+    uint8_t row_step = (TEMP_COUNT > 4) ? 1 : 2;
+
     display_clear();
 
     for (uint8_t i = 0; i < TEMP_COUNT; i++)
@@ -312,9 +436,38 @@ void render_temperature_menu(void)
             break;
         }
 
-        if (i == TEMP_TARGET_TEMP)
+        if (i == TEMP_KEEP_WARM)
+        {
+            int drop = is_editing ? (int)temp_staged_value : (int)current_settings->keep_warm_drop;
+            char value[8];
+            if (drop > 0)
+            {
+                snprintf(value, sizeof(value), "-%d", drop);
+            }
+            else
+            {
+                snprintf(value, sizeof(value), "Off");
+            }
+
+            if (is_editing)
+            {
+                snprintf(line, sizeof(line), "> %-9s [%4s]", temp_menu_items[i], value);
+            }
+            else if (is_selected)
+            {
+                snprintf(line, sizeof(line), "> %-9s  %4s ", temp_menu_items[i], value);
+            }
+            else
+            {
+                snprintf(line, sizeof(line), "  %-9s  %4s ", temp_menu_items[i], value);
+            }
+        }
+        else if (i == TEMP_TARGET_TEMP || i == TEMP_BACK_OFFSET)
         {
-            int temp_int = is_editing ? (int)temp_staged_value : (int)current_settings->target_temp;
+            float current_value = (i == TEMP_TARGET_TEMP) ?
+                                  current_settings->target_temp :
+                                  current_settings->back_temp_offset;
+            int temp_int = is_editing ? (int)temp_staged_value : (int)current_value;
             if (is_editing)
             {
                 snprintf(line, sizeof(line), "> %-9s  [%3d]", temp_menu_items[i], temp_int);
@@ -328,6 +481,22 @@ void render_temperature_menu(void)
                 snprintf(line, sizeof(line), "  %-9s   %3d ", temp_menu_items[i], temp_int);
             }
         }
+        else if (i == TEMP_SURFACE_CAL)
+        {
+            // Points in the correction table in force
+            surface_calibration_t calibration;
+            get_surface_calibration(&calibration);
+            char value[8];
+            if (calibration.count > 0)
+            {
+                snprintf(value, sizeof(value), "%upt", calibration.count);
+            }
+            else
+            {
+                snprintf(value, sizeof(value), "Off");
+            }
+            snprintf(line, sizeof(line), "%c %-11s %4s", is_selected ? '>' : ' ', temp_menu_items[i], value);
+        }
         else // TEMP_PID_CONTROL
         {
             if (is_selected)
@@ -339,7 +508,7 @@ void render_temperature_menu(void)
                 snprintf(line, sizeof(line), "  %s", temp_menu_items[i]);
             }
         }
-        display_text(0, i * 2, line);
+        display_text(0, i * row_step, line);
     }
 
     display_flush();
@@ -361,14 +530,44 @@ void render_pid_menu(void)
 {
     char line[21];
 
+    // More than four items do not fit double-spaced on the 8-row display
+    uint8_t row_step = (PID_COUNT > 4) ? 1 : 2;
+    uint8_t visible_items = 8 / row_step;
+
+    // Scroll to keep the selected item visible
+    uint8_t scroll_offset = 0;
+    if (pid_selected_index >= visible_items)
+    {
+        scroll_offset = pid_selected_index - visible_items + 1;
+    }
+
     display_clear();
 
-    for (uint8_t i = 0; i < PID_COUNT; i++)
+    for (uint8_t i = scroll_offset; i < PID_COUNT && i < scroll_offset + visible_items; i++)
     {
         bool is_selected = (i == pid_selected_index);
         bool is_editing = is_selected && pid_edit_mode;
 
-        if (i == PID_AUTOTUNE)
+        if (i == PID_ADAPTIVE || i == PID_CASCADE || i == PID_SMITH || i == PID_LOAD_COMP ||
+            i == PID_POWER_FF || i == PID_PREBOOST)
+        {
+            bool enabled = (i == PID_ADAPTIVE)  ? current_settings->adaptive_tuning :
+                           (i == PID_CASCADE)   ? current_settings->cascade_enabled :
+                           (i == PID_SMITH)     ? current_settings->smith_enabled :
+                           (i == PID_LOAD_COMP) ? current_settings->load_compensation :
+                           (i == PID_POWER_FF)  ? current_settings->power_feedforward :
+                                                  current_settings->press_preboost;
+            const char *value = enabled ? "On" : "Off";
+            if (is_selected)
+            {
+                snprintf(line, sizeof(line), "> %-9s %3s ", pid_menu_items[i], value);
+            }
+            else
+            {
+                snprintf(line, sizeof(line), "  %-9s %3s ", pid_menu_items[i], value);
+            }
+        }
+        else if (i == PID_AUTOTUNE)
         {
             // Auto-Tune doesn't have a value to display or edit
             if (is_selected)
@@ -428,7 +627,7 @@ void render_pid_menu(void)
                 snprintf(line, sizeof(line), "  %-3s   %5.2f ", pid_menu_items[i], value);
             }
         }
-        display_text(0, i * 2, line);
+        display_text(0, (i - scroll_offset) * row_step, line);
     }
 
     display_flush();
@@ -463,12 +662,35 @@ void render_start_pressing(void)
     char buffer[32];
 
     display_clear();
-    display_text(0, 0, "Ready to Press");
+    if (current_run != NULL && current_run->type == DOUBLE_SIDED)
+    {
+        display_text(0, 0, (get_active_side() == BACK) ? "Ready: Back side" : "Ready: Front side");
+    }
+    else
+    {
+        display_text(0, 0, "Ready to Press");
+    }
     sprintf(buffer, "Temp: %.1f/%.1f C",
             temperature_display_celsius,
-            current_settings->target_temp);
+            get_active_target_temp());
     display_text(0, 1, buffer);
     display_text(0, 2, "Close press to start");
+    display_text(0, 3, ready_status_text());
+
+    // Imported job ticket
+    uint8_t queued = 0;
+    const char *ticket = get_active_job_ticket(&queued);
+    if (ticket != NULL && current_run != NULL)
+    {
+        snprintf(buffer, sizeof(buffer), "Job %s %u/%u", ticket,
+                 current_run->shirts_completed, current_run->num_shirts);
+        display_text(0, 5, buffer);
+    }
+    if (queued > 0)
+    {
+        sprintf(buffer, "Queued: %u", queued);
+        display_text(0, 6, buffer);
+    }
     display_flush();
 }
 
@@ -485,6 +707,7 @@ void render_free_press(void)
     sprintf(buffer, "Pressed: %d", free_press_count);
     display_text(0, 2, buffer);
     display_text(0, 3, "Close press to start");
+    display_text(0, 4, ready_status_text());
     display_flush();
 }
 
@@ -495,36 +718,35 @@ void render_profiles_menu(void)
 
 void render_pressing_active(void)
 {
-    extern pressing_cycle_t current_cycle;
-    extern uint32_t stage_start_time;
-    extern cycle_status_t current_stage;
-
     static uint32_t last_time_remaining = 9999;
     static cycle_status_t last_stage = IDLE;
+    static uint8_t last_stage_index = 0;
     static bool screen_initialized = false;
 
     uint32_t current_time = esp_timer_get_time() / 1000000;  // Convert to seconds
-    uint32_t stage_elapsed = current_time - stage_start_time;
-    uint32_t stage_duration = (current_stage == STAGE1) ?
-                               current_cycle.stage1_duration :
-                               current_cycle.stage2_duration;
-    uint32_t time_remaining = (stage_elapsed < stage_duration) ?
-                               (stage_duration - stage_elapsed) : 0;
+    const cycle_stage_t *stage = cycle_engine_current_stage(&cycle_engine);
+    uint8_t stage_index = cycle_engine_stage_index(&cycle_engine);
+    uint32_t stage_duration = stage ? stage->duration : 0;
+    uint32_t time_remaining = cycle_engine_remaining(&cycle_engine, current_time);
+    bool last_stage_running = (stage_index + 1 >= cycle_engine.definition.stage_count);
 
     // Full redraw when stage changes or waiting between stages
-    if (current_stage != last_stage || !screen_initialized)
+    if (current_stage != last_stage || stage_index != last_stage_index || !screen_initialized)
     {
         display_clear();
 
-        if (current_stage == IDLE)
+        if (current_stage == IDLE || !stage)
         {
-            // Waiting between Stage 1 and Stage 2
-            display_text(0, 0, "Stage 1 Done!");
+            // Waiting between stages
+            char buffer[22];
+            display_text(0, 0, "Stage Done!");
             display_text(0, 1, "Open press, then");
-            display_text(0, 2, "close for Stage 2");
+            snprintf(buffer, sizeof(buffer), "close for %s", stage ? stage->name : "next");
+            display_text(0, 2, buffer);
             display_flush();
             screen_initialized = true;
             last_stage = current_stage;
+            last_stage_index = stage_index;
             return;  // Don't show countdown when waiting
         }
 
@@ -542,15 +764,32 @@ void render_pressing_active(void)
         }
 
         // Format: "Stage 1         # 125" (stage left-aligned, shirt number right-aligned)
-        const char *stage_text = (current_stage == STAGE1) ? "Stage 1" : "Stage 2";
+        // Double-sided jobs tag the stage with the side: "Stage 1 B       # 125"
+        char stage_text[12];
+        if (!free_press_mode && print_run.type == DOUBLE_SIDED)
+        {
+            snprintf(stage_text, sizeof(stage_text), "%s %c", stage->name,
+                     (current_cycle.side == BACK) ? 'B' : 'F');
+        }
+        else
+        {
+            snprintf(stage_text, sizeof(stage_text), "%s", stage->name);
+        }
         int padding = 21 - strlen(stage_text) - strlen(shirt_buffer);
         if (padding < 1) padding = 1;
 
         sprintf(top_line, "%s%*s", stage_text, padding + (int)strlen(shirt_buffer), shirt_buffer);
         display_text(0, 0, top_line);
 
+        if (SHUTTLE_ENABLED)
+        {
+            format_station_line(top_line, sizeof(top_line));
+            display_text(0, 1, top_line);
+        }
+
         screen_initialized = true;
         last_stage = current_stage;
+        last_stage_index = stage_index;
         last_time_remaining = 9999; // Force update
     }
 
@@ -565,7 +804,7 @@ void render_pressing_active(void)
         }
 
         // Show completion message when done or draw countdown
-        if (time_remaining == 0 && current_stage == STAGE2)
+        if (time_remaining == 0 && last_stage_running)
         {
             display_text(0, 2, "Open to complete");
         }
@@ -635,6 +874,19 @@ void render_stats_production(void)
     sprintf(buffer, "Idle: %lu%%", idle_pct);
     display_text(0, 3, buffer);
 
+    // Per-side averages (only once double-sided shirts have been pressed)
+    if (stats->front_presses > 0 || stats->back_presses > 0)
+    {
+        uint32_t front_avg = (stats->front_presses > 0) ?
+                             stats->front_press_time / stats->front_presses : 0;
+        uint32_t back_avg = (stats->back_presses > 0) ?
+                            stats->back_press_time / stats->back_presses : 0;
+        sprintf(buffer, "F/B: %lus / %lus", front_avg, back_avg);
+        display_text(0, 4, buffer);
+        sprintf(buffer, "2-sided: %lu", stats->double_sided_shirts);
+        display_text(0, 5, buffer);
+    }
+
     display_flush();
 }
 
@@ -673,6 +925,12 @@ void render_stats_temperature(void)
     sprintf(buffer, "Since tune: %lu", presses_since_tune);
     display_text(0, 3, buffer);
 
+    // Observed thermal load (what the garment/ambient is drawing)
+    sprintf(buffer, "Load: %dW", (int)get_estimated_load_watts());
+    display_text(0, 4, buffer);
+    sprintf(buffer, "Last press: %dW", (int)get_last_press_load_watts());
+    display_text(0, 5, buffer);
+
     display_flush();
 }
 
@@ -762,6 +1020,227 @@ void render_stats_kpis(void)
     display_flush();
 }
 
+void render_stats_shift(void)
+{
+    char buffer[32];
+    session_tally_t session;
+    session_tally_t shift;
+
+    get_session_report(&session, &shift);
+    const session_tally_t *tally = shift_report_show_session ? &session : &shift;
+    uint32_t total = session_tally_total_seconds(tally);
+
+    display_clear();
+
+    // Header: view, duration and finished shirts
+    sprintf(buffer, "%-7s %luh%02lum %3lush",
+            shift_report_show_session ? "Session" : "Shift",
+            total / 3600, (total % 3600) / 60, tally->shirts);
+    display_text(0, 0, buffer);
+
+    sprintf(buffer, "Util %u%%  %.1f sh/h",
+            session_tally_utilization(tally),
+            session_tally_shirts_per_hour(tally));
+    display_text(0, 1, buffer);
+
+    // One line per time category
+    for (int i = 0; i < TIME_CATEGORY_COUNT; i++)
+    {
+        uint32_t secs = tally->seconds[i];
+        uint32_t pct = (total > 0) ? (uint32_t)(((uint64_t)secs * 100) / total) : 0;
+        sprintf(buffer, "%-8s %2luh%02lum %3lu%%",
+                session_time_category_name((time_category_t)i),
+                secs / 3600, (secs % 3600) / 60, pct);
+        display_text(0, 2 + i, buffer);
+    }
+
+    display_flush();
+}
+
+void render_stats_pace(void)
+{
+    static const uint8_t windows[] = {5, 15, 60};
+    char buffer[32];
+    pace_status_t pace;
+
+    display_clear();
+    display_text(0, 0, "===== Pace =====");
+
+    // Shirts and seconds per shirt over each window
+    for (int i = 0; i < 3; i++)
+    {
+        get_pace_status(windows[i], &pace);
+        if (pace.shirts > 0)
+        {
+            sprintf(buffer, "%2umin %3ush %4us", pace.window_min, pace.shirts, pace.actual_takt);
+        }
+        else
+        {
+            sprintf(buffer, "%2umin %3ush   --", pace.window_min, pace.shirts);
+        }
+        display_text(0, 1 + i, buffer);
+    }
+
+    // Where the time per press went over the pacing window
+    get_pace_status(PACING_WINDOW_MIN, &pace);
+    sprintf(buffer, "Target %us/shirt", pace.target_takt);
+    display_text(0, 4, buffer);
+    sprintf(buffer, "Press %us Hand %us", pace.press_sec, pace.handling_sec);
+    display_text(0, 5, buffer);
+    sprintf(buffer, "Wait temp %us", pace.recovery_sec);
+    display_text(0, 6, buffer);
+    sprintf(buffer, "Limit: %s", (pace.presses > 0) ? throughput_limit_name(pace.limit) : "--");
+    display_text(0, 7, buffer);
+
+    display_flush();
+}
+
+void render_stats_wear(void)
+{
+    char buffer[32];
+    wear_stats_t wear;
+
+    get_wear_stats(&wear);
+
+    display_clear();
+    display_text(0, 0, "===== Wear =====");
+
+    // Life used per part; '!' once it is due for service
+    for (int part = 0; part < WEAR_PART_COUNT; part++)
+    {
+        static const char *names[WEAR_PART_COUNT] = {"SSR", "Element", "Platen"};
+        float used = get_wear_life_used((wear_part_t)part);
+        sprintf(buffer, "%-7s %5.1f%%%s", names[part], (used < 999.9f) ? used : 999.9f,
+                (used >= WEAR_SERVICE_PERCENT) ? " !" : "");
+        display_text(0, 1 + part * 2, buffer);
+    }
+
+    sprintf(buffer, " %lu sw %luh on", wear.ssr_switches, wear.ssr_on_seconds / 3600);
+    display_text(0, 2, buffer);
+    sprintf(buffer, " %lu cycles", rainflow_total_cycles(&wear.element));
+    display_text(0, 4, buffer);
+    sprintf(buffer, " %lu cycles", rainflow_total_cycles(&wear.platen));
+    display_text(0, 6, buffer);
+
+    // Heater power from warm-up fits against the baseline
+    heater_trend_t trend;
+    get_heater_trend(&trend);
+    if (trend.valid)
+    {
+        bool due = trend.watts_change_percent <= -HEATER_HEALTH_POWER_DROP ||
+                   trend.loss_change_percent >= HEATER_HEALTH_LOSS_RISE;
+        sprintf(buffer, "Heater %+4.0f%% pwr%s", trend.watts_change_percent, due ? " !" : "");
+    }
+    else
+    {
+        sprintf(buffer, "Heater learning");
+    }
+    display_text(0, 7, buffer);
+
+    display_flush();
+}
+
+// =============================================================================
+// Surface Calibration
+// =============================================================================
+
+void render_surface_cal(void)
+{
+    char buffer[32];
+    surface_cal_status_t status;
+
+    get_surface_cal_status(&status);
+
+    display_clear();
+    display_text(0, 0, "== Surface Cal ==");
+
+    if (!status.active)
+    {
+        // Table in force
+        surface_calibration_t calibration;
+        get_surface_calibration(&calibration);
+        if (calibration.count == 0)
+        {
+            display_text(0, 2, "No table in use");
+        }
+        else
+        {
+            sprintf(buffer, "%u points", calibration.count);
+            display_text(0, 2, buffer);
+
+            if (calibration.day != 0)
+            {
+                time_t date = (time_t)calibration.day * 86400;
+                struct tm utc;
+                gmtime_r(&date, &utc);
+                strftime(buffer, sizeof(buffer), "Cal %Y-%m-%d", &utc);
+            }
+            else
+            {
+                sprintf(buffer, "Cal date unknown");
+            }
+            display_text(0, 3, buffer);
+
+            sprintf(buffer, "As found %.1f C", calibration.as_found_max);
+            display_text(0, 4, buffer);
+        }
+
+        display_text(0, 6, "PUSH to start");
+        display_text(0, 7, surface_cal_clear_armed ? "SAVE again: clear" : "SAVE twice: clear");
+        display_flush();
+        return;
+    }
+
+    sprintf(buffer, "Point %u/%u at %.0f C", status.point + 1, status.points, status.setpoint);
+    display_text(0, 1, buffer);
+    sprintf(buffer, "Temp: %.1f C", temperature_display_celsius);
+    display_text(0, 2, buffer);
+
+    if (!status.settled)
+    {
+        sprintf(buffer, "Settling %us", status.settle_remaining);
+        display_text(0, 4, buffer);
+        display_text(0, 5, "Place surface probe");
+    }
+    else
+    {
+        // Probe reading starts at the thermocouple reading until it is dialled in
+        float probe = (surface_cal_probe_point == status.point) ? surface_cal_probe_value : status.reading;
+        sprintf(buffer, "Reading %.1f C", status.reading);
+        display_text(0, 4, buffer);
+        sprintf(buffer, "Probe  [%.1f C]", probe);
+        display_text(0, 5, buffer);
+        display_text(0, 6, "PUSH to record");
+    }
+
+    display_text(0, 7, "BACK to abort");
+    display_flush();
+}
+
+void render_surface_cal_done(void)
+{
+    char buffer[32];
+    surface_cal_status_t status;
+
+    get_surface_cal_status(&status);
+
+    display_clear();
+    display_text(0, 0, "Surface Cal Done");
+
+    sprintf(buffer, "%u points", status.point);
+    display_text(0, 2, buffer);
+
+    // Drift since the previous table, and how far the points are from straight
+    sprintf(buffer, "As found %.1f C", status.as_found_max);
+    display_text(0, 3, buffer);
+    sprintf(buffer, "Interp   %.1f C", status.interpolation_max);
+    display_text(0, 4, buffer);
+
+    display_text(0, 6, "PUSH to save");
+    display_text(0, 7, "BACK to discard");
+    display_flush();
+}
+
 // =============================================================================
 // Auto-Tune State Handlers (NEW)
 // =============================================================================
@@ -830,16 +1309,32 @@ void render_autotune_complete(void)
     display_clear();
     display_text(0, 0, "Auto-Tune Done!");
 
-    // Show new PID parameters
+    // Show new PID parameters (surface loop gains after a cascade auto-tune)
+    bool cascade = current_settings->cascade_enabled;
     sprintf(buffer, "Kp:%.2f Ki:%.3f",
-            current_settings->pid_kp,
-            current_settings->pid_ki);
+            cascade ? current_settings->outer_kp : current_settings->pid_kp,
+            cascade ? current_settings->outer_ki : current_settings->pid_ki);
     display_text(0, 1, buffer);
 
-    sprintf(buffer, "Kd:%.3f", current_settings->pid_kd);
+    sprintf(buffer, "Kd:%.3f", cascade ? current_settings->outer_kd : current_settings->pid_kd);
     display_text(0, 2, buffer);
 
-    display_text(0, 3, "Press any button");
+    // Simulated rule ranking, best (applied) first
+    uint8_t row = 3;
+    const char *rule_name;
+    float score;
+    for (uint8_t rank = 0; rank < 4; rank++)
+    {
+        if (ui_callbacks.get_autotune_ranking == NULL ||
+            !ui_callbacks.get_autotune_ranking(rank, &rule_name, &score))
+        {
+            break;
+        }
+        sprintf(buffer, "%c%u %-6s %5.1f", (rank == 0) ? '>' : ' ', rank + 1, rule_name, score);
+        display_text(0, row++, buffer);
+    }
+
+    display_text(0, row, "Press any button");
     display_flush();
 }
 
@@ -997,7 +1492,7 @@ void render_reset_stats(void)
 }
 
 // New state render functions
-void render_stage1_done(void)
+void render_stage_done(void)
 {
     display_clear();
     display_invert(true);
@@ -1005,15 +1500,30 @@ void render_stage1_done(void)
     display_flush();
 }
 
-void render_stage2_ready(void)
+void render_stage_ready(void)
 {
+    char buffer[22];
+    const cycle_stage_t *stage = cycle_engine_current_stage(&cycle_engine);
+
     display_clear();
     display_invert(false);
     display_large_text(10, 16, "READY");
+    if (stage)
+    {
+        snprintf(buffer, sizeof(buffer), "Next: %s", stage->name);
+        display_text(0, 6, buffer);
+    }
+    format_pace_line(buffer, sizeof(buffer));
+    display_text(0, 7, buffer);
+    if (SHUTTLE_ENABLED)
+    {
+        format_station_line(buffer, sizeof(buffer));
+        display_text(0, 0, buffer);
+    }
     display_flush();
 }
 
-void render_stage2_done(void)
+void render_last_stage_done(void)
 {
     display_clear();
     display_invert(true);
@@ -1029,6 +1539,21 @@ void render_cycle_complete(void)
     display_clear();
     display_invert(false);
 
+    format_pace_line(buffer, sizeof(buffer));
+    display_text(0, 7, buffer);
+
+    if (SHUTTLE_ENABLED)
+    {
+        station_summary_t a;
+        station_summary_t b;
+        get_station_summary(0, &a);
+        get_station_summary(1, &b);
+        snprintf(buffer, sizeof(buffer), "A:%u B:%u presses", a.presses, b.presses);
+        display_text(0, 5, buffer);
+        format_station_line(buffer, sizeof(buffer));
+        display_text(0, 6, buffer);
+    }
+
     if (free_press_mode)
     {
         display_text(0, 0, "Press Complete!");
@@ -1040,6 +1565,19 @@ void render_cycle_complete(void)
             display_text(0, 2, buffer);
         }
     }
+    else if (print_run.type == DOUBLE_SIDED && print_run.next_side == BACK)
+    {
+        // Front side just finished - the same shirt goes back on for its back side
+        display_text(0, 0, "Front Done!");
+        sprintf(buffer, "Done: %d / %d",
+                print_run.shirts_completed,
+                print_run.num_shirts);
+        display_text(0, 1, buffer);
+        display_text(0, 2, "Flip shirt");
+        display_text(0, 3, "Close for back");
+        display_flush();
+        return;
+    }
     else
     {
         display_text(0, 0, "Cycle Complete!");
@@ -1102,6 +1640,44 @@ void handle_heat_up_state(ui_event_t event)
     }
 }
 
+void render_paused(void)
+{
+    char buffer[32];
+
+    display_clear();
+    display_text(0, 0, "===== PAUSED =====");
+
+    if (is_keep_warm_active())
+    {
+        sprintf(buffer, "Keep warm: %.0fC", get_control_setpoint());
+    }
+    else
+    {
+        sprintf(buffer, "Heater off");
+    }
+    display_text(0, 1, buffer);
+
+    sprintf(buffer, "Now: %.1f/%.1fC",
+            temperature_display_celsius,
+            get_active_target_temp());
+    display_text(0, 2, buffer);
+
+    // Predicted time to be ready again after resuming
+    uint32_t eta_sec = get_resume_ready_eta();
+    if (eta_sec == 0)
+    {
+        sprintf(buffer, "Resume: ready now");
+    }
+    else
+    {
+        sprintf(buffer, "Resume: ~%lum %02lus", eta_sec / 60, eta_sec % 60);
+    }
+    display_text(0, 3, buffer);
+
+    display_text(0, 5, "PAUSE to resume");
+    display_flush();
+}
+
 void render_heat_up(void)
 {
     char buffer[32];
@@ -1130,8 +1706,17 @@ void render_heat_up(void)
     // Full redraw only when heating state changes or entering for first time
     if (heating_active != heat_up_heating_was_active || !heat_up_screen_initialized)
     {
+        uint16_t ready_minute;
         display_clear();
-        display_text(0, 0, "Heating Up...");
+        if (get_scheduled_preheat(&ready_minute))
+        {
+            sprintf(buffer, "Pre-heat for %02u:%02u", ready_minute / 60, ready_minute % 60);
+            display_text(0, 0, buffer);
+        }
+        else
+        {
+            display_text(0, 0, "Heating Up...");
+        }
         display_flush();
         heat_up_screen_initialized = true;
         heat_up_heating_was_active = true;
@@ -1172,6 +1757,10 @@ void render_heat_up(void)
                 {
                     sprintf(buffer, "ETA: %lum %lus       ", eta_min, eta_sec_remainder);
                 }
+                else if (is_setpoint_profile_active())
+                {
+                    sprintf(buffer, "Soaking...          ");
+                }
                 else
                 {
                     sprintf(buffer, "ETA: Ready!         ");
@@ -10,7 +10,9 @@
  */
 
 #include <string.h>
+#include <strings.h>
 #include <stdio.h>
+#include <math.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "esp_log.h"
@@ -23,6 +25,8 @@
 #include "data_model.h"           // components/storage/include/
 #include "system_config.h"        // components/system_config/include/
 #include "main.h"                 // For is_heat_press_ready()
+#include "settings_events.h"      // Settings change notifications
+#include "cycle_engine.h"         // Cycle program names
 
 static const char *TAG = "ui_state";
 
@@ -65,7 +69,10 @@ const char *stats_menu_items[] = {
     "Production",
     "Temperature",
     "Events",
-    "KPIs"
+    "KPIs",
+    "Shift Report",
+    "Pace",
+    "Wear"
 };
 
 const char *settings_menu_items[] = {
@@ -76,11 +83,19 @@ const char *settings_menu_items[] = {
 
 const char *timer_menu_items[] = {
     "Stage 1",
-    "Stage 2"
+    "Stage 2",
+    "Back S1",
+    "Back S2",
+    "Stn B S1",
+    "Stn B S2",
+    "Program"
 };
 
 const char *temp_menu_items[] = {
     "Target C",
+    "Back +/-C",
+    "Keep warm",
+    "Surface cal",
     "PID Control"
 };
 
@@ -88,7 +103,13 @@ const char *pid_menu_items[] = {
     "Auto-Tune",
     "Kp",
     "Ki",
-    "Kd"
+    "Kd",
+    "Adaptive",
+    "Cascade",
+    "Smith pred",
+    "Load comp",
+    "Power FF",
+    "Pre-boost"
 };
 
 const char *job_setup_items[] = {
@@ -139,6 +160,7 @@ int profile_selected_index = 0;  // non-static - shared with ui_renderers.c
 
 // Statistics submenu state (non-static - shared with ui_renderers.c)
 int stats_selected_index = 0;
+bool shift_report_show_session = false;  ///< Shift report screen shows session instead of shift
 
 // Settings submenu state (non-static - shared with ui_renderers.c)
 int timer_selected_index = 0;
@@ -153,9 +175,18 @@ int pid_selected_index = 0;
 bool pid_edit_mode = false;
 float pid_staged_value = 0.0f;
 
+// Surface calibration screen state (non-static - shared with ui_renderers.c)
+float surface_cal_probe_value = 0.0f;  ///< Probe reading being dialled in (°C)
+int surface_cal_probe_point = -1;      ///< Point surface_cal_probe_value belongs to, -1 = none yet
+bool surface_cal_clear_armed = false;  ///< SAVE pressed once on the table screen
+
 // Press state tracking
 static bool was_press_closed_ui = false;
 
+// Pause tracking
+static bool pause_requested = false;                   ///< Pause button seen, not yet handled by main
+static ui_state_t pause_return_state = UI_STATE_MAIN_MENU; ///< State to return to after pause
+
 // Free press mode tracking (non-static - shared with ui_helpers.c)
 bool free_press_mode = false;              ///< Whether we're in free press mode (no job tracking)
 uint16_t free_press_count = 0;             ///< Number of shirts pressed in free press mode
@@ -211,15 +242,21 @@ static void handle_start_pressing_state(ui_event_t event);
 static void handle_free_press_state(ui_event_t event);         // NEW
 static void handle_profiles_menu_state(ui_event_t event);      // NEW
 static void handle_pressing_active_state(ui_event_t event);
-static void handle_stage1_done_state(ui_event_t event);        // NEW
-static void handle_stage2_ready_state(ui_event_t event);       // NEW
-static void handle_stage2_done_state(ui_event_t event);        // NEW
+static void handle_stage_done_state(ui_event_t event);
+static void handle_stage_ready_state(ui_event_t event);
+static void handle_last_stage_done_state(ui_event_t event);
 static void handle_cycle_complete_state(ui_event_t event);     // NEW
 static void handle_statistics_state(ui_event_t event);
 static void handle_stats_production_state(ui_event_t event);   // NEW
 static void handle_stats_temperature_state(ui_event_t event);  // NEW
 static void handle_stats_events_state(ui_event_t event);       // NEW
 static void handle_stats_kpis_state(ui_event_t event);         // NEW
+static void handle_stats_shift_state(ui_event_t event);
+static void handle_stats_pace_state(ui_event_t event);
+static void handle_stats_wear_state(ui_event_t event);
+static void handle_surface_cal_state(ui_event_t event);
+static void handle_surface_cal_done_state(ui_event_t event);
+static void handle_paused_state(ui_event_t event);
 // Note: handle_autotune_state, handle_autotune_complete_state, handle_reset_stats_state,
 // and handle_heat_up_state are now in ui_renderers.c
 
@@ -245,13 +282,19 @@ void render_stats_production(void);
 void render_stats_temperature(void);
 void render_stats_events(void);
 void render_stats_kpis(void);
+void render_stats_shift(void);
+void render_stats_pace(void);
+void render_stats_wear(void);
+void render_surface_cal(void);
+void render_surface_cal_done(void);
 void render_autotune(void);
 void render_autotune_complete(void);
 void render_reset_stats(void);
 void render_heat_up(void);
-void render_stage1_done(void);
-void render_stage2_ready(void);
-void render_stage2_done(void);
+void render_paused(void);
+void render_stage_done(void);
+void render_stage_ready(void);
+void render_last_stage_done(void);
 void render_cycle_complete(void);
 
 // Event handlers for specific states (defined in ui_renderers.c)
@@ -289,19 +332,25 @@ static const state_handler_entry_t state_handlers[] = {
     {UI_STATE_FREE_PRESS, handle_free_press_state, render_free_press, "Free Press"},
     {UI_STATE_PROFILES_MENU, handle_profiles_menu_state, render_profiles_menu, "Profiles"},
     {UI_STATE_PRESSING_ACTIVE, handle_pressing_active_state, render_pressing_active, "Pressing Active"},
-    {UI_STATE_STAGE1_DONE, handle_stage1_done_state, render_stage1_done, "Stage 1 Done"},
-    {UI_STATE_STAGE2_READY, handle_stage2_ready_state, render_stage2_ready, "Stage 2 Ready"},
-    {UI_STATE_STAGE2_DONE, handle_stage2_done_state, render_stage2_done, "Stage 2 Done"},
+    {UI_STATE_STAGE_DONE, handle_stage_done_state, render_stage_done, "Stage Done"},
+    {UI_STATE_STAGE_READY, handle_stage_ready_state, render_stage_ready, "Stage Ready"},
+    {UI_STATE_LAST_STAGE_DONE, handle_last_stage_done_state, render_last_stage_done, "Last Stage Done"},
     {UI_STATE_CYCLE_COMPLETE, handle_cycle_complete_state, render_cycle_complete, "Cycle Complete"},
     {UI_STATE_STATISTICS, handle_statistics_state, render_statistics, "Statistics"},
     {UI_STATE_STATS_PRODUCTION, handle_stats_production_state, render_stats_production, "Production Stats"},
     {UI_STATE_STATS_TEMPERATURE, handle_stats_temperature_state, render_stats_temperature, "Temperature Stats"},
     {UI_STATE_STATS_EVENTS, handle_stats_events_state, render_stats_events, "Events Stats"},
     {UI_STATE_STATS_KPIS, handle_stats_kpis_state, render_stats_kpis, "KPI Stats"},
+    {UI_STATE_STATS_SHIFT, handle_stats_shift_state, render_stats_shift, "Shift Report"},
+    {UI_STATE_STATS_PACE, handle_stats_pace_state, render_stats_pace, "Pace"},
+    {UI_STATE_STATS_WEAR, handle_stats_wear_state, render_stats_wear, "Wear"},
     {UI_STATE_AUTOTUNE, handle_autotune_state, render_autotune, "Auto-Tune"},
     {UI_STATE_AUTOTUNE_COMPLETE, handle_autotune_complete_state, render_autotune_complete, "Results"},
+    {UI_STATE_SURFACE_CAL, handle_surface_cal_state, render_surface_cal, "Surface Cal"},
+    {UI_STATE_SURFACE_CAL_DONE, handle_surface_cal_done_state, render_surface_cal_done, "Surface Cal Done"},
     {UI_STATE_RESET_STATS, handle_reset_stats_state, render_reset_stats, "Reset Stats"},
     {UI_STATE_HEAT_UP, handle_heat_up_state, render_heat_up, "Heat Up"},
+    {UI_STATE_PAUSED, handle_paused_state, render_paused, "Paused"},
 };
 
 // =============================================================================
@@ -364,9 +413,10 @@ void ui_update(float current_temp)
         display_needs_update = true;
     }
 
-    // Update display during heat up only once per second to reduce flicker
+    // Update display during heat up and pause only once per second to reduce flicker
     static uint32_t last_heat_up_update = 0;
-    if (ui_current_state == UI_STATE_HEAT_UP)
+    if (ui_current_state == UI_STATE_HEAT_UP || ui_current_state == UI_STATE_PAUSED ||
+        ui_current_state == UI_STATE_SURFACE_CAL)
     {
         uint32_t current_time_ms = esp_timer_get_time() / 1000;
         if (current_time_ms - last_heat_up_update >= 1000) // Update once per second
@@ -426,6 +476,10 @@ ui_event_t ui_get_event(void)
         ESP_LOGI(TAG, "UI Event: BUTTON_BACK");
         return UI_EVENT_BUTTON_BACK;
     }
+    if (button == BUTTON_PAUSE) {
+        // Not a UI event - latched for handle_pause_button() in main
+        pause_requested = true;
+    }
 
     // Rotary events
     if (rotary == ROTARY_PUSH) {
@@ -497,6 +551,30 @@ void ui_update_display(void)
     display_flush();
 }
 
+bool ui_consume_pause_request(void)
+{
+    bool requested = pause_requested;
+    pause_requested = false;
+    return requested;
+}
+
+void ui_show_pause_screen(bool paused)
+{
+    if (paused)
+    {
+        if (ui_current_state != UI_STATE_PAUSED)
+        {
+            pause_return_state = ui_current_state;
+            ui_current_state = UI_STATE_PAUSED;
+        }
+    }
+    else if (ui_current_state == UI_STATE_PAUSED)
+    {
+        ui_current_state = pause_return_state;
+    }
+    display_needs_update = true;
+}
+
 ui_state_t ui_get_current_state(void)
 {
     return ui_current_state;
@@ -547,6 +625,20 @@ menu_item_t ui_get_selected_item(void)
     return menu_selected_item;
 }
 
+/**
+ * @brief Check if a Timers menu item is shown
+ *
+ * The station B timers only apply to a shuttle press.
+ */
+bool ui_is_timer_item_shown(timer_item_t item)
+{
+    if (item == TIMER_STATION_B_STAGE1 || item == TIMER_STATION_B_STAGE2)
+    {
+        return SHUTTLE_ENABLED;
+    }
+    return true;
+}
+
 void ui_adjust_value(int8_t delta)
 {
     ui_adjustment_value = CLAMP(ui_adjustment_value + delta,
@@ -720,7 +812,12 @@ static void handle_job_setup_state(ui_event_t event)
             else if (job_setup_selected_index == JOB_ITEM_PRINT_TYPE)
             {
                 current_run->type = job_setup_staged_print_type;
+                if (current_run->type == SINGLE_SIDED)
+                {
+                    current_run->next_side = FRONT;
+                }
             }
+            current_run->manual = true;
             save_persistent_data();
             job_setup_edit_mode = false;
             ESP_LOGI(TAG, "Job setup value saved");
@@ -778,6 +875,7 @@ static void handle_job_setup_adjust_state(ui_event_t event)
 
     case UI_EVENT_ROTARY_PUSH:
         // Exit adjustment mode and return to menu
+        current_run->manual = true;
         save_persistent_data();
         ui_current_state = UI_STATE_JOB_SETUP;
         ESP_LOGI(TAG, "Job setup value confirmed and saved");
@@ -809,6 +907,11 @@ static void handle_print_type_select_state(ui_event_t event)
     case UI_EVENT_ROTARY_PUSH:
         // Save selection and return to job setup
         current_run->type = (printing_type_t)print_type_selected_index;
+        if (current_run->type == SINGLE_SIDED)
+        {
+            current_run->next_side = FRONT;
+        }
+        current_run->manual = true;
         save_persistent_data();
         ui_current_state = UI_STATE_JOB_SETUP;
         ESP_LOGI(TAG, "Print type set to: %d and saved", current_run->type);
@@ -887,8 +990,11 @@ static void handle_timers_menu_state(ui_event_t event)
         }
         else
         {
-            // Navigate menu
-            timer_selected_index = MENU_WRAP(timer_selected_index + 1, TIMER_COUNT);
+            // Navigate menu, skipping hidden items
+            do
+            {
+                timer_selected_index = MENU_WRAP(timer_selected_index + 1, TIMER_COUNT);
+            } while (!ui_is_timer_item_shown(timer_selected_index));
         }
         break;
 
@@ -900,13 +1006,23 @@ static void handle_timers_menu_state(ui_event_t event)
         }
         else
         {
-            // Navigate menu
-            timer_selected_index = MENU_WRAP(timer_selected_index - 1, TIMER_COUNT);
+            // Navigate menu, skipping hidden items
+            do
+            {
+                timer_selected_index = MENU_WRAP(timer_selected_index - 1, TIMER_COUNT);
+            } while (!ui_is_timer_item_shown(timer_selected_index));
         }
         break;
 
     case UI_EVENT_ROTARY_PUSH:
-        if (timer_edit_mode)
+        if (timer_selected_index == TIMER_PROGRAM)
+        {
+            // Step through the cycle programs
+            current_settings->cycle_program = (current_settings->cycle_program + 1) % CYCLE_PROGRAM_COUNT;
+            settings_publish_change(SETTINGS_CHANGE_TIMERS);
+            ESP_LOGI(TAG, "Cycle program: %s", cycle_program_name(current_settings->cycle_program));
+        }
+        else if (timer_edit_mode)
         {
             // Commit staged changes and save
             if (timer_selected_index == TIMER_STAGE1)
@@ -917,7 +1033,23 @@ static void handle_timers_menu_state(ui_event_t event)
             {
                 current_settings->stage2_default = timer_staged_value;
             }
-            save_persistent_data();
+            else if (timer_selected_index == TIMER_BACK_STAGE1)
+            {
+                current_settings->back_stage1_default = timer_staged_value;
+            }
+            else if (timer_selected_index == TIMER_BACK_STAGE2)
+            {
+                current_settings->back_stage2_default = timer_staged_value;
+            }
+            else if (timer_selected_index == TIMER_STATION_B_STAGE1)
+            {
+                current_settings->station_b_stage1_default = timer_staged_value;
+            }
+            else if (timer_selected_index == TIMER_STATION_B_STAGE2)
+            {
+                current_settings->station_b_stage2_default = timer_staged_value;
+            }
+            settings_publish_change(SETTINGS_CHANGE_TIMERS);
             timer_edit_mode = false;
             ESP_LOGI(TAG, "Timer value saved");
         }
@@ -932,6 +1064,22 @@ static void handle_timers_menu_state(ui_event_t event)
             {
                 timer_staged_value = current_settings->stage2_default;
             }
+            else if (timer_selected_index == TIMER_BACK_STAGE1)
+            {
+                timer_staged_value = current_settings->back_stage1_default;
+            }
+            else if (timer_selected_index == TIMER_BACK_STAGE2)
+            {
+                timer_staged_value = current_settings->back_stage2_default;
+            }
+            else if (timer_selected_index == TIMER_STATION_B_STAGE1)
+            {
+                timer_staged_value = current_settings->station_b_stage1_default;
+            }
+            else if (timer_selected_index == TIMER_STATION_B_STAGE2)
+            {
+                timer_staged_value = current_settings->station_b_stage2_default;
+            }
             timer_edit_mode = true;
             ESP_LOGI(TAG, "Entering edit mode for: %s", timer_menu_items[timer_selected_index]);
         }
@@ -952,7 +1100,7 @@ static void handle_timer_adjust_state(ui_event_t event)
         break;
 
     case UI_EVENT_BUTTON_SAVE:
-        save_persistent_data();
+        settings_publish_change(SETTINGS_CHANGE_TIMERS);
         ui_current_state = UI_STATE_TIMERS_MENU;
         ESP_LOGI(TAG, "Timer saved to persistent storage");
         break;
@@ -980,7 +1128,7 @@ static void handle_timer_adjust_state(ui_event_t event)
         break;
 
     case UI_EVENT_ROTARY_PUSH:
-        save_persistent_data();
+        settings_publish_change(SETTINGS_CHANGE_TIMERS);
         ui_current_state = UI_STATE_TIMERS_MENU;
         ESP_LOGI(TAG, "Timer confirmed and saved");
         break;
@@ -1011,11 +1159,19 @@ static void handle_temperature_menu_state(ui_event_t event)
     case UI_EVENT_ROTARY_CW:
         if (temp_edit_mode)
         {
-            // Adjust staged value (only Target Temp is editable here)
+            // Adjust staged value (Target Temp or Back side offset)
             if (temp_selected_index == TEMP_TARGET_TEMP)
             {
                 temp_staged_value = CLAMP(temp_staged_value + 1.0f, 0.0f, 250.0f);
             }
+            else if (temp_selected_index == TEMP_BACK_OFFSET)
+            {
+                temp_staged_value = CLAMP(temp_staged_value + 1.0f, -30.0f, 30.0f);
+            }
+            else if (temp_selected_index == TEMP_KEEP_WARM)
+            {
+                temp_staged_value = CLAMP(temp_staged_value + 5.0f, 0.0f, 150.0f);
+            }
         }
         else
         {
@@ -1027,11 +1183,19 @@ static void handle_temperature_menu_state(ui_event_t event)
     case UI_EVENT_ROTARY_CCW:
         if (temp_edit_mode)
         {
-            // Adjust staged value (only Target Temp is editable here)
+            // Adjust staged value (Target Temp or Back side offset)
             if (temp_selected_index == TEMP_TARGET_TEMP)
             {
                 temp_staged_value = CLAMP(temp_staged_value - 1.0f, 0.0f, 250.0f);
             }
+            else if (temp_selected_index == TEMP_BACK_OFFSET)
+            {
+                temp_staged_value = CLAMP(temp_staged_value - 1.0f, -30.0f, 30.0f);
+            }
+            else if (temp_selected_index == TEMP_KEEP_WARM)
+            {
+                temp_staged_value = CLAMP(temp_staged_value - 5.0f, 0.0f, 150.0f);
+            }
         }
         else
         {
@@ -1044,8 +1208,19 @@ static void handle_temperature_menu_state(ui_event_t event)
         if (temp_edit_mode)
         {
             // Commit staged changes and save
-            current_settings->target_temp = temp_staged_value;
-            save_persistent_data();
+            if (temp_selected_index == TEMP_TARGET_TEMP)
+            {
+                current_settings->target_temp = temp_staged_value;
+            }
+            else if (temp_selected_index == TEMP_BACK_OFFSET)
+            {
+                current_settings->back_temp_offset = temp_staged_value;
+            }
+            else if (temp_selected_index == TEMP_KEEP_WARM)
+            {
+                current_settings->keep_warm_drop = temp_staged_value;
+            }
+            settings_publish_change(SETTINGS_CHANGE_TARGET);
             temp_edit_mode = false;
             ESP_LOGI(TAG, "Temperature value saved");
         }
@@ -1059,6 +1234,25 @@ static void handle_temperature_menu_state(ui_event_t event)
                 temp_edit_mode = true;
                 ESP_LOGI(TAG, "Entering edit mode for Target Temp");
             }
+            else if (temp_selected_index == TEMP_BACK_OFFSET)
+            {
+                temp_staged_value = current_settings->back_temp_offset;
+                temp_edit_mode = true;
+                ESP_LOGI(TAG, "Entering edit mode for Back side offset");
+            }
+            else if (temp_selected_index == TEMP_KEEP_WARM)
+            {
+                temp_staged_value = current_settings->keep_warm_drop;
+                temp_edit_mode = true;
+                ESP_LOGI(TAG, "Entering edit mode for Keep warm drop");
+            }
+            else if (temp_selected_index == TEMP_SURFACE_CAL)
+            {
+                // Shows the table in force; the procedure starts from there
+                ui_current_state = UI_STATE_SURFACE_CAL;
+                surface_cal_clear_armed = false;
+                ESP_LOGI(TAG, "Entering Surface calibration");
+            }
             else if (temp_selected_index == TEMP_PID_CONTROL)
             {
                 // Navigate to PID submenu
@@ -1084,7 +1278,7 @@ static void handle_temp_adjust_state(ui_event_t event)
         break;
 
     case UI_EVENT_BUTTON_SAVE:
-        save_persistent_data();
+        settings_publish_change(SETTINGS_CHANGE_TARGET);
         ui_current_state = UI_STATE_TEMPERATURE_MENU;
         ESP_LOGI(TAG, "Temperature saved to persistent storage");
         break;
@@ -1098,7 +1292,7 @@ static void handle_temp_adjust_state(ui_event_t event)
         break;
 
     case UI_EVENT_ROTARY_PUSH:
-        save_persistent_data();
+        settings_publish_change(SETTINGS_CHANGE_TARGET);
         ui_current_state = UI_STATE_TEMPERATURE_MENU;
         ESP_LOGI(TAG, "Temperature confirmed and saved");
         break;
@@ -1190,7 +1384,7 @@ static void handle_pid_menu_state(ui_event_t event)
             {
                 current_settings->pid_kd = pid_staged_value;
             }
-            save_persistent_data();
+            settings_publish_change(SETTINGS_CHANGE_PID_GAINS);
             pid_edit_mode = false;
             ESP_LOGI(TAG, "PID value saved");
         }
@@ -1211,6 +1405,43 @@ static void handle_pid_menu_state(ui_event_t event)
                     ESP_LOGW(TAG, "Failed to start auto-tune from UI");
                 }
             }
+            else if (pid_selected_index == PID_ADAPTIVE)
+            {
+                // On/off toggles directly, no edit mode
+                current_settings->adaptive_tuning = !current_settings->adaptive_tuning;
+                settings_publish_change(SETTINGS_CHANGE_PID_GAINS);
+                ESP_LOGI(TAG, "Adaptive tuning %s", current_settings->adaptive_tuning ? "enabled" : "disabled");
+            }
+            else if (pid_selected_index == PID_CASCADE)
+            {
+                current_settings->cascade_enabled = !current_settings->cascade_enabled;
+                settings_publish_change(SETTINGS_CHANGE_PID_GAINS);
+                ESP_LOGI(TAG, "Cascade control %s", current_settings->cascade_enabled ? "enabled" : "disabled");
+            }
+            else if (pid_selected_index == PID_SMITH)
+            {
+                current_settings->smith_enabled = !current_settings->smith_enabled;
+                settings_publish_change(SETTINGS_CHANGE_PID_GAINS);
+                ESP_LOGI(TAG, "Smith predictor %s", current_settings->smith_enabled ? "enabled" : "disabled");
+            }
+            else if (pid_selected_index == PID_LOAD_COMP)
+            {
+                current_settings->load_compensation = !current_settings->load_compensation;
+                settings_publish_change(SETTINGS_CHANGE_PID_GAINS);
+                ESP_LOGI(TAG, "Load compensation %s", current_settings->load_compensation ? "enabled" : "disabled");
+            }
+            else if (pid_selected_index == PID_POWER_FF)
+            {
+                current_settings->power_feedforward = !current_settings->power_feedforward;
+                settings_publish_change(SETTINGS_CHANGE_PID_GAINS);
+                ESP_LOGI(TAG, "Holding power feedforward %s", current_settings->power_feedforward ? "enabled" : "disabled");
+            }
+            else if (pid_selected_index == PID_PREBOOST)
+            {
+                current_settings->press_preboost = !current_settings->press_preboost;
+                settings_publish_change(SETTINGS_CHANGE_PID_GAINS);
+                ESP_LOGI(TAG, "Press pre-boost %s", current_settings->press_preboost ? "enabled" : "disabled");
+            }
             else
             {
                 // Enter edit mode - initialize staged value with current value
@@ -1247,7 +1478,7 @@ static void handle_pid_adjust_state(ui_event_t event)
         break;
 
     case UI_EVENT_BUTTON_SAVE:
-        save_persistent_data();
+        settings_publish_change(SETTINGS_CHANGE_PID_GAINS);
         ui_current_state = UI_STATE_PID_MENU;
         ESP_LOGI(TAG, "PID saved to persistent storage");
         break;
@@ -1283,7 +1514,7 @@ static void handle_pid_adjust_state(ui_event_t event)
         break;
 
     case UI_EVENT_ROTARY_PUSH:
-        save_persistent_data();
+        settings_publish_change(SETTINGS_CHANGE_PID_GAINS);
         ui_current_state = UI_STATE_PID_MENU;
         ESP_LOGI(TAG, "PID confirmed and saved");
         break;
@@ -1330,6 +1561,86 @@ static void handle_free_press_state(ui_event_t event)
     }
 }
 
+/**
+ * @brief Find a material profile by name (case-insensitive)
+ *
+ * @return Profile index, or -1
+ */
+int ui_find_material_profile(const char *name)
+{
+    for (int i = 0; i < PROFILE_COUNT; i++)
+    {
+        if (strcasecmp(name, profile_items[i]) == 0)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Apply a material profile to the settings
+ *
+ * Used by the Profiles menu and by imported job tickets.
+ *
+ * @return false if the profile does not exist
+ */
+bool ui_apply_material_profile(uint8_t profile)
+{
+    if (profile >= PROFILE_COUNT)
+    {
+        return false;
+    }
+
+    switch (profile)
+    {
+    case PROFILE_COTTON:
+        current_settings->target_temp = 140.0f;
+        current_settings->stage1_default = 15;
+        current_settings->stage2_default = 5;
+        current_settings->ramp_rate = 1.0f;
+        current_settings->soak_time = 30;
+        break;
+    case PROFILE_POLYESTER:
+        current_settings->target_temp = 125.0f;
+        current_settings->stage1_default = 12;
+        current_settings->stage2_default = 5;
+        current_settings->ramp_rate = 0.5f;   // Gentle approach, polyester scorches
+        current_settings->soak_time = 30;
+        break;
+    case PROFILE_BLOCKOUT:
+        current_settings->target_temp = 125.0f;
+        current_settings->stage1_default = 12;
+        current_settings->stage2_default = 5;
+        current_settings->ramp_rate = 0.5f;
+        current_settings->soak_time = 30;
+        break;
+    case PROFILE_WOOD:
+        current_settings->target_temp = 170.0f;
+        current_settings->stage1_default = 20;
+        current_settings->stage2_default = 5;
+        current_settings->ramp_rate = 1.0f;
+        current_settings->soak_time = 60;
+        break;
+    case PROFILE_METAL:
+        current_settings->target_temp = 204.0f;
+        current_settings->stage1_default = 80;
+        current_settings->stage2_default = 5;
+        current_settings->ramp_rate = 1.0f;
+        current_settings->soak_time = 120;    // Let the platen soak evenly
+        break;
+    }
+    // Profiles press both sides the same; the back side can be tuned in Settings
+    current_settings->back_stage1_default = current_settings->stage1_default;
+    current_settings->back_stage2_default = current_settings->stage2_default;
+    current_settings->station_b_stage1_default = current_settings->stage1_default;
+    current_settings->station_b_stage2_default = current_settings->stage2_default;
+    current_settings->back_temp_offset = 0.0f;
+    settings_publish_change(SETTINGS_CHANGE_MATERIAL);
+    ESP_LOGI(TAG, "Applied profile: %s", profile_items[profile]);
+    return true;
+}
+
 static void handle_profiles_menu_state(ui_event_t event)
 {
     switch (event)
@@ -1343,37 +1654,7 @@ static void handle_profiles_menu_state(ui_event_t event)
         break;
 
     case UI_EVENT_ROTARY_PUSH:
-        // Apply selected profile settings
-        switch (profile_selected_index)
-        {
-        case PROFILE_COTTON:
-            current_settings->target_temp = 140.0f;
-            current_settings->stage1_default = 15;
-            current_settings->stage2_default = 5;
-            break;
-        case PROFILE_POLYESTER:
-            current_settings->target_temp = 125.0f;
-            current_settings->stage1_default = 12;
-            current_settings->stage2_default = 5;
-            break;
-        case PROFILE_BLOCKOUT:
-            current_settings->target_temp = 125.0f;
-            current_settings->stage1_default = 12;
-            current_settings->stage2_default = 5;
-            break;
-        case PROFILE_WOOD:
-            current_settings->target_temp = 170.0f;
-            current_settings->stage1_default = 20;
-            current_settings->stage2_default = 5;
-            break;
-        case PROFILE_METAL:
-            current_settings->target_temp = 204.0f;
-            current_settings->stage1_default = 80;
-            current_settings->stage2_default = 5;
-            break;
-        }
-        save_persistent_data();
-        ESP_LOGI(TAG, "Applied profile: %s", profile_items[profile_selected_index]);
+        ui_apply_material_profile(profile_selected_index);
         ui_current_state = UI_STATE_MAIN_MENU;
         break;
 
@@ -1403,13 +1684,13 @@ static void handle_pressing_active_state(ui_event_t event)
     }
 }
 
-static void handle_stage1_done_state(ui_event_t event)
+static void handle_stage_done_state(ui_event_t event)
 {
     switch (event)
     {
     case UI_EVENT_BUTTON_BACK:
         ui_current_state = UI_STATE_MAIN_MENU;
-        ESP_LOGI(TAG, "Stage 1 done - returning to main menu");
+        ESP_LOGI(TAG, "Stage done - returning to main menu");
         break;
 
     default:
@@ -1417,13 +1698,13 @@ static void handle_stage1_done_state(ui_event_t event)
     }
 }
 
-static void handle_stage2_ready_state(ui_event_t event)
+static void handle_stage_ready_state(ui_event_t event)
 {
     switch (event)
     {
     case UI_EVENT_BUTTON_BACK:
         ui_current_state = UI_STATE_MAIN_MENU;
-        ESP_LOGI(TAG, "Stage 2 ready - returning to main menu");
+        ESP_LOGI(TAG, "Stage ready - returning to main menu");
         break;
 
     default:
@@ -1431,13 +1712,13 @@ static void handle_stage2_ready_state(ui_event_t event)
     }
 }
 
-static void handle_stage2_done_state(ui_event_t event)
+static void handle_last_stage_done_state(ui_event_t event)
 {
     switch (event)
     {
     case UI_EVENT_BUTTON_BACK:
         ui_current_state = UI_STATE_MAIN_MENU;
-        ESP_LOGI(TAG, "Stage 2 done - returning to main menu");
+        ESP_LOGI(TAG, "Last stage done - returning to main menu");
         break;
 
     default:
@@ -1486,6 +1767,16 @@ static void handle_statistics_state(ui_event_t event)
         case STATS_KPIS:
             ui_current_state = UI_STATE_STATS_KPIS;
             break;
+        case STATS_SHIFT:
+            shift_report_show_session = false;
+            ui_current_state = UI_STATE_STATS_SHIFT;
+            break;
+        case STATS_PACE:
+            ui_current_state = UI_STATE_STATS_PACE;
+            break;
+        case STATS_WEAR:
+            ui_current_state = UI_STATE_STATS_WEAR;
+            break;
         }
         break;
 
@@ -1530,6 +1821,161 @@ static void handle_stats_kpis_state(ui_event_t event)
     }
 }
 
+static void handle_stats_pace_state(ui_event_t event)
+{
+    if (event == UI_EVENT_BUTTON_BACK)
+    {
+        ui_current_state = UI_STATE_STATISTICS;
+    }
+}
+
+static void handle_stats_wear_state(ui_event_t event)
+{
+    switch (event)
+    {
+    case UI_EVENT_ROTARY_PUSH:
+        // Dump the cycle histograms to the console
+        log_wear_report();
+        break;
+
+    case UI_EVENT_BUTTON_BACK:
+        ui_current_state = UI_STATE_STATISTICS;
+        break;
+
+    default:
+        break;
+    }
+}
+
+static void handle_surface_cal_state(ui_event_t event)
+{
+    surface_cal_status_t status;
+    get_surface_cal_status(&status);
+
+    if (!status.active)
+    {
+        // Table in force: start a new calibration or clear it
+        switch (event)
+        {
+        case UI_EVENT_ROTARY_PUSH:
+            surface_cal_clear_armed = false;
+            surface_cal_probe_point = -1;
+            start_surface_calibration();
+            break;
+
+        case UI_EVENT_BUTTON_SAVE:
+            // Clearing takes a second press
+            if (surface_cal_clear_armed)
+            {
+                clear_surface_calibration();
+            }
+            surface_cal_clear_armed = !surface_cal_clear_armed;
+            break;
+
+        case UI_EVENT_BUTTON_BACK:
+            surface_cal_clear_armed = false;
+            ui_current_state = UI_STATE_TEMPERATURE_MENU;
+            break;
+
+        default:
+            break;
+        }
+        return;
+    }
+
+    switch (event)
+    {
+    case UI_EVENT_ROTARY_CW:
+    case UI_EVENT_ROTARY_CCW:
+        if (status.settled)
+        {
+            // Dial in the probe reading in 0.1°C steps, starting from the thermocouple reading
+            if (surface_cal_probe_point != status.point)
+            {
+                surface_cal_probe_value = roundf(status.reading * 10.0f) / 10.0f;
+                surface_cal_probe_point = status.point;
+            }
+            surface_cal_probe_value += (event == UI_EVENT_ROTARY_CW) ? 0.1f : -0.1f;
+        }
+        break;
+
+    case UI_EVENT_ROTARY_PUSH:
+        if (status.settled)
+        {
+            float probe = (surface_cal_probe_point == status.point) ? surface_cal_probe_value : status.reading;
+            if (record_surface_cal_point(probe) && status.point + 1 >= status.points)
+            {
+                ui_current_state = UI_STATE_SURFACE_CAL_DONE;
+            }
+        }
+        break;
+
+    case UI_EVENT_BUTTON_BACK:
+        cancel_surface_calibration();
+        ui_current_state = UI_STATE_TEMPERATURE_MENU;
+        break;
+
+    default:
+        break;
+    }
+}
+
+static void handle_surface_cal_done_state(ui_event_t event)
+{
+    switch (event)
+    {
+    case UI_EVENT_ROTARY_PUSH:
+    case UI_EVENT_BUTTON_SAVE:
+        finish_surface_calibration();
+        ui_current_state = UI_STATE_TEMPERATURE_MENU;
+        break;
+
+    case UI_EVENT_BUTTON_BACK:
+        cancel_surface_calibration();
+        ui_current_state = UI_STATE_TEMPERATURE_MENU;
+        break;
+
+    default:
+        break;
+    }
+}
+
+static void handle_paused_state(ui_event_t event)
+{
+    // Only the pause button (handled in main) leaves this screen
+    (void)event;
+}
+
+static void handle_stats_shift_state(ui_event_t event)
+{
+    switch (event)
+    {
+    case UI_EVENT_ROTARY_CW:
+    case UI_EVENT_ROTARY_CCW:
+        // Toggle between current shift and whole session
+        shift_report_show_session = !shift_report_show_session;
+        break;
+
+    case UI_EVENT_ROTARY_PUSH:
+        // Dump both reports to the console
+        log_session_report();
+        break;
+
+    case UI_EVENT_BUTTON_SAVE:
+        // End the shift (its report is logged) and start a new one
+        start_new_shift();
+        shift_report_show_session = false;
+        break;
+
+    case UI_EVENT_BUTTON_BACK:
+        ui_current_state = UI_STATE_STATISTICS;
+        break;
+
+    default:
+        break;
+    }
+}
+
 // =============================================================================
 // Helper Functions - See ui_helpers.c
 // =============================================================================
@@ -56,6 +56,7 @@ extern int profile_selected_index;
 
 // Statistics submenu state
 extern int stats_selected_index;
+extern bool shift_report_show_session;
 
 // Settings submenu state
 extern int timer_selected_index;
@@ -145,19 +146,22 @@ void handle_start_pressing_state(ui_event_t event);
 void handle_free_press_state(ui_event_t event);
 void handle_profiles_menu_state(ui_event_t event);
 void handle_pressing_active_state(ui_event_t event);
-void handle_stage1_done_state(ui_event_t event);
-void handle_stage2_ready_state(ui_event_t event);
-void handle_stage2_done_state(ui_event_t event);
+void handle_stage_done_state(ui_event_t event);
+void handle_stage_ready_state(ui_event_t event);
+void handle_last_stage_done_state(ui_event_t event);
 void handle_cycle_complete_state(ui_event_t event);
 void handle_statistics_state(ui_event_t event);
 void handle_stats_production_state(ui_event_t event);
 void handle_stats_temperature_state(ui_event_t event);
 void handle_stats_events_state(ui_event_t event);
 void handle_stats_kpis_state(ui_event_t event);
+void handle_stats_shift_state(ui_event_t event);
+void handle_stats_pace_state(ui_event_t event);
 void handle_autotune_state(ui_event_t event);
 void handle_autotune_complete_state(ui_event_t event);
 void handle_reset_stats_state(ui_event_t event);
 void handle_heat_up_state(ui_event_t event);
+void handle_paused_state(ui_event_t event);
 
 // =============================================================================
 // Renderers (implemented in ui_renderers.c)
@@ -179,18 +183,21 @@ void render_start_pressing(void);
 void render_free_press(void);
 void render_profiles_menu(void);
 void render_pressing_active(void);
-void render_stage1_done(void);
-void render_stage2_ready(void);
-void render_stage2_done(void);
+void render_stage_done(void);
+void render_stage_ready(void);
+void render_last_stage_done(void);
 void render_cycle_complete(void);
 void render_statistics(void);
 void render_stats_production(void);
 void render_stats_temperature(void);
 void render_stats_events(void);
 void render_stats_kpis(void);
+void render_stats_shift(void);
+void render_stats_pace(void);
 void render_autotune(void);
 void render_autotune_complete(void);
 void render_reset_stats(void);
 void render_heat_up(void);
+void render_paused(void);
 
 #endif // UI_STATE_INTERNAL_H
@@ -0,0 +1,258 @@
+/**
+ * @file cycle_engine.c
+ * @brief Table-driven pressing cycle engine implementation
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#include "cycle_engine.h"
+#include "esp_log.h"
+#include <math.h>
+#include <string.h>
+
+static const char *TAG = "cycle_engine";
+
+#define CYCLE_PREPRESS_SEC 5        ///< Transfer program moisture-removal pre-press (s)
+#define CYCLE_COOL_FINISH_DROP 15.0f ///< Cool-finish program finishing press drop (°C)
+
+// =============================================================================
+// Built-in Programs
+// =============================================================================
+
+/**
+ * @brief Where a program stage takes its duration from
+ */
+typedef enum
+{
+    STAGE_TIME_FIXED,   ///< The template's duration
+    STAGE_TIME_PRESS,   ///< Main press timer (Stage 1 / Back S1)
+    STAGE_TIME_FINISH   ///< Finishing press timer (Stage 2 / Back S2)
+} stage_time_source_t;
+
+typedef struct
+{
+    cycle_stage_t stage;
+    stage_time_source_t time;
+} stage_template_t;
+
+typedef struct
+{
+    const char *name;
+    uint8_t stage_count;
+    stage_template_t stages[CYCLE_MAX_STAGES];
+} program_template_t;
+
+static const program_template_t programs[CYCLE_PROGRAM_COUNT] = {
+    // Classic two stages, reopened in between
+    {"Standard", 2,
+     {{{"Stage 1", 0, STAGE_END_TIME, STAGE_ENTRY_REOPEN, 0.0f}, STAGE_TIME_PRESS},
+      {{"Stage 2", 0, STAGE_END_TIME, STAGE_ENTRY_REOPEN, 0.0f}, STAGE_TIME_FINISH}}},
+
+    // Pre-press to drive out moisture, dosed main press, peel, finishing press
+    {"Transfer", 3,
+     {{{"Pre-press", CYCLE_PREPRESS_SEC, STAGE_END_TIME, STAGE_ENTRY_REOPEN, 0.0f}, STAGE_TIME_FIXED},
+      {{"Press", 0, STAGE_END_DOSE, STAGE_ENTRY_REOPEN, 0.0f}, STAGE_TIME_PRESS},
+      {{"Finish", 0, STAGE_END_TIME, STAGE_ENTRY_REOPEN, 0.0f}, STAGE_TIME_FINISH}}},
+
+    // Dosed main press, then a cooler finishing press; the drop starts during the peel
+    {"Cool fin", 2,
+     {{{"Press", 0, STAGE_END_DOSE, STAGE_ENTRY_REOPEN, 0.0f}, STAGE_TIME_PRESS},
+      {{"Finish", 0, STAGE_END_TIME, STAGE_ENTRY_REOPEN, -CYCLE_COOL_FINISH_DROP}, STAGE_TIME_FINISH}}},
+};
+
+bool cycle_program_build(uint8_t program, uint16_t press_time, uint16_t finish_time,
+                         cycle_definition_t *definition)
+{
+    if (!definition || program >= CYCLE_PROGRAM_COUNT)
+    {
+        return false;
+    }
+
+    const program_template_t *source = &programs[program];
+    memset(definition, 0, sizeof(cycle_definition_t));
+    definition->stage_count = source->stage_count;
+
+    for (uint8_t i = 0; i < source->stage_count; i++)
+    {
+        cycle_stage_t *stage = &definition->stages[i];
+        *stage = source->stages[i].stage;
+        if (source->stages[i].time == STAGE_TIME_PRESS)
+        {
+            stage->duration = press_time;
+        }
+        else if (source->stages[i].time == STAGE_TIME_FINISH)
+        {
+            stage->duration = finish_time;
+        }
+    }
+    return true;
+}
+
+const char *cycle_program_name(uint8_t program)
+{
+    return (program < CYCLE_PROGRAM_COUNT) ? programs[program].name : "?";
+}
+
+// =============================================================================
+// Engine
+// =============================================================================
+
+static void begin_stage(cycle_engine_t *engine, uint8_t stage, uint32_t now_sec)
+{
+    engine->stage = stage;
+    engine->phase = CYCLE_PHASE_RUNNING;
+    engine->stage_start = now_sec;
+    engine->last_update = now_sec;
+    engine->dose = 0.0f;
+
+    const cycle_stage_t *definition = &engine->definition.stages[stage];
+    ESP_LOGI(TAG, "Stage %u/%u '%s': %u %s, setpoint %+.0f°C",
+             stage + 1, engine->definition.stage_count, definition->name, definition->duration,
+             (definition->end == STAGE_END_DOSE) ? "equivalent s" : "s", definition->setpoint_offset);
+}
+
+/**
+ * @brief The running stage has ended; decide what comes next
+ */
+static void end_stage(cycle_engine_t *engine, uint32_t now_sec)
+{
+    uint8_t next = engine->stage + 1;
+    if (next >= engine->definition.stage_count)
+    {
+        engine->phase = CYCLE_PHASE_LAST_DONE;
+    }
+    else if (engine->definition.stages[next].entry == STAGE_ENTRY_CLOSED)
+    {
+        begin_stage(engine, next, now_sec);
+    }
+    else
+    {
+        engine->phase = CYCLE_PHASE_STAGE_DONE;
+    }
+}
+
+bool cycle_engine_start(cycle_engine_t *engine, const cycle_definition_t *definition, uint32_t now_sec)
+{
+    if (!engine || !definition || definition->stage_count == 0 || definition->stage_count > CYCLE_MAX_STAGES)
+    {
+        return false;
+    }
+
+    engine->definition = *definition;
+    begin_stage(engine, 0, now_sec);
+    return true;
+}
+
+cycle_phase_t cycle_engine_update(cycle_engine_t *engine, uint32_t now_sec, float temperature, float target)
+{
+    if (engine->phase != CYCLE_PHASE_RUNNING)
+    {
+        return engine->phase;
+    }
+
+    const cycle_stage_t *stage = &engine->definition.stages[engine->stage];
+    uint32_t elapsed = now_sec - engine->stage_start;
+    bool done;
+
+    if (stage->end == STAGE_END_DOSE)
+    {
+        float setpoint = target + stage->setpoint_offset;
+        float rate = exp2f((temperature - setpoint) / CYCLE_DOSE_DOUBLING);
+        engine->dose += rate * (float)(now_sec - engine->last_update);
+        done = engine->dose >= stage->duration ||
+               elapsed >= (uint32_t)stage->duration * CYCLE_DOSE_TIME_LIMIT;
+    }
+    else
+    {
+        done = elapsed >= stage->duration;
+    }
+    engine->last_update = now_sec;
+
+    if (done)
+    {
+        end_stage(engine, now_sec);
+    }
+    return engine->phase;
+}
+
+cycle_phase_t cycle_engine_press_opened(cycle_engine_t *engine, uint32_t now_sec)
+{
+    (void)now_sec;
+
+    switch (engine->phase)
+    {
+    case CYCLE_PHASE_RUNNING:
+        // Early release skips the rest of the stage
+        if (engine->stage + 1 >= engine->definition.stage_count)
+        {
+            engine->phase = CYCLE_PHASE_COMPLETE;
+        }
+        else
+        {
+            ESP_LOGI(TAG, "Stage %u released early", engine->stage + 1);
+            engine->phase = CYCLE_PHASE_READY;
+        }
+        break;
+
+    case CYCLE_PHASE_STAGE_DONE:
+        engine->phase = CYCLE_PHASE_READY;
+        break;
+
+    case CYCLE_PHASE_LAST_DONE:
+        engine->phase = CYCLE_PHASE_COMPLETE;
+        break;
+
+    default:
+        break;
+    }
+    return engine->phase;
+}
+
+cycle_phase_t cycle_engine_press_closed(cycle_engine_t *engine, uint32_t now_sec)
+{
+    if (engine->phase == CYCLE_PHASE_READY)
+    {
+        begin_stage(engine, engine->stage + 1, now_sec);
+    }
+    return engine->phase;
+}
+
+uint8_t cycle_engine_stage_index(const cycle_engine_t *engine)
+{
+    bool waiting = engine->phase == CYCLE_PHASE_STAGE_DONE || engine->phase == CYCLE_PHASE_READY;
+    return waiting ? engine->stage + 1 : engine->stage;
+}
+
+const cycle_stage_t *cycle_engine_current_stage(const cycle_engine_t *engine)
+{
+    if (engine->phase == CYCLE_PHASE_IDLE || engine->phase == CYCLE_PHASE_COMPLETE)
+    {
+        return NULL;
+    }
+    return &engine->definition.stages[cycle_engine_stage_index(engine)];
+}
+
+float cycle_engine_setpoint_offset(const cycle_engine_t *engine)
+{
+    const cycle_stage_t *stage = cycle_engine_current_stage(engine);
+    return stage ? stage->setpoint_offset : 0.0f;
+}
+
+uint16_t cycle_engine_remaining(const cycle_engine_t *engine, uint32_t now_sec)
+{
+    if (engine->phase != CYCLE_PHASE_RUNNING)
+    {
+        return 0;
+    }
+
+    const cycle_stage_t *stage = &engine->definition.stages[engine->stage];
+    if (stage->end == STAGE_END_DOSE)
+    {
+        float left = ceilf((float)stage->duration - engine->dose);
+        return (left > 0.0f) ? (uint16_t)left : 0;
+    }
+
+    uint32_t elapsed = now_sec - engine->stage_start;
+    return (elapsed < stage->duration) ? (uint16_t)(stage->duration - elapsed) : 0;
+}
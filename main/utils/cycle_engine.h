@@ -0,0 +1,151 @@
+/**
+ * @file cycle_engine.h
+ * @brief Table-driven pressing cycle engine
+ *
+ * A pressing cycle is a list of stages (cycle_definition_t in
+ * data_model.h). Each stage has:
+ * - a duration, in plain seconds or as a thermal dose. A dose is counted
+ *   in equivalent seconds at the stage setpoint: a second spent
+ *   CYCLE_DOSE_DOUBLING °C hotter counts double, one that much colder
+ *   counts half. A platen that sags under a cold garment therefore presses
+ *   a little longer instead of under-curing.
+ * - an entry rule: the press is opened and closed again before the stage
+ *   (moisture release, peel), or the stage follows straight on with the
+ *   press still closed
+ * - a setpoint offset, applied as soon as the previous stage ends, so the
+ *   controller can move the platen towards it while the press is open
+ *
+ * The engine only tracks where the cycle is; the caller maps the phases
+ * onto UI states, statistics and safety checks. The built-in programs are
+ * built from the stage timers by cycle_program_build().
+ *
+ * The functions here operate on a caller-owned engine and do no locking;
+ * the caller serializes access.
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#ifndef CYCLE_ENGINE_H
+#define CYCLE_ENGINE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "data_model.h"  // components/storage/include/ - cycle_definition_t
+
+#define CYCLE_DOSE_DOUBLING 10.0f    ///< °C above the stage setpoint that doubles the dose rate
+#define CYCLE_DOSE_TIME_LIMIT 3      ///< A dose stage ends after this many times its duration regardless
+
+/**
+ * @brief Where the cycle is
+ */
+typedef enum
+{
+    CYCLE_PHASE_IDLE,        ///< No cycle
+    CYCLE_PHASE_RUNNING,     ///< A stage is timing, press closed
+    CYCLE_PHASE_STAGE_DONE,  ///< Stage over, waiting for the press to open
+    CYCLE_PHASE_READY,       ///< Press open, waiting for the close that starts the next stage
+    CYCLE_PHASE_LAST_DONE,   ///< Last stage over, waiting for the press to open
+    CYCLE_PHASE_COMPLETE     ///< Press opened after (or during) the last stage
+} cycle_phase_t;
+
+/**
+ * @brief Engine state
+ */
+typedef struct
+{
+    cycle_definition_t definition;
+    cycle_phase_t phase;
+    uint8_t stage;            ///< Running stage, or the one that just ended
+    uint32_t stage_start;     ///< When the stage started (s)
+    uint32_t last_update;     ///< Last dose integration (s)
+    float dose;               ///< Equivalent seconds accumulated in the stage
+} cycle_engine_t;
+
+// =============================================================================
+// Function Prototypes
+// =============================================================================
+
+/**
+ * @brief Build a built-in cycle program
+ *
+ * Program 0 is the classic two stages with a reopen in between. The
+ * others add stages and rules around the same two timers.
+ *
+ * @param program Program index (< CYCLE_PROGRAM_COUNT)
+ * @param press_time Main press timer (s)
+ * @param finish_time Finishing press timer (s)
+ * @param[out] definition Cycle definition
+ * @return false if the program does not exist
+ */
+bool cycle_program_build(uint8_t program, uint16_t press_time, uint16_t finish_time,
+                         cycle_definition_t *definition);
+
+/**
+ * @brief Short program name for menus (8 chars max)
+ */
+const char *cycle_program_name(uint8_t program);
+
+/**
+ * @brief Start the first stage (press just closed)
+ *
+ * @param engine Engine state
+ * @param definition Stages to run, copied
+ * @param now_sec Current time (s)
+ * @return false if the definition has no stages
+ */
+bool cycle_engine_start(cycle_engine_t *engine, const cycle_definition_t *definition, uint32_t now_sec);
+
+/**
+ * @brief Advance timing and dose; call once per control period
+ *
+ * @param engine Engine state
+ * @param now_sec Current time (s)
+ * @param temperature Platen temperature (°C)
+ * @param target Base setpoint, before the stage offset (°C)
+ * @return Phase after the update
+ */
+cycle_phase_t cycle_engine_update(cycle_engine_t *engine, uint32_t now_sec, float temperature, float target);
+
+/**
+ * @brief The press opened
+ *
+ * Opening during a stage ends it early. The cycle completes if it was the
+ * last stage, otherwise it waits for the close that starts the next one.
+ *
+ * @return Phase after the event
+ */
+cycle_phase_t cycle_engine_press_opened(cycle_engine_t *engine, uint32_t now_sec);
+
+/**
+ * @brief The press closed; starts the next stage if the engine was ready for it
+ *
+ * @return Phase after the event
+ */
+cycle_phase_t cycle_engine_press_closed(cycle_engine_t *engine, uint32_t now_sec);
+
+/**
+ * @brief The stage that is running, or the next one while waiting for the press
+ *
+ * @return Stage, or NULL when no cycle is running
+ */
+const cycle_stage_t *cycle_engine_current_stage(const cycle_engine_t *engine);
+
+/**
+ * @brief Index of the stage cycle_engine_current_stage() returns
+ */
+uint8_t cycle_engine_stage_index(const cycle_engine_t *engine);
+
+/**
+ * @brief Setpoint offset to apply now (°C)
+ *
+ * The running stage's offset, or the next stage's while waiting for it.
+ */
+float cycle_engine_setpoint_offset(const cycle_engine_t *engine);
+
+/**
+ * @brief Seconds (or equivalent seconds) left in the running stage
+ */
+uint16_t cycle_engine_remaining(const cycle_engine_t *engine, uint32_t now_sec);
+
+#endif // CYCLE_ENGINE_H
@@ -0,0 +1,412 @@
+/**
+ * @file heater_wear.c
+ * @brief Heater wear counting and heater health tracking implementation
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#include "heater_wear.h"
+#include "main.h"
+#include "heater_health.h"
+#include "rainflow.h"
+#include "preheat_schedule.h"
+#include "heating_contract.h"     // components/heating/include/
+#include "storage_contract.h"     // components/storage/include/
+#include "system_config.h"        // components/system_config/include/
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+#include <math.h>
+#include <string.h>
+#include <time.h>
+
+static const char *TAG = "heater_wear";
+
+static SemaphoreHandle_t wear_mutex = NULL;  ///< Guards wear_stats and heater_health
+
+// Heater wear (counted by the temperature control task)
+static wear_stats_t wear_stats;              ///< SSR counters and thermal cycle histograms, persisted
+static heating_ssr_usage_t wear_ssr_last;    ///< SSR usage since boot at the last update
+static rainflow_t wear_element_flow;         ///< Reversal detector on the element temperature
+static rainflow_t wear_platen_flow;          ///< Reversal detector on the platen temperature
+static pid_cascade_t wear_element_model;     ///< Element model while the cascade is off (loops unused)
+static uint32_t wear_last_save = 0;          ///< Last time the counters were written (seconds since boot)
+static uint8_t wear_service_reported = 0;    ///< Parts flagged for service this boot, one bit per wear_part_t
+
+// Heater health (fitted by the temperature control task)
+static heater_health_t heater_health;        ///< Heater power and loss per day, persisted
+static heater_fit_t heater_fit;              ///< Warm-up being fitted
+static bool heater_fit_running = false;      ///< heater_fit is collecting
+static uint32_t heater_fit_last_step = 0;    ///< Last step added to the fit (seconds since boot)
+static uint16_t heater_fit_settled_sec = 0;  ///< Settled time at the end of the fit (s)
+static bool heater_health_alerted = false;   ///< Maintenance alert raised this boot
+
+static inline void wear_lock(void) { xSemaphoreTake(wear_mutex, portMAX_DELAY); }
+static inline void wear_unlock(void) { xSemaphoreGive(wear_mutex); }
+
+// =============================================================================
+// Heater Wear
+// =============================================================================
+
+static const char *wear_part_names[WEAR_PART_COUNT] = {"SSR", "Element", "Platen"};
+
+static void wear_init(void)
+{
+    if (storage_load_wear_stats(&wear_stats) != ESP_OK ||
+        !rainflow_validate(&wear_stats.element) || !rainflow_validate(&wear_stats.platen))
+    {
+        memset(&wear_stats, 0, sizeof(wear_stats));
+    }
+
+    heating_get_ssr_usage(&wear_ssr_last);
+    rainflow_reset(&wear_element_flow);
+    rainflow_reset(&wear_platen_flow);
+    wear_last_save = esp_timer_get_time() / 1000000;
+
+    ESP_LOGI(TAG, "Wear: SSR %.1f%%, element %.1f%%, platen %.1f%% of rated life",
+             get_wear_life_used(WEAR_PART_SSR), get_wear_life_used(WEAR_PART_ELEMENT),
+             get_wear_life_used(WEAR_PART_PLATEN));
+}
+
+void save_wear_stats(void)
+{
+    wear_stats_t wear;
+    get_wear_stats(&wear);
+    if (storage_save_wear_stats(&wear) != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Wear counters not saved");
+    }
+}
+
+/**
+ * @brief Count SSR use and thermal cycles of the element and platen
+ *
+ * The element temperature is the cascade's core estimate while the
+ * cascade runs (it may be measured), otherwise the same first-order
+ * model tracked here.
+ */
+void update_wear(uint32_t now, const pid_cascade_t *cascade)
+{
+    rainflow_config_t config = {
+        .hysteresis = WEAR_CYCLE_HYSTERESIS,
+        .reference_range = WEAR_REFERENCE_RANGE,
+        .exponent = WEAR_DAMAGE_EXPONENT,
+    };
+    heating_ssr_usage_t usage;
+
+    heating_get_ssr_usage(&usage);
+    pid_cascade_track(&wear_element_model, current_temperature, heating_get_power(), 1.0f);
+    float element = pid_cascade_get_core_temp(cascade ? cascade : &wear_element_model);
+
+    wear_lock();
+    wear_stats.ssr_switches += usage.switch_count - wear_ssr_last.switch_count;
+    wear_stats.ssr_on_seconds += usage.on_seconds - wear_ssr_last.on_seconds;
+    wear_stats.heater_full_power_seconds += usage.full_power_seconds - wear_ssr_last.full_power_seconds;
+    rainflow_update(&wear_element_flow, &wear_stats.element, element, &config);
+    rainflow_update(&wear_platen_flow, &wear_stats.platen, current_temperature, &config);
+    wear_unlock();
+    wear_ssr_last = usage;
+
+    // Flag each worn part once per boot
+    for (int part = 0; part < WEAR_PART_COUNT; part++)
+    {
+        float used = get_wear_life_used((wear_part_t)part);
+        if (used >= WEAR_SERVICE_PERCENT && !(wear_service_reported & (1 << part)))
+        {
+            wear_service_reported |= (1 << part);
+            ESP_LOGW(TAG, "%s has used %.0f%% of its rated life - schedule a replacement",
+                     wear_part_names[part], used);
+        }
+    }
+
+    if (now - wear_last_save >= WEAR_SAVE_INTERVAL_SEC)
+    {
+        wear_last_save = now;
+        save_wear_stats();
+    }
+}
+
+bool get_wear_stats(wear_stats_t *wear)
+{
+    if (wear == NULL)
+    {
+        return false;
+    }
+
+    wear_lock();
+    *wear = wear_stats;
+    wear_unlock();
+    return true;
+}
+
+float get_wear_life_used(wear_part_t part)
+{
+    float used = 0.0f;
+
+    wear_lock();
+    switch (part)
+    {
+    case WEAR_PART_SSR:
+        used = (float)wear_stats.ssr_switches / WEAR_SSR_RATED_SWITCHES;
+        break;
+    case WEAR_PART_ELEMENT:
+        used = wear_stats.element.damage / WEAR_ELEMENT_RATED_CYCLES;
+        break;
+    case WEAR_PART_PLATEN:
+        used = wear_stats.platen.damage / WEAR_PLATEN_RATED_CYCLES;
+        break;
+    default:
+        break;
+    }
+    wear_unlock();
+
+    return used * 100.0f;
+}
+
+void reset_wear(wear_part_t part)
+{
+    if (part >= WEAR_PART_COUNT)
+    {
+        return;
+    }
+
+    wear_lock();
+    if (part == WEAR_PART_SSR)
+    {
+        wear_stats.ssr_switches = 0;
+        wear_stats.ssr_on_seconds = 0;
+        wear_stats.heater_full_power_seconds = 0;
+    }
+    else
+    {
+        thermal_cycles_t *cycles = (part == WEAR_PART_ELEMENT) ? &wear_stats.element : &wear_stats.platen;
+        rainflow_clear(cycles);
+        rainflow_reset((part == WEAR_PART_ELEMENT) ? &wear_element_flow : &wear_platen_flow);
+    }
+    wear_service_reported &= ~(1 << part);
+    if (part == WEAR_PART_ELEMENT)
+    {
+        // A new element needs a new baseline
+        heater_health_init(&heater_health);
+        heater_health_alerted = false;
+    }
+    heater_health_t health = heater_health;
+    wear_unlock();
+
+    save_wear_stats();
+    if (part == WEAR_PART_ELEMENT)
+    {
+        storage_save_heater_health(&health);
+    }
+    ESP_LOGI(TAG, "%s wear counters cleared (part replaced)", wear_part_names[part]);
+}
+
+void log_wear_report(void)
+{
+    wear_stats_t wear;
+    char line[128];
+
+    get_wear_stats(&wear);
+    ESP_LOGI(TAG, "SSR: %lu switches, %lu h on, %lu h at full power, %.1f%% of rated life",
+             wear.ssr_switches, wear.ssr_on_seconds / 3600, wear.heater_full_power_seconds / 3600,
+             get_wear_life_used(WEAR_PART_SSR));
+
+    for (int part = WEAR_PART_ELEMENT; part < WEAR_PART_COUNT; part++)
+    {
+        const thermal_cycles_t *cycles = (part == WEAR_PART_ELEMENT) ? &wear.element : &wear.platen;
+        ESP_LOGI(TAG, "%s: %lu cycles, damage %.1f reference cycles, %.1f%% of rated life",
+                 wear_part_names[part], rainflow_total_cycles(cycles), cycles->damage,
+                 get_wear_life_used((wear_part_t)part));
+
+        // Full cycles per range bin, e.g. "20+:12"
+        size_t length = 0;
+        for (uint8_t bin = 0; bin < WEAR_RANGE_BINS && length < sizeof(line); bin++)
+        {
+            length += snprintf(line + length, sizeof(line) - length, " %.0f+:%lu",
+                               rainflow_bin_lower(bin), cycles->half_cycles[bin] / 2);
+        }
+        ESP_LOGI(TAG, "  range °C:%s", line);
+    }
+
+    heater_health_t health;
+    wear_lock();
+    health = heater_health;
+    wear_unlock();
+
+    ESP_LOGI(TAG, "Heater health: baseline %.0fW, %.2fW/°C", health.baseline_watts, health.baseline_loss);
+    for (uint8_t i = 0; i < health.count; i++)
+    {
+        const heater_health_point_t *point = &health.points[i];
+        ESP_LOGI(TAG, "  day %lu: %.0fW, %.2fW/°C (%u fits)",
+                 point->day, point->heater_watts, point->loss_coefficient, point->fits);
+    }
+}
+
+// =============================================================================
+// Heater Health
+// =============================================================================
+
+/**
+ * @brief Raise the maintenance alert once the trend crosses a threshold
+ *
+ * Logged once per boot, and again on every boot until the element is
+ * replaced (WEAR,RESET,ELEMENT starts a new series).
+ */
+static void check_heater_health(const heater_health_t *health)
+{
+    heater_trend_t trend;
+    heater_health_trend(health, &trend);
+    if (!trend.valid)
+    {
+        return;
+    }
+
+    bool weak = trend.watts_change_percent <= -HEATER_HEALTH_POWER_DROP;
+    bool leaky = trend.loss_change_percent >= HEATER_HEALTH_LOSS_RISE;
+    if ((weak || leaky) && !heater_health_alerted)
+    {
+        heater_health_alerted = true;
+        ESP_LOGW(TAG, "Heater maintenance due: power %+.0f%%, losses %+.0f%% against the baseline (%s)",
+                 trend.watts_change_percent, trend.loss_change_percent,
+                 weak ? "element weakening" : "insulation or platen contact");
+    }
+    else if (!weak && trend.watts_per_month < 0.0f)
+    {
+        // Early warning from the fitted slope
+        float limit = health->baseline_watts * (1.0f - HEATER_HEALTH_POWER_DROP / 100.0f);
+        float days = 30.0f * (trend.recent_watts - limit) / -trend.watts_per_month;
+        ESP_LOGI(TAG, "Heater power falling %.0fW/month, alert level in about %.0f days",
+                 -trend.watts_per_month, days);
+    }
+}
+
+static void heater_health_load(void)
+{
+    if (storage_load_heater_health(&heater_health) != ESP_OK || !heater_health_validate(&heater_health))
+    {
+        heater_health_init(&heater_health);
+    }
+    check_heater_health(&heater_health);
+}
+
+/**
+ * @brief Fit the finished warm-up and add it to the series
+ */
+static void finish_heater_fit(void)
+{
+    float watts;
+    float loss;
+
+    heater_fit_running = false;
+    if (heater_fit.max_temp - heater_fit.start_temp < HEATER_HEALTH_MIN_RISE ||
+        !heater_fit_solve(&heater_fit, &watts, &loss))
+    {
+        ESP_LOGD(TAG, "Warm-up not fitted (rise %.0f°C, %u blocks)",
+                 heater_fit.max_temp - heater_fit.start_temp, heater_fit.blocks);
+        return;
+    }
+
+    int64_t utc = (int64_t)time(NULL);
+    uint32_t day = preheat_clock_valid(utc) ? (uint32_t)(utc / PREHEAT_SECONDS_PER_DAY) : 0;
+
+    wear_lock();
+    heater_health_add(&heater_health, day, watts, loss);
+    heater_health_t health = heater_health;
+    wear_unlock();
+
+    ESP_LOGI(TAG, "Warm-up fit: heater %.0fW, losses %.2fW/°C (rated %.0fW, %.2fW/°C)",
+             watts, loss, OBSERVER_HEATER_WATTS, OBSERVER_LOSS_COEFFICIENT);
+    if (storage_save_heater_health(&health) != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Heater health not saved");
+    }
+    check_heater_health(&health);
+}
+
+/**
+ * @brief Fit heater power and losses from warm-ups
+ *
+ * A fit starts when the controller takes over at least
+ * HEATER_HEALTH_MIN_RISE below its setpoint. It collects every step
+ * while the controller keeps driving the heater with no press closed, and
+ * is solved once the platen has been settled for HEATER_HEALTH_SETTLE_SEC.
+ * It is also solved early if a press, pause or fault ends it.
+ */
+void update_heater_health(uint32_t now, bool controlling, float setpoint)
+{
+    bool eligible = controlling && !pressing_active;
+
+    // Skipped steps (auto-tune, sensor retries) break the heat balance
+    if (heater_fit_running && (!eligible || now - heater_fit_last_step > 2))
+    {
+        finish_heater_fit();
+    }
+    if (!eligible)
+    {
+        return;
+    }
+
+    if (!heater_fit_running)
+    {
+        // Only warm-ups from well below the setpoint separate heater power from losses
+        if (setpoint - current_temperature >= HEATER_HEALTH_MIN_RISE)
+        {
+            heater_fit_start(&heater_fit, OBSERVER_CAPACITY, DEFAULT_TEMPERATURE, current_temperature);
+            heater_fit_running = true;
+            heater_fit_settled_sec = 0;
+            heater_fit_last_step = now;
+        }
+        return;
+    }
+
+    // Power during the step that just ended (the new output is applied after this)
+    heater_fit_add(&heater_fit, current_temperature, heating_get_power(), (float)(now - heater_fit_last_step));
+    heater_fit_last_step = now;
+
+    if (fabsf(current_temperature - setpoint) <= POWER_MAP_SETTLE_BAND)
+    {
+        heater_fit_settled_sec++;
+    }
+    else
+    {
+        heater_fit_settled_sec = 0;
+    }
+    if (heater_fit_settled_sec >= HEATER_HEALTH_SETTLE_SEC)
+    {
+        finish_heater_fit();
+    }
+}
+
+bool get_heater_trend(heater_trend_t *trend)
+{
+    if (trend == NULL)
+    {
+        return false;
+    }
+
+    wear_lock();
+    heater_health_trend(&heater_health, trend);
+    wear_unlock();
+    return true;
+}
+
+// =============================================================================
+// Initialization
+// =============================================================================
+
+void heater_wear_init(void)
+{
+    if (wear_mutex == NULL)
+    {
+        wear_mutex = xSemaphoreCreateMutex();
+        if (wear_mutex == NULL)
+        {
+            ESP_LOGE(TAG, "Failed to create wear mutex");
+        }
+    }
+
+    wear_init();
+    heater_health_load();
+}
@@ -0,0 +1,58 @@
+/**
+ * @file heater_wear.h
+ * @brief Heater wear counting and heater health tracking
+ *
+ * Keeps the SSR switch and on-time counters, rainflow-counts the thermal
+ * cycles of the element and platen, and fits heater power and losses
+ * from warm-ups into the heater health series. Both are persisted. The
+ * update functions run on the temperature control task; the getters in
+ * main.h (get_wear_stats(), get_wear_life_used(), get_heater_trend(),
+ * reset_wear(), log_wear_report()) are thread-safe.
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#ifndef HEATER_WEAR_H
+#define HEATER_WEAR_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "pid_cascade.h"
+
+/**
+ * @brief Restore the wear counters and the heater health series
+ *
+ * Call once at boot, before the temperature control task starts.
+ */
+void heater_wear_init(void);
+
+/**
+ * @brief Count SSR use and thermal cycles of the element and platen
+ *
+ * Call after each good reading. Counters are saved every
+ * WEAR_SAVE_INTERVAL_SEC; a power cut loses at most that much.
+ *
+ * @param now Current time (seconds since boot)
+ * @param cascade Running cascade, whose core estimate is the element
+ *        temperature (NULL when the single loop is in use)
+ */
+void update_wear(uint32_t now, const pid_cascade_t *cascade);
+
+/**
+ * @brief Write the wear counters to flash
+ */
+void save_wear_stats(void);
+
+/**
+ * @brief Fit heater power and losses from warm-ups
+ *
+ * Call every control step, next to the power map update.
+ *
+ * @param now Current time (seconds since boot)
+ * @param controlling The controller drove the heater this step
+ * @param setpoint Setpoint the controller is tracking (°C)
+ */
+void update_heater_health(uint32_t now, bool controlling, float setpoint);
+
+#endif // HEATER_WEAR_H
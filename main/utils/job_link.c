@@ -0,0 +1,354 @@
+/**
+ * @file job_link.c
+ * @brief Job ticket link to the shop system implementation
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#include "job_link.h"
+#include "job_ticket.h"
+#include "shuttle_station.h"
+#include "main.h"
+#include "ui_state.h"
+#include "storage_contract.h"     // components/storage/include/
+#include "serial_link_contract.h" // components/serial_link/include/
+#include "system_config.h"        // components/system_config/include/
+#include "esp_log.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+static const char *TAG = "job_link";
+
+static job_queue_t job_queue;                ///< Tickets from the shop system, persisted
+static bool job_link_up = false;             ///< Serial link initialized
+static bool ticket_held = false;             ///< Host told the next ticket waits for the current job
+
+// =============================================================================
+// External State (defined in main.c)
+// =============================================================================
+
+extern uint32_t run_start_time;
+void save_persistent_data(void);
+
+// =============================================================================
+// Job Ticket Import
+// =============================================================================
+
+static void job_link_send(const char *fields)
+{
+    char line[JOB_LINE_MAX];
+
+    if (job_link_up && job_ticket_frame(line, sizeof(line), fields))
+    {
+        serial_link_write(line);
+    }
+}
+
+static void job_link_send_status(void)
+{
+    char fields[JOB_LINE_MAX];
+
+    snprintf(fields, sizeof(fields), "STATUS,%s,%u,%u,%u",
+             job_queue.active ? job_queue.tickets[0].id : "-",
+             print_run.shirts_completed, print_run.num_shirts, job_queue.count);
+    job_link_send(fields);
+}
+
+static void save_job_queue(void)
+{
+    if (storage_save_job_queue(&job_queue) != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Job queue not saved - tickets will be lost on power loss");
+    }
+}
+
+void job_link_init(void)
+{
+    if (!JOB_LINK_ENABLED)
+    {
+        return;
+    }
+
+    if (storage_load_job_queue(&job_queue) != ESP_OK || !job_queue_validate(&job_queue))
+    {
+        memset(&job_queue, 0, sizeof(job_queue));
+    }
+    if (job_queue.active && job_queue.tickets[0].profile != JOB_PROFILE_KEEP)
+    {
+        ui_apply_material_profile(job_queue.tickets[0].profile);
+    }
+
+    esp_err_t err = serial_link_init(JOB_LINK_UART_PORT, JOB_LINK_BAUD_RATE, JOB_LINK_TX_PIN, JOB_LINK_RX_PIN);
+    if (err != ESP_OK)
+    {
+        ESP_LOGW(TAG, "Job link unavailable, job setup by hand only: %s", esp_err_to_name(err));
+        return;
+    }
+
+    job_link_up = true;
+    ESP_LOGI(TAG, "Job link ready, %u ticket(s) queued%s", job_queue.count,
+             job_queue.active ? " (first active)" : "");
+}
+
+/**
+ * @brief Load the first queued ticket into the print run
+ *
+ * Only between jobs: the current run is finished, or it has not pressed
+ * a shirt yet and was not set up by hand, and no cycle is running or
+ * parked. A job the operator entered in Job Setup is never replaced;
+ * the ticket waits until it is finished (or its stats are reset), and
+ * the host is sent a STATUS line once so it can see the ticket was not
+ * started. The operator still starts pressing as usual.
+ */
+static void load_next_job_ticket(void)
+{
+    ui_state_t state = ui_get_current_state();
+    bool finished = print_run.shirts_completed >= print_run.num_shirts;
+    bool busy_screen = state == UI_STATE_JOB_SETUP || state == UI_STATE_PRESSING_ACTIVE ||
+                       state == UI_STATE_STAGE_DONE || state == UI_STATE_STAGE_READY ||
+                       state == UI_STATE_LAST_STAGE_DONE;
+
+    if (job_queue.active || job_queue.count == 0)
+    {
+        ticket_held = false;
+        return;
+    }
+    if (pressing_active || is_parked_cycle_active() || print_run.next_side != FRONT || busy_screen)
+    {
+        return;
+    }
+
+    if (!finished && (print_run.shirts_completed > 0 || print_run.manual))
+    {
+        if (!ticket_held)
+        {
+            ticket_held = true;
+            job_link_send_status();
+            ESP_LOGI(TAG, "Job %s waits for the current job (%u/%u shirts%s)",
+                     job_queue.tickets[0].id, print_run.shirts_completed, print_run.num_shirts,
+                     print_run.manual ? ", set up by hand" : "");
+        }
+        return;
+    }
+    ticket_held = false;
+
+    const job_ticket_t *ticket = &job_queue.tickets[0];
+    if (ticket->profile != JOB_PROFILE_KEEP)
+    {
+        ui_apply_material_profile(ticket->profile);
+    }
+
+    print_run.id++;
+    print_run.num_shirts = ticket->num_shirts;
+    print_run.type = ticket->type;
+    print_run.progress = 0;
+    print_run.time_elapsed = 0;
+    print_run.shirts_completed = 0;
+    print_run.avg_time_per_shirt = 0;
+    print_run.next_side = FRONT;
+    print_run.front_presses = 0;
+    print_run.back_presses = 0;
+    print_run.front_press_time = 0;
+    print_run.back_press_time = 0;
+    print_run.manual = false;
+    run_start_time = 0;
+    save_persistent_data();
+
+    job_queue.active = true;
+    save_job_queue();
+
+    char fields[JOB_LINE_MAX];
+    snprintf(fields, sizeof(fields), "START,%s,%u", ticket->id, ticket->num_shirts);
+    job_link_send(fields);
+    ESP_LOGI(TAG, "Job %s loaded: %u shirts, %s", ticket->id, ticket->num_shirts,
+             ticket->type == DOUBLE_SIDED ? "double-sided" : "single-sided");
+}
+
+static void handle_job_command(const job_command_t *command)
+{
+    char fields[JOB_LINE_MAX];
+    const char *id = command->ticket.id[0] ? command->ticket.id : "-";
+    const char *error = NULL;
+
+    switch (command->type)
+    {
+    case JOB_CMD_PING:
+        job_link_send("PONG");
+        return;
+
+    case JOB_CMD_CLOCK:
+        if (command->set)
+        {
+            set_wall_clock(command->clock_utc, command->utc_offset_min);
+        }
+        snprintf(fields, sizeof(fields), "CLOCK,%lld,%d", (long long)time(NULL), get_utc_offset());
+        job_link_send(fields);
+        return;
+
+    case JOB_CMD_PREHEAT:
+        if (command->set)
+        {
+            set_preheat_ready_time(command->weekday, command->ready_minute);
+        }
+        for (uint8_t day = 0; day < PREHEAT_DAYS; day++)
+        {
+            uint16_t minute = get_preheat_ready_time(day);
+            if (command->set && day != command->weekday)
+            {
+                continue;
+            }
+            if (minute == PREHEAT_DAY_OFF)
+            {
+                snprintf(fields, sizeof(fields), "PREHEAT,%u,OFF", day);
+            }
+            else
+            {
+                snprintf(fields, sizeof(fields), "PREHEAT,%u,%02u:%02u", day, minute / 60, minute % 60);
+            }
+            job_link_send(fields);
+        }
+        return;
+
+    case JOB_CMD_WEAR:
+    {
+        wear_stats_t wear;
+        if (command->set)
+        {
+            reset_wear(command->wear_part);
+        }
+        get_wear_stats(&wear);
+        snprintf(fields, sizeof(fields), "WEAR,%lu,%lu,%.1f,%.1f,%.1f",
+                 wear.ssr_switches, wear.ssr_on_seconds / 3600,
+                 get_wear_life_used(WEAR_PART_SSR), get_wear_life_used(WEAR_PART_ELEMENT),
+                 get_wear_life_used(WEAR_PART_PLATEN));
+        job_link_send(fields);
+        return;
+    }
+
+    case JOB_CMD_STATUS:
+        job_link_send_status();
+        return;
+
+    case JOB_CMD_JOB:
+    {
+        job_ticket_t ticket = command->ticket;
+        int profile = (strcmp(command->profile_name, "-") == 0) ? JOB_PROFILE_KEEP :
+                      ui_find_material_profile(command->profile_name);
+        if (profile < 0)
+        {
+            error = "profile";
+        }
+        else if (job_queue_find(&job_queue, ticket.id) >= 0)
+        {
+            error = "duplicate";
+        }
+        else
+        {
+            ticket.profile = (uint8_t)profile;
+            if (!job_queue_push(&job_queue, &ticket))
+            {
+                error = "full";
+            }
+        }
+        break;
+    }
+
+    case JOB_CMD_CANCEL:
+    {
+        int index = job_queue_find(&job_queue, command->ticket.id);
+        if (index < 0)
+        {
+            error = "unknown";
+        }
+        else if (index == 0 && job_queue.active && (pressing_active || print_run.shirts_completed > 0))
+        {
+            error = "active";
+        }
+        else
+        {
+            job_queue_remove(&job_queue, (uint8_t)index);
+        }
+        break;
+    }
+
+    default:
+        error = command->error ? command->error : "command";
+        break;
+    }
+
+    if (error)
+    {
+        snprintf(fields, sizeof(fields), "NAK,%s,%s", id, error);
+        ESP_LOGW(TAG, "Job request for %s refused: %s", id, error);
+    }
+    else
+    {
+        save_job_queue();
+        snprintf(fields, sizeof(fields), "ACK,%s,%u", id, job_queue.count);
+        ESP_LOGI(TAG, "Job request for %s accepted, %u queued", id, job_queue.count);
+    }
+    job_link_send(fields);
+}
+
+void job_link_poll(void)
+{
+    char line[JOB_LINE_MAX];
+    job_command_t command;
+
+    if (!job_link_up)
+    {
+        return;
+    }
+
+    while (serial_link_read_line(line, sizeof(line)))
+    {
+        if (job_ticket_parse(line, &command) != JOB_CMD_NONE)
+        {
+            handle_job_command(&command);
+        }
+    }
+
+    load_next_job_ticket();
+}
+
+void job_link_report_shirt(void)
+{
+    if (!job_queue.active)
+    {
+        return;
+    }
+
+    char fields[JOB_LINE_MAX];
+    const char *id = job_queue.tickets[0].id;
+    snprintf(fields, sizeof(fields), "PROG,%s,%u,%u", id, print_run.shirts_completed, print_run.num_shirts);
+    job_link_send(fields);
+
+    if (print_run.shirts_completed >= print_run.num_shirts)
+    {
+        snprintf(fields, sizeof(fields), "DONE,%s,%u", id, print_run.shirts_completed);
+        job_link_send(fields);
+        ESP_LOGI(TAG, "Job %s finished", id);
+        job_queue_remove(&job_queue, 0);
+        save_job_queue();
+    }
+}
+
+const char *get_active_job_ticket(uint8_t *queued)
+{
+    if (queued != NULL)
+    {
+        *queued = job_queue.active ? job_queue.count - 1 : job_queue.count;
+    }
+    return job_queue.active ? job_queue.tickets[0].id : NULL;
+}
+
+void job_link_deinit(void)
+{
+    if (job_link_up)
+    {
+        serial_link_deinit();
+        job_link_up = false;
+    }
+}
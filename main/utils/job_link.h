@@ -0,0 +1,42 @@
+/**
+ * @file job_link.h
+ * @brief Job ticket link to the shop system
+ *
+ * Answers the host's requests on the serial link (job_ticket.h protocol),
+ * keeps the persisted ticket queue and loads the next ticket into the
+ * print run between jobs. All functions run on the UI task.
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#ifndef JOB_LINK_H
+#define JOB_LINK_H
+
+/**
+ * @brief Open the serial link and restore the persisted job queue
+ *
+ * The active ticket's material profile is applied again, since boot
+ * always starts from the Cotton settings. Does nothing unless
+ * JOB_LINK_ENABLED.
+ */
+void job_link_init(void);
+
+/**
+ * @brief Answer host requests and load the next ticket when between jobs
+ *
+ * Call from the UI task every iteration.
+ */
+void job_link_poll(void);
+
+/**
+ * @brief Report a finished shirt of the active ticket; drop it when done
+ */
+void job_link_report_shirt(void);
+
+/**
+ * @brief Close the serial link (tickets are already persisted)
+ */
+void job_link_deinit(void);
+
+#endif // JOB_LINK_H
@@ -0,0 +1,348 @@
+/**
+ * @file job_ticket.c
+ * @brief Job ticket protocol and queue implementation
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#include "job_ticket.h"
+#include "system_config.h"  // components/system_config/include/ - NUM_SHIRTS_MIN/MAX
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define JOB_MAX_FIELDS 6
+
+// =============================================================================
+// Internal Helpers
+// =============================================================================
+
+static uint8_t checksum(const char *start, size_t length)
+{
+    uint8_t sum = 0;
+    for (size_t i = 0; i < length; i++)
+    {
+        sum ^= (uint8_t)start[i];
+    }
+    return sum;
+}
+
+/**
+ * @brief Split in place at commas (empty fields are kept)
+ *
+ * @return Number of fields, or -1 if there are more than max_fields
+ */
+static int split_fields(char *body, char **fields, int max_fields)
+{
+    int count = 0;
+    char *field = body;
+
+    while (true)
+    {
+        if (count == max_fields)
+        {
+            return -1;
+        }
+        fields[count++] = field;
+
+        char *comma = strchr(field, ',');
+        if (!comma)
+        {
+            return count;
+        }
+        *comma = '\0';
+        field = comma + 1;
+    }
+}
+
+static bool parse_id(const char *text, char *id)
+{
+    size_t length = strlen(text);
+    if (length == 0 || length >= JOB_ID_LEN)
+    {
+        return false;
+    }
+    for (size_t i = 0; i < length; i++)
+    {
+        // Printable and not a frame character, so it can be echoed back
+        if (!isgraph((unsigned char)text[i]) || text[i] == '$' || text[i] == '*')
+        {
+            return false;
+        }
+    }
+    memcpy(id, text, length + 1);
+    return true;
+}
+
+static bool parse_long(const char *text, long long min, long long max, long long *value)
+{
+    char *end;
+    long long parsed = strtoll(text, &end, 10);
+    if (end == text || *end != '\0' || parsed < min || parsed > max)
+    {
+        return false;
+    }
+    *value = parsed;
+    return true;
+}
+
+/**
+ * @brief Parse "HH:MM" or "OFF" into minutes after midnight
+ */
+static bool parse_ready_time(const char *text, uint16_t *minute)
+{
+    if (strcmp(text, "OFF") == 0)
+    {
+        *minute = PREHEAT_DAY_OFF;
+        return true;
+    }
+
+    unsigned hours, minutes;
+    char tail;
+    if (strlen(text) != 5 || sscanf(text, "%2u:%2u%c", &hours, &minutes, &tail) != 2 ||
+        hours > 23 || minutes > 59)
+    {
+        return false;
+    }
+    *minute = (uint16_t)(hours * 60 + minutes);
+    return true;
+}
+
+static job_command_type_t reject(job_command_t *command, const char *error)
+{
+    command->type = JOB_CMD_INVALID;
+    command->error = error;
+    return command->type;
+}
+
+// =============================================================================
+// Protocol
+// =============================================================================
+
+job_command_type_t job_ticket_parse(const char *line, job_command_t *command)
+{
+    memset(command, 0, sizeof(job_command_t));
+
+    if (!line || line[0] != '$')
+    {
+        return JOB_CMD_NONE;
+    }
+
+    const char *star = strrchr(line, '*');
+    size_t body_length = star ? (size_t)(star - line - 1) : 0;
+    if (!star || strlen(star) != 3 || !isxdigit((unsigned char)star[1]) || !isxdigit((unsigned char)star[2]))
+    {
+        return reject(command, "frame");
+    }
+    if (body_length >= JOB_LINE_MAX)
+    {
+        return reject(command, "length");
+    }
+    if ((uint8_t)strtoul(star + 1, NULL, 16) != checksum(line + 1, body_length))
+    {
+        return reject(command, "checksum");
+    }
+
+    char body[JOB_LINE_MAX];
+    memcpy(body, line + 1, body_length);
+    body[body_length] = '\0';
+
+    char *fields[JOB_MAX_FIELDS];
+    int count = split_fields(body, fields, JOB_MAX_FIELDS);
+    if (count < 0)
+    {
+        return reject(command, "fields");
+    }
+
+    // Keep the id first so a NAK can name the ticket
+    if (count >= 2)
+    {
+        parse_id(fields[1], command->ticket.id);
+    }
+
+    if (strcmp(fields[0], "PING") == 0 && count == 1)
+    {
+        command->type = JOB_CMD_PING;
+    }
+    else if (strcmp(fields[0], "STATUS") == 0 && count == 1)
+    {
+        command->type = JOB_CMD_STATUS;
+    }
+    else if (strcmp(fields[0], "CLOCK") == 0 && (count == 1 || count == 3))
+    {
+        command->ticket.id[0] = '\0';
+        if (count == 3)
+        {
+            long long utc, offset;
+            if (!parse_long(fields[1], 0, INT64_MAX, &utc) || !parse_long(fields[2], -14 * 60, 14 * 60, &offset))
+            {
+                return reject(command, "clock");
+            }
+            command->set = true;
+            command->clock_utc = utc;
+            command->utc_offset_min = (int16_t)offset;
+        }
+        command->type = JOB_CMD_CLOCK;
+    }
+    else if (strcmp(fields[0], "PREHEAT") == 0 && (count == 1 || count == 3))
+    {
+        command->ticket.id[0] = '\0';
+        if (count == 3)
+        {
+            long long day;
+            if (!parse_long(fields[1], 0, PREHEAT_DAYS - 1, &day) ||
+                !parse_ready_time(fields[2], &command->ready_minute))
+            {
+                return reject(command, "preheat");
+            }
+            command->set = true;
+            command->weekday = (uint8_t)day;
+        }
+        command->type = JOB_CMD_PREHEAT;
+    }
+    else if (strcmp(fields[0], "WEAR") == 0 && (count == 1 || count == 3))
+    {
+        command->ticket.id[0] = '\0';
+        if (count == 3)
+        {
+            static const char *parts[WEAR_PART_COUNT] = {"SSR", "ELEMENT", "PLATEN"};
+            int part = 0;
+            while (part < WEAR_PART_COUNT && strcmp(fields[2], parts[part]) != 0)
+            {
+                part++;
+            }
+            if (strcmp(fields[1], "RESET") != 0 || part == WEAR_PART_COUNT)
+            {
+                return reject(command, "wear");
+            }
+            command->set = true;
+            command->wear_part = (wear_part_t)part;
+        }
+        command->type = JOB_CMD_WEAR;
+    }
+    else if (strcmp(fields[0], "CANCEL") == 0 && count == 2)
+    {
+        if (!parse_id(fields[1], command->ticket.id))
+        {
+            return reject(command, "id");
+        }
+        command->type = JOB_CMD_CANCEL;
+    }
+    else if (strcmp(fields[0], "JOB") == 0 && count == 5)
+    {
+        job_ticket_t *ticket = &command->ticket;
+        if (!parse_id(fields[1], ticket->id))
+        {
+            return reject(command, "id");
+        }
+
+        char *end;
+        long shirts = strtol(fields[2], &end, 10);
+        if (end == fields[2] || *end != '\0' || shirts < NUM_SHIRTS_MIN || shirts > NUM_SHIRTS_MAX)
+        {
+            return reject(command, "shirts");
+        }
+        ticket->num_shirts = (uint16_t)shirts;
+
+        if (strcmp(fields[3], "S") == 0 || strcmp(fields[3], "1") == 0)
+        {
+            ticket->type = SINGLE_SIDED;
+        }
+        else if (strcmp(fields[3], "D") == 0 || strcmp(fields[3], "2") == 0)
+        {
+            ticket->type = DOUBLE_SIDED;
+        }
+        else
+        {
+            return reject(command, "sides");
+        }
+
+        size_t name_length = strlen(fields[4]);
+        if (name_length == 0 || name_length >= JOB_PROFILE_NAME_MAX)
+        {
+            return reject(command, "profile");
+        }
+        memcpy(command->profile_name, fields[4], name_length + 1);
+        ticket->profile = JOB_PROFILE_KEEP;
+        command->type = JOB_CMD_JOB;
+    }
+    else
+    {
+        return reject(command, "command");
+    }
+
+    return command->type;
+}
+
+bool job_ticket_frame(char *buffer, size_t size, const char *fields)
+{
+    size_t length = strlen(fields);
+    int written = snprintf(buffer, size, "$%s*%02X\r\n", fields, checksum(fields, length));
+    return written > 0 && (size_t)written < size;
+}
+
+// =============================================================================
+// Queue
+// =============================================================================
+
+bool job_queue_push(job_queue_t *queue, const job_ticket_t *ticket)
+{
+    if (queue->count >= JOB_QUEUE_MAX || job_queue_find(queue, ticket->id) >= 0)
+    {
+        return false;
+    }
+
+    queue->tickets[queue->count++] = *ticket;
+    return true;
+}
+
+int job_queue_find(const job_queue_t *queue, const char *id)
+{
+    for (uint8_t i = 0; i < queue->count; i++)
+    {
+        if (strcmp(queue->tickets[i].id, id) == 0)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+void job_queue_remove(job_queue_t *queue, uint8_t index)
+{
+    if (index >= queue->count)
+    {
+        return;
+    }
+
+    memmove(&queue->tickets[index], &queue->tickets[index + 1],
+            (queue->count - index - 1) * sizeof(job_ticket_t));
+    queue->count--;
+    memset(&queue->tickets[queue->count], 0, sizeof(job_ticket_t));
+    if (index == 0)
+    {
+        queue->active = false;
+    }
+}
+
+bool job_queue_validate(const job_queue_t *queue)
+{
+    if (queue->count > JOB_QUEUE_MAX || (queue->active && queue->count == 0))
+    {
+        return false;
+    }
+
+    for (uint8_t i = 0; i < queue->count; i++)
+    {
+        const job_ticket_t *ticket = &queue->tickets[i];
+        if (memchr(ticket->id, '\0', JOB_ID_LEN) == NULL || ticket->id[0] == '\0' ||
+            ticket->num_shirts < NUM_SHIRTS_MIN || ticket->num_shirts > NUM_SHIRTS_MAX ||
+            (ticket->type != SINGLE_SIDED && ticket->type != DOUBLE_SIDED))
+        {
+            return false;
+        }
+    }
+    return true;
+}
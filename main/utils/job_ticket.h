@@ -0,0 +1,141 @@
+/**
+ * @file job_ticket.h
+ * @brief Job ticket protocol and queue
+ *
+ * The shop management system (or a script standing in for it) pushes job
+ * tickets over the serial port instead of the operator entering them with
+ * the encoder. Messages are single lines, framed so they survive sharing
+ * the port with the console log:
+ *
+ *     $<fields>*<checksum>\r\n
+ *
+ * The checksum is the XOR of the characters between '$' and '*', as two
+ * hex digits (the NMEA 0183 scheme). Lines that do not start with '$' are
+ * ignored; framed lines with a bad checksum are answered with NAK.
+ *
+ * Host to press:
+ * - JOB,<id>,<shirts>,<S|D>,<profile>  queue a ticket; profile is a
+ *   material profile name, or '-' to keep the current settings
+ * - CANCEL,<id>                         drop a queued ticket
+ * - STATUS                              report the active job and queue
+ * - PING
+ * - CLOCK[,<utc>,<offset>]              set (seconds since 1970, local
+ *                                       offset in minutes) or read the clock
+ * - PREHEAT[,<day>,<HH:MM|OFF>]         set a weekday's ready time
+ *                                       (0 = Sunday) or list them all
+ * - WEAR[,RESET,<SSR|ELEMENT|PLATEN>]   read the wear counters, or clear
+ *                                       one part's after replacing it
+ *
+ * Press to host:
+ * - ACK,<id>,<queued> / NAK,<id>,<reason>
+ * - START,<id>,<shirts>                 ticket loaded into the print run
+ * - PROG,<id>,<done>,<shirts>           after every finished shirt
+ * - DONE,<id>,<done>                    job finished, ticket dropped
+ * - STATUS,<id|->,<done>,<shirts>,<queued>
+ *                                       after STATUS, and once unasked when
+ *                                       the next ticket waits for a job
+ *                                       set up by hand
+ * - PONG
+ * - CLOCK,<utc>,<offset>                the clock after CLOCK
+ * - PREHEAT,<day>,<HH:MM|OFF>           one line per weekday after PREHEAT
+ * - WEAR,<switches>,<on h>,<ssr %>,<element %>,<platen %>
+ *
+ * The functions here do no I/O and no locking; the caller owns the queue
+ * and the serial port.
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#ifndef JOB_TICKET_H
+#define JOB_TICKET_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "data_model.h"  // components/storage/include/ - job_ticket_t, job_queue_t
+
+#define JOB_LINE_MAX 96          ///< Longest framed line, terminator included
+#define JOB_PROFILE_NAME_MAX 12  ///< Profile name field, terminator included
+
+/**
+ * @brief Host request
+ */
+typedef enum
+{
+    JOB_CMD_NONE,     ///< Not a framed line - ignore
+    JOB_CMD_INVALID,  ///< Framed but unusable - answer NAK with error
+    JOB_CMD_JOB,
+    JOB_CMD_CANCEL,
+    JOB_CMD_STATUS,
+    JOB_CMD_PING,
+    JOB_CMD_CLOCK,
+    JOB_CMD_PREHEAT,
+    JOB_CMD_WEAR
+} job_command_type_t;
+
+/**
+ * @brief Parsed host request
+ */
+typedef struct
+{
+    job_command_type_t type;
+    job_ticket_t ticket;                      ///< JOB: ticket (profile unresolved); CANCEL: id only
+    char profile_name[JOB_PROFILE_NAME_MAX];  ///< JOB: profile field as sent
+    const char *error;                        ///< INVALID: NAK reason
+    bool set;                                 ///< CLOCK/PREHEAT/WEAR: set (reset) rather than read
+    int64_t clock_utc;                        ///< CLOCK: seconds since 1970 (UTC)
+    int16_t utc_offset_min;                   ///< CLOCK: local time offset (minutes)
+    uint8_t weekday;                          ///< PREHEAT: 0 = Sunday
+    uint16_t ready_minute;                    ///< PREHEAT: minutes after midnight, or PREHEAT_DAY_OFF
+    wear_part_t wear_part;                    ///< WEAR: part to reset
+} job_command_t;
+
+// =============================================================================
+// Function Prototypes
+// =============================================================================
+
+/**
+ * @brief Parse one received line
+ *
+ * @param line Line without the line ending
+ * @param[out] command Parsed request
+ * @return Request type (also in command->type)
+ */
+job_command_type_t job_ticket_parse(const char *line, job_command_t *command);
+
+/**
+ * @brief Frame a reply: adds '$', the checksum and "\r\n"
+ *
+ * @param buffer Output
+ * @param size Output size (JOB_LINE_MAX is always enough for the replies above)
+ * @param fields Comma-separated fields
+ * @return false if the line did not fit
+ */
+bool job_ticket_frame(char *buffer, size_t size, const char *fields);
+
+/**
+ * @brief Append a ticket
+ *
+ * @return false if the queue is full or the id is already queued
+ */
+bool job_queue_push(job_queue_t *queue, const job_ticket_t *ticket);
+
+/**
+ * @brief Find a queued ticket by id
+ *
+ * @return Index, or -1
+ */
+int job_queue_find(const job_queue_t *queue, const char *id);
+
+/**
+ * @brief Remove the ticket at an index, keeping the order
+ */
+void job_queue_remove(job_queue_t *queue, uint8_t index);
+
+/**
+ * @brief Check a loaded queue for corruption
+ */
+bool job_queue_validate(const job_queue_t *queue);
+
+#endif // JOB_TICKET_H
@@ -0,0 +1,128 @@
+/**
+ * @file preheat_schedule.c
+ * @brief Scheduled automatic pre-heat implementation
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#include "preheat_schedule.h"
+#include <string.h>
+
+#define PREHEAT_EPOCH_WEEKDAY 4       ///< 1970-01-01 was a Thursday
+#define PREHEAT_MAX_OFFSET_MIN (14 * 60)
+
+static int64_t floor_div(int64_t value, int64_t divisor)
+{
+    int64_t quotient = value / divisor;
+    return (value % divisor < 0) ? quotient - 1 : quotient;
+}
+
+void preheat_schedule_init(preheat_schedule_t *schedule)
+{
+    memset(schedule, 0, sizeof(preheat_schedule_t));
+    for (int day = 0; day < PREHEAT_DAYS; day++)
+    {
+        schedule->ready_minute[day] = PREHEAT_DAY_OFF;
+    }
+}
+
+bool preheat_schedule_validate(const preheat_schedule_t *schedule)
+{
+    if (schedule->utc_offset_min < -PREHEAT_MAX_OFFSET_MIN || schedule->utc_offset_min > PREHEAT_MAX_OFFSET_MIN ||
+        !(schedule->warmup_sec_per_degree >= 0.0f && schedule->warmup_sec_per_degree < 600.0f))
+    {
+        return false;
+    }
+
+    for (int day = 0; day < PREHEAT_DAYS; day++)
+    {
+        if (schedule->ready_minute[day] != PREHEAT_DAY_OFF && schedule->ready_minute[day] >= 24 * 60)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool preheat_clock_valid(int64_t utc)
+{
+    return utc >= PREHEAT_CLOCK_VALID_AFTER;
+}
+
+void preheat_local_time(const preheat_schedule_t *schedule, int64_t utc, uint8_t *weekday, uint16_t *minute)
+{
+    int64_t local = utc + (int64_t)schedule->utc_offset_min * 60;
+    int64_t day = floor_div(local, PREHEAT_SECONDS_PER_DAY);
+
+    if (weekday)
+    {
+        *weekday = (uint8_t)(((day + PREHEAT_EPOCH_WEEKDAY) % 7 + 7) % 7);
+    }
+    if (minute)
+    {
+        *minute = (uint16_t)((local - day * PREHEAT_SECONDS_PER_DAY) / 60);
+    }
+}
+
+bool preheat_next_ready(const preheat_schedule_t *schedule, int64_t utc_now, int64_t *ready_utc)
+{
+    int64_t offset = (int64_t)schedule->utc_offset_min * 60;
+    int64_t local = utc_now + offset;
+    int64_t day_start = floor_div(local, PREHEAT_SECONDS_PER_DAY) * PREHEAT_SECONDS_PER_DAY;
+    uint8_t weekday;
+    preheat_local_time(schedule, utc_now, &weekday, NULL);
+
+    // Today (if still ahead) through the same weekday next week
+    for (int days = 0; days <= PREHEAT_DAYS; days++)
+    {
+        uint16_t minute = schedule->ready_minute[(weekday + days) % PREHEAT_DAYS];
+        if (minute == PREHEAT_DAY_OFF)
+        {
+            continue;
+        }
+
+        int64_t ready = day_start + days * PREHEAT_SECONDS_PER_DAY + (int64_t)minute * 60;
+        if (ready >= local)
+        {
+            *ready_utc = ready - offset;
+            return true;
+        }
+    }
+    return false;
+}
+
+uint32_t preheat_lead_seconds(const preheat_schedule_t *schedule, float current, float target,
+                              float fallback_sec_per_degree, uint32_t margin_sec)
+{
+    float rise = target - current;
+    if (rise <= 0.0f)
+    {
+        return margin_sec;
+    }
+
+    float rate = (schedule->warmup_samples > 0) ? schedule->warmup_sec_per_degree : fallback_sec_per_degree;
+    return (uint32_t)(rise * rate) + margin_sec;
+}
+
+void preheat_learn(preheat_schedule_t *schedule, uint32_t seconds, float rise, float weight)
+{
+    if (rise <= 0.0f || seconds == 0)
+    {
+        return;
+    }
+
+    float rate = (float)seconds / rise;
+    if (schedule->warmup_samples == 0)
+    {
+        schedule->warmup_sec_per_degree = rate;
+    }
+    else
+    {
+        schedule->warmup_sec_per_degree += weight * (rate - schedule->warmup_sec_per_degree);
+    }
+    if (schedule->warmup_samples < UINT16_MAX)
+    {
+        schedule->warmup_samples++;
+    }
+}
@@ -0,0 +1,96 @@
+/**
+ * @file preheat_schedule.h
+ * @brief Scheduled automatic pre-heat
+ *
+ * The schedule holds one ready-by time per weekday in local wall-clock
+ * time. The clock itself is the system time (kept by the RTC across
+ * resets, set by the host over the serial link); it is not trusted until
+ * it has been set at least once (PREHEAT_CLOCK_VALID_AFTER).
+ *
+ * The heat-up lead time is learned from completed heat-ups as seconds per
+ * °C of rise, so a platen that is still warm from an earlier shift starts
+ * later than a cold one. Until the first heat-up has been learned the
+ * caller supplies a fallback rate.
+ *
+ * The functions here operate on a caller-owned schedule and do no locking;
+ * the caller serializes access.
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#ifndef PREHEAT_SCHEDULE_H
+#define PREHEAT_SCHEDULE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "data_model.h"  // components/storage/include/ - preheat_schedule_t
+
+#define PREHEAT_CLOCK_VALID_AFTER 1704067200LL  ///< 2024-01-01 UTC; earlier means the clock was never set
+#define PREHEAT_SECONDS_PER_DAY 86400LL
+
+// =============================================================================
+// Function Prototypes
+// =============================================================================
+
+/**
+ * @brief Reset to no pre-heat days, UTC, nothing learned
+ */
+void preheat_schedule_init(preheat_schedule_t *schedule);
+
+/**
+ * @brief Check a loaded schedule for corruption
+ */
+bool preheat_schedule_validate(const preheat_schedule_t *schedule);
+
+/**
+ * @brief Check that the wall clock has been set
+ *
+ * @param utc Seconds since 1970 (UTC)
+ */
+bool preheat_clock_valid(int64_t utc);
+
+/**
+ * @brief Local weekday (0 = Sunday) and minute of day
+ *
+ * @param schedule Schedule (for the UTC offset)
+ * @param utc Seconds since 1970 (UTC)
+ * @param[out] weekday Local weekday (may be NULL)
+ * @param[out] minute Local minutes after midnight (may be NULL)
+ */
+void preheat_local_time(const preheat_schedule_t *schedule, int64_t utc, uint8_t *weekday, uint16_t *minute);
+
+/**
+ * @brief Next scheduled ready time at or after now
+ *
+ * @param schedule Schedule
+ * @param utc_now Seconds since 1970 (UTC)
+ * @param[out] ready_utc Ready time (UTC)
+ * @return false if no weekday is scheduled
+ */
+bool preheat_next_ready(const preheat_schedule_t *schedule, int64_t utc_now, int64_t *ready_utc);
+
+/**
+ * @brief Seconds before the ready time to start heating
+ *
+ * @param schedule Schedule (learned heat-up rate)
+ * @param current Platen temperature (°C)
+ * @param target Ready temperature (°C)
+ * @param fallback_sec_per_degree Rate to assume before any heat-up is learned
+ * @param margin_sec Added for the final approach and soak
+ * @return Lead time (s)
+ */
+uint32_t preheat_lead_seconds(const preheat_schedule_t *schedule, float current, float target,
+                              float fallback_sec_per_degree, uint32_t margin_sec);
+
+/**
+ * @brief Learn from a completed heat-up
+ *
+ * @param schedule Schedule
+ * @param seconds Heat-up duration (s)
+ * @param rise Temperature rise (°C)
+ * @param weight Weight of the new heat-up (0-1); the first one is taken as is
+ */
+void preheat_learn(preheat_schedule_t *schedule, uint32_t seconds, float rise, float weight);
+
+#endif // PREHEAT_SCHEDULE_H
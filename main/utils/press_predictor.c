@@ -0,0 +1,144 @@
+/**
+ * @file press_predictor.c
+ * @brief Press close prediction implementation
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#include "press_predictor.h"
+#include "system_config.h"
+#include "esp_log.h"
+#include <string.h>
+
+static const char *TAG = "press_predictor";
+
+/**
+ * @brief Interval at a percentile of the stored history
+ *
+ * Nearest-rank on a sorted copy; the history is small.
+ */
+static uint16_t interval_percentile(const press_predictor_t *predictor, uint8_t percent)
+{
+    uint16_t sorted[PRESS_PREDICTOR_HISTORY];
+    uint8_t n = predictor->count;
+    memcpy(sorted, predictor->intervals, n * sizeof(uint16_t));
+
+    for (uint8_t i = 1; i < n; i++)
+    {
+        uint16_t value = sorted[i];
+        int j = i - 1;
+        while (j >= 0 && sorted[j] > value)
+        {
+            sorted[j + 1] = sorted[j];
+            j--;
+        }
+        sorted[j + 1] = value;
+    }
+
+    uint8_t rank = (uint8_t)((percent * (n - 1) + 50) / 100);
+    return sorted[rank];
+}
+
+void press_predictor_reset(press_predictor_t *predictor)
+{
+    if (predictor)
+    {
+        memset(predictor, 0, sizeof(press_predictor_t));
+    }
+}
+
+void press_predictor_on_open(press_predictor_t *predictor, uint32_t now_sec)
+{
+    if (!predictor)
+    {
+        return;
+    }
+
+    predictor->open_pending = true;
+    predictor->open_time = now_sec;
+    predictor->cancelled = false;
+}
+
+void press_predictor_on_close(press_predictor_t *predictor, uint32_t now_sec)
+{
+    if (!predictor || !predictor->open_pending)
+    {
+        return;
+    }
+
+    predictor->open_pending = false;
+    predictor->boosting = false;
+
+    uint32_t interval = now_sec - predictor->open_time;
+    if (interval > PREBOOST_MAX_INTERVAL_SEC)
+    {
+        ESP_LOGD(TAG, "Open for %lus: break, not learned", (unsigned long)interval);
+        return;
+    }
+
+    predictor->intervals[predictor->head] = (uint16_t)interval;
+    predictor->head = (predictor->head + 1) % PRESS_PREDICTOR_HISTORY;
+    if (predictor->count < PRESS_PREDICTOR_HISTORY)
+    {
+        predictor->count++;
+    }
+
+    ESP_LOGI(TAG, "Open-to-close %lus (%u learned)", (unsigned long)interval, predictor->count);
+}
+
+bool press_predictor_window(const press_predictor_t *predictor, uint16_t *early_sec, uint16_t *late_sec)
+{
+    if (!predictor || !early_sec || !late_sec || predictor->count < PREBOOST_MIN_SAMPLES)
+    {
+        return false;
+    }
+
+    uint16_t lower_quartile = interval_percentile(predictor, 25);
+    uint16_t upper_quartile = interval_percentile(predictor, 75);
+    if (upper_quartile - lower_quartile > PREBOOST_MAX_SPREAD_SEC)
+    {
+        return false;
+    }
+
+    *early_sec = lower_quartile;
+    *late_sec = interval_percentile(predictor, 90);
+    return true;
+}
+
+float press_predictor_boost(press_predictor_t *predictor, uint32_t now_sec)
+{
+    if (!predictor)
+    {
+        return 0.0f;
+    }
+
+    bool boost = false;
+    uint16_t early, late;
+    if (predictor->open_pending && !predictor->cancelled &&
+        press_predictor_window(predictor, &early, &late))
+    {
+        uint32_t open_for = now_sec - predictor->open_time;
+        uint32_t start = (early > PREBOOST_LEAD_SEC) ? (uint32_t)(early - PREBOOST_LEAD_SEC) : 0;
+
+        if (open_for > late)
+        {
+            // The close did not come: the operator has stopped or slowed down
+            predictor->cancelled = true;
+            ESP_LOGI(TAG, "No close by %us, pre-boost cancelled", late);
+        }
+        else
+        {
+            boost = (open_for >= start);
+        }
+    }
+
+    if (boost && !predictor->boosting)
+    {
+        ESP_LOGI(TAG, "Close expected %u-%us after opening, pre-boost +%.1f°C",
+                 early, late, PREBOOST_CELSIUS);
+    }
+    predictor->boosting = boost;
+
+    return boost ? PREBOOST_CELSIUS : 0.0f;
+}
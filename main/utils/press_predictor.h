@@ -0,0 +1,91 @@
+/**
+ * @file press_predictor.h
+ * @brief Press close prediction for anticipatory pre-boost
+ *
+ * In production the operator opens the press, swaps the shirt and closes
+ * it again on a steady rhythm. The close loads the platen with a cold
+ * garment, and a feedback loop only reacts once the sag reaches the
+ * thermocouple. This module learns the open-to-close interval from the
+ * reed switch timestamps of the current job and asks for a small
+ * setpoint boost just before the close is expected, so the extra heat is
+ * already on its way when the load arrives.
+ *
+ * The boost starts PREBOOST_LEAD_SEC before the early (25th percentile)
+ * close and is cancelled if the press is still open at the late (90th
+ * percentile) close. It is only requested once PREBOOST_MIN_SAMPLES
+ * intervals are known and their interquartile range is within
+ * PREBOOST_MAX_SPREAD_SEC; an erratic rhythm gets no boost. Intervals
+ * longer than PREBOOST_MAX_INTERVAL_SEC are breaks and are not learned.
+ *
+ * The functions here operate on a caller-owned predictor and do no
+ * locking; the caller serializes access.
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#ifndef PRESS_PREDICTOR_H
+#define PRESS_PREDICTOR_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define PRESS_PREDICTOR_HISTORY 16 ///< Open-to-close intervals kept per job
+
+/**
+ * @brief Predictor state
+ */
+typedef struct
+{
+    uint16_t intervals[PRESS_PREDICTOR_HISTORY]; ///< Recent open-to-close intervals (s), ring buffer
+    uint8_t count;            ///< Intervals stored
+    uint8_t head;             ///< Next ring buffer slot
+    bool open_pending;        ///< Press is open, waiting for the close
+    uint32_t open_time;       ///< When the press was opened (s)
+    bool boosting;            ///< Boost requested at the last update
+    bool cancelled;           ///< Close did not come in time for this opening
+} press_predictor_t;
+
+/**
+ * @brief Forget all intervals (new job)
+ *
+ * @param predictor Predictor state
+ */
+void press_predictor_reset(press_predictor_t *predictor);
+
+/**
+ * @brief Record the press opening after a completed cycle
+ *
+ * @param predictor Predictor state
+ * @param now_sec Timestamp of the opening (s)
+ */
+void press_predictor_on_open(press_predictor_t *predictor, uint32_t now_sec);
+
+/**
+ * @brief Record the press closing on a new garment
+ *
+ * @param predictor Predictor state
+ * @param now_sec Timestamp of the close (s)
+ */
+void press_predictor_on_close(press_predictor_t *predictor, uint32_t now_sec);
+
+/**
+ * @brief Expected close window after an opening
+ *
+ * @param predictor Predictor state
+ * @param[out] early_sec Early close, 25th percentile interval (s)
+ * @param[out] late_sec Late close, 90th percentile interval (s)
+ * @return true if the rhythm is known and steady enough to act on
+ */
+bool press_predictor_window(const press_predictor_t *predictor, uint16_t *early_sec, uint16_t *late_sec);
+
+/**
+ * @brief Setpoint boost to apply now
+ *
+ * @param predictor Predictor state
+ * @param now_sec Current time (s)
+ * @return Boost (°C), 0 outside the pre-close window
+ */
+float press_predictor_boost(press_predictor_t *predictor, uint32_t now_sec);
+
+#endif // PRESS_PREDICTOR_H
@@ -0,0 +1,196 @@
+/**
+ * @file rainflow.c
+ * @brief Rainflow counting of thermal cycles implementation
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#include "rainflow.h"
+#include <math.h>
+#include <string.h>
+
+// Upper edges of all but the last bin (°C); the last bin is open-ended
+static const float bin_upper[WEAR_RANGE_BINS - 1] = {5.0f, 10.0f, 20.0f, 40.0f, 80.0f, 120.0f, 160.0f};
+
+// =============================================================================
+// Internal Helpers
+// =============================================================================
+
+static void count_half_cycles(thermal_cycles_t *cycles, float range, uint8_t halves,
+                              const rainflow_config_t *config)
+{
+    uint8_t bin = rainflow_bin(range);
+    if (cycles->half_cycles[bin] <= UINT32_MAX - halves)
+    {
+        cycles->half_cycles[bin] += halves;
+    }
+    cycles->damage += 0.5f * halves * powf(range / config->reference_range, config->exponent);
+}
+
+static void drop_oldest(thermal_cycles_t *cycles)
+{
+    memmove(&cycles->residue[0], &cycles->residue[1], (cycles->residue_count - 1) * sizeof(float));
+    cycles->residue_count--;
+}
+
+/**
+ * @brief Add a reversal to the residue and close whatever cycles it completes
+ */
+static void add_reversal(thermal_cycles_t *cycles, float point, const rainflow_config_t *config)
+{
+    uint8_t n = cycles->residue_count;
+    float *residue = cycles->residue;
+
+    if (n >= 2 && (point - residue[n - 1]) * (residue[n - 1] - residue[n - 2]) > 0.0f)
+    {
+        // Continues the last leg (the detector restarted after a reset): extend it
+        residue[n - 1] = point;
+    }
+    else
+    {
+        if (n == WEAR_RESIDUE_MAX)
+        {
+            // Out of room: close the oldest leg as a half cycle
+            count_half_cycles(cycles, fabsf(residue[1] - residue[0]), 1, config);
+            drop_oldest(cycles);
+        }
+        residue[cycles->residue_count++] = point;
+    }
+
+    // Three-point rainflow: the last range closes the one before it if it is at least as large
+    while (cycles->residue_count >= 3)
+    {
+        n = cycles->residue_count;
+        float x = fabsf(residue[n - 1] - residue[n - 2]);
+        float y = fabsf(residue[n - 2] - residue[n - 3]);
+        if (x < y)
+        {
+            break;
+        }
+
+        if (n == 3)
+        {
+            // Range y starts at the first reversal ever seen: half a cycle
+            count_half_cycles(cycles, y, 1, config);
+            drop_oldest(cycles);
+        }
+        else
+        {
+            count_half_cycles(cycles, y, 2, config);
+            residue[n - 3] = residue[n - 1];
+            cycles->residue_count -= 2;
+        }
+    }
+}
+
+// =============================================================================
+// Counting
+// =============================================================================
+
+void rainflow_reset(rainflow_t *rainflow)
+{
+    if (rainflow)
+    {
+        memset(rainflow, 0, sizeof(rainflow_t));
+    }
+}
+
+void rainflow_clear(thermal_cycles_t *cycles)
+{
+    if (cycles)
+    {
+        memset(cycles, 0, sizeof(thermal_cycles_t));
+    }
+}
+
+bool rainflow_validate(const thermal_cycles_t *cycles)
+{
+    if (!cycles || cycles->residue_count > WEAR_RESIDUE_MAX || !isfinite(cycles->damage) || cycles->damage < 0.0f)
+    {
+        return false;
+    }
+
+    for (uint8_t i = 0; i < cycles->residue_count; i++)
+    {
+        if (!isfinite(cycles->residue[i]) || cycles->residue[i] < -50.0f || cycles->residue[i] > 500.0f)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void rainflow_update(rainflow_t *rainflow, thermal_cycles_t *cycles, float temperature,
+                     const rainflow_config_t *config)
+{
+    if (!rainflow || !cycles || !config || !isfinite(temperature))
+    {
+        return;
+    }
+
+    if (!rainflow->started)
+    {
+        rainflow->started = true;
+        rainflow->extreme = temperature;
+        rainflow->direction = 0;
+        if (cycles->residue_count == 0)
+        {
+            // Very first sample: the starting point of the history
+            cycles->residue[cycles->residue_count++] = temperature;
+            return;
+        }
+    }
+
+    if (rainflow->direction == 0)
+    {
+        // Direction is set by the first clear move away from the last reversal
+        float last = cycles->residue[cycles->residue_count - 1];
+        if (fabsf(temperature - last) >= config->hysteresis)
+        {
+            rainflow->direction = (temperature > last) ? 1 : -1;
+            rainflow->extreme = temperature;
+        }
+        return;
+    }
+
+    if ((temperature - rainflow->extreme) * rainflow->direction > 0.0f)
+    {
+        rainflow->extreme = temperature;
+    }
+    else if (fabsf(temperature - rainflow->extreme) >= config->hysteresis)
+    {
+        add_reversal(cycles, rainflow->extreme, config);
+        rainflow->direction = -rainflow->direction;
+        rainflow->extreme = temperature;
+    }
+}
+
+uint8_t rainflow_bin(float range)
+{
+    uint8_t bin = 0;
+    while (bin < WEAR_RANGE_BINS - 1 && range >= bin_upper[bin])
+    {
+        bin++;
+    }
+    return bin;
+}
+
+float rainflow_bin_lower(uint8_t bin)
+{
+    if (bin == 0 || bin >= WEAR_RANGE_BINS)
+    {
+        return 0.0f;
+    }
+    return bin_upper[bin - 1];
+}
+
+uint32_t rainflow_total_cycles(const thermal_cycles_t *cycles)
+{
+    uint64_t halves = 0;
+    for (uint8_t i = 0; i < WEAR_RANGE_BINS; i++)
+    {
+        halves += cycles->half_cycles[i];
+    }
+    return (uint32_t)(halves / 2);
+}
@@ -0,0 +1,102 @@
+/**
+ * @file rainflow.h
+ * @brief Rainflow counting of thermal cycles for heater wear
+ *
+ * Heating elements and platens fail from thermal fatigue: every heat-up
+ * and cool-down, and every dip when a cold garment is pressed, is a
+ * stress cycle, and large cycles do far more damage than small ones.
+ * This module turns the temperature history into closed cycles with the
+ * rainflow method (ASTM E1049, three-point variant) and sorts them into
+ * a histogram of ranges.
+ *
+ * Samples are reduced to reversals (peaks and valleys) first. Reversals
+ * smaller than the configured hysteresis are sensor noise and are
+ * dropped. Open reversals are kept in the persisted residue, so a cycle
+ * that spans a power cycle (the daily heat-up and overnight cool-down)
+ * still closes and is counted.
+ *
+ * Each closed cycle adds (range / reference_range)^exponent to the
+ * damage (the Coffin-Manson relation, normalized to full cycles at the
+ * reference range). The damage divided by the part's rated cycles is the
+ * fraction of its life used.
+ *
+ * The functions here operate on caller-owned state and do no locking;
+ * the caller serializes access.
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#ifndef RAINFLOW_H
+#define RAINFLOW_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "data_model.h"  // components/storage/include/ - thermal_cycles_t
+
+/**
+ * @brief Counting parameters
+ */
+typedef struct
+{
+    float hysteresis;        ///< Smallest reversal counted (°C)
+    float reference_range;   ///< Range of one unit of damage (°C)
+    float exponent;          ///< Damage exponent
+} rainflow_config_t;
+
+/**
+ * @brief Reversal detector (not persisted)
+ */
+typedef struct
+{
+    float extreme;           ///< Furthest sample since the last reversal (°C)
+    int8_t direction;        ///< +1 rising, -1 falling, 0 not known yet
+    bool started;
+} rainflow_t;
+
+// =============================================================================
+// Function Prototypes
+// =============================================================================
+
+/**
+ * @brief Reset the reversal detector (at boot)
+ */
+void rainflow_reset(rainflow_t *rainflow);
+
+/**
+ * @brief Clear a part's histogram, damage and residue (part replaced)
+ */
+void rainflow_clear(thermal_cycles_t *cycles);
+
+/**
+ * @brief Check loaded cycle counts for corruption
+ */
+bool rainflow_validate(const thermal_cycles_t *cycles);
+
+/**
+ * @brief Feed one temperature sample
+ *
+ * @param rainflow Reversal detector
+ * @param cycles Histogram, damage and residue to update
+ * @param temperature Sample (°C)
+ * @param config Counting parameters
+ */
+void rainflow_update(rainflow_t *rainflow, thermal_cycles_t *cycles, float temperature,
+                     const rainflow_config_t *config);
+
+/**
+ * @brief Histogram bin of a cycle range
+ */
+uint8_t rainflow_bin(float range);
+
+/**
+ * @brief Lower edge of a histogram bin (°C)
+ */
+float rainflow_bin_lower(uint8_t bin);
+
+/**
+ * @brief Closed full cycles in total (half cycles count as half)
+ */
+uint32_t rainflow_total_cycles(const thermal_cycles_t *cycles);
+
+#endif // RAINFLOW_H
@@ -0,0 +1,126 @@
+/**
+ * @file session_accounting.c
+ * @brief Session and shift time accounting implementation
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#include "session_accounting.h"
+#include "esp_log.h"
+#include <string.h>
+
+static const char *TAG = "session";
+
+static const char *category_names[TIME_CATEGORY_COUNT] = {
+    "Heat up",
+    "Idle",
+    "Pressing",
+    "Wait tmp",
+    "Paused",
+    "Fault"
+};
+
+void session_tally_reset(session_tally_t *tally, uint32_t now_sec)
+{
+    if (tally == NULL)
+    {
+        return;
+    }
+
+    memset(tally, 0, sizeof(session_tally_t));
+    tally->start_time = now_sec;
+}
+
+void session_tally_add_time(session_tally_t *tally, time_category_t category, uint32_t seconds)
+{
+    if (tally == NULL || category >= TIME_CATEGORY_COUNT)
+    {
+        return;
+    }
+
+    tally->seconds[category] += seconds;
+}
+
+void session_tally_add_press(session_tally_t *tally, bool shirt_finished)
+{
+    if (tally == NULL)
+    {
+        return;
+    }
+
+    tally->presses++;
+    if (shirt_finished)
+    {
+        tally->shirts++;
+    }
+}
+
+uint32_t session_tally_total_seconds(const session_tally_t *tally)
+{
+    if (tally == NULL)
+    {
+        return 0;
+    }
+
+    uint32_t total = 0;
+    for (int i = 0; i < TIME_CATEGORY_COUNT; i++)
+    {
+        total += tally->seconds[i];
+    }
+    return total;
+}
+
+uint8_t session_tally_utilization(const session_tally_t *tally)
+{
+    uint32_t total = session_tally_total_seconds(tally);
+    if (total == 0)
+    {
+        return 0;
+    }
+
+    return (uint8_t)(((uint64_t)tally->seconds[TIME_PRESSING] * 100) / total);
+}
+
+float session_tally_shirts_per_hour(const session_tally_t *tally)
+{
+    uint32_t total = session_tally_total_seconds(tally);
+    if (total == 0)
+    {
+        return 0.0f;
+    }
+
+    return (float)tally->shirts * 3600.0f / (float)total;
+}
+
+const char *session_time_category_name(time_category_t category)
+{
+    if (category >= TIME_CATEGORY_COUNT)
+    {
+        return "?";
+    }
+    return category_names[category];
+}
+
+void session_tally_log(const char *label, const session_tally_t *tally)
+{
+    if (tally == NULL)
+    {
+        return;
+    }
+
+    uint32_t total = session_tally_total_seconds(tally);
+
+    ESP_LOGI(TAG, "===== %s report =====", label != NULL ? label : "Session");
+    ESP_LOGI(TAG, "Duration: %luh %02lum %02lus",
+             total / 3600, (total % 3600) / 60, total % 60);
+    for (int i = 0; i < TIME_CATEGORY_COUNT; i++)
+    {
+        uint32_t pct = (total > 0) ? (uint32_t)(((uint64_t)tally->seconds[i] * 100) / total) : 0;
+        ESP_LOGI(TAG, "  %-8s %6lus  %3lu%%",
+                 category_names[i], tally->seconds[i], pct);
+    }
+    ESP_LOGI(TAG, "Presses: %lu  Shirts: %lu", tally->presses, tally->shirts);
+    ESP_LOGI(TAG, "Utilization: %u%%  Throughput: %.1f shirts/h",
+             session_tally_utilization(tally), session_tally_shirts_per_hour(tally));
+}
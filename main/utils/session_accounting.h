@@ -0,0 +1,82 @@
+/**
+ * @file session_accounting.h
+ * @brief Session and shift time accounting
+ *
+ * Every second of operation is classified into one time category
+ * (heating up, ready/idle, pressing, waiting for temperature, paused,
+ * fault) and accumulated into a session_tally_t, together with press and
+ * shirt counts. main.c keeps one tally for the session (since boot or the
+ * last statistics reset) and one for the current operator shift.
+ *
+ * The functions here operate on caller-owned tallies and do no locking;
+ * the caller serializes access.
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#ifndef SESSION_ACCOUNTING_H
+#define SESSION_ACCOUNTING_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "data_model.h"
+
+/**
+ * @brief Clear a tally and start it at the given time
+ *
+ * @param tally Tally to reset
+ * @param now_sec Start timestamp in seconds
+ */
+void session_tally_reset(session_tally_t *tally, uint32_t now_sec);
+
+/**
+ * @brief Add elapsed seconds to one time category
+ *
+ * @param tally Tally to update
+ * @param category Category the elapsed time belongs to
+ * @param seconds Elapsed seconds
+ */
+void session_tally_add_time(session_tally_t *tally, time_category_t category, uint32_t seconds);
+
+/**
+ * @brief Record a completed press
+ *
+ * @param tally Tally to update
+ * @param shirt_finished true if the press finished a shirt
+ */
+void session_tally_add_press(session_tally_t *tally, bool shirt_finished);
+
+/**
+ * @brief Total accounted seconds across all categories
+ */
+uint32_t session_tally_total_seconds(const session_tally_t *tally);
+
+/**
+ * @brief Press utilization: pressing time as a percentage of total time
+ *
+ * @return 0-100, or 0 if no time has been accounted yet
+ */
+uint8_t session_tally_utilization(const session_tally_t *tally);
+
+/**
+ * @brief Finished shirts per hour over the tally's accounted time
+ *
+ * @return Shirts per hour, or 0 if no time has been accounted yet
+ */
+float session_tally_shirts_per_hour(const session_tally_t *tally);
+
+/**
+ * @brief Short display name for a time category (max 8 chars)
+ */
+const char *session_time_category_name(time_category_t category);
+
+/**
+ * @brief Dump a tally to the console
+ *
+ * @param label Report heading (e.g. "Shift", "Session")
+ * @param tally Tally to print
+ */
+void session_tally_log(const char *label, const session_tally_t *tally);
+
+#endif // SESSION_ACCOUNTING_H
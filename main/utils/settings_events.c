@@ -0,0 +1,88 @@
+/**
+ * @file settings_events.c
+ * @brief Settings change notifications implementation
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#include "settings_events.h"
+#include "system_config.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+
+static const char *TAG = "settings_events";
+
+static SemaphoreHandle_t events_mutex = NULL; ///< Guards the fields below
+static uint32_t pending_changes = SETTINGS_CHANGE_NONE; ///< Published, not yet consumed
+static bool save_pending = false;             ///< NVS write scheduled
+static uint32_t last_change_time = 0;         ///< Time of the last publish (s since boot)
+
+void settings_events_init(void)
+{
+    if (events_mutex == NULL)
+    {
+        events_mutex = xSemaphoreCreateMutex();
+        if (events_mutex == NULL)
+        {
+            ESP_LOGE(TAG, "Failed to create settings events mutex");
+        }
+    }
+
+    pending_changes = SETTINGS_CHANGE_NONE;
+    save_pending = false;
+}
+
+void settings_publish_change(uint32_t changes)
+{
+    if (events_mutex == NULL || changes == SETTINGS_CHANGE_NONE)
+    {
+        return;
+    }
+
+    xSemaphoreTake(events_mutex, portMAX_DELAY);
+    pending_changes |= changes;
+    save_pending = true;
+    last_change_time = esp_timer_get_time() / 1000000;
+    xSemaphoreGive(events_mutex);
+
+    ESP_LOGD(TAG, "Settings change published: 0x%02lx", changes);
+}
+
+uint32_t settings_consume_changes(void)
+{
+    if (events_mutex == NULL)
+    {
+        return SETTINGS_CHANGE_NONE;
+    }
+
+    xSemaphoreTake(events_mutex, portMAX_DELAY);
+    uint32_t changes = pending_changes;
+    pending_changes = SETTINGS_CHANGE_NONE;
+    xSemaphoreGive(events_mutex);
+
+    return changes;
+}
+
+bool settings_save_due(void)
+{
+    if (events_mutex == NULL)
+    {
+        return false;
+    }
+
+    uint32_t now = esp_timer_get_time() / 1000000;
+    bool due = false;
+
+    xSemaphoreTake(events_mutex, portMAX_DELAY);
+    if (save_pending && (now - last_change_time) >= SETTINGS_SAVE_DELAY_SEC)
+    {
+        save_pending = false;
+        due = true;
+    }
+    xSemaphoreGive(events_mutex);
+
+    return due;
+}
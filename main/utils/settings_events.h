@@ -0,0 +1,82 @@
+/**
+ * @file settings_events.h
+ * @brief Settings change notifications
+ *
+ * The UI edits settings_t in place; this module tells the temperature
+ * control task what kind of change was made so it can apply it to the
+ * running controller at its next step instead of after a reboot.
+ *
+ * Changes are published as typed flags and coalesced until consumed.
+ * Publishing also schedules a deferred NVS write: the settings are saved
+ * once edits have been quiet for SETTINGS_SAVE_DELAY_SEC, so turning the
+ * encoder through several values costs one flash write, and the write
+ * happens on the control task rather than blocking the UI.
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#ifndef SETTINGS_EVENTS_H
+#define SETTINGS_EVENTS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// =============================================================================
+// Type Definitions
+// =============================================================================
+
+/**
+ * @brief Settings change types (bit flags, may be combined)
+ */
+typedef enum
+{
+    SETTINGS_CHANGE_NONE = 0,
+    SETTINGS_CHANGE_TARGET = (1 << 0),    ///< target_temp, back_temp_offset, keep_warm_drop
+    SETTINGS_CHANGE_PID_GAINS = (1 << 1), ///< pid_kp, pid_ki, pid_kd, adaptive_tuning
+    SETTINGS_CHANGE_TIMERS = (1 << 2),    ///< Stage durations (front and back)
+    SETTINGS_CHANGE_HEAT_UP = (1 << 3),   ///< ramp_rate, soak_time
+    SETTINGS_CHANGE_LEARNED = (1 << 4)    ///< Data learned by the controller (power_map); save only
+} settings_change_t;
+
+/// Everything a material profile sets
+#define SETTINGS_CHANGE_MATERIAL (SETTINGS_CHANGE_TARGET | SETTINGS_CHANGE_TIMERS | SETTINGS_CHANGE_HEAT_UP)
+
+// =============================================================================
+// Function Prototypes
+// =============================================================================
+
+/**
+ * @brief Initialize change tracking
+ *
+ * Must be called before any task publishes or consumes changes.
+ */
+void settings_events_init(void);
+
+/**
+ * @brief Publish a settings change
+ *
+ * Call after settings_t has been updated. Thread-safe.
+ *
+ * @param changes One or more settings_change_t flags
+ */
+void settings_publish_change(uint32_t changes);
+
+/**
+ * @brief Take all changes published since the last call
+ *
+ * @return settings_change_t flags (SETTINGS_CHANGE_NONE if nothing changed)
+ */
+uint32_t settings_consume_changes(void);
+
+/**
+ * @brief Check if the deferred NVS write is due
+ *
+ * Returns true once per burst of edits, after SETTINGS_SAVE_DELAY_SEC
+ * without further changes. The caller performs the write.
+ *
+ * @return true if settings should be saved now
+ */
+bool settings_save_due(void);
+
+#endif // SETTINGS_EVENTS_H
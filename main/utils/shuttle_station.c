@@ -0,0 +1,162 @@
+/**
+ * @file shuttle_station.c
+ * @brief Shuttle press station switching implementation
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#include "shuttle_station.h"
+#include "main.h"
+#include "system_config.h"        // components/system_config/include/
+#include "esp_log.h"
+#include <string.h>
+
+static const char *TAG = "shuttle_station";
+
+static station_context_t station_contexts[STATION_COUNT]; ///< Parked stations, set by the UI task
+static uint8_t platen_station = 0;          ///< Station under the heated platen, set by the UI task
+static uint16_t station_presses[STATION_COUNT]; ///< Cycles completed per station
+static float station_press_load[STATION_COUNT]; ///< Last press load per station (W), control task
+
+// =============================================================================
+// External State (defined in main.c)
+// =============================================================================
+
+extern cycle_engine_t cycle_engine;
+
+// =============================================================================
+// Shuttle Press Stations
+// =============================================================================
+
+/**
+ * @brief Move the cycle context to another station
+ *
+ * Called by the UI task when the platen closes on the other station of a
+ * shuttle press. The platen station's cycle, UI state and next shirt side
+ * are parked, and the new station's are restored. A parked cycle can only
+ * be waiting for the close that starts its next stage: a running stage
+ * ends when the platen lifts. Its timestamps are moved on by the time it
+ * spent parked, so the maximum cycle time only counts time under the
+ * platen.
+ *
+ * @param station Station the platen closed on
+ * @param now Current time (s)
+ */
+void switch_station(uint8_t station, uint32_t now)
+{
+    station_context_t *parked = &station_contexts[platen_station];
+    parked->pressing_active = pressing_active;
+    parked->press_safety_locked = press_safety_locked;
+    parked->cycle = current_cycle;
+    parked->engine = cycle_engine;
+    parked->cycle_start_time = cycle_start_time;
+    parked->stage_start_time = stage_start_time;
+    parked->stage = current_stage;
+    parked->ui_state = ui_get_current_state();
+    parked->next_side = print_run.next_side;
+    parked->parked_time = now;
+
+    const station_context_t *restored = &station_contexts[station];
+    current_cycle = restored->cycle;
+    print_run.next_side = restored->next_side;
+    if (restored->pressing_active)
+    {
+        uint32_t away = now - restored->parked_time;
+        pressing_active = true;
+        press_safety_locked = restored->press_safety_locked;
+        cycle_engine = restored->engine;
+        cycle_start_time = restored->cycle_start_time + away;
+        stage_start_time = restored->stage_start_time + away;
+        current_stage = restored->stage;
+        ui_set_state(restored->ui_state);
+    }
+    else
+    {
+        pressing_active = false;
+        press_safety_locked = true; // Released when the cycle starts
+        cycle_engine.phase = CYCLE_PHASE_IDLE;
+        cycle_start_time = 0;
+        stage_start_time = 0;
+        current_stage = IDLE;
+        ui_set_state(ui_is_free_press_mode() ? UI_STATE_FREE_PRESS : UI_STATE_START_PRESSING);
+    }
+
+    platen_station = station;
+    ESP_LOGI(TAG, "Platen moved to station %c (%s)", 'A' + station,
+             restored->pressing_active ? "cycle waiting" : "new cycle");
+}
+
+bool is_parked_cycle_active(void)
+{
+    if (!SHUTTLE_ENABLED)
+    {
+        return false;
+    }
+
+    for (uint8_t station = 0; station < STATION_COUNT; station++)
+    {
+        if (station != platen_station && station_contexts[station].pressing_active)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+uint8_t get_platen_station(void)
+{
+    return platen_station;
+}
+
+bool get_station_summary(uint8_t station, station_summary_t *summary)
+{
+    if (station >= STATION_COUNT || !summary)
+    {
+        return false;
+    }
+
+    const cycle_engine_t *engine = &cycle_engine;
+    bool active = pressing_active;
+    if (station != platen_station)
+    {
+        engine = &station_contexts[station].engine;
+        active = station_contexts[station].pressing_active;
+    }
+
+    const cycle_stage_t *stage = active ? cycle_engine_current_stage(engine) : NULL;
+    summary->cycle_active = active;
+    summary->next_stage = stage ? stage->name : NULL;
+    summary->presses = station_presses[station];
+    return true;
+}
+
+const station_context_t *get_parked_station(uint8_t station)
+{
+    return (station < STATION_COUNT) ? &station_contexts[station] : NULL;
+}
+
+void reset_station_cycles(void)
+{
+    memset(station_contexts, 0, sizeof(station_contexts));
+}
+
+void reset_station_presses(void)
+{
+    memset(station_presses, 0, sizeof(station_presses));
+}
+
+void count_station_press(void)
+{
+    station_presses[platen_station]++;
+}
+
+void set_station_press_load(float watts)
+{
+    station_press_load[platen_station] = watts;
+}
+
+float get_station_press_load(uint8_t station)
+{
+    return (station < STATION_COUNT) ? station_press_load[station] : 0.0f;
+}
@@ -0,0 +1,96 @@
+/**
+ * @file shuttle_station.h
+ * @brief Shuttle press station switching
+ *
+ * On a shuttle press one heated platen serves two stations. The pressing
+ * cycle globals in main.h always hold the cycle of the station under the
+ * platen; the other station's cycle is parked here and swapped back in
+ * when the platen closes on it. Switching runs on the UI task; the press
+ * load per station is kept by the temperature control task.
+ *
+ * get_platen_station() and get_station_summary() are declared in main.h.
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#ifndef SHUTTLE_STATION_H
+#define SHUTTLE_STATION_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "data_model.h"
+#include "cycle_engine.h"
+#include "ui_state.h"
+
+/**
+ * @brief Cycle context of a station while the platen is elsewhere
+ */
+typedef struct
+{
+    bool pressing_active;
+    bool press_safety_locked;
+    pressing_cycle_t cycle;
+    cycle_engine_t engine;
+    uint32_t cycle_start_time;
+    uint32_t stage_start_time;
+    cycle_status_t stage;
+    ui_state_t ui_state;
+    shirt_side_t next_side;   ///< Side the station presses next (double-sided jobs)
+    uint32_t parked_time;     ///< When the platen left the station (s)
+} station_context_t;
+
+/**
+ * @brief Move the cycle context to another station
+ *
+ * @param station Station the platen closed on
+ * @param now Current time (s)
+ */
+void switch_station(uint8_t station, uint32_t now);
+
+/**
+ * @brief Check for a parked station waiting for its next stage
+ *
+ * @return Always false on a single press
+ */
+bool is_parked_cycle_active(void);
+
+/**
+ * @brief Get a station's parked context
+ *
+ * Only meaningful for a station other than the platen station.
+ *
+ * @return Context, or NULL if the station does not exist
+ */
+const station_context_t *get_parked_station(uint8_t station);
+
+/**
+ * @brief Drop the parked cycles (new run, emergency shutdown)
+ */
+void reset_station_cycles(void);
+
+/**
+ * @brief Clear the per-station press counts (new run)
+ */
+void reset_station_presses(void);
+
+/**
+ * @brief Count a completed cycle on the platen station
+ */
+void count_station_press(void);
+
+/**
+ * @brief Record the peak load of the press just completed on the platen station
+ *
+ * @param watts Peak load (W)
+ */
+void set_station_press_load(float watts);
+
+/**
+ * @brief Last press load measured on a station
+ *
+ * @return Load (W), 0 before the station's first press
+ */
+float get_station_press_load(uint8_t station);
+
+#endif // SHUTTLE_STATION_H
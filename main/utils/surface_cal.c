@@ -0,0 +1,160 @@
+/**
+ * @file surface_cal.c
+ * @brief Multi-point surface temperature correction implementation
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#include "surface_cal.h"
+#include <math.h>
+#include <string.h>
+
+// =============================================================================
+// Internal Helpers
+// =============================================================================
+
+static float point_correction(const surface_cal_point_t *point)
+{
+    return point->surface_celsius - point->sensor_celsius;
+}
+
+/**
+ * @brief Correction at a reading, interpolated between two points
+ */
+static float interpolate(const surface_cal_point_t *low, const surface_cal_point_t *high, float reading)
+{
+    float fraction = (reading - low->sensor_celsius) / (high->sensor_celsius - low->sensor_celsius);
+    return point_correction(low) + fraction * (point_correction(high) - point_correction(low));
+}
+
+// =============================================================================
+// Correction Table
+// =============================================================================
+
+void surface_cal_clear(surface_calibration_t *calibration)
+{
+    if (calibration)
+    {
+        memset(calibration, 0, sizeof(surface_calibration_t));
+    }
+}
+
+bool surface_cal_validate(const surface_calibration_t *calibration)
+{
+    if (!calibration || calibration->count > SURFACE_CAL_POINTS ||
+        !isfinite(calibration->as_found_max) || calibration->as_found_max < 0.0f ||
+        !isfinite(calibration->interpolation_max) || calibration->interpolation_max < 0.0f)
+    {
+        return false;
+    }
+
+    for (uint8_t i = 0; i < calibration->count; i++)
+    {
+        const surface_cal_point_t *point = &calibration->points[i];
+        if (!isfinite(point->sensor_celsius) || !isfinite(point->surface_celsius) || !isfinite(point->as_found) ||
+            fabsf(point_correction(point)) > SURFACE_CAL_LIMIT ||
+            (i > 0 && point->sensor_celsius <= calibration->points[i - 1].sensor_celsius))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+float surface_cal_apply(const surface_calibration_t *calibration, float reading)
+{
+    if (!calibration || calibration->count == 0)
+    {
+        return reading;
+    }
+
+    const surface_cal_point_t *points = calibration->points;
+    uint8_t last = calibration->count - 1;
+
+    // Hold the end corrections outside the calibrated range
+    if (reading <= points[0].sensor_celsius)
+    {
+        return reading + point_correction(&points[0]);
+    }
+    if (reading >= points[last].sensor_celsius)
+    {
+        return reading + point_correction(&points[last]);
+    }
+
+    uint8_t i = 1;
+    while (reading > points[i].sensor_celsius)
+    {
+        i++;
+    }
+    return reading + interpolate(&points[i - 1], &points[i], reading);
+}
+
+bool surface_cal_add_point(surface_calibration_t *calibration, const surface_calibration_t *previous,
+                           float sensor_celsius, float surface_celsius)
+{
+    if (!calibration)
+    {
+        return false;
+    }
+
+    surface_cal_point_t point = {
+        .sensor_celsius = sensor_celsius,
+        .surface_celsius = surface_celsius,
+        .as_found = surface_celsius - surface_cal_apply(previous, sensor_celsius),
+    };
+
+    // Measured again: replace the old point at this setpoint
+    for (uint8_t i = 0; i < calibration->count; i++)
+    {
+        if (fabsf(calibration->points[i].sensor_celsius - sensor_celsius) < SURFACE_CAL_MIN_SPACING)
+        {
+            memmove(&calibration->points[i], &calibration->points[i + 1],
+                    (calibration->count - i - 1) * sizeof(surface_cal_point_t));
+            calibration->count--;
+            break;
+        }
+    }
+
+    if (calibration->count == SURFACE_CAL_POINTS)
+    {
+        return false;
+    }
+
+    uint8_t index = calibration->count;
+    while (index > 0 && calibration->points[index - 1].sensor_celsius > sensor_celsius)
+    {
+        calibration->points[index] = calibration->points[index - 1];
+        index--;
+    }
+    calibration->points[index] = point;
+    calibration->count++;
+    return true;
+}
+
+void surface_cal_finish(surface_calibration_t *calibration, uint32_t day)
+{
+    if (!calibration)
+    {
+        return;
+    }
+
+    calibration->day = day;
+    calibration->as_found_max = 0.0f;
+    calibration->interpolation_max = 0.0f;
+
+    for (uint8_t i = 0; i < calibration->count; i++)
+    {
+        const surface_cal_point_t *point = &calibration->points[i];
+        calibration->as_found_max = fmaxf(calibration->as_found_max, fabsf(point->as_found));
+
+        // Leave an inner point out and see how well its neighbours predict it
+        if (i > 0 && i + 1 < calibration->count)
+        {
+            float predicted = interpolate(&calibration->points[i - 1], &calibration->points[i + 1],
+                                          point->sensor_celsius);
+            calibration->interpolation_max = fmaxf(calibration->interpolation_max,
+                                                   fabsf(point_correction(point) - predicted));
+        }
+    }
+}
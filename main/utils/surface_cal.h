@@ -0,0 +1,85 @@
+/**
+ * @file surface_cal.h
+ * @brief Multi-point surface temperature correction
+ *
+ * The thermocouple sits in the platen casting, not on its surface, and
+ * the surface runs cooler by an amount that grows with temperature (more
+ * heat flows out through the face). A single calibration offset is only
+ * right at the temperature it was set at.
+ *
+ * The correction table pairs thermocouple readings with reference probe
+ * readings taken on the surface at several setpoints. The correction
+ * (probe minus reading) is interpolated linearly between points and held
+ * at the end values outside them, so a reading beyond the calibrated
+ * range never gets an extrapolated correction.
+ *
+ * Two residuals are kept with the table. The as-found error is how far
+ * the previous table was off at each new point (drift between
+ * calibrations). The interpolation error is how far each inner point is
+ * from the line through its neighbours, which shows whether the points
+ * are close enough together to trust the readings between them.
+ *
+ * The functions here operate on caller-owned state and do no locking;
+ * the caller serializes access.
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#ifndef SURFACE_CAL_H
+#define SURFACE_CAL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "data_model.h"  // components/storage/include/ - surface_calibration_t
+
+#define SURFACE_CAL_MIN_SPACING 5.0f   ///< A point this close to another replaces it (°C)
+#define SURFACE_CAL_LIMIT 50.0f        ///< Loaded corrections beyond this are corrupt (°C)
+
+// =============================================================================
+// Function Prototypes
+// =============================================================================
+
+/**
+ * @brief Empty the table (no correction)
+ */
+void surface_cal_clear(surface_calibration_t *calibration);
+
+/**
+ * @brief Check a loaded table for corruption
+ */
+bool surface_cal_validate(const surface_calibration_t *calibration);
+
+/**
+ * @brief Correct a thermocouple reading to the surface temperature
+ *
+ * @param calibration Table (an empty table returns the reading unchanged)
+ * @param reading Thermocouple reading (°C)
+ * @return Surface temperature (°C)
+ */
+float surface_cal_apply(const surface_calibration_t *calibration, float reading);
+
+/**
+ * @brief Add a measured point to a table being built
+ *
+ * Kept in ascending order; a point within SURFACE_CAL_MIN_SPACING of an
+ * existing one replaces it (the setpoint was measured again).
+ *
+ * @param calibration Table being built
+ * @param previous Table in force until now, for the as-found error
+ * @param sensor_celsius Uncorrected thermocouple reading (°C)
+ * @param surface_celsius Reference probe reading (°C)
+ * @return false if the table is full
+ */
+bool surface_cal_add_point(surface_calibration_t *calibration, const surface_calibration_t *previous,
+                           float sensor_celsius, float surface_celsius);
+
+/**
+ * @brief Update the residual summaries and date the table
+ *
+ * @param calibration Table
+ * @param day Days since 1970 (UTC), 0 if the wall clock is not set
+ */
+void surface_cal_finish(surface_calibration_t *calibration, uint32_t day);
+
+#endif // SURFACE_CAL_H
@@ -0,0 +1,166 @@
+/**
+ * @file throughput.c
+ * @brief Rolling throughput metrics implementation
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#include "throughput.h"
+#include <string.h>
+
+static const char *limit_names[] = {
+    "On pace",
+    "Press",
+    "Operator"
+};
+
+static uint16_t saturate_u16(uint32_t value)
+{
+    return (value > UINT16_MAX) ? UINT16_MAX : (uint16_t)value;
+}
+
+/**
+ * @brief Move the head to the current minute, clearing buckets on the way
+ */
+static throughput_bucket_t *current_bucket(throughput_t *throughput, uint32_t now_sec)
+{
+    uint32_t minute = now_sec / THROUGHPUT_BUCKET_SEC;
+
+    if (minute > throughput->head_minute)
+    {
+        uint32_t steps = minute - throughput->head_minute;
+        if (steps > THROUGHPUT_BUCKETS)
+        {
+            steps = THROUGHPUT_BUCKETS;
+        }
+        for (uint32_t i = 0; i < steps; i++)
+        {
+            throughput->head = (throughput->head + 1) % THROUGHPUT_BUCKETS;
+            memset(&throughput->buckets[throughput->head], 0, sizeof(throughput_bucket_t));
+        }
+        throughput->head_minute = minute;
+    }
+
+    return &throughput->buckets[throughput->head];
+}
+
+void throughput_reset(throughput_t *throughput, uint32_t now_sec)
+{
+    if (!throughput)
+    {
+        return;
+    }
+
+    memset(throughput, 0, sizeof(throughput_t));
+    throughput->head_minute = now_sec / THROUGHPUT_BUCKET_SEC;
+    throughput->start_minute = throughput->head_minute;
+}
+
+void throughput_add_time(throughput_t *throughput, uint32_t now_sec, pace_category_t category, uint32_t seconds)
+{
+    if (!throughput || category >= PACE_CATEGORY_COUNT)
+    {
+        return;
+    }
+
+    throughput_bucket_t *bucket = current_bucket(throughput, now_sec);
+    bucket->seconds[category] = saturate_u16(bucket->seconds[category] + seconds);
+}
+
+void throughput_add_press(throughput_t *throughput, uint32_t now_sec, bool shirt_finished)
+{
+    if (!throughput)
+    {
+        return;
+    }
+
+    throughput_bucket_t *bucket = current_bucket(throughput, now_sec);
+    bucket->presses++;
+    if (shirt_finished)
+    {
+        bucket->shirts++;
+    }
+}
+
+void throughput_pace(throughput_t *throughput, uint32_t now_sec, uint16_t minutes,
+                     const pace_plan_t *plan, pace_status_t *status)
+{
+    if (!throughput || !plan || !status)
+    {
+        return;
+    }
+
+    memset(status, 0, sizeof(pace_status_t));
+    current_bucket(throughput, now_sec);
+
+    // Never reach back past the reset
+    uint32_t available = throughput->head_minute - throughput->start_minute + 1;
+    if (minutes > THROUGHPUT_BUCKETS)
+    {
+        minutes = THROUGHPUT_BUCKETS;
+    }
+    if (minutes > available)
+    {
+        minutes = (uint16_t)available;
+    }
+
+    uint32_t presses = 0;
+    uint32_t shirts = 0;
+    uint32_t seconds[PACE_CATEGORY_COUNT] = {0};
+    for (uint16_t i = 0; i < minutes; i++)
+    {
+        const throughput_bucket_t *bucket =
+            &throughput->buckets[(throughput->head + THROUGHPUT_BUCKETS - i) % THROUGHPUT_BUCKETS];
+        presses += bucket->presses;
+        shirts += bucket->shirts;
+        for (int c = 0; c < PACE_CATEGORY_COUNT; c++)
+        {
+            seconds[c] += bucket->seconds[c];
+        }
+    }
+
+    // Plan: shuttle presses load one station while the other presses
+    uint32_t takt_per_press = plan->overlapped ?
+                              ((plan->press_sec > plan->handling_sec) ? plan->press_sec : plan->handling_sec) :
+                              (uint32_t)plan->press_sec + plan->handling_sec;
+    uint8_t presses_per_shirt = (plan->presses_per_shirt > 0) ? plan->presses_per_shirt : 1;
+
+    status->window_min = minutes;
+    status->presses = saturate_u16(presses);
+    status->shirts = saturate_u16(shirts);
+    status->target_takt = saturate_u16(takt_per_press * presses_per_shirt);
+
+    uint32_t production = seconds[PACE_PRESSING] + seconds[PACE_HANDLING] + seconds[PACE_RECOVERY];
+    if (shirts > 0)
+    {
+        status->actual_takt = saturate_u16(production / shirts);
+    }
+    if (presses == 0)
+    {
+        return;
+    }
+
+    status->press_sec = saturate_u16(seconds[PACE_PRESSING] / presses);
+    status->handling_sec = saturate_u16(seconds[PACE_HANDLING] / presses);
+    status->recovery_sec = saturate_u16(seconds[PACE_RECOVERY] / presses);
+
+    // Behind when the shirts so far took longer than planned, or none finished in a full takt
+    bool behind = (shirts > 0) ? (status->actual_takt > status->target_takt) :
+                                 (production > status->target_takt);
+    if (!behind)
+    {
+        status->limit = PACE_LIMIT_NONE;
+        return;
+    }
+
+    // Whichever overran its share of the plan more
+    int32_t press_excess = (int32_t)status->press_sec - plan->press_sec + status->recovery_sec;
+    int32_t operator_excess = (int32_t)status->handling_sec - plan->handling_sec;
+    status->limit = (press_excess > operator_excess) ? PACE_LIMIT_PRESS : PACE_LIMIT_OPERATOR;
+}
+
+const char *throughput_limit_name(pace_limit_t limit)
+{
+    return (limit <= PACE_LIMIT_OPERATOR) ? limit_names[limit] : "?";
+}
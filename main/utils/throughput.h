@@ -0,0 +1,127 @@
+/**
+ * @file throughput.h
+ * @brief Rolling throughput metrics and operator pacing
+ *
+ * The statistics screens show totals since the statistics were reset.
+ * For pacing, the operator needs to know how the last few minutes went.
+ * This module keeps a ring of one-minute buckets covering the last hour.
+ * Each bucket counts presses, finished shirts and the seconds spent
+ * pressing, handling (press open or waiting for the operator) and
+ * recovering (waiting for temperature). Paused, fault and heat-up time is
+ * kept apart and does not count against the pace.
+ *
+ * throughput_pace() compares a window of buckets with the job's plan:
+ * the stage times plus a handling allowance per press (PACING_HANDLING_SEC).
+ * When the press is behind, it names the limit as the press or the
+ * operator, whichever overran its share of the plan more.
+ *
+ * The functions here operate on a caller-owned ring and do no locking;
+ * the caller serializes access.
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#ifndef THROUGHPUT_H
+#define THROUGHPUT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "data_model.h"  // components/storage/include/ - pace_status_t
+
+#define THROUGHPUT_BUCKET_SEC 60   ///< Bucket width (s)
+#define THROUGHPUT_BUCKETS 60      ///< Buckets kept (one hour)
+
+/**
+ * @brief Where a second of production time went
+ */
+typedef enum
+{
+    PACE_PRESSING,     ///< A stage is timing
+    PACE_HANDLING,     ///< Waiting for the operator to open, load or close
+    PACE_RECOVERY,     ///< Waiting for the platen to recover temperature
+    PACE_OFF,          ///< Paused, faulted or heating up - not production time
+    PACE_CATEGORY_COUNT
+} pace_category_t;
+
+/**
+ * @brief One bucket
+ */
+typedef struct
+{
+    uint16_t presses;
+    uint16_t shirts;
+    uint16_t seconds[PACE_CATEGORY_COUNT];
+} throughput_bucket_t;
+
+/**
+ * @brief Bucket ring
+ */
+typedef struct
+{
+    throughput_bucket_t buckets[THROUGHPUT_BUCKETS];
+    uint8_t head;             ///< Bucket for the current minute
+    uint32_t head_minute;     ///< Minute (since boot) of the head bucket
+    uint32_t start_minute;    ///< Minute the ring was reset
+} throughput_t;
+
+/**
+ * @brief Job plan to pace against
+ */
+typedef struct
+{
+    uint16_t press_sec;       ///< Stage time per press (s)
+    uint16_t handling_sec;    ///< Handling allowance per press (s)
+    uint8_t presses_per_shirt;
+    bool overlapped;          ///< Handling overlaps pressing (shuttle press)
+} pace_plan_t;
+
+// =============================================================================
+// Function Prototypes
+// =============================================================================
+
+/**
+ * @brief Clear the ring
+ *
+ * @param throughput Ring
+ * @param now_sec Current time (s)
+ */
+void throughput_reset(throughput_t *throughput, uint32_t now_sec);
+
+/**
+ * @brief Book elapsed time to a category
+ *
+ * @param throughput Ring
+ * @param now_sec Current time (s)
+ * @param category Where the time went
+ * @param seconds Elapsed seconds
+ */
+void throughput_add_time(throughput_t *throughput, uint32_t now_sec, pace_category_t category, uint32_t seconds);
+
+/**
+ * @brief Record a completed press
+ *
+ * @param throughput Ring
+ * @param now_sec Current time (s)
+ * @param shirt_finished true if the press finished a shirt
+ */
+void throughput_add_press(throughput_t *throughput, uint32_t now_sec, bool shirt_finished);
+
+/**
+ * @brief Pace over the last minutes against a plan
+ *
+ * @param throughput Ring
+ * @param now_sec Current time (s)
+ * @param minutes Window (1 to THROUGHPUT_BUCKETS), shortened to the data available
+ * @param plan Job plan
+ * @param[out] status Window figures and limit
+ */
+void throughput_pace(throughput_t *throughput, uint32_t now_sec, uint16_t minutes,
+                     const pace_plan_t *plan, pace_status_t *status);
+
+/**
+ * @brief Short name for a pace limit (8 chars max)
+ */
+const char *throughput_limit_name(pace_limit_t limit);
+
+#endif // THROUGHPUT_H
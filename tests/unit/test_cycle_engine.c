@@ -0,0 +1,186 @@
+/**
+ * @file test_cycle_engine.c
+ * @brief Unit tests for the table-driven pressing cycle engine
+ *
+ * This test suite validates stage sequencing and thermal dose timing.
+ * Tests cover:
+ * - Built-in programs built from the stage timers
+ * - Reopen and closed stage entry
+ * - Early release by opening the press
+ * - Dose stages ending early on a hot platen and late on a cold one
+ * - The dose stage time limit
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#include <unity.h>
+#include <string.h>
+
+#include "cycle_engine.h"
+
+#define TEST_TARGET 180.0f  ///< Base setpoint for the dose tests (°C)
+#define TEST_DOSE_SEC 20    ///< Dose stage length (equivalent s)
+
+// =============================================================================
+// Test Helpers
+// =============================================================================
+
+/**
+ * @brief A one-stage cycle ending on dose
+ */
+static cycle_definition_t dose_cycle(void)
+{
+    cycle_definition_t definition;
+    memset(&definition, 0, sizeof(definition));
+    definition.stage_count = 1;
+    definition.stages[0] = (cycle_stage_t){"Press", TEST_DOSE_SEC, STAGE_END_DOSE, STAGE_ENTRY_REOPEN, 0.0f};
+    return definition;
+}
+
+/**
+ * @brief Run a started engine at a constant temperature until the stage ends
+ *
+ * @return Seconds the stage ran, or 0 if it did not end within limit_sec
+ */
+static uint32_t run_until_done(cycle_engine_t *engine, float temperature, uint32_t limit_sec)
+{
+    for (uint32_t now = 1; now <= limit_sec; now++)
+    {
+        if (cycle_engine_update(engine, now, temperature, TEST_TARGET) != CYCLE_PHASE_RUNNING)
+        {
+            return now;
+        }
+    }
+    return 0;
+}
+
+// =============================================================================
+// Program Tests
+// =============================================================================
+
+// Built-in programs take their main and finishing press times from the timers
+void test_cycle_program_build(void)
+{
+    cycle_definition_t definition;
+
+    TEST_ASSERT_TRUE(cycle_program_build(0, 15, 5, &definition));
+    TEST_ASSERT_EQUAL_UINT8(2, definition.stage_count);
+    TEST_ASSERT_EQUAL_UINT16(15, definition.stages[0].duration);
+    TEST_ASSERT_EQUAL_UINT16(5, definition.stages[1].duration);
+
+    // Transfer: fixed pre-press, dosed main press
+    TEST_ASSERT_TRUE(cycle_program_build(1, 15, 5, &definition));
+    TEST_ASSERT_EQUAL_UINT8(3, definition.stage_count);
+    TEST_ASSERT_EQUAL(STAGE_END_DOSE, definition.stages[1].end);
+    TEST_ASSERT_EQUAL_UINT16(15, definition.stages[1].duration);
+
+    TEST_ASSERT_FALSE(cycle_program_build(CYCLE_PROGRAM_COUNT, 15, 5, &definition));
+    TEST_ASSERT_EQUAL_STRING("?", cycle_program_name(CYCLE_PROGRAM_COUNT));
+}
+
+// =============================================================================
+// Sequencing Tests
+// =============================================================================
+
+// Standard program: stage, reopen, stage, open to complete
+void test_cycle_engine_reopen_sequence(void)
+{
+    cycle_definition_t definition;
+    cycle_engine_t engine;
+
+    TEST_ASSERT_TRUE(cycle_program_build(0, 10, 4, &definition));
+    TEST_ASSERT_TRUE(cycle_engine_start(&engine, &definition, 0));
+
+    TEST_ASSERT_EQUAL(CYCLE_PHASE_RUNNING, cycle_engine_update(&engine, 9, TEST_TARGET, TEST_TARGET));
+    TEST_ASSERT_EQUAL_UINT16(1, cycle_engine_remaining(&engine, 9));
+    TEST_ASSERT_EQUAL(CYCLE_PHASE_STAGE_DONE, cycle_engine_update(&engine, 10, TEST_TARGET, TEST_TARGET));
+
+    // Waiting for the reopen already points at the next stage
+    TEST_ASSERT_EQUAL_UINT8(1, cycle_engine_stage_index(&engine));
+    TEST_ASSERT_EQUAL(CYCLE_PHASE_READY, cycle_engine_press_opened(&engine, 12));
+    TEST_ASSERT_EQUAL(CYCLE_PHASE_RUNNING, cycle_engine_press_closed(&engine, 15));
+
+    TEST_ASSERT_EQUAL(CYCLE_PHASE_LAST_DONE, cycle_engine_update(&engine, 19, TEST_TARGET, TEST_TARGET));
+    TEST_ASSERT_EQUAL(CYCLE_PHASE_COMPLETE, cycle_engine_press_opened(&engine, 20));
+    TEST_ASSERT_NULL(cycle_engine_current_stage(&engine));
+}
+
+// A closed-entry stage follows straight on, with its own setpoint offset
+void test_cycle_engine_closed_entry(void)
+{
+    cycle_definition_t definition;
+    cycle_engine_t engine;
+
+    memset(&definition, 0, sizeof(definition));
+    definition.stage_count = 2;
+    definition.stages[0] = (cycle_stage_t){"Press", 5, STAGE_END_TIME, STAGE_ENTRY_REOPEN, 0.0f};
+    definition.stages[1] = (cycle_stage_t){"Cool", 5, STAGE_END_TIME, STAGE_ENTRY_CLOSED, -15.0f};
+
+    TEST_ASSERT_TRUE(cycle_engine_start(&engine, &definition, 0));
+    TEST_ASSERT_EQUAL(CYCLE_PHASE_RUNNING, cycle_engine_update(&engine, 5, TEST_TARGET, TEST_TARGET));
+    TEST_ASSERT_EQUAL_UINT8(1, cycle_engine_stage_index(&engine));
+    TEST_ASSERT_EQUAL_FLOAT(-15.0f, cycle_engine_setpoint_offset(&engine));
+}
+
+// Opening the press during a stage releases it early
+void test_cycle_engine_early_release(void)
+{
+    cycle_definition_t definition;
+    cycle_engine_t engine;
+
+    TEST_ASSERT_TRUE(cycle_program_build(0, 10, 4, &definition));
+    TEST_ASSERT_TRUE(cycle_engine_start(&engine, &definition, 0));
+
+    TEST_ASSERT_EQUAL(CYCLE_PHASE_READY, cycle_engine_press_opened(&engine, 3));
+    TEST_ASSERT_EQUAL(CYCLE_PHASE_RUNNING, cycle_engine_press_closed(&engine, 6));
+    TEST_ASSERT_EQUAL(CYCLE_PHASE_COMPLETE, cycle_engine_press_opened(&engine, 7));
+}
+
+// =============================================================================
+// Dose Tests
+// =============================================================================
+
+// At the setpoint a dose stage takes its nominal time
+void test_cycle_engine_dose_at_setpoint(void)
+{
+    cycle_definition_t definition = dose_cycle();
+    cycle_engine_t engine;
+
+    TEST_ASSERT_TRUE(cycle_engine_start(&engine, &definition, 0));
+    TEST_ASSERT_EQUAL_UINT32(TEST_DOSE_SEC, run_until_done(&engine, TEST_TARGET, 3 * TEST_DOSE_SEC));
+}
+
+// A platen one doubling step hot doubles the dose rate: the stage ends in half the time
+void test_cycle_engine_dose_hot_platen_ends_early(void)
+{
+    cycle_definition_t definition = dose_cycle();
+    cycle_engine_t engine;
+
+    TEST_ASSERT_TRUE(cycle_engine_start(&engine, &definition, 0));
+    TEST_ASSERT_EQUAL_UINT32(TEST_DOSE_SEC / 2,
+                             run_until_done(&engine, TEST_TARGET + CYCLE_DOSE_DOUBLING, 3 * TEST_DOSE_SEC));
+    TEST_ASSERT_EQUAL(CYCLE_PHASE_LAST_DONE, engine.phase);
+}
+
+// A sagging platen presses longer instead of under-curing
+void test_cycle_engine_dose_cold_platen_runs_long(void)
+{
+    cycle_definition_t definition = dose_cycle();
+    cycle_engine_t engine;
+
+    TEST_ASSERT_TRUE(cycle_engine_start(&engine, &definition, 0));
+    TEST_ASSERT_EQUAL_UINT32(2 * TEST_DOSE_SEC,
+                             run_until_done(&engine, TEST_TARGET - CYCLE_DOSE_DOUBLING, 3 * TEST_DOSE_SEC));
+}
+
+// A platen far below setpoint still ends the stage at the time limit
+void test_cycle_engine_dose_time_limit(void)
+{
+    cycle_definition_t definition = dose_cycle();
+    cycle_engine_t engine;
+
+    TEST_ASSERT_TRUE(cycle_engine_start(&engine, &definition, 0));
+    TEST_ASSERT_EQUAL_UINT32(CYCLE_DOSE_TIME_LIMIT * TEST_DOSE_SEC,
+                             run_until_done(&engine, TEST_TARGET - 60.0f, 4 * TEST_DOSE_SEC));
+}
@@ -0,0 +1,137 @@
+/**
+ * @file test_disturbance_observer.c
+ * @brief Unit tests for the thermal load observer
+ *
+ * This test suite drives the observer with the rated press plant (see
+ * pid_batch_plant_step()) behind a thermocouple dead time. Tests cover:
+ * - Heater power steps without a load leave the estimate near zero
+ * - A real load is found and converted to compensating output
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#include <unity.h>
+#include <math.h>
+
+#include "disturbance_observer.h"
+#include "pid_batch.h"
+
+// =============================================================================
+// Test Helpers
+// =============================================================================
+
+#define DOB_TEST_HEATER_WATTS 2200.0f
+#define DOB_TEST_CAPACITY 4400.0f
+#define DOB_TEST_LOSS 8.0f
+#define DOB_TEST_AMBIENT 25.0f
+#define DOB_TEST_DEAD_STEPS 20
+#define DOB_TEST_DT 1.0f
+
+/**
+ * @brief Press plant with the reading delayed by the dead time
+ */
+typedef struct
+{
+    float temperature;
+    float history[DOB_TEST_DEAD_STEPS];
+    int head;
+} delayed_plant_t;
+
+static void plant_init(delayed_plant_t *plant, float temperature)
+{
+    plant->temperature = temperature;
+    plant->head = 0;
+    for (int i = 0; i < DOB_TEST_DEAD_STEPS; i++)
+    {
+        plant->history[i] = temperature;
+    }
+}
+
+/**
+ * @brief Advance the plant one step
+ *
+ * @return Thermocouple reading at the end of the step (°C)
+ */
+static float plant_step(delayed_plant_t *plant, float power, float load_watts)
+{
+    plant->temperature = pid_batch_plant_step(plant->temperature, power, DOB_TEST_HEATER_WATTS,
+                                              DOB_TEST_LOSS, DOB_TEST_AMBIENT, load_watts,
+                                              DOB_TEST_CAPACITY, DOB_TEST_DT);
+    float reading = plant->history[plant->head];
+    plant->history[plant->head] = plant->temperature;
+    plant->head = (plant->head + 1) % DOB_TEST_DEAD_STEPS;
+    return reading;
+}
+
+static void observer_init(disturbance_observer_t *dob)
+{
+    thermal_model_t model = {
+        .heater_watts = DOB_TEST_HEATER_WATTS,
+        .capacity = DOB_TEST_CAPACITY,
+        .loss_coefficient = DOB_TEST_LOSS,
+        .ambient = DOB_TEST_AMBIENT,
+        .dead_time = DOB_TEST_DEAD_STEPS * DOB_TEST_DT,
+        .observer_gain = 0.05f};
+    dob_init(dob, model, DOB_TEST_DT);
+}
+
+/**
+ * @brief Run the plant and observer together
+ *
+ * @return Largest |load estimate| seen (W)
+ */
+static float run(disturbance_observer_t *dob, delayed_plant_t *plant,
+                 float power, float load_watts, int steps)
+{
+    float worst = 0.0f;
+    for (int i = 0; i < steps; i++)
+    {
+        float reading = plant_step(plant, power, load_watts);
+        dob_update(dob, reading, power);
+        worst = fmaxf(worst, fabsf(dob_get_load_watts(dob)));
+    }
+    return worst;
+}
+
+// =============================================================================
+// Dead Time Tests
+// =============================================================================
+
+// Full power from cold, then down to holding power: no load is invented
+void test_dob_power_step_without_load(void)
+{
+    disturbance_observer_t dob;
+    delayed_plant_t plant;
+    observer_init(&dob);
+    plant_init(&plant, DOB_TEST_AMBIENT);
+
+    TEST_ASSERT_TRUE(run(&dob, &plant, 0.0f, 0.0f, 60) < 5.0f);
+    TEST_ASSERT_TRUE(run(&dob, &plant, 100.0f, 0.0f, 300) < 5.0f);
+    TEST_ASSERT_TRUE(run(&dob, &plant, 40.0f, 0.0f, 300) < 5.0f);
+    TEST_ASSERT_TRUE(run(&dob, &plant, 0.0f, 0.0f, 120) < 5.0f);
+}
+
+// =============================================================================
+// Load Tests
+// =============================================================================
+
+// A garment's draw is found once it reaches the thermocouple
+void test_dob_finds_load(void)
+{
+    disturbance_observer_t dob;
+    delayed_plant_t plant;
+    observer_init(&dob);
+    plant_init(&plant, 160.0f);
+
+    // Holding power for 160°C: 8 W/°C * 135°C = 1080 W
+    float hold = 1080.0f / DOB_TEST_HEATER_WATTS * 100.0f;
+    TEST_ASSERT_TRUE(run(&dob, &plant, hold, 0.0f, 60) < 5.0f);
+
+    run(&dob, &plant, hold, 440.0f, 300);
+    TEST_ASSERT_FLOAT_WITHIN(10.0f, 440.0f, dob_get_load_watts(&dob));
+    TEST_ASSERT_FLOAT_WITHIN(0.5f, 16.0f, dob_compensation(&dob, 0.8f));
+
+    run(&dob, &plant, hold, 0.0f, 300);
+    TEST_ASSERT_FLOAT_WITHIN(10.0f, 0.0f, dob_get_load_watts(&dob));
+}
@@ -0,0 +1,231 @@
+/**
+ * @file test_heater_health.c
+ * @brief Unit tests for the heater degradation trend
+ *
+ * This test suite fits warm-ups of a simulated lumped press and feeds the
+ * results into the persisted series. Tests cover:
+ * - Recovering the heater power and loss coefficient from a warm-up
+ * - Rejecting data that cannot separate power from losses
+ * - Merging fits into daily (or undated) points
+ * - Baseline, change against it and the monthly slope
+ * - Dropping the oldest point and rejecting corrupted series
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#include <unity.h>
+#include <stddef.h>
+
+#include "heater_health.h"
+
+// =============================================================================
+// Test Helpers
+// =============================================================================
+
+#define HEALTH_TEST_CAPACITY 4400.0f   ///< J/°C
+#define HEALTH_TEST_AMBIENT 25.0f
+#define HEALTH_TEST_TARGET 160.0f
+#define HEALTH_TEST_DAY 20100          ///< Days since 1970, early 2025
+
+/**
+ * @brief Warm up a lumped press at full power, then hold the target
+ *
+ * Integrated in 0.1 s steps and reported to the fit every second as the
+ * control task does.
+ */
+static void fit_warm_up(heater_fit_t *fit, float heater_watts, float loss, uint32_t hold_sec)
+{
+    float temperature = HEALTH_TEST_AMBIENT;
+    float hold_power = 100.0f * loss * (HEALTH_TEST_TARGET - HEALTH_TEST_AMBIENT) / heater_watts;
+    heater_fit_start(fit, HEALTH_TEST_CAPACITY, HEALTH_TEST_AMBIENT, temperature);
+
+    uint32_t held = 0;
+    while (held < hold_sec)
+    {
+        float power = (temperature < HEALTH_TEST_TARGET) ? 100.0f : hold_power;
+        for (int i = 0; i < 10; i++)
+        {
+            float net = heater_watts * power / 100.0f - loss * (temperature - HEALTH_TEST_AMBIENT);
+            temperature += 0.1f * net / HEALTH_TEST_CAPACITY;
+        }
+        heater_fit_add(fit, temperature, power, 1.0f);
+        if (power < 100.0f)
+        {
+            held++;
+        }
+    }
+}
+
+// =============================================================================
+// Fit Tests
+// =============================================================================
+
+// A warm-up and hold recover the heater power and the loss coefficient
+void test_heater_fit_recovers_plant(void)
+{
+    heater_fit_t fit;
+    float watts, loss;
+
+    fit_warm_up(&fit, 2200.0f, 8.0f, 300);
+    TEST_ASSERT_TRUE(heater_fit_solve(&fit, &watts, &loss));
+    TEST_ASSERT_FLOAT_WITHIN(2200.0f * 0.03f, 2200.0f, watts);
+    TEST_ASSERT_FLOAT_WITHIN(8.0f * 0.05f, 8.0f, loss);
+
+    // A weakened element and worse insulation are told apart
+    fit_warm_up(&fit, 1800.0f, 10.0f, 300);
+    TEST_ASSERT_TRUE(heater_fit_solve(&fit, &watts, &loss));
+    TEST_ASSERT_FLOAT_WITHIN(1800.0f * 0.03f, 1800.0f, watts);
+    TEST_ASSERT_FLOAT_WITHIN(10.0f * 0.05f, 10.0f, loss);
+}
+
+// A steady hold alone, or too short a warm-up, gives no fit
+void test_heater_fit_rejects(void)
+{
+    heater_fit_t fit;
+    float watts, loss;
+
+    heater_fit_start(&fit, HEALTH_TEST_CAPACITY, HEALTH_TEST_AMBIENT, HEALTH_TEST_TARGET);
+    for (int s = 0; s < 600; s++)
+    {
+        heater_fit_add(&fit, HEALTH_TEST_TARGET, 50.0f, 1.0f);
+    }
+    TEST_ASSERT_FALSE(heater_fit_solve(&fit, &watts, &loss));
+
+    heater_fit_start(&fit, HEALTH_TEST_CAPACITY, HEALTH_TEST_AMBIENT, HEALTH_TEST_AMBIENT);
+    for (int s = 0; s < 5 * HEATER_FIT_BLOCK_SEC; s++)
+    {
+        heater_fit_add(&fit, HEALTH_TEST_AMBIENT + 0.5f * s, 100.0f, 1.0f);
+    }
+    TEST_ASSERT_FALSE(heater_fit_solve(&fit, &watts, &loss));
+    TEST_ASSERT_FALSE(heater_fit_solve(&fit, NULL, &loss));
+}
+
+// =============================================================================
+// Series Tests
+// =============================================================================
+
+// Fits on the same day are averaged; undated fits merge in groups
+void test_heater_health_merging(void)
+{
+    heater_health_t health;
+    heater_health_init(&health);
+
+    heater_health_add(&health, HEALTH_TEST_DAY, 2200.0f, 8.0f);
+    heater_health_add(&health, HEALTH_TEST_DAY, 2100.0f, 9.0f);
+    TEST_ASSERT_EQUAL(1, health.count);
+    TEST_ASSERT_EQUAL(2, health.points[0].fits);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 2150.0f, health.points[0].heater_watts);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 8.5f, health.points[0].loss_coefficient);
+
+    heater_health_add(&health, HEALTH_TEST_DAY + 1, 2200.0f, 8.0f);
+    TEST_ASSERT_EQUAL(2, health.count);
+
+    // Clock not set: HEATER_HEALTH_MERGE_FITS fits per point
+    heater_health_init(&health);
+    for (int i = 0; i < HEATER_HEALTH_MERGE_FITS + 1; i++)
+    {
+        heater_health_add(&health, 0, 2200.0f, 8.0f);
+    }
+    TEST_ASSERT_EQUAL(2, health.count);
+    TEST_ASSERT_EQUAL(HEATER_HEALTH_MERGE_FITS, health.points[0].fits);
+    TEST_ASSERT_EQUAL(1, health.points[1].fits);
+}
+
+// The first points become the baseline once a later day starts
+void test_heater_health_baseline_and_change(void)
+{
+    heater_health_t health;
+    heater_trend_t trend;
+    heater_health_init(&health);
+
+    for (int day = 0; day < HEATER_HEALTH_BASELINE_POINTS; day++)
+    {
+        heater_health_add(&health, HEALTH_TEST_DAY + day, 2200.0f, 8.0f);
+    }
+    heater_health_trend(&health, &trend);
+    TEST_ASSERT_FALSE(trend.valid);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, health.baseline_watts);
+
+    // A weaker element later on: 10% less power, 25% more loss
+    for (int day = 0; day < HEATER_HEALTH_RECENT_POINTS; day++)
+    {
+        heater_health_add(&health, HEALTH_TEST_DAY + 30 + day, 1980.0f, 10.0f);
+    }
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 2200.0f, health.baseline_watts);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 8.0f, health.baseline_loss);
+
+    heater_health_trend(&health, &trend);
+    TEST_ASSERT_TRUE(trend.valid);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 1980.0f, trend.recent_watts);
+    TEST_ASSERT_FLOAT_WITHIN(0.1f, -10.0f, trend.watts_change_percent);
+    TEST_ASSERT_FLOAT_WITHIN(0.1f, 25.0f, trend.loss_change_percent);
+}
+
+// A steady loss of power shows as a negative slope per month
+void test_heater_health_slope(void)
+{
+    heater_health_t health;
+    heater_trend_t trend;
+    heater_health_init(&health);
+
+    // 2 W lost per day over two weeks
+    for (int day = 0; day <= 14; day += 2)
+    {
+        heater_health_add(&health, HEALTH_TEST_DAY + day, 2200.0f - 2.0f * day, 8.0f);
+    }
+    heater_health_trend(&health, &trend);
+    TEST_ASSERT_FLOAT_WITHIN(0.5f, -60.0f, trend.watts_per_month);
+
+    // Under a week of data gives no slope
+    heater_health_init(&health);
+    for (int day = 0; day < 5; day++)
+    {
+        heater_health_add(&health, HEALTH_TEST_DAY + day, 2200.0f - 2.0f * day, 8.0f);
+    }
+    heater_health_trend(&health, &trend);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, trend.watts_per_month);
+}
+
+// A full series drops its oldest point and keeps the baseline
+void test_heater_health_full_series(void)
+{
+    heater_health_t health;
+    heater_health_init(&health);
+
+    for (int day = 0; day < HEATER_HEALTH_POINTS + 5; day++)
+    {
+        heater_health_add(&health, HEALTH_TEST_DAY + day, (day < 3) ? 2200.0f : 2000.0f, 8.0f);
+    }
+    TEST_ASSERT_EQUAL(HEATER_HEALTH_POINTS, health.count);
+    TEST_ASSERT_EQUAL(HEALTH_TEST_DAY + 5, health.points[0].day);
+    TEST_ASSERT_EQUAL(HEALTH_TEST_DAY + HEATER_HEALTH_POINTS + 4, health.points[HEATER_HEALTH_POINTS - 1].day);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 2200.0f, health.baseline_watts);
+    TEST_ASSERT_TRUE(heater_health_validate(&health));
+}
+
+// Impossible counts and values mark a corrupted series
+void test_heater_health_validate(void)
+{
+    heater_health_t health;
+    heater_health_init(&health);
+    TEST_ASSERT_TRUE(heater_health_validate(&health));
+
+    heater_health_add(&health, HEALTH_TEST_DAY, 2200.0f, 8.0f);
+    health.points[0].fits = 0;
+    TEST_ASSERT_FALSE(heater_health_validate(&health));
+
+    heater_health_init(&health);
+    heater_health_add(&health, HEALTH_TEST_DAY, 2200.0f, 8.0f);
+    health.points[0].heater_watts = 0.0f;
+    TEST_ASSERT_FALSE(heater_health_validate(&health));
+
+    heater_health_init(&health);
+    health.count = HEATER_HEALTH_POINTS + 1;
+    TEST_ASSERT_FALSE(heater_health_validate(&health));
+
+    heater_health_init(&health);
+    health.baseline_loss = -1.0f;
+    TEST_ASSERT_FALSE(heater_health_validate(&health));
+    TEST_ASSERT_FALSE(heater_health_validate(NULL));
+}
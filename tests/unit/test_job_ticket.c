@@ -0,0 +1,182 @@
+/**
+ * @file test_job_ticket.c
+ * @brief Unit tests for the job ticket protocol and queue
+ *
+ * This test suite validates the serial job link parser and the ticket
+ * queue. Tests cover:
+ * - Framing and checksum of received lines
+ * - JOB, CANCEL and setting requests, with their NAK reasons
+ * - Reply framing
+ * - Queue order, duplicates and corruption checks
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#include <unity.h>
+#include <string.h>
+
+#include "job_ticket.h"
+#include "system_config.h"
+
+// =============================================================================
+// Test Helpers
+// =============================================================================
+
+/**
+ * @brief Frame fields as the host would send them, without the line ending
+ */
+static const char *framed(const char *fields)
+{
+    static char line[JOB_LINE_MAX];
+
+    TEST_ASSERT_TRUE(job_ticket_frame(line, sizeof(line), fields));
+    line[strcspn(line, "\r\n")] = '\0';
+    return line;
+}
+
+static job_ticket_t make_ticket(const char *id, uint16_t shirts)
+{
+    job_ticket_t ticket = {0};
+    strncpy(ticket.id, id, JOB_ID_LEN - 1);
+    ticket.num_shirts = shirts;
+    ticket.type = SINGLE_SIDED;
+    ticket.profile = JOB_PROFILE_KEEP;
+    return ticket;
+}
+
+// =============================================================================
+// Protocol Tests
+// =============================================================================
+
+// A framed JOB line queues a ticket with the fields as sent
+void test_job_ticket_parse_job(void)
+{
+    job_command_t command;
+
+    TEST_ASSERT_EQUAL(JOB_CMD_JOB, job_ticket_parse(framed("JOB,A-17,24,D,Cotton"), &command));
+    TEST_ASSERT_EQUAL_STRING("A-17", command.ticket.id);
+    TEST_ASSERT_EQUAL_UINT16(24, command.ticket.num_shirts);
+    TEST_ASSERT_EQUAL(DOUBLE_SIDED, command.ticket.type);
+    TEST_ASSERT_EQUAL_STRING("Cotton", command.profile_name);
+    TEST_ASSERT_EQUAL_UINT8(JOB_PROFILE_KEEP, command.ticket.profile);
+
+    TEST_ASSERT_EQUAL(JOB_CMD_CANCEL, job_ticket_parse(framed("CANCEL,A-17"), &command));
+    TEST_ASSERT_EQUAL_STRING("A-17", command.ticket.id);
+}
+
+// Corrupted lines are answered with NAK, console output is ignored
+void test_job_ticket_parse_framing(void)
+{
+    job_command_t command;
+
+    // XOR of "PING" is 0x10
+    TEST_ASSERT_EQUAL(JOB_CMD_INVALID, job_ticket_parse("$PING*00", &command));
+    TEST_ASSERT_EQUAL_STRING("checksum", command.error);
+
+    TEST_ASSERT_EQUAL(JOB_CMD_INVALID, job_ticket_parse("$PING", &command));
+    TEST_ASSERT_EQUAL_STRING("frame", command.error);
+
+    TEST_ASSERT_EQUAL(JOB_CMD_NONE, job_ticket_parse("I (1234) main: log line", &command));
+    TEST_ASSERT_EQUAL(JOB_CMD_PING, job_ticket_parse(framed("PING"), &command));
+}
+
+// Bad fields are rejected by name, keeping the id so the NAK can name the ticket
+void test_job_ticket_parse_rejects(void)
+{
+    job_command_t command;
+
+    TEST_ASSERT_EQUAL(JOB_CMD_INVALID, job_ticket_parse(framed("JOB,A-18,0,S,-"), &command));
+    TEST_ASSERT_EQUAL_STRING("shirts", command.error);
+    TEST_ASSERT_EQUAL_STRING("A-18", command.ticket.id);
+
+    TEST_ASSERT_EQUAL(JOB_CMD_INVALID, job_ticket_parse(framed("JOB,A-18,5,X,-"), &command));
+    TEST_ASSERT_EQUAL_STRING("sides", command.error);
+
+    TEST_ASSERT_EQUAL(JOB_CMD_INVALID, job_ticket_parse(framed("PREHEAT,7,06:30"), &command));
+    TEST_ASSERT_EQUAL_STRING("preheat", command.error);
+
+    TEST_ASSERT_EQUAL(JOB_CMD_INVALID, job_ticket_parse(framed("WEAR,RESET,FAN"), &command));
+    TEST_ASSERT_EQUAL_STRING("wear", command.error);
+
+    TEST_ASSERT_EQUAL(JOB_CMD_INVALID, job_ticket_parse(framed("REBOOT"), &command));
+    TEST_ASSERT_EQUAL_STRING("command", command.error);
+}
+
+// Setting requests carry their values
+void test_job_ticket_parse_settings(void)
+{
+    job_command_t command;
+
+    TEST_ASSERT_EQUAL(JOB_CMD_PREHEAT, job_ticket_parse(framed("PREHEAT,1,06:30"), &command));
+    TEST_ASSERT_TRUE(command.set);
+    TEST_ASSERT_EQUAL_UINT8(1, command.weekday);
+    TEST_ASSERT_EQUAL_UINT16(6 * 60 + 30, command.ready_minute);
+
+    TEST_ASSERT_EQUAL(JOB_CMD_CLOCK, job_ticket_parse(framed("CLOCK,1735689600,60"), &command));
+    TEST_ASSERT_TRUE(command.set);
+    TEST_ASSERT_EQUAL_INT16(60, command.utc_offset_min);
+
+    TEST_ASSERT_EQUAL(JOB_CMD_WEAR, job_ticket_parse(framed("WEAR,RESET,SSR"), &command));
+    TEST_ASSERT_EQUAL(WEAR_PART_SSR, command.wear_part);
+}
+
+// Replies get the same framing the parser accepts
+void test_job_ticket_frame(void)
+{
+    char line[JOB_LINE_MAX];
+
+    // XOR of "PONG" is 0x16
+    TEST_ASSERT_TRUE(job_ticket_frame(line, sizeof(line), "PONG"));
+    TEST_ASSERT_EQUAL_STRING("$PONG*16\r\n", line);
+
+    TEST_ASSERT_FALSE(job_ticket_frame(line, 6, "PONG"));
+}
+
+// =============================================================================
+// Queue Tests
+// =============================================================================
+
+// Tickets stay in arrival order and ids are unique
+void test_job_queue_order(void)
+{
+    job_queue_t queue = {0};
+    job_ticket_t a = make_ticket("A", 10);
+    job_ticket_t b = make_ticket("B", 20);
+    job_ticket_t c = make_ticket("C", 30);
+
+    TEST_ASSERT_TRUE(job_queue_push(&queue, &a));
+    TEST_ASSERT_TRUE(job_queue_push(&queue, &b));
+    TEST_ASSERT_TRUE(job_queue_push(&queue, &c));
+    TEST_ASSERT_FALSE(job_queue_push(&queue, &b));
+    TEST_ASSERT_EQUAL_UINT8(3, queue.count);
+
+    queue.active = true;
+    job_queue_remove(&queue, (uint8_t)job_queue_find(&queue, "B"));
+    TEST_ASSERT_EQUAL_UINT8(2, queue.count);
+    TEST_ASSERT_EQUAL_STRING("C", queue.tickets[1].id);
+    TEST_ASSERT_TRUE(queue.active);
+    TEST_ASSERT_EQUAL_INT(-1, job_queue_find(&queue, "B"));
+
+    // Removing the head drops the active job
+    job_queue_remove(&queue, 0);
+    TEST_ASSERT_FALSE(queue.active);
+    TEST_ASSERT_TRUE(job_queue_validate(&queue));
+}
+
+// A corrupted queue loaded from storage is rejected
+void test_job_queue_validate(void)
+{
+    job_queue_t queue = {0};
+    job_ticket_t a = make_ticket("A", 10);
+
+    TEST_ASSERT_TRUE(job_queue_push(&queue, &a));
+    TEST_ASSERT_TRUE(job_queue_validate(&queue));
+
+    queue.tickets[0].num_shirts = NUM_SHIRTS_MAX + 1;
+    TEST_ASSERT_FALSE(job_queue_validate(&queue));
+
+    queue.tickets[0].num_shirts = 10;
+    memset(queue.tickets[0].id, 'X', JOB_ID_LEN);
+    TEST_ASSERT_FALSE(job_queue_validate(&queue));
+}
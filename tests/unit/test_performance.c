@@ -9,6 +9,10 @@
  * - Temperature sensor operations
  * - System health monitoring
  * - Memory usage during operation
+ * - PID kernel cost (float controller vs fixed-point kernel, in CPU cycles)
+ * - Batched tuning simulator (bit-identical to the scalar kernel)
+ * - PID integral preload (output equals the holding output)
+ * - PID anti-windup (bounded overshoot after a full-power heat-up)
  *
  * Performance tests ensure the system can respond quickly enough for
  * industrial safety requirements and user experience expectations.
@@ -18,13 +22,18 @@
  */
 
 #include <unity.h>
+#include <math.h>
 #include <esp_timer.h>
 #include <esp_system.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "esp_cpu.h"
 
 // Include main functions for performance testing
 #include "main.h"
+#include "pid_controller.h"
+#include "pid_fixed.h"
+#include "pid_batch.h"
 
 // =============================================================================
 // Performance Test Configuration
@@ -33,6 +42,12 @@
 #define PERFORMANCE_TEST_ITERATIONS 100 ///< Number of iterations per test
 #define MAX_RESPONSE_TIME_MS 1000       ///< Maximum allowed response time (1 second)
 #define TARGET_RESPONSE_TIME_MS 500     ///< Target response time (500ms)
+#define PID_BENCH_ITERATIONS 1000       ///< PID steps per kernel benchmark
+#define PID_BENCH_DT 0.1f               ///< Simulated control step (s)
+#define PID_PRESS_DT 1.0f               ///< Control task step (s)
+#define PID_PRESS_DEAD_STEPS 20         ///< Press dead time, in control steps
+#define PID_PRESS_STEPS 1800            ///< Simulated heat-up length, in control steps
+#define PID_HEAT_UP_MAX_OVERSHOOT 5.0f  ///< Allowed overshoot after a saturated heat-up (°C)
 
 // Performance measurement variables
 static uint64_t start_time; ///< Test start timestamp
@@ -243,6 +258,244 @@ void test_memory_usage_during_performance(void)
              initial_heap, final_heap, heap_difference);
 }
 
+// =============================================================================
+// PID Kernel Benchmark
+// =============================================================================
+
+/**
+ * @brief Simple platen model for driving the PID kernels
+ *
+ * First-order lag toward ambient, 2°C/s at full power from cold.
+ */
+static float bench_plant_step(float temperature, float output)
+{
+    return temperature + PID_BENCH_DT * (2.0f * output / 100.0f - 0.01f * (temperature - 25.0f));
+}
+
+static pid_config_t bench_pid_config(void)
+{
+    pid_config_t config = {
+        .kp = PID_DEFAULT_KP,
+        .ki = PID_DEFAULT_KI,
+        .kd = PID_DEFAULT_KD,
+        .setpoint = 180.0f,
+        .output_min = 0.0f,
+        .output_max = 100.0f};
+    return config;
+}
+
+// Fixed-point kernel must follow the float controller on a closed loop
+void test_pid_fixed_matches_float(void)
+{
+    pid_controller_t float_pid;
+    pid_fixed_state_t fixed_state = {0};
+    float float_temp = 25.0f;
+    float fixed_temp = 25.0f;
+
+    pid_controller_init(&float_pid, bench_pid_config());
+
+    for (int i = 0; i < PID_BENCH_ITERATIONS; i++)
+    {
+        // Force an exact step so the float controller's timer read matches the fixed step
+        float_pid.last_update_us = esp_timer_get_time() - (uint64_t)(PID_BENCH_DT * 1000000.0f);
+        float float_out = pid_controller_update(&float_pid, float_temp);
+        float fixed_out = q16_to_float(pid_fixed_production_update(&fixed_state, Q16_FROM_FLOAT(180.0f),
+                                                                   Q16_FROM_FLOAT(fixed_temp)));
+
+        TEST_ASSERT_FLOAT_WITHIN(0.5f, float_out, fixed_out);
+
+        float_temp = bench_plant_step(float_temp, float_out);
+        fixed_temp = bench_plant_step(fixed_temp, fixed_out);
+    }
+
+    TEST_ASSERT_FLOAT_WITHIN(0.5f, float_temp, fixed_temp);
+}
+
+// Preloading for a holding output must give exactly that output at zero error,
+// even with a small Ki (the anti-windup limit is in output space)
+void test_pid_preload_reaches_hold_output(void)
+{
+    pid_controller_t pid;
+    pid_config_t config = bench_pid_config();
+    config.ki = 0.05f;
+    pid_controller_init(&pid, config);
+
+    pid_controller_preload(&pid, 40.0f);
+    pid.last_update_us = esp_timer_get_time() - (uint64_t)(PID_BENCH_DT * 1000000.0f);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 40.0f, pid_controller_update(&pid, config.setpoint));
+
+    // With a feedforward term the integral makes up the rest
+    pid_controller_set_feedforward(&pid, 10.0f);
+    pid_controller_preload(&pid, 35.0f);
+    pid.last_update_us = esp_timer_get_time() - (uint64_t)(PID_BENCH_DT * 1000000.0f);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 35.0f, pid_controller_update(&pid, config.setpoint));
+}
+
+/**
+ * @brief Press platen with its element-to-thermocouple dead time
+ *
+ * Rated heater and losses, stepped at the control task rate.
+ */
+static const batch_plant_t press_plant = {
+    .heater_watts = 2200.0f,
+    .capacity = 4400.0f,
+    .loss_coefficient = 8.0f,
+    .ambient = 25.0f,
+    .dead_time = PID_PRESS_DEAD_STEPS * PID_PRESS_DT,
+    .initial_temp = 25.0f};
+
+// A full-power heat-up from cold must not wind up the integral: the
+// overshoot stays small instead of running on toward the safety limit
+void test_pid_saturated_heat_up_overshoot(void)
+{
+    static pid_batch_t batch;
+    batch_result_t result;
+    pid_controller_t pid;
+    pid_config_t config = bench_pid_config();
+    float history[PID_PRESS_DEAD_STEPS];
+    float temperature = press_plant.initial_temp;
+    float peak = temperature;
+
+    pid_controller_init(&pid, config);
+    for (int i = 0; i < PID_PRESS_DEAD_STEPS; i++)
+    {
+        history[i] = temperature;
+    }
+
+    // 30 minutes: saturated for the first ~6, then settling
+    for (int i = 0; i < PID_PRESS_STEPS; i++)
+    {
+        float measured = history[i % PID_PRESS_DEAD_STEPS];
+        pid.last_update_us = esp_timer_get_time() - (uint64_t)(PID_PRESS_DT * 1000000.0f);
+        float output = pid_controller_update(&pid, measured);
+
+        history[i % PID_PRESS_DEAD_STEPS] = temperature;
+        temperature = pid_batch_plant_step(temperature, output, press_plant.heater_watts,
+                                           press_plant.loss_coefficient, press_plant.ambient, 0.0f,
+                                           press_plant.capacity, PID_PRESS_DT);
+        peak = fmaxf(peak, temperature);
+    }
+
+    TEST_ASSERT_TRUE(peak < config.setpoint + PID_HEAT_UP_MAX_OVERSHOOT);
+    TEST_ASSERT_FLOAT_WITHIN(1.0f, config.setpoint, temperature);
+
+    // The same heat-up through the fixed-point law
+    pid_batch_init(&batch, PID_PRESS_DT, config.setpoint, config.output_min, config.output_max);
+    TEST_ASSERT_EQUAL_INT(0, pid_batch_add_lane(&batch, &press_plant, config.kp, config.ki, config.kd));
+    pid_batch_run(&batch, PID_PRESS_STEPS);
+    TEST_ASSERT_TRUE(pid_batch_get_result(&batch, 0, &result));
+
+    TEST_ASSERT_TRUE(result.peak_temp < config.setpoint + PID_HEAT_UP_MAX_OVERSHOOT);
+    TEST_ASSERT_FLOAT_WITHIN(1.0f, config.setpoint, result.final_temp);
+}
+
+// Cycle cost per step of each PID implementation
+void test_pid_kernel_cycle_benchmark(void)
+{
+    pid_controller_t float_pid;
+    pid_fixed_t fixed_pid;
+    pid_fixed_state_t production_state = {0};
+    volatile float float_sink = 0.0f;
+    volatile q16_t fixed_sink = 0;
+    uint32_t start;
+    uint32_t float_cycles = 0;
+    uint32_t fixed_cycles = 0;
+    uint32_t production_cycles = 0;
+
+    pid_controller_init(&float_pid, bench_pid_config());
+    pid_fixed_init(&fixed_pid, bench_pid_config(), PID_BENCH_DT);
+
+    for (int i = 0; i < PID_BENCH_ITERATIONS; i++)
+    {
+        float temperature = 170.0f + (float)(i % 20);
+        q16_t temperature_q16 = Q16_FROM_FLOAT(temperature);
+
+        // Float path includes its timer read, as in production; an old
+        // timestamp gets it past the minimum-interval early return
+        float_pid.last_update_us = 0;
+        start = esp_cpu_get_cycle_count();
+        float_sink = pid_controller_update(&float_pid, temperature);
+        float_cycles += esp_cpu_get_cycle_count() - start;
+
+        start = esp_cpu_get_cycle_count();
+        fixed_sink = pid_fixed_update(&fixed_pid, temperature_q16);
+        fixed_cycles += esp_cpu_get_cycle_count() - start;
+
+        start = esp_cpu_get_cycle_count();
+        fixed_sink = pid_fixed_production_update(&production_state, Q16_FROM_FLOAT(180.0f), temperature_q16);
+        production_cycles += esp_cpu_get_cycle_count() - start;
+    }
+    (void)float_sink;
+    (void)fixed_sink;
+
+    ESP_LOGI("PERF", "PID step cycles: float=%lu, fixed=%lu, fixed (compile-time gains)=%lu",
+             (unsigned long)(float_cycles / PID_BENCH_ITERATIONS),
+             (unsigned long)(fixed_cycles / PID_BENCH_ITERATIONS),
+             (unsigned long)(production_cycles / PID_BENCH_ITERATIONS));
+
+    TEST_ASSERT_LESS_THAN(float_cycles, fixed_cycles);
+    TEST_ASSERT_LESS_THAN(float_cycles, production_cycles);
+}
+
+// Each batch lane must reproduce a scalar fixed-point PID on the same plant
+void test_pid_batch_matches_scalar(void)
+{
+    static pid_batch_t batch;
+    batch_plant_t plant = {
+        .heater_watts = 2200.0f,
+        .capacity = 2200.0f,
+        .loss_coefficient = 5.0f,
+        .ambient = 20.0f,
+        .dead_time = 0.0f,
+        .initial_temp = 25.0f};
+
+    pid_batch_init(&batch, 1.0f, 180.0f, 0.0f, 100.0f);
+    for (int lane = 0; lane < PID_BATCH_MAX_LANES; lane++)
+    {
+        plant.dead_time = (float)(lane % 20);
+        TEST_ASSERT_EQUAL_INT(lane, pid_batch_add_lane(&batch, &plant, 1.0f + lane * 0.25f, 0.02f, 2.0f));
+    }
+
+    start_performance_timer();
+    pid_batch_run(&batch, PID_BENCH_ITERATIONS);
+    TEST_ASSERT_TRUE(check_performance_time(MAX_RESPONSE_TIME_MS, "pid_batch_run"));
+
+    int lanes[] = {0, PID_BATCH_MAX_LANES / 2, PID_BATCH_MAX_LANES - 1};
+    for (int k = 0; k < (int)ARRAY_SIZE(lanes); k++)
+    {
+        int lane = lanes[k];
+        pid_config_t config = bench_pid_config();
+        config.kp = 1.0f + lane * 0.25f;
+        config.ki = 0.02f;
+        config.kd = 2.0f;
+
+        pid_fixed_t pid;
+        pid_fixed_init(&pid, config, 1.0f);
+
+        // Scalar reference with the same dead time
+        float history[PID_BATCH_MAX_DELAY_STEPS];
+        int delay = lane % 20;
+        float temperature = plant.initial_temp;
+        for (int i = 0; i < PID_BATCH_MAX_DELAY_STEPS; i++)
+        {
+            history[i] = temperature;
+        }
+
+        for (int step = 0; step < PID_BENCH_ITERATIONS; step++)
+        {
+            history[step % PID_BATCH_MAX_DELAY_STEPS] = temperature;
+            float measured = history[(step + PID_BATCH_MAX_DELAY_STEPS - delay) % PID_BATCH_MAX_DELAY_STEPS];
+            float output = q16_to_float(pid_fixed_update(&pid, Q16_FROM_FLOAT(measured)));
+            temperature = pid_batch_plant_step(temperature, output, plant.heater_watts, plant.loss_coefficient,
+                                               plant.ambient, 0.0f, plant.capacity, 1.0f);
+        }
+
+        batch_result_t result;
+        TEST_ASSERT_TRUE(pid_batch_get_result(&batch, lane, &result));
+        TEST_ASSERT_EQUAL_MEMORY(&temperature, &result.final_temp, sizeof(float));
+    }
+}
+
 // Benchmark report
 void test_performance_benchmark_report(void)
 {
@@ -0,0 +1,288 @@
+/**
+ * @file test_pid_adaptive.c
+ * @brief Unit tests for the between-press adaptive tuner
+ *
+ * This test suite validates the adaptive tuner. Tests cover:
+ * - A bounded trial step proposed after a baseline window
+ * - Rollback of a trial that scores worse, acceptance otherwise
+ * - The scale bound around the reference gains
+ * - The bound and audit log surviving a save and restore
+ * - Rejection of corrupt records and of gains outside the saved bounds
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#include <unity.h>
+#include <string.h>
+
+#include "pid_adaptive.h"
+
+// =============================================================================
+// Test Helpers
+// =============================================================================
+
+#define TEST_REF_KP 2.0f
+#define TEST_REF_KI 0.1f
+#define TEST_REF_KD 1.0f
+#define TEST_SETPOINT 180.0f
+#define TEST_CYCLE_STEPS 60
+
+static const pid_gains_t test_reference = {TEST_REF_KP, TEST_REF_KI, TEST_REF_KD};
+
+/**
+ * @brief Run one scored press
+ *
+ * The reading sags for 10 s when the cold platen closes, then rises above
+ * the setpoint for 10 s while recovering, then holds.
+ *
+ * @return true if the tuner changed the gains
+ */
+static bool press(pid_adaptive_t *ad, float sag, float overshoot, pid_gains_t *new_gains)
+{
+    pid_adaptive_begin_cycle(ad);
+    for (int i = 0; i < TEST_CYCLE_STEPS; i++)
+    {
+        float error = 0.0f;
+        if (i < 10)
+        {
+            error = -sag;
+        }
+        else if (i < 20)
+        {
+            error = overshoot;
+        }
+        pid_adaptive_sample(ad, TEST_SETPOINT, TEST_SETPOINT + error, 1.0f);
+    }
+    return pid_adaptive_end_cycle(ad, new_gains);
+}
+
+static void start(pid_adaptive_t *ad)
+{
+    memset(ad, 0, sizeof(pid_adaptive_t));
+    pid_adaptive_init(ad, test_reference);
+}
+
+// =============================================================================
+// Trial Tests
+// =============================================================================
+
+// A press that holds well leaves the gains alone
+void test_adaptive_no_change_when_tracking(void)
+{
+    pid_adaptive_t ad;
+    pid_gains_t gains;
+    start(&ad);
+
+    for (int i = 0; i < 3 * ADAPTIVE_WINDOW_CYCLES; i++)
+    {
+        TEST_ASSERT_FALSE(press(&ad, 2.0f, 0.5f, &gains));
+    }
+    TEST_ASSERT_EQUAL_FLOAT(TEST_REF_KP, ad.gains.kp);
+}
+
+// Deep sag over a baseline window proposes one bounded stiffening step
+void test_adaptive_stiffen_trial(void)
+{
+    pid_adaptive_t ad;
+    pid_gains_t gains;
+    start(&ad);
+
+    TEST_ASSERT_FALSE(press(&ad, 10.0f, 0.0f, &gains));
+    TEST_ASSERT_FALSE(press(&ad, 10.0f, 0.0f, &gains));
+    TEST_ASSERT_TRUE(press(&ad, 10.0f, 0.0f, &gains));
+
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, TEST_REF_KP * (1.0f + ADAPTIVE_STEP), gains.kp);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, TEST_REF_KI * (1.0f + ADAPTIVE_STEP), gains.ki);
+    TEST_ASSERT_EQUAL_FLOAT(TEST_REF_KD, gains.kd);
+    TEST_ASSERT_TRUE(ad.trial_active);
+
+    const adaptive_audit_entry_t *entry = pid_adaptive_get_audit(&ad, 0);
+    TEST_ASSERT_NOT_NULL(entry);
+    TEST_ASSERT_EQUAL(ADAPTIVE_CHANGE_STIFFEN, entry->change);
+    TEST_ASSERT_EQUAL_FLOAT(TEST_REF_KP, entry->from.kp);
+}
+
+// Overshoot proposes less gain
+void test_adaptive_detune_trial(void)
+{
+    pid_adaptive_t ad;
+    pid_gains_t gains;
+    start(&ad);
+
+    for (int i = 0; i < ADAPTIVE_WINDOW_CYCLES - 1; i++)
+    {
+        TEST_ASSERT_FALSE(press(&ad, 0.0f, 5.0f, &gains));
+    }
+    TEST_ASSERT_TRUE(press(&ad, 0.0f, 5.0f, &gains));
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, TEST_REF_KP * (1.0f - ADAPTIVE_STEP), gains.kp);
+    TEST_ASSERT_EQUAL(ADAPTIVE_CHANGE_DETUNE, pid_adaptive_get_audit(&ad, 0)->change);
+}
+
+// A trial that scores worse than the margin allows is rolled back
+void test_adaptive_rollback(void)
+{
+    pid_adaptive_t ad;
+    pid_gains_t gains;
+    start(&ad);
+
+    for (int i = 0; i < ADAPTIVE_WINDOW_CYCLES; i++)
+    {
+        press(&ad, 10.0f, 0.0f, &gains);
+    }
+    TEST_ASSERT_TRUE(ad.trial_active);
+
+    TEST_ASSERT_FALSE(press(&ad, 20.0f, 0.0f, &gains));
+    TEST_ASSERT_FALSE(press(&ad, 20.0f, 0.0f, &gains));
+    TEST_ASSERT_TRUE(press(&ad, 20.0f, 0.0f, &gains));
+
+    TEST_ASSERT_EQUAL_FLOAT(TEST_REF_KP, gains.kp);
+    TEST_ASSERT_EQUAL_FLOAT(TEST_REF_KI, gains.ki);
+    TEST_ASSERT_FALSE(ad.trial_active);
+    TEST_ASSERT_EQUAL(ADAPTIVE_CHANGE_ROLLBACK, pid_adaptive_get_audit(&ad, 0)->change);
+}
+
+// A trial that scores no worse is kept as the new baseline
+void test_adaptive_accept(void)
+{
+    pid_adaptive_t ad;
+    pid_gains_t gains;
+    start(&ad);
+
+    for (int i = 0; i < ADAPTIVE_WINDOW_CYCLES; i++)
+    {
+        press(&ad, 10.0f, 0.0f, &gains);
+    }
+    pid_gains_t trial = ad.gains;
+
+    for (int i = 0; i < ADAPTIVE_WINDOW_CYCLES; i++)
+    {
+        TEST_ASSERT_FALSE(press(&ad, 9.0f, 0.0f, &gains));
+    }
+    TEST_ASSERT_EQUAL_FLOAT(trial.kp, ad.gains.kp);
+    TEST_ASSERT_EQUAL_FLOAT(trial.kp, ad.baseline.kp);
+    TEST_ASSERT_EQUAL(ADAPTIVE_CHANGE_ACCEPT, pid_adaptive_get_audit(&ad, 0)->change);
+}
+
+// =============================================================================
+// Bound Tests
+// =============================================================================
+
+/**
+ * @brief Keep pressing with a deep sag, checking the bound every press
+ */
+static void stiffen_repeatedly(pid_adaptive_t *ad, int presses)
+{
+    pid_gains_t gains;
+
+    for (int i = 0; i < presses; i++)
+    {
+        press(ad, 10.0f, 0.0f, &gains);
+        TEST_ASSERT_TRUE(ad->gains.kp <= TEST_REF_KP * ADAPTIVE_MAX_SCALE);
+        TEST_ASSERT_TRUE(ad->gains.ki <= TEST_REF_KI * ADAPTIVE_MAX_SCALE);
+    }
+}
+
+// Gains stop at the scale bound and stay there
+void test_adaptive_bound(void)
+{
+    pid_adaptive_t ad;
+    start(&ad);
+
+    stiffen_repeatedly(&ad, 120);
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, TEST_REF_KP * ADAPTIVE_MAX_SCALE, ad.gains.kp);
+    TEST_ASSERT_EQUAL_FLOAT(TEST_REF_KD, ad.gains.kd);
+    TEST_ASSERT_EQUAL_FLOAT(TEST_REF_KP, ad.reference.kp);
+}
+
+// The reference, and with it the bound, survives a save and restore
+void test_adaptive_bound_survives_restore(void)
+{
+    pid_adaptive_t ad;
+    adaptive_record_t record;
+    start(&ad);
+
+    stiffen_repeatedly(&ad, 30);
+    TEST_ASSERT_TRUE(ad.gains.kp > TEST_REF_KP);
+    uint8_t audit_count = ad.audit_count;
+    pid_adaptive_export(&ad, &record);
+
+    // Reboot: the controller runs the adapted gains saved with the settings
+    pid_adaptive_t restored;
+    memset(&restored, 0, sizeof(restored));
+    TEST_ASSERT_TRUE(pid_adaptive_restore(&restored, &record, record.gains));
+    TEST_ASSERT_EQUAL_FLOAT(TEST_REF_KP, restored.reference.kp);
+    TEST_ASSERT_EQUAL_FLOAT(record.gains.kp, restored.gains.kp);
+    TEST_ASSERT_EQUAL(audit_count, restored.audit_count);
+    TEST_ASSERT_EQUAL(pid_adaptive_get_audit(&ad, 0)->cycle, pid_adaptive_get_audit(&restored, 0)->cycle);
+    TEST_ASSERT_EQUAL(pid_adaptive_get_audit(&ad, 0)->change, pid_adaptive_get_audit(&restored, 0)->change);
+
+    stiffen_repeatedly(&restored, 120);
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, TEST_REF_KP * ADAPTIVE_MAX_SCALE, restored.gains.kp);
+}
+
+// A save cut short leaves older gains running: they become the baseline
+void test_adaptive_restore_takes_running_gains(void)
+{
+    pid_adaptive_t ad;
+    adaptive_record_t record;
+    pid_gains_t gains;
+    start(&ad);
+
+    for (int i = 0; i < ADAPTIVE_WINDOW_CYCLES; i++)
+    {
+        press(&ad, 10.0f, 0.0f, &gains);
+    }
+    TEST_ASSERT_TRUE(ad.trial_active);
+    pid_adaptive_export(&ad, &record);
+
+    pid_adaptive_t restored;
+    memset(&restored, 0, sizeof(restored));
+    TEST_ASSERT_TRUE(pid_adaptive_restore(&restored, &record, test_reference));
+    TEST_ASSERT_FALSE(restored.trial_active);
+    TEST_ASSERT_EQUAL_FLOAT(TEST_REF_KP, restored.gains.kp);
+    TEST_ASSERT_EQUAL_FLOAT(TEST_REF_KP, restored.baseline.kp);
+}
+
+// Gains outside the saved bounds, or a corrupt record, mean re-anchoring
+void test_adaptive_restore_rejects(void)
+{
+    pid_adaptive_t ad;
+    adaptive_record_t record;
+    start(&ad);
+    pid_adaptive_export(&ad, &record);
+
+    pid_adaptive_t restored;
+    memset(&restored, 0, sizeof(restored));
+    pid_gains_t edited = {TEST_REF_KP * 3.0f, TEST_REF_KI, TEST_REF_KD};
+    TEST_ASSERT_FALSE(pid_adaptive_restore(&restored, &record, edited));
+
+    adaptive_record_t corrupt = record;
+    corrupt.audit_count = ADAPTIVE_AUDIT_SIZE + 1;
+    TEST_ASSERT_FALSE(pid_adaptive_restore(&restored, &corrupt, test_reference));
+
+    corrupt = record;
+    corrupt.gains.kp = TEST_REF_KP * 5.0f;
+    TEST_ASSERT_FALSE(pid_adaptive_restore(&restored, &corrupt, corrupt.gains));
+
+    corrupt = record;
+    corrupt.audit[0].change = ADAPTIVE_CHANGE_COUNT;
+    TEST_ASSERT_FALSE(pid_adaptive_restore(&restored, &corrupt, test_reference));
+}
+
+// Re-anchoring keeps the audit log and records the new reference
+void test_adaptive_anchor_logged(void)
+{
+    pid_adaptive_t ad;
+    start(&ad);
+
+    pid_gains_t tuned = {3.0f, 0.2f, 0.5f};
+    pid_adaptive_init(&ad, tuned);
+
+    TEST_ASSERT_EQUAL(2, ad.audit_count);
+    const adaptive_audit_entry_t *entry = pid_adaptive_get_audit(&ad, 0);
+    TEST_ASSERT_EQUAL(ADAPTIVE_CHANGE_ANCHOR, entry->change);
+    TEST_ASSERT_EQUAL_FLOAT(TEST_REF_KP, entry->from.kp);
+    TEST_ASSERT_EQUAL_FLOAT(3.0f, entry->to.kp);
+    TEST_ASSERT_EQUAL_FLOAT(3.0f, ad.reference.kp);
+}
@@ -0,0 +1,142 @@
+/**
+ * @file test_pid_autotune.c
+ * @brief Unit tests for the relay auto-tuner
+ *
+ * This test suite validates the ultimate gain correction for an
+ * asymmetric relay. Recorded cycles are loaded into the context and the
+ * calculation step is run, so the tests do not wait on the wall clock.
+ * Tests cover:
+ * - Balanced relay without hysteresis gives 4d / (pi * a)
+ * - Duty away from 50% scales Ku by sin(pi * D)
+ * - Hysteresis reduces the effective amplitude to sqrt(a^2 - e^2)
+ * - Gains and result fields follow the corrected Ku
+ * - Relay switching around the noise band
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#include <unity.h>
+#include <math.h>
+
+#include "pid_autotune.h"
+
+// =============================================================================
+// Test Helpers
+// =============================================================================
+
+#define AUTOTUNE_TEST_SETPOINT 160.0f
+#define AUTOTUNE_TEST_RELAY 30.0f      ///< Relay half-swing d (%)
+#define AUTOTUNE_TEST_AMPLITUDE 5.0f   ///< Half peak-to-peak (°C)
+#define AUTOTUNE_TEST_PERIOD 120.0f    ///< Cycle period (s)
+
+/**
+ * @brief Run the calculation on two identical recorded cycles
+ *
+ * @return Auto-tune result (ultimate_gain 0 if the run failed)
+ */
+static autotune_result_t calculate(float duty, float noise_band, tuning_rule_t rule)
+{
+    autotune_context_t ctx;
+    autotune_result_t result = {0};
+    autotune_config_t config = pid_autotune_default_config(AUTOTUNE_TEST_SETPOINT);
+    config.noise_band = noise_band;
+
+    pid_autotune_init(&ctx, config, rule);
+    pid_autotune_start(&ctx);
+
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        ctx.cycle_amplitude[i] = AUTOTUNE_TEST_AMPLITUDE;
+        ctx.cycle_period[i] = AUTOTUNE_TEST_PERIOD;
+        ctx.cycle_duty[i] = duty;
+        ctx.cycle_relay[i] = AUTOTUNE_TEST_RELAY;
+    }
+    ctx.cycle_count = 2;
+    ctx.relay_bias = 42.0f;
+    ctx.state = AUTOTUNE_STATE_CALCULATING;
+
+    pid_autotune_update(&ctx, AUTOTUNE_TEST_SETPOINT);
+    pid_autotune_get_result(&ctx, &result);
+    return result;
+}
+
+// =============================================================================
+// Ultimate Gain Tests
+// =============================================================================
+
+// A balanced relay without hysteresis gives the textbook 4d / (pi * a)
+void test_autotune_ku_balanced(void)
+{
+    autotune_result_t result = calculate(0.5f, 0.0f, TUNING_RULE_ZIEGLER_NICHOLS_CLASSIC);
+
+    float expected = 4.0f * AUTOTUNE_TEST_RELAY / ((float)M_PI * AUTOTUNE_TEST_AMPLITUDE);
+    TEST_ASSERT_FLOAT_WITHIN(expected * 0.001f, expected, result.ultimate_gain);
+    TEST_ASSERT_EQUAL_FLOAT(AUTOTUNE_TEST_PERIOD, result.ultimate_period);
+}
+
+// An unbalanced relay puts less power into the fundamental
+void test_autotune_ku_asymmetric(void)
+{
+    autotune_result_t balanced = calculate(0.5f, 0.0f, TUNING_RULE_ZIEGLER_NICHOLS_CLASSIC);
+    autotune_result_t high = calculate(0.3f, 0.0f, TUNING_RULE_ZIEGLER_NICHOLS_CLASSIC);
+    autotune_result_t low = calculate(0.7f, 0.0f, TUNING_RULE_ZIEGLER_NICHOLS_CLASSIC);
+
+    float scale = sinf((float)M_PI * 0.3f);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, balanced.ultimate_gain * scale, high.ultimate_gain);
+
+    // Only how far the duty is from 50% matters, not which side
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, high.ultimate_gain, low.ultimate_gain);
+}
+
+// The noise band hysteresis is taken out of the measured amplitude
+void test_autotune_ku_hysteresis(void)
+{
+    // 3-4-5 triangle: effective amplitude sqrt(5^2 - 3^2) = 4
+    autotune_result_t result = calculate(0.5f, 3.0f, TUNING_RULE_ZIEGLER_NICHOLS_CLASSIC);
+
+    float expected = 4.0f * AUTOTUNE_TEST_RELAY / ((float)M_PI * 4.0f);
+    TEST_ASSERT_FLOAT_WITHIN(expected * 0.001f, expected, result.ultimate_gain);
+}
+
+// Gains come from the corrected Ku and the balanced bias is reported
+void test_autotune_gains_from_corrected_ku(void)
+{
+    autotune_result_t result = calculate(0.35f, 0.5f, TUNING_RULE_TYREUS_LUYBEN);
+    float kp, ki, kd;
+
+    TEST_ASSERT_TRUE(result.ultimate_gain > 0.0f);
+    pid_autotune_rule_gains(TUNING_RULE_TYREUS_LUYBEN, result.ultimate_gain, result.ultimate_period,
+                            &kp, &ki, &kd);
+    TEST_ASSERT_EQUAL_FLOAT(kp, result.kp);
+    TEST_ASSERT_EQUAL_FLOAT(ki, result.ki);
+    TEST_ASSERT_EQUAL_FLOAT(kd, result.kd);
+    TEST_ASSERT_EQUAL_FLOAT(42.0f, result.relay_bias);
+    TEST_ASSERT_EQUAL(2, result.cycles_observed);
+}
+
+// =============================================================================
+// Relay Tests
+// =============================================================================
+
+// The relay only switches once the input leaves the noise band
+void test_autotune_relay_switching(void)
+{
+    autotune_context_t ctx;
+    autotune_config_t config = pid_autotune_default_config(AUTOTUNE_TEST_SETPOINT);
+    pid_autotune_init(&ctx, config, TUNING_RULE_TYREUS_LUYBEN);
+    TEST_ASSERT_TRUE(pid_autotune_start(&ctx));
+    TEST_ASSERT_FALSE(pid_autotune_start(&ctx));
+
+    float high = config.initial_output + config.output_step;
+    float low = fmaxf(config.initial_output - config.output_step, 0.0f);
+
+    TEST_ASSERT_EQUAL_FLOAT(high, pid_autotune_update(&ctx, AUTOTUNE_TEST_SETPOINT));
+    TEST_ASSERT_EQUAL_FLOAT(high, pid_autotune_update(&ctx, AUTOTUNE_TEST_SETPOINT + config.noise_band));
+    TEST_ASSERT_EQUAL_FLOAT(low, pid_autotune_update(&ctx, AUTOTUNE_TEST_SETPOINT + config.noise_band + 0.1f));
+    TEST_ASSERT_EQUAL_FLOAT(low, pid_autotune_update(&ctx, AUTOTUNE_TEST_SETPOINT - config.noise_band));
+    TEST_ASSERT_EQUAL_FLOAT(high, pid_autotune_update(&ctx, AUTOTUNE_TEST_SETPOINT - config.noise_band - 0.1f));
+
+    pid_autotune_cancel(&ctx);
+    TEST_ASSERT_EQUAL(AUTOTUNE_STATE_IDLE, pid_autotune_get_state(&ctx));
+}
@@ -0,0 +1,199 @@
+/**
+ * @file test_pid_cascade.c
+ * @brief Unit tests for cascade (heater core / platen surface) control
+ *
+ * This test suite closes the cascade around a two-node press plant: the
+ * heater element drives a small core mass that conducts into the platen,
+ * which loses heat to ambient and to any garment. The node parameters
+ * match the cascade core model (CASCADE_CORE_GAIN at full power,
+ * CASCADE_CORE_TIME_CONSTANT lag) and the rated press. Tests cover:
+ * - Core estimate settling to surface + gain * power
+ * - Measured core temperature overriding the estimate for one step
+ * - Heat-up tracking with bounded overshoot and core excess
+ * - Recovery from a garment load at temperature
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#include <unity.h>
+#include <math.h>
+
+#include "pid_cascade.h"
+#include "system_config.h"
+#include "esp_timer.h"
+
+// =============================================================================
+// Test Helpers
+// =============================================================================
+
+#define CASCADE_TEST_HEATER_WATTS 2200.0f
+#define CASCADE_TEST_CAPACITY 4400.0f
+#define CASCADE_TEST_LOSS 8.0f
+#define CASCADE_TEST_AMBIENT 25.0f
+#define CASCADE_TEST_DT 1.0f
+#define CASCADE_TEST_SETPOINT 160.0f
+#define CASCADE_TEST_MAX_OVERSHOOT 5.0f
+
+/**
+ * @brief Two-node press plant (heater core and platen face)
+ */
+typedef struct
+{
+    float core;         ///< Element temperature (°C)
+    float surface;      ///< Platen face temperature (°C)
+    float conductance;  ///< Core to face (W/°C)
+    float core_capacity;
+    float surface_capacity;
+} press_plant_t;
+
+static void plant_init(press_plant_t *plant, float temperature)
+{
+    plant->core = temperature;
+    plant->surface = temperature;
+    // Full power holds the core CASCADE_CORE_GAIN above the face, and the
+    // core settles with CASCADE_CORE_TIME_CONSTANT
+    plant->conductance = CASCADE_TEST_HEATER_WATTS / CASCADE_CORE_GAIN;
+    plant->core_capacity = plant->conductance * CASCADE_CORE_TIME_CONSTANT;
+    plant->surface_capacity = CASCADE_TEST_CAPACITY - plant->core_capacity;
+}
+
+static void plant_step(press_plant_t *plant, float power, float load_watts)
+{
+    float flow = plant->conductance * (plant->core - plant->surface);
+    float heating = (power / 100.0f) * CASCADE_TEST_HEATER_WATTS;
+    float loss = CASCADE_TEST_LOSS * (plant->surface - CASCADE_TEST_AMBIENT);
+
+    plant->core += (heating - flow) * CASCADE_TEST_DT / plant->core_capacity;
+    plant->surface += (flow - loss - load_watts) * CASCADE_TEST_DT / plant->surface_capacity;
+}
+
+static void cascade_init(pid_cascade_t *cascade)
+{
+    pid_config_t outer = {
+        .kp = PID_DEFAULT_KP,
+        .ki = PID_DEFAULT_KI,
+        .kd = PID_DEFAULT_KD,
+        .setpoint = CASCADE_TEST_SETPOINT};
+    pid_config_t inner = {.kp = 2.0f, .ki = 0.1f, .kd = 0.0f};
+    pid_cascade_init(cascade, outer, inner);
+}
+
+/**
+ * @brief One control step, as the temperature control task runs it
+ *
+ * @return Heater power applied during the step (%)
+ */
+static float control_step(pid_cascade_t *cascade, press_plant_t *plant, float load_watts)
+{
+    uint64_t step_us = (uint64_t)(CASCADE_TEST_DT * 1000000.0f);
+    cascade->outer.last_update_us = esp_timer_get_time() - step_us;
+    cascade->inner.last_update_us = esp_timer_get_time() - step_us;
+
+    float power = pid_cascade_update(cascade, plant->surface);
+    plant_step(plant, power, load_watts);
+    pid_cascade_track(cascade, plant->surface, power, CASCADE_TEST_DT);
+    return power;
+}
+
+// =============================================================================
+// Core Model Tests
+// =============================================================================
+
+// Constant power settles the estimate at surface + gain * power
+void test_cascade_core_estimate(void)
+{
+    pid_cascade_t cascade;
+    cascade_init(&cascade);
+
+    pid_cascade_track(&cascade, 100.0f, 0.0f, CASCADE_TEST_DT);
+    TEST_ASSERT_EQUAL_FLOAT(100.0f, pid_cascade_get_core_temp(&cascade));
+
+    for (int i = 0; i < (int)(10.0f * CASCADE_CORE_TIME_CONSTANT); i++)
+    {
+        pid_cascade_track(&cascade, 100.0f, 50.0f, CASCADE_TEST_DT);
+    }
+    TEST_ASSERT_FLOAT_WITHIN(0.1f, 100.0f + 0.5f * CASCADE_CORE_GAIN,
+                             pid_cascade_get_core_temp(&cascade));
+
+    // Heater off: the core falls back to the face
+    for (int i = 0; i < (int)(10.0f * CASCADE_CORE_TIME_CONSTANT); i++)
+    {
+        pid_cascade_track(&cascade, 100.0f, 0.0f, CASCADE_TEST_DT);
+    }
+    TEST_ASSERT_FLOAT_WITHIN(0.1f, 100.0f, pid_cascade_get_core_temp(&cascade));
+}
+
+// A measured core reading replaces the estimate for that step
+void test_cascade_core_measurement(void)
+{
+    pid_cascade_t cascade;
+    cascade_init(&cascade);
+    pid_cascade_track(&cascade, 100.0f, 0.0f, CASCADE_TEST_DT);
+
+    pid_cascade_set_core_measurement(&cascade, 150.0f);
+    pid_cascade_track(&cascade, 100.0f, 0.0f, CASCADE_TEST_DT);
+    TEST_ASSERT_EQUAL_FLOAT(150.0f, pid_cascade_get_core_temp(&cascade));
+
+    // Without a new reading the model takes over again
+    pid_cascade_track(&cascade, 100.0f, 0.0f, CASCADE_TEST_DT);
+    TEST_ASSERT_TRUE(pid_cascade_get_core_temp(&cascade) < 150.0f);
+}
+
+// =============================================================================
+// Closed-Loop Tests
+// =============================================================================
+
+// Cold heat-up reaches the setpoint without running the core away
+void test_cascade_heat_up_tracking(void)
+{
+    pid_cascade_t cascade;
+    press_plant_t plant;
+    cascade_init(&cascade);
+    plant_init(&plant, CASCADE_TEST_AMBIENT);
+
+    float peak = 0.0f;
+    float worst_excess = 0.0f;
+    for (int i = 0; i < 1800; i++)
+    {
+        control_step(&cascade, &plant, 0.0f);
+        peak = fmaxf(peak, plant.surface);
+        worst_excess = fmaxf(worst_excess, pid_cascade_get_core_setpoint(&cascade) - CASCADE_TEST_SETPOINT);
+    }
+
+    TEST_ASSERT_TRUE(peak < CASCADE_TEST_SETPOINT + CASCADE_TEST_MAX_OVERSHOOT);
+    TEST_ASSERT_TRUE(worst_excess <= CASCADE_MAX_CORE_EXCESS + 0.001f);
+    TEST_ASSERT_FLOAT_WITHIN(1.0f, CASCADE_TEST_SETPOINT, plant.surface);
+}
+
+// A garment's draw is made up and the face recovers to the setpoint
+void test_cascade_load_recovery(void)
+{
+    pid_cascade_t cascade;
+    press_plant_t plant;
+    cascade_init(&cascade);
+    plant_init(&plant, CASCADE_TEST_AMBIENT);
+
+    for (int i = 0; i < 1800; i++)
+    {
+        control_step(&cascade, &plant, 0.0f);
+    }
+    float hold_power = control_step(&cascade, &plant, 0.0f);
+
+    // 15 s press drawing 800 W from the platen
+    float dip = CASCADE_TEST_SETPOINT;
+    float press_power = 0.0f;
+    for (int i = 0; i < 15; i++)
+    {
+        press_power = control_step(&cascade, &plant, 800.0f);
+        dip = fminf(dip, plant.surface);
+    }
+    TEST_ASSERT_TRUE(press_power > hold_power);
+    TEST_ASSERT_TRUE(dip < CASCADE_TEST_SETPOINT);
+
+    for (int i = 0; i < 600; i++)
+    {
+        control_step(&cascade, &plant, 0.0f);
+    }
+    TEST_ASSERT_FLOAT_WITHIN(1.0f, CASCADE_TEST_SETPOINT, plant.surface);
+}
@@ -0,0 +1,181 @@
+/**
+ * @file test_pid_rule_select.c
+ * @brief Unit tests for tuning rule selection by simulation
+ *
+ * This test suite validates the model fit and the rule ranking. Relay
+ * results are generated from a known FOPDT press model. Tests cover:
+ * - Ku/Tu fitted back to the dead time and time constant
+ * - Fallback to the configured model when no FOPDT fits
+ * - Ranking order, scores and gains of every rule
+ * - The chosen rule not beaten on every criterion by another
+ * - Repeated selections ranking the same way
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#include <unity.h>
+#include <math.h>
+#include <stddef.h>
+
+#include "pid_rule_select.h"
+#include "system_config.h"
+
+// =============================================================================
+// Test Helpers
+// =============================================================================
+
+#define RULE_TEST_GAIN 2.0f             ///< Steady rise per % power (°C/%)
+#define RULE_TEST_TIME_CONSTANT 400.0f  ///< Platen lag (s)
+#define RULE_TEST_DEAD_TIME 20.0f       ///< Element to thermocouple delay (s)
+#define RULE_TEST_SETPOINT 160.0f
+
+/**
+ * @brief Relay test result an FOPDT plant would give
+ *
+ * Solves atan(w*tau) + w*L = pi for the crossover frequency by bisection.
+ */
+static void fopdt_ultimate(float gain, float tau, float dead_time, float *ku, float *tu)
+{
+    float lo = 1e-5f;
+    float hi = (float)M_PI / dead_time;
+    for (int i = 0; i < 60; i++)
+    {
+        float w = 0.5f * (lo + hi);
+        if (atanf(w * tau) + w * dead_time < (float)M_PI)
+        {
+            lo = w;
+        }
+        else
+        {
+            hi = w;
+        }
+    }
+    float wu = 0.5f * (lo + hi);
+    *ku = sqrtf(1.0f + (wu * tau) * (wu * tau)) / gain;
+    *tu = 2.0f * (float)M_PI / wu;
+}
+
+static const rule_score_t *find_rule(const rule_ranking_t *ranking, tuning_rule_t rule)
+{
+    for (uint8_t i = 0; i < ranking->count; i++)
+    {
+        if (ranking->entries[i].rule == rule)
+        {
+            return &ranking->entries[i];
+        }
+    }
+    return NULL;
+}
+
+// =============================================================================
+// Model Fit Tests
+// =============================================================================
+
+// Ku and Tu from a known plant fit back to that plant
+void test_rule_fit_model_round_trip(void)
+{
+    float ku, tu;
+    fopdt_model_t model;
+    fopdt_ultimate(RULE_TEST_GAIN, RULE_TEST_TIME_CONSTANT, RULE_TEST_DEAD_TIME, &ku, &tu);
+
+    TEST_ASSERT_TRUE(pid_rule_fit_model(ku, tu, RULE_TEST_GAIN, &model));
+    TEST_ASSERT_EQUAL_FLOAT(RULE_TEST_GAIN, model.gain);
+    TEST_ASSERT_FLOAT_WITHIN(RULE_TEST_TIME_CONSTANT * 0.01f, RULE_TEST_TIME_CONSTANT, model.time_constant);
+    TEST_ASSERT_FLOAT_WITHIN(0.5f, RULE_TEST_DEAD_TIME, model.dead_time);
+}
+
+// A loop gain of one or less cannot come from an FOPDT plant
+void test_rule_fit_model_fallback(void)
+{
+    fopdt_model_t model;
+
+    TEST_ASSERT_FALSE(pid_rule_fit_model(0.4f, 80.0f, RULE_TEST_GAIN, &model));
+    TEST_ASSERT_EQUAL_FLOAT(SMITH_MODEL_GAIN, model.gain);
+    TEST_ASSERT_EQUAL_FLOAT(SMITH_TIME_CONSTANT, model.time_constant);
+    TEST_ASSERT_EQUAL_FLOAT(SMITH_DEAD_TIME, model.dead_time);
+
+    TEST_ASSERT_FALSE(pid_rule_fit_model(5.0f, 0.0f, RULE_TEST_GAIN, &model));
+    TEST_ASSERT_FALSE(pid_rule_fit_model(5.0f, 80.0f, RULE_TEST_GAIN, NULL));
+}
+
+// =============================================================================
+// Ranking Tests
+// =============================================================================
+
+// Every rule is ranked once, best first, with its own gains and score
+void test_rule_select_ranking(void)
+{
+    float ku, tu;
+    rule_ranking_t ranking;
+    fopdt_ultimate(SMITH_MODEL_GAIN, RULE_TEST_TIME_CONSTANT, RULE_TEST_DEAD_TIME, &ku, &tu);
+
+    TEST_ASSERT_TRUE(pid_rule_select(ku, tu, RULE_TEST_SETPOINT, &ranking));
+    TEST_ASSERT_EQUAL(TUNING_RULE_COUNT, ranking.count);
+
+    for (int rule = 0; rule < TUNING_RULE_COUNT; rule++)
+    {
+        const rule_score_t *entry = find_rule(&ranking, (tuning_rule_t)rule);
+        TEST_ASSERT_NOT_NULL(entry);
+
+        float kp, ki, kd;
+        pid_autotune_rule_gains((tuning_rule_t)rule, ku, tu, &kp, &ki, &kd);
+        TEST_ASSERT_EQUAL_FLOAT(kp, entry->kp);
+        TEST_ASSERT_EQUAL_FLOAT(ki, entry->ki);
+        TEST_ASSERT_EQUAL_FLOAT(kd, entry->kd);
+
+        TEST_ASSERT_TRUE(entry->overshoot >= 0.0f);
+        TEST_ASSERT_TRUE(entry->settle_time > 0.0f);
+        TEST_ASSERT_TRUE(entry->recovery_iae > 0.0f);
+    }
+
+    for (uint8_t i = 1; i < ranking.count; i++)
+    {
+        TEST_ASSERT_TRUE(ranking.entries[i - 1].score <= ranking.entries[i].score);
+    }
+}
+
+// No rule beats the chosen one on overshoot, settling and recovery at once
+void test_rule_select_best_not_dominated(void)
+{
+    float ku, tu;
+    rule_ranking_t ranking;
+    fopdt_ultimate(SMITH_MODEL_GAIN, RULE_TEST_TIME_CONSTANT, RULE_TEST_DEAD_TIME, &ku, &tu);
+    TEST_ASSERT_TRUE(pid_rule_select(ku, tu, RULE_TEST_SETPOINT, &ranking));
+
+    const rule_score_t *best = &ranking.entries[0];
+    for (uint8_t i = 1; i < ranking.count; i++)
+    {
+        const rule_score_t *other = &ranking.entries[i];
+        bool dominates = other->overshoot <= best->overshoot &&
+                         other->settle_time <= best->settle_time &&
+                         other->recovery_iae <= best->recovery_iae;
+        TEST_ASSERT_FALSE(dominates);
+    }
+}
+
+// The scratch simulation starts clean: a second run ranks the same way
+void test_rule_select_repeatable(void)
+{
+    float ku, tu;
+    rule_ranking_t first, second;
+    fopdt_ultimate(SMITH_MODEL_GAIN, RULE_TEST_TIME_CONSTANT, RULE_TEST_DEAD_TIME, &ku, &tu);
+
+    TEST_ASSERT_TRUE(pid_rule_select(ku, tu, RULE_TEST_SETPOINT, &first));
+    TEST_ASSERT_TRUE(pid_rule_select(ku, tu, RULE_TEST_SETPOINT, &second));
+    for (uint8_t i = 0; i < first.count; i++)
+    {
+        TEST_ASSERT_EQUAL(first.entries[i].rule, second.entries[i].rule);
+        TEST_ASSERT_EQUAL_FLOAT(first.entries[i].score, second.entries[i].score);
+    }
+}
+
+// A relay test that failed produces no ranking
+void test_rule_select_invalid(void)
+{
+    rule_ranking_t ranking;
+
+    TEST_ASSERT_FALSE(pid_rule_select(0.0f, 80.0f, RULE_TEST_SETPOINT, &ranking));
+    TEST_ASSERT_FALSE(pid_rule_select(5.0f, 0.0f, RULE_TEST_SETPOINT, &ranking));
+    TEST_ASSERT_FALSE(pid_rule_select(5.0f, 80.0f, RULE_TEST_SETPOINT, NULL));
+}
@@ -0,0 +1,247 @@
+/**
+ * @file test_pid_smith.c
+ * @brief Unit tests for the Smith predictor
+ *
+ * This test suite runs the predictor against the rated press plant (see
+ * pid_batch_plant_step()) behind a thermocouple dead time, stepped in
+ * the same order as the temperature control task. Tests cover:
+ * - Prediction of the undelayed temperature with a matching model
+ * - Tighter setpoint tracking than plain PID on the same gains
+ * - Fallback to plain feedback on a wrong model
+ * - Dead time and time constant from a cold full-power heat-up
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#include <unity.h>
+#include <math.h>
+#include <stddef.h>
+
+#include "pid_smith.h"
+#include "pid_controller.h"
+#include "pid_batch.h"
+#include "esp_timer.h"
+
+// =============================================================================
+// Test Helpers
+// =============================================================================
+
+#define SMITH_TEST_HEATER_WATTS 2200.0f
+#define SMITH_TEST_CAPACITY 4400.0f
+#define SMITH_TEST_LOSS 8.0f
+#define SMITH_TEST_AMBIENT 25.0f
+#define SMITH_TEST_DEAD_STEPS 20
+#define SMITH_TEST_DT 1.0f
+#define SMITH_TEST_SETPOINT 160.0f
+
+/**
+ * @brief Press plant with the reading delayed by the dead time
+ */
+typedef struct
+{
+    float temperature;
+    float history[SMITH_TEST_DEAD_STEPS];
+    int head;
+} delayed_plant_t;
+
+static void plant_init(delayed_plant_t *plant, float temperature)
+{
+    plant->temperature = temperature;
+    plant->head = 0;
+    for (int i = 0; i < SMITH_TEST_DEAD_STEPS; i++)
+    {
+        plant->history[i] = temperature;
+    }
+}
+
+/**
+ * @brief Advance the plant one step
+ *
+ * @return Thermocouple reading at the end of the step (°C)
+ */
+static float plant_step(delayed_plant_t *plant, float power)
+{
+    plant->temperature = pid_batch_plant_step(plant->temperature, power, SMITH_TEST_HEATER_WATTS,
+                                              SMITH_TEST_LOSS, SMITH_TEST_AMBIENT, 0.0f,
+                                              SMITH_TEST_CAPACITY, SMITH_TEST_DT);
+    float reading = plant->history[plant->head];
+    plant->history[plant->head] = plant->temperature;
+    plant->head = (plant->head + 1) % SMITH_TEST_DEAD_STEPS;
+    return reading;
+}
+
+/**
+ * @brief FOPDT model of the rated plant
+ */
+static fopdt_model_t plant_model(void)
+{
+    fopdt_model_t model = {
+        .gain = SMITH_TEST_HEATER_WATTS / SMITH_TEST_LOSS / 100.0f,
+        .time_constant = SMITH_TEST_CAPACITY / SMITH_TEST_LOSS,
+        .dead_time = SMITH_TEST_DEAD_STEPS * SMITH_TEST_DT};
+    return model;
+}
+
+/**
+ * @brief Heat-up figures
+ */
+typedef struct
+{
+    float peak;          ///< Highest plant temperature (°C)
+    float settled_error; ///< Largest |setpoint - temperature| over the last 600 s (°C)
+} heat_up_result_t;
+
+/**
+ * @brief Heat up from cold under PID, with or without the predictor
+ */
+static heat_up_result_t run_heat_up(pid_smith_t *smith, float kp, float ki, float kd, int steps)
+{
+    pid_controller_t pid;
+    delayed_plant_t plant;
+    pid_config_t config = {
+        .kp = kp,
+        .ki = ki,
+        .kd = kd,
+        .setpoint = SMITH_TEST_SETPOINT,
+        .output_min = 0.0f,
+        .output_max = 100.0f};
+    pid_controller_init(&pid, config);
+    plant_init(&plant, SMITH_TEST_AMBIENT);
+
+    float reading = SMITH_TEST_AMBIENT;
+    float power = 0.0f;
+    heat_up_result_t result = {.peak = SMITH_TEST_AMBIENT, .settled_error = 0.0f};
+    for (int i = 0; i < steps; i++)
+    {
+        float feedback = reading;
+        if (smith)
+        {
+            pid_smith_step(smith, reading, power);
+            feedback = pid_smith_feedback(smith, reading);
+        }
+        pid.last_update_us = esp_timer_get_time() - (uint64_t)(SMITH_TEST_DT * 1000000.0f);
+        power = pid_controller_update(&pid, feedback);
+        reading = plant_step(&plant, power);
+        result.peak = fmaxf(result.peak, plant.temperature);
+        if (i >= steps - 600)
+        {
+            result.settled_error = fmaxf(result.settled_error,
+                                         fabsf(SMITH_TEST_SETPOINT - plant.temperature));
+        }
+    }
+    return result;
+}
+
+// =============================================================================
+// Prediction Tests
+// =============================================================================
+
+// With a matching model the feedback is the temperature without dead time
+void test_smith_predicts_undelayed(void)
+{
+    pid_smith_t smith;
+    delayed_plant_t plant;
+    pid_smith_init(&smith, plant_model(), SMITH_TEST_DT);
+    plant_init(&plant, SMITH_TEST_AMBIENT);
+
+    float reading = SMITH_TEST_AMBIENT;
+    float power = 0.0f;
+    float worst = 0.0f;
+    float lag = 0.0f;
+    for (int i = 0; i < 600; i++)
+    {
+        pid_smith_step(&smith, reading, power);
+        worst = fmaxf(worst, fabsf(pid_smith_feedback(&smith, reading) - plant.temperature));
+        lag = fmaxf(lag, plant.temperature - reading);
+
+        power = (i < 300) ? 100.0f : 30.0f;
+        reading = plant_step(&plant, power);
+    }
+
+    // The raw reading lags the platen by several degrees on the heat-up
+    TEST_ASSERT_TRUE(lag > 5.0f);
+    TEST_ASSERT_TRUE(worst < 0.5f);
+    TEST_ASSERT_TRUE(pid_smith_is_active(&smith));
+}
+
+// Gains that make plain PID cycle through the dead time settle with the predictor
+void test_smith_tracks_tighter(void)
+{
+    pid_smith_t smith;
+    pid_smith_init(&smith, plant_model(), SMITH_TEST_DT);
+
+    heat_up_result_t plain = run_heat_up(NULL, 20.0f, 0.1f, 0.0f, 1800);
+    heat_up_result_t predicted = run_heat_up(&smith, 20.0f, 0.1f, 0.0f, 1800);
+
+    TEST_ASSERT_TRUE(plain.settled_error > 3.0f);
+    TEST_ASSERT_TRUE(predicted.settled_error < 0.5f);
+    TEST_ASSERT_TRUE(predicted.peak < SMITH_TEST_SETPOINT + 1.0f);
+    TEST_ASSERT_TRUE(pid_smith_is_active(&smith));
+}
+
+// =============================================================================
+// Fallback Tests
+// =============================================================================
+
+// A badly wrong model is dropped for plain feedback
+void test_smith_mismatch_fallback(void)
+{
+    pid_smith_t smith;
+    delayed_plant_t plant;
+    fopdt_model_t wrong = plant_model();
+    wrong.gain *= 0.3f;
+    wrong.time_constant = 60.0f;
+    pid_smith_init(&smith, wrong, SMITH_TEST_DT);
+    plant_init(&plant, SMITH_TEST_AMBIENT);
+
+    float reading = SMITH_TEST_AMBIENT;
+    float power = 0.0f;
+    for (int i = 0; i < 600 && pid_smith_is_active(&smith); i++)
+    {
+        pid_smith_step(&smith, reading, power);
+        power = ((i / 100) % 2 == 0) ? 100.0f : 0.0f;
+        reading = plant_step(&plant, power);
+    }
+
+    TEST_ASSERT_FALSE(pid_smith_is_active(&smith));
+    TEST_ASSERT_TRUE(pid_smith_get_mismatch(&smith) > SMITH_MISMATCH_LIMIT / 2.0f);
+    TEST_ASSERT_EQUAL_FLOAT(123.0f, pid_smith_feedback(&smith, 123.0f));
+}
+
+// =============================================================================
+// Identification Tests
+// =============================================================================
+
+// A cold full-power heat-up yields the plant dead time and lag
+void test_smith_identify_heat_up(void)
+{
+    smith_identifier_t id;
+    delayed_plant_t plant;
+    fopdt_model_t model;
+    fopdt_model_t rated = plant_model();
+    plant_init(&plant, SMITH_TEST_AMBIENT);
+
+    smith_identify_begin(&id, SMITH_TEST_AMBIENT);
+    float reading = SMITH_TEST_AMBIENT;
+    for (int i = 0; i < 30; i++)
+    {
+        smith_identify_sample(&id, reading, 100.0f, SMITH_TEST_DT);
+        reading = plant_step(&plant, 100.0f);
+    }
+    // Too little of the slope seen yet
+    TEST_ASSERT_FALSE(smith_identify_result(&id, rated.gain, &model));
+
+    for (int i = 0; i < 120; i++)
+    {
+        smith_identify_sample(&id, reading, 100.0f, SMITH_TEST_DT);
+        reading = plant_step(&plant, 100.0f);
+    }
+    TEST_ASSERT_TRUE(smith_identify_result(&id, rated.gain, &model));
+    TEST_ASSERT_FLOAT_WITHIN(3.0f, rated.dead_time, model.dead_time);
+    TEST_ASSERT_FLOAT_WITHIN(rated.time_constant * 0.1f, rated.time_constant, model.time_constant);
+
+    // Dropping off full power abandons the test
+    smith_identify_sample(&id, reading, 50.0f, SMITH_TEST_DT);
+    TEST_ASSERT_FALSE(id.active);
+}
@@ -0,0 +1,186 @@
+/**
+ * @file test_power_map.c
+ * @brief Unit tests for the learned holding power map
+ *
+ * This test suite validates learning and lookup. Tests cover:
+ * - Heat balance estimate when nothing is learned
+ * - Learning on a point and between two points
+ * - Blending repeated settled periods
+ * - Interpolation between learned points
+ * - Extrapolation from the nearest learned point by the rise over ambient
+ * - Temperatures too close to ambient and out-of-range powers
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#include <unity.h>
+#include <stddef.h>
+
+#include "power_map.h"
+#include "system_config.h"
+
+// =============================================================================
+// Test Helpers
+// =============================================================================
+
+#define MAP_TEST_AMBIENT 25.0f
+
+/**
+ * @brief Map point index of a temperature on the grid
+ */
+static int point_of(float temperature)
+{
+    return (int)(temperature / POWER_MAP_SPACING);
+}
+
+// =============================================================================
+// Estimate Tests
+// =============================================================================
+
+// An empty map falls back to the observer heat balance
+void test_power_map_empty(void)
+{
+    power_map_t map;
+    float hold;
+    power_map_init(&map);
+
+    TEST_ASSERT_FALSE(power_map_lookup(&map, 160.0f, MAP_TEST_AMBIENT, &hold));
+    float expected = 100.0f * OBSERVER_LOSS_COEFFICIENT * (160.0f - MAP_TEST_AMBIENT) / OBSERVER_HEATER_WATTS;
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, expected, hold);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, expected, power_map_model_estimate(160.0f, MAP_TEST_AMBIENT));
+
+    // Nothing to hold at or below ambient
+    TEST_ASSERT_FALSE(power_map_lookup(&map, 20.0f, MAP_TEST_AMBIENT, &hold));
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, hold);
+}
+
+// =============================================================================
+// Learning Tests
+// =============================================================================
+
+// A settled period on a grid point sets that point only
+void test_power_map_learn_on_point(void)
+{
+    power_map_t map;
+    float hold;
+    power_map_init(&map);
+
+    power_map_learn(&map, 160.0f, MAP_TEST_AMBIENT, 40.0f);
+    TEST_ASSERT_EQUAL(1, map.samples[point_of(160.0f)]);
+    TEST_ASSERT_EQUAL(0, map.samples[point_of(180.0f)]);
+    TEST_ASSERT_EQUAL(0, map.samples[point_of(140.0f)]);
+
+    TEST_ASSERT_TRUE(power_map_lookup(&map, 160.0f, MAP_TEST_AMBIENT, &hold));
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 40.0f, hold);
+}
+
+// Between points, both neighbours learn the power scaled to their rise
+void test_power_map_learn_between_points(void)
+{
+    power_map_t map;
+    float hold;
+    power_map_init(&map);
+
+    // 150°C is 125°C over ambient; 140 and 160 are 115 and 135 over
+    power_map_learn(&map, 150.0f, MAP_TEST_AMBIENT, 50.0f);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 50.0f * 115.0f / 125.0f, map.hold_power[point_of(140.0f)]);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 50.0f * 135.0f / 125.0f, map.hold_power[point_of(160.0f)]);
+
+    TEST_ASSERT_TRUE(power_map_lookup(&map, 150.0f, MAP_TEST_AMBIENT, &hold));
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 50.0f, hold);
+}
+
+// Later settled periods pull a learned point by the learn weight
+void test_power_map_learn_blends(void)
+{
+    power_map_t map;
+    power_map_init(&map);
+    int point = point_of(160.0f);
+
+    power_map_learn(&map, 160.0f, MAP_TEST_AMBIENT, 40.0f);
+    power_map_learn(&map, 160.0f, MAP_TEST_AMBIENT, 50.0f);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 40.0f + POWER_MAP_LEARN_WEIGHT * 10.0f, map.hold_power[point]);
+    TEST_ASSERT_EQUAL(2, map.samples[point]);
+
+    for (int i = 0; i < 50; i++)
+    {
+        power_map_learn(&map, 160.0f, MAP_TEST_AMBIENT, 50.0f);
+    }
+    TEST_ASSERT_FLOAT_WITHIN(0.1f, 50.0f, map.hold_power[point]);
+}
+
+// Out-of-range powers and temperatures near ambient are not learned
+void test_power_map_learn_rejects(void)
+{
+    power_map_t map;
+    power_map_init(&map);
+
+    power_map_learn(&map, 160.0f, MAP_TEST_AMBIENT, -1.0f);
+    power_map_learn(&map, 160.0f, MAP_TEST_AMBIENT, 101.0f);
+    power_map_learn(&map, 30.0f, MAP_TEST_AMBIENT, 5.0f);
+
+    for (int i = 0; i < POWER_MAP_POINTS; i++)
+    {
+        TEST_ASSERT_EQUAL(0, map.samples[i]);
+    }
+}
+
+// =============================================================================
+// Lookup Tests
+// =============================================================================
+
+// Between two learned points the power is interpolated linearly
+void test_power_map_interpolation(void)
+{
+    power_map_t map;
+    float hold;
+    power_map_init(&map);
+
+    power_map_learn(&map, 140.0f, MAP_TEST_AMBIENT, 30.0f);
+    power_map_learn(&map, 160.0f, MAP_TEST_AMBIENT, 50.0f);
+
+    TEST_ASSERT_TRUE(power_map_lookup(&map, 145.0f, MAP_TEST_AMBIENT, &hold));
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 35.0f, hold);
+    TEST_ASSERT_TRUE(power_map_lookup(&map, 150.0f, MAP_TEST_AMBIENT, &hold));
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 40.0f, hold);
+}
+
+// Away from learned points the power follows the rise over ambient
+void test_power_map_extrapolation(void)
+{
+    power_map_t map;
+    float hold;
+    power_map_init(&map);
+    power_map_learn(&map, 160.0f, MAP_TEST_AMBIENT, 40.0f);
+
+    // Above: 200°C is 175°C over ambient against 135°C
+    TEST_ASSERT_TRUE(power_map_lookup(&map, 200.0f, MAP_TEST_AMBIENT, &hold));
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 40.0f * 175.0f / 135.0f, hold);
+
+    // Below, between two unlearned points
+    TEST_ASSERT_TRUE(power_map_lookup(&map, 110.0f, MAP_TEST_AMBIENT, &hold));
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 40.0f * 85.0f / 135.0f, hold);
+}
+
+// Near ambient the lower neighbour is taken as zero power; the top is clamped
+void test_power_map_lookup_limits(void)
+{
+    power_map_t map;
+    float hold;
+    power_map_init(&map);
+
+    // 20°C is below ambient: halfway to 40°C gives half of its power
+    power_map_learn(&map, 40.0f, MAP_TEST_AMBIENT, 10.0f);
+    TEST_ASSERT_TRUE(power_map_lookup(&map, 30.0f, MAP_TEST_AMBIENT, &hold));
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 5.0f, hold);
+
+    // A hot point carried far up the grid cannot ask for more than 100%
+    power_map_init(&map);
+    power_map_learn(&map, 100.0f, MAP_TEST_AMBIENT, 80.0f);
+    TEST_ASSERT_TRUE(power_map_lookup(&map, 240.0f, MAP_TEST_AMBIENT, &hold));
+    TEST_ASSERT_EQUAL_FLOAT(100.0f, hold);
+
+    TEST_ASSERT_FALSE(power_map_lookup(NULL, 160.0f, MAP_TEST_AMBIENT, &hold));
+    TEST_ASSERT_FALSE(power_map_lookup(&map, 160.0f, MAP_TEST_AMBIENT, NULL));
+}
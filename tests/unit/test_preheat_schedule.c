@@ -0,0 +1,174 @@
+/**
+ * @file test_preheat_schedule.c
+ * @brief Unit tests for scheduled automatic pre-heat
+ *
+ * This test suite validates the weekly schedule against known dates.
+ * Tests cover:
+ * - Clock validity and local weekday/minute with UTC offsets
+ * - The next ready time today, later in the week and a week ahead
+ * - Lead time from the fallback rate and from learned heat-ups
+ * - Rejecting corrupted schedules
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#include <unity.h>
+#include <stddef.h>
+
+#include "preheat_schedule.h"
+
+// =============================================================================
+// Test Helpers
+// =============================================================================
+
+#define MONDAY_2025_01_06 1736121600LL   ///< 2025-01-06 00:00 UTC, a Monday
+#define HOUR (60LL * 60LL)
+
+/**
+ * @brief Schedule with a 07:30 ready time on Monday only
+ */
+static void monday_schedule(preheat_schedule_t *schedule, int16_t utc_offset_min)
+{
+    preheat_schedule_init(schedule);
+    schedule->utc_offset_min = utc_offset_min;
+    schedule->ready_minute[1] = 7 * 60 + 30;
+}
+
+// =============================================================================
+// Clock Tests
+// =============================================================================
+
+// A clock that was never set reads 1970; one set over serial is trusted
+void test_preheat_clock_valid(void)
+{
+    TEST_ASSERT_FALSE(preheat_clock_valid(0));
+    TEST_ASSERT_FALSE(preheat_clock_valid(PREHEAT_CLOCK_VALID_AFTER - 1));
+    TEST_ASSERT_TRUE(preheat_clock_valid(MONDAY_2025_01_06));
+}
+
+// The UTC offset moves the local weekday and minute, across midnight both ways
+void test_preheat_local_time(void)
+{
+    preheat_schedule_t schedule;
+    uint8_t weekday;
+    uint16_t minute;
+    preheat_schedule_init(&schedule);
+
+    preheat_local_time(&schedule, MONDAY_2025_01_06 + 9 * HOUR + 15 * 60, &weekday, &minute);
+    TEST_ASSERT_EQUAL(1, weekday);
+    TEST_ASSERT_EQUAL(9 * 60 + 15, minute);
+
+    // UTC-5: Sunday 19:00 local
+    schedule.utc_offset_min = -5 * 60;
+    preheat_local_time(&schedule, MONDAY_2025_01_06, &weekday, &minute);
+    TEST_ASSERT_EQUAL(0, weekday);
+    TEST_ASSERT_EQUAL(19 * 60, minute);
+
+    // UTC+10: Monday 10:00 local; Sunday 23:00 UTC is already Monday
+    schedule.utc_offset_min = 10 * 60;
+    preheat_local_time(&schedule, MONDAY_2025_01_06, &weekday, &minute);
+    TEST_ASSERT_EQUAL(1, weekday);
+    TEST_ASSERT_EQUAL(10 * 60, minute);
+    preheat_local_time(&schedule, MONDAY_2025_01_06 - 1 * HOUR, &weekday, NULL);
+    TEST_ASSERT_EQUAL(1, weekday);
+}
+
+// =============================================================================
+// Next Ready Tests
+// =============================================================================
+
+// Today while still ahead, otherwise the same weekday next week
+void test_preheat_next_ready(void)
+{
+    preheat_schedule_t schedule;
+    int64_t ready;
+    monday_schedule(&schedule, 0);
+
+    int64_t monday_ready = MONDAY_2025_01_06 + 7 * HOUR + 30 * 60;
+    TEST_ASSERT_TRUE(preheat_next_ready(&schedule, MONDAY_2025_01_06 + 6 * HOUR, &ready));
+    TEST_ASSERT_TRUE(ready == monday_ready);
+
+    TEST_ASSERT_TRUE(preheat_next_ready(&schedule, monday_ready, &ready));
+    TEST_ASSERT_TRUE(ready == monday_ready);
+
+    TEST_ASSERT_TRUE(preheat_next_ready(&schedule, monday_ready + 60, &ready));
+    TEST_ASSERT_TRUE(ready == monday_ready + 7 * PREHEAT_SECONDS_PER_DAY);
+
+    // A Wednesday entry comes first after Monday's has passed
+    schedule.ready_minute[3] = 6 * 60;
+    TEST_ASSERT_TRUE(preheat_next_ready(&schedule, monday_ready + 60, &ready));
+    TEST_ASSERT_TRUE(ready == MONDAY_2025_01_06 + 2 * PREHEAT_SECONDS_PER_DAY + 6 * HOUR);
+
+    preheat_schedule_init(&schedule);
+    TEST_ASSERT_FALSE(preheat_next_ready(&schedule, MONDAY_2025_01_06, &ready));
+}
+
+// The ready time is local: 07:30 at UTC-5 is 12:30 UTC
+void test_preheat_next_ready_offset(void)
+{
+    preheat_schedule_t schedule;
+    int64_t ready;
+    monday_schedule(&schedule, -5 * 60);
+
+    // Monday 00:00 UTC is still Sunday locally
+    TEST_ASSERT_TRUE(preheat_next_ready(&schedule, MONDAY_2025_01_06, &ready));
+    TEST_ASSERT_TRUE(ready == MONDAY_2025_01_06 + 12 * HOUR + 30 * 60);
+}
+
+// =============================================================================
+// Lead Time Tests
+// =============================================================================
+
+// The fallback rate is used until a heat-up is learned, then the learned one
+void test_preheat_lead_and_learning(void)
+{
+    preheat_schedule_t schedule;
+    preheat_schedule_init(&schedule);
+
+    TEST_ASSERT_EQUAL(135 * 6 + 300, preheat_lead_seconds(&schedule, 25.0f, 160.0f, 6.0f, 300));
+
+    // A warm platen starts later; one already there needs only the margin
+    TEST_ASSERT_EQUAL(60 * 6 + 300, preheat_lead_seconds(&schedule, 100.0f, 160.0f, 6.0f, 300));
+    TEST_ASSERT_EQUAL(300, preheat_lead_seconds(&schedule, 165.0f, 160.0f, 6.0f, 300));
+
+    // The first heat-up is taken as is, later ones are blended
+    preheat_learn(&schedule, 540, 135.0f, 0.25f);
+    TEST_ASSERT_EQUAL(1, schedule.warmup_samples);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 4.0f, schedule.warmup_sec_per_degree);
+    TEST_ASSERT_EQUAL(135 * 4 + 300, preheat_lead_seconds(&schedule, 25.0f, 160.0f, 6.0f, 300));
+
+    preheat_learn(&schedule, 1080, 135.0f, 0.25f);
+    TEST_ASSERT_EQUAL(2, schedule.warmup_samples);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 5.0f, schedule.warmup_sec_per_degree);
+
+    // No rise or no time is not a heat-up
+    preheat_learn(&schedule, 600, 0.0f, 0.25f);
+    preheat_learn(&schedule, 0, 100.0f, 0.25f);
+    TEST_ASSERT_EQUAL(2, schedule.warmup_samples);
+}
+
+// =============================================================================
+// Validation Tests
+// =============================================================================
+
+// Out-of-range offsets, minutes and rates mark a corrupted schedule
+void test_preheat_schedule_validate(void)
+{
+    preheat_schedule_t schedule;
+    monday_schedule(&schedule, 14 * 60);
+    TEST_ASSERT_TRUE(preheat_schedule_validate(&schedule));
+
+    schedule.utc_offset_min = 14 * 60 + 1;
+    TEST_ASSERT_FALSE(preheat_schedule_validate(&schedule));
+
+    monday_schedule(&schedule, 0);
+    schedule.ready_minute[2] = 24 * 60;
+    TEST_ASSERT_FALSE(preheat_schedule_validate(&schedule));
+
+    monday_schedule(&schedule, 0);
+    schedule.warmup_sec_per_degree = -1.0f;
+    TEST_ASSERT_FALSE(preheat_schedule_validate(&schedule));
+    schedule.warmup_sec_per_degree = 600.0f;
+    TEST_ASSERT_FALSE(preheat_schedule_validate(&schedule));
+}
@@ -0,0 +1,188 @@
+/**
+ * @file test_press_predictor.c
+ * @brief Unit tests for press close prediction
+ *
+ * This test suite feeds open/close timestamps as the reed switch would
+ * report them. Tests cover:
+ * - No boost before enough intervals are learned
+ * - Boost timing against the expected close on a steady rhythm
+ * - Close window percentiles
+ * - Erratic rhythms and breaks
+ * - Cancelling when the close does not come
+ * - The history following the latest rhythm
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#include <unity.h>
+
+#include "press_predictor.h"
+#include "system_config.h"
+
+// =============================================================================
+// Test Helpers
+// =============================================================================
+
+/**
+ * @brief Feed presses with a fixed open-to-close interval
+ *
+ * @return Time after the last close (s)
+ */
+static uint32_t feed_presses(press_predictor_t *predictor, uint32_t now, int presses, uint16_t interval)
+{
+    for (int i = 0; i < presses; i++)
+    {
+        now += 30; // Cycle time, press closed
+        press_predictor_on_open(predictor, now);
+        now += interval;
+        press_predictor_on_close(predictor, now);
+    }
+    return now;
+}
+
+// =============================================================================
+// Learning Tests
+// =============================================================================
+
+// Nothing is boosted until PREBOOST_MIN_SAMPLES intervals are known
+void test_predictor_needs_samples(void)
+{
+    press_predictor_t predictor;
+    uint16_t early, late;
+    press_predictor_reset(&predictor);
+
+    uint32_t now = feed_presses(&predictor, 1000, PREBOOST_MIN_SAMPLES - 1, 40);
+    TEST_ASSERT_FALSE(press_predictor_window(&predictor, &early, &late));
+
+    press_predictor_on_open(&predictor, now);
+    for (uint32_t t = 0; t <= 40; t++)
+    {
+        TEST_ASSERT_EQUAL_FLOAT(0.0f, press_predictor_boost(&predictor, now + t));
+    }
+    press_predictor_on_close(&predictor, now + 40);
+    TEST_ASSERT_TRUE(press_predictor_window(&predictor, &early, &late));
+}
+
+// Breaks are not learned and a close without an opening is ignored
+void test_predictor_ignores_breaks(void)
+{
+    press_predictor_t predictor;
+    press_predictor_reset(&predictor);
+
+    press_predictor_on_close(&predictor, 500);
+    TEST_ASSERT_EQUAL(0, predictor.count);
+
+    press_predictor_on_open(&predictor, 1000);
+    press_predictor_on_close(&predictor, 1000 + PREBOOST_MAX_INTERVAL_SEC + 1);
+    TEST_ASSERT_EQUAL(0, predictor.count);
+
+    press_predictor_on_open(&predictor, 2000);
+    press_predictor_on_close(&predictor, 2000 + PREBOOST_MAX_INTERVAL_SEC);
+    TEST_ASSERT_EQUAL(1, predictor.count);
+}
+
+// =============================================================================
+// Window Tests
+// =============================================================================
+
+// The window runs from the 25th to the 90th percentile interval
+void test_predictor_window_percentiles(void)
+{
+    press_predictor_t predictor;
+    uint16_t early, late;
+    press_predictor_reset(&predictor);
+
+    // Out of order on purpose: 30, 32 ... 44
+    const uint16_t intervals[] = {38, 30, 44, 34, 40, 32, 42, 36};
+    uint32_t now = 1000;
+    for (int i = 0; i < 8; i++)
+    {
+        now = feed_presses(&predictor, now, 1, intervals[i]);
+    }
+
+    TEST_ASSERT_TRUE(press_predictor_window(&predictor, &early, &late));
+    TEST_ASSERT_EQUAL(34, early);
+    TEST_ASSERT_EQUAL(42, late);
+}
+
+// An erratic rhythm is not acted on
+void test_predictor_erratic_rhythm(void)
+{
+    press_predictor_t predictor;
+    uint16_t early, late;
+    press_predictor_reset(&predictor);
+
+    uint32_t now = 1000;
+    for (int i = 0; i < 8; i++)
+    {
+        now = feed_presses(&predictor, now, 1, (i % 2) ? 20 : 20 + PREBOOST_MAX_SPREAD_SEC + 10);
+    }
+    TEST_ASSERT_FALSE(press_predictor_window(&predictor, &early, &late));
+
+    press_predictor_on_open(&predictor, now);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, press_predictor_boost(&predictor, now + 20));
+}
+
+// Only the most recent intervals count once the history is full
+void test_predictor_follows_latest_rhythm(void)
+{
+    press_predictor_t predictor;
+    uint16_t early, late;
+    press_predictor_reset(&predictor);
+
+    uint32_t now = feed_presses(&predictor, 1000, PRESS_PREDICTOR_HISTORY, 40);
+    feed_presses(&predictor, now, PRESS_PREDICTOR_HISTORY, 70);
+
+    TEST_ASSERT_EQUAL(PRESS_PREDICTOR_HISTORY, predictor.count);
+    TEST_ASSERT_TRUE(press_predictor_window(&predictor, &early, &late));
+    TEST_ASSERT_EQUAL(70, early);
+    TEST_ASSERT_EQUAL(70, late);
+}
+
+// =============================================================================
+// Boost Tests
+// =============================================================================
+
+// The boost starts PREBOOST_LEAD_SEC before the expected close and ends on it
+void test_predictor_boost_timing(void)
+{
+    press_predictor_t predictor;
+    press_predictor_reset(&predictor);
+    uint32_t now = feed_presses(&predictor, 1000, 8, 40);
+
+    press_predictor_on_open(&predictor, now);
+    uint32_t start = 40 - PREBOOST_LEAD_SEC;
+    for (uint32_t t = 0; t <= 40; t++)
+    {
+        float expected = (t >= start) ? PREBOOST_CELSIUS : 0.0f;
+        TEST_ASSERT_EQUAL_FLOAT(expected, press_predictor_boost(&predictor, now + t));
+    }
+
+    press_predictor_on_close(&predictor, now + 40);
+    TEST_ASSERT_FALSE(predictor.boosting);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, press_predictor_boost(&predictor, now + 41));
+}
+
+// A close that does not come by the late edge cancels the boost for that opening
+void test_predictor_boost_cancelled(void)
+{
+    press_predictor_t predictor;
+    press_predictor_reset(&predictor);
+    uint32_t now = feed_presses(&predictor, 1000, 8, 40);
+
+    press_predictor_on_open(&predictor, now);
+    TEST_ASSERT_EQUAL_FLOAT(PREBOOST_CELSIUS, press_predictor_boost(&predictor, now + 40));
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, press_predictor_boost(&predictor, now + 41));
+    TEST_ASSERT_TRUE(predictor.cancelled);
+
+    // Stays off for this opening even if time wraps back into the window
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, press_predictor_boost(&predictor, now + 30));
+
+    // The long interval is a break; the next opening boosts again
+    press_predictor_on_close(&predictor, now + PREBOOST_MAX_INTERVAL_SEC + 60);
+    now += PREBOOST_MAX_INTERVAL_SEC + 90;
+    press_predictor_on_open(&predictor, now);
+    TEST_ASSERT_FALSE(predictor.cancelled);
+    TEST_ASSERT_EQUAL_FLOAT(PREBOOST_CELSIUS, press_predictor_boost(&predictor, now + 30));
+}
@@ -0,0 +1,168 @@
+/**
+ * @file test_rainflow.c
+ * @brief Unit tests for rainflow counting of thermal cycles
+ *
+ * This test suite validates the wear cycle counter. Tests cover:
+ * - Known half and full cycle counts for short reversal sequences
+ * - Damage from the configured reference range and exponent
+ * - Noise below the hysteresis being ignored
+ * - A cycle spanning a reboot closing from the persisted residue
+ * - Histogram bins and corruption checks
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#include <unity.h>
+
+#include "rainflow.h"
+
+// =============================================================================
+// Test Helpers
+// =============================================================================
+
+static const rainflow_config_t test_config = {
+    .hysteresis = 2.0f,
+    .reference_range = 100.0f,
+    .exponent = 2.0f};
+
+/**
+ * @brief Feed a straight ramp from the previous sample to a turning point, 1 °C a sample
+ */
+static void ramp_to(rainflow_t *rainflow, thermal_cycles_t *cycles, float *temperature, float point)
+{
+    float step = (point > *temperature) ? 1.0f : -1.0f;
+    while (*temperature != point)
+    {
+        *temperature += step;
+        rainflow_update(rainflow, cycles, *temperature, &test_config);
+    }
+}
+
+/**
+ * @brief Feed a sequence of turning points, starting from the first
+ */
+static void feed_points(rainflow_t *rainflow, thermal_cycles_t *cycles, const float *points, int count)
+{
+    float temperature = points[0];
+    rainflow_update(rainflow, cycles, temperature, &test_config);
+    for (int i = 1; i < count; i++)
+    {
+        ramp_to(rainflow, cycles, &temperature, points[i]);
+    }
+}
+
+// =============================================================================
+// Counting Tests
+// =============================================================================
+
+// Heat-up, cool-down, heat-up: the first range closes as a half cycle
+void test_rainflow_three_points_half_cycle(void)
+{
+    rainflow_t rainflow;
+    thermal_cycles_t cycles;
+    const float points[] = {20.0f, 180.0f, 20.0f, 60.0f};
+
+    rainflow_reset(&rainflow);
+    rainflow_clear(&cycles);
+    feed_points(&rainflow, &cycles, points, 4);
+
+    // 20 -> 180 -> 20 is a 160 °C half cycle; 180 -> 20 stays open in the residue
+    TEST_ASSERT_EQUAL_UINT32(1, cycles.half_cycles[rainflow_bin(160.0f)]);
+    TEST_ASSERT_EQUAL_UINT32(0, rainflow_total_cycles(&cycles));
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.5f * 1.6f * 1.6f, cycles.damage);
+    TEST_ASSERT_EQUAL_UINT8(2, cycles.residue_count);
+    TEST_ASSERT_EQUAL_FLOAT(180.0f, cycles.residue[0]);
+    TEST_ASSERT_EQUAL_FLOAT(20.0f, cycles.residue[1]);
+}
+
+// A dip inside a larger swing closes as a full cycle (ASTM E1049 example shape)
+void test_rainflow_inner_full_cycle(void)
+{
+    rainflow_t rainflow;
+    thermal_cycles_t cycles;
+    const float points[] = {20.0f, 100.0f, 60.0f, 140.0f, 20.0f};
+
+    rainflow_reset(&rainflow);
+    rainflow_clear(&cycles);
+    feed_points(&rainflow, &cycles, points, 5);
+
+    // 100 -> 60 -> 100 is one 40 °C cycle; 20 -> 140 is left open
+    TEST_ASSERT_EQUAL_UINT32(2, cycles.half_cycles[rainflow_bin(40.0f)]);
+    TEST_ASSERT_EQUAL_UINT32(1, rainflow_total_cycles(&cycles));
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.4f * 0.4f, cycles.damage);
+    TEST_ASSERT_EQUAL_UINT8(2, cycles.residue_count);
+}
+
+// Swings smaller than the hysteresis are sensor noise
+void test_rainflow_ignores_noise(void)
+{
+    rainflow_t rainflow;
+    thermal_cycles_t cycles;
+
+    rainflow_reset(&rainflow);
+    rainflow_clear(&cycles);
+    for (int i = 0; i < 100; i++)
+    {
+        rainflow_update(&rainflow, &cycles, 180.0f + ((i % 2) ? 1.0f : 0.0f), &test_config);
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(0, rainflow_total_cycles(&cycles));
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, cycles.damage);
+    TEST_ASSERT_EQUAL_UINT8(1, cycles.residue_count);
+}
+
+// The overnight cool-down closes against the residue kept across a reboot
+void test_rainflow_cycle_spans_reboot(void)
+{
+    rainflow_t rainflow;
+    thermal_cycles_t cycles;
+    float temperature = 20.0f;
+
+    rainflow_clear(&cycles);
+    for (int day = 0; day < 3; day++)
+    {
+        // Each boot starts a fresh detector on the persisted residue
+        rainflow_reset(&rainflow);
+        temperature = 20.0f;
+        rainflow_update(&rainflow, &cycles, temperature, &test_config);
+        ramp_to(&rainflow, &cycles, &temperature, 180.0f);
+        ramp_to(&rainflow, &cycles, &temperature, 170.0f);
+    }
+
+    // Each overnight cool-down and the next heat-up close as 160 °C half
+    // cycles: two reboots, two full cycles
+    TEST_ASSERT_EQUAL_UINT32(4, cycles.half_cycles[rainflow_bin(160.0f)]);
+    TEST_ASSERT_EQUAL_UINT32(2, rainflow_total_cycles(&cycles));
+    TEST_ASSERT_TRUE(rainflow_validate(&cycles));
+}
+
+// =============================================================================
+// Histogram and Storage Tests
+// =============================================================================
+
+// Bin edges are inclusive at the bottom
+void test_rainflow_bins(void)
+{
+    TEST_ASSERT_EQUAL_UINT8(0, rainflow_bin(4.9f));
+    TEST_ASSERT_EQUAL_UINT8(1, rainflow_bin(5.0f));
+    TEST_ASSERT_EQUAL_UINT8(WEAR_RANGE_BINS - 1, rainflow_bin(400.0f));
+    TEST_ASSERT_EQUAL_FLOAT(5.0f, rainflow_bin_lower(1));
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, rainflow_bin_lower(0));
+}
+
+// Corrupted counts loaded from storage are rejected
+void test_rainflow_validate(void)
+{
+    thermal_cycles_t cycles;
+
+    rainflow_clear(&cycles);
+    TEST_ASSERT_TRUE(rainflow_validate(&cycles));
+
+    cycles.residue_count = WEAR_RESIDUE_MAX + 1;
+    TEST_ASSERT_FALSE(rainflow_validate(&cycles));
+
+    rainflow_clear(&cycles);
+    cycles.damage = -1.0f;
+    TEST_ASSERT_FALSE(rainflow_validate(&cycles));
+}
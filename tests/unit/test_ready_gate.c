@@ -0,0 +1,147 @@
+/**
+ * @file test_ready_gate.c
+ * @brief Unit tests for predictive readiness
+ *
+ * This test suite validates the ready verdict over a stage 1 dwell.
+ * Starting states use the rated press (observer heat balance) and the
+ * default proportional gain. Tests cover:
+ * - A settled press is ready
+ * - A reading still recovering is ready once the surface is there
+ * - A falling or overshooting reading is not ready
+ * - A heavy press load rejects a press that would otherwise be ready
+ * - Unusable inputs
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#include <unity.h>
+#include <stddef.h>
+
+#include "ready_gate.h"
+#include "system_config.h"
+
+// =============================================================================
+// Test Helpers
+// =============================================================================
+
+#define GATE_TEST_TARGET 160.0f
+#define GATE_TEST_TOLERANCE 5.0f
+#define GATE_TEST_DWELL 15.0f
+
+/**
+ * @brief Settled press at the target, no load
+ */
+static ready_gate_input_t settled_input(void)
+{
+    ready_gate_input_t input = {
+        .temperature = GATE_TEST_TARGET,
+        .slope = 0.0f,
+        .hold_power = 100.0f * OBSERVER_LOSS_COEFFICIENT * (GATE_TEST_TARGET - DEFAULT_TEMPERATURE) /
+                      OBSERVER_HEATER_WATTS,
+        .kp = PID_DEFAULT_KP,
+        .load_watts = 0.0f,
+        .target = GATE_TEST_TARGET,
+        .tolerance = GATE_TEST_TOLERANCE,
+        .dwell = GATE_TEST_DWELL};
+    return input;
+}
+
+// =============================================================================
+// Accept Tests
+// =============================================================================
+
+// Holding power at the target keeps the whole dwell on the target
+void test_ready_gate_settled(void)
+{
+    ready_gate_input_t input = settled_input();
+    ready_gate_result_t result;
+
+    TEST_ASSERT_TRUE(ready_gate_predict(&input, &result));
+    TEST_ASSERT_TRUE(result.ready);
+    TEST_ASSERT_FLOAT_WITHIN(0.1f, GATE_TEST_TARGET, result.min_temp);
+    TEST_ASSERT_FLOAT_WITHIN(0.1f, GATE_TEST_TARGET, result.max_temp);
+}
+
+// The reading is still outside the band, but the surface it trails is not
+void test_ready_gate_recovering_accepted(void)
+{
+    ready_gate_input_t input = settled_input();
+    ready_gate_result_t result;
+
+    // One dead time at 0.4°C/s brings 152°C up to the target
+    input.slope = (GATE_TEST_TARGET - 152.0f) / SMITH_DEAD_TIME;
+    input.temperature = 152.0f;
+    TEST_ASSERT_TRUE(input.temperature < GATE_TEST_TARGET - GATE_TEST_TOLERANCE);
+
+    TEST_ASSERT_TRUE(ready_gate_predict(&input, &result));
+    TEST_ASSERT_TRUE(result.ready);
+    TEST_ASSERT_TRUE(result.min_temp >= GATE_TEST_TARGET - GATE_TEST_TOLERANCE);
+}
+
+// =============================================================================
+// Reject Tests
+// =============================================================================
+
+// A reading on target but falling means the surface has already dropped
+void test_ready_gate_falling_rejected(void)
+{
+    ready_gate_input_t input = settled_input();
+    ready_gate_result_t result;
+    input.slope = -0.5f;
+
+    TEST_ASSERT_TRUE(ready_gate_predict(&input, &result));
+    TEST_ASSERT_FALSE(result.ready);
+    TEST_ASSERT_TRUE(result.min_temp < GATE_TEST_TARGET - GATE_TEST_TOLERANCE);
+}
+
+// A reading on target but still climbing fast will overshoot the band
+void test_ready_gate_overshoot_rejected(void)
+{
+    ready_gate_input_t input = settled_input();
+    ready_gate_result_t result;
+    input.slope = 0.5f;
+
+    TEST_ASSERT_TRUE(ready_gate_predict(&input, &result));
+    TEST_ASSERT_FALSE(result.ready);
+    TEST_ASSERT_TRUE(result.max_temp > GATE_TEST_TARGET + GATE_TEST_TOLERANCE);
+}
+
+// The last measured press load decides a marginal case
+void test_ready_gate_press_load(void)
+{
+    ready_gate_input_t input = settled_input();
+    ready_gate_result_t result;
+    input.temperature = GATE_TEST_TARGET - 3.0f;
+    input.dwell = 60.0f;
+
+    TEST_ASSERT_TRUE(ready_gate_predict(&input, &result));
+    TEST_ASSERT_TRUE(result.ready);
+
+    input.load_watts = 1500.0f;
+    TEST_ASSERT_TRUE(ready_gate_predict(&input, &result));
+    TEST_ASSERT_FALSE(result.ready);
+    TEST_ASSERT_TRUE(result.min_temp < GATE_TEST_TARGET - GATE_TEST_TOLERANCE);
+}
+
+// Dwell and tolerance out of range give no verdict
+void test_ready_gate_invalid_input(void)
+{
+    ready_gate_input_t input = settled_input();
+    ready_gate_result_t result;
+
+    input.dwell = 0.0f;
+    TEST_ASSERT_FALSE(ready_gate_predict(&input, &result));
+    TEST_ASSERT_FALSE(result.ready);
+    TEST_ASSERT_EQUAL_FLOAT(GATE_TEST_TARGET, result.min_temp);
+
+    input.dwell = 601.0f;
+    TEST_ASSERT_FALSE(ready_gate_predict(&input, &result));
+
+    input = settled_input();
+    input.tolerance = 0.0f;
+    TEST_ASSERT_FALSE(ready_gate_predict(&input, &result));
+    TEST_ASSERT_FALSE(result.ready);
+
+    TEST_ASSERT_FALSE(ready_gate_predict(&input, NULL));
+}
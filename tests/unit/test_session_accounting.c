@@ -0,0 +1,107 @@
+/**
+ * @file test_session_accounting.c
+ * @brief Unit tests for session and shift time accounting
+ *
+ * This test suite validates the session tally. Tests cover:
+ * - Time accumulated per category and in total
+ * - Press and shirt counts
+ * - Utilization and shirts per hour
+ * - Reset and out-of-range categories
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#include <unity.h>
+#include <string.h>
+
+#include "session_accounting.h"
+
+// =============================================================================
+// Time Accounting Tests
+// =============================================================================
+
+// A reset tally is empty and starts at the given time
+void test_session_tally_reset(void)
+{
+    session_tally_t tally;
+
+    session_tally_reset(&tally, 0);
+    session_tally_add_time(&tally, TIME_PRESSING, 99);
+    session_tally_add_press(&tally, true);
+    session_tally_reset(&tally, 1234);
+    TEST_ASSERT_EQUAL(1234, tally.start_time);
+    TEST_ASSERT_EQUAL(0, session_tally_total_seconds(&tally));
+    TEST_ASSERT_EQUAL(0, tally.presses);
+    TEST_ASSERT_EQUAL(0, session_tally_utilization(&tally));
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, session_tally_shirts_per_hour(&tally));
+}
+
+// Seconds land in their category and add up to the total
+void test_session_tally_categories(void)
+{
+    session_tally_t tally;
+    session_tally_reset(&tally, 0);
+
+    session_tally_add_time(&tally, TIME_HEATING_UP, 600);
+    session_tally_add_time(&tally, TIME_READY_IDLE, 300);
+    session_tally_add_time(&tally, TIME_PRESSING, 1800);
+    session_tally_add_time(&tally, TIME_PRESSING, 200);
+    session_tally_add_time(&tally, TIME_WAITING_TEMP, 100);
+    session_tally_add_time(&tally, TIME_CATEGORY_COUNT, 500); // ignored
+
+    TEST_ASSERT_EQUAL(2000, tally.seconds[TIME_PRESSING]);
+    TEST_ASSERT_EQUAL(0, tally.seconds[TIME_FAULT]);
+    TEST_ASSERT_EQUAL(3000, session_tally_total_seconds(&tally));
+}
+
+// =============================================================================
+// Production Figures Tests
+// =============================================================================
+
+// Only presses that finish a shirt count as shirts
+void test_session_tally_presses(void)
+{
+    session_tally_t tally;
+    session_tally_reset(&tally, 0);
+
+    // Two double-sided shirts: front presses do not finish the shirt
+    session_tally_add_press(&tally, false);
+    session_tally_add_press(&tally, true);
+    session_tally_add_press(&tally, false);
+    session_tally_add_press(&tally, true);
+
+    TEST_ASSERT_EQUAL(4, tally.presses);
+    TEST_ASSERT_EQUAL(2, tally.shirts);
+}
+
+// Utilization is pressing time over all time; throughput is per hour
+void test_session_tally_utilization_and_rate(void)
+{
+    session_tally_t tally;
+    session_tally_reset(&tally, 0);
+
+    session_tally_add_time(&tally, TIME_PRESSING, 1800);
+    session_tally_add_time(&tally, TIME_READY_IDLE, 1200);
+    session_tally_add_time(&tally, TIME_PAUSED, 600);
+    for (int i = 0; i < 45; i++)
+    {
+        session_tally_add_press(&tally, true);
+    }
+
+    // 1800 s of 3600 s pressing, 45 shirts in one hour
+    TEST_ASSERT_EQUAL(50, session_tally_utilization(&tally));
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 45.0f, session_tally_shirts_per_hour(&tally));
+}
+
+// Category names fit the report column and out-of-range is marked
+void test_session_category_names(void)
+{
+    for (int i = 0; i < TIME_CATEGORY_COUNT; i++)
+    {
+        const char *name = session_time_category_name((time_category_t)i);
+        TEST_ASSERT_NOT_NULL(name);
+        TEST_ASSERT_TRUE(strlen(name) <= 8);
+    }
+    TEST_ASSERT_EQUAL_STRING("?", session_time_category_name(TIME_CATEGORY_COUNT));
+}
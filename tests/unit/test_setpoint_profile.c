@@ -0,0 +1,220 @@
+/**
+ * @file test_setpoint_profile.c
+ * @brief Unit tests for the ramp/soak setpoint profile engine
+ *
+ * This test suite validates the profile runner step by step. Tests cover:
+ * - Ramp rate and immediate steps
+ * - Soak duration with and without holdback
+ * - Holdback pausing the soak timer while the measurement lags
+ * - Offsets following a base target edit mid-run
+ * - Full profiles and finishing on the base target
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#include <unity.h>
+
+#include "setpoint_profile.h"
+
+// =============================================================================
+// Test Helpers
+// =============================================================================
+
+/**
+ * @brief Step the runner with the measurement sitting on the setpoint
+ *
+ * @return Number of steps until the runner finished (or max_steps)
+ */
+static int run_tracking(sp_runner_t *runner, float base_target, float dt, int max_steps)
+{
+    int steps = 0;
+    while (sp_runner_is_active(runner) && steps < max_steps)
+    {
+        sp_runner_step(runner, base_target, runner->setpoint, dt);
+        steps++;
+    }
+    return steps;
+}
+
+// =============================================================================
+// Ramp Tests
+// =============================================================================
+
+// A ramp moves the setpoint at its rate and lands exactly on the target
+void test_sp_ramp_rate(void)
+{
+    sp_profile_t profile;
+    sp_runner_t runner;
+    sp_profile_clear(&profile);
+    TEST_ASSERT_TRUE(sp_profile_add_ramp(&profile, 0.0f, 2.0f));
+    sp_runner_start(&runner, &profile, 100.0f);
+
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 102.0f, sp_runner_step(&runner, 160.0f, 100.0f, 1.0f));
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 103.0f, sp_runner_step(&runner, 160.0f, 100.0f, 0.5f));
+
+    // 57°C left at 2°C/s: 28 more steps of 1 s, the last one clamps
+    int steps = run_tracking(&runner, 160.0f, 1.0f, 100);
+    TEST_ASSERT_EQUAL(29, steps);
+    TEST_ASSERT_EQUAL_FLOAT(160.0f, runner.setpoint);
+    TEST_ASSERT_FALSE(sp_runner_is_active(&runner));
+}
+
+// A ramp runs downward as well as upward
+void test_sp_ramp_down(void)
+{
+    sp_profile_t profile;
+    sp_runner_t runner;
+    sp_profile_clear(&profile);
+    sp_profile_add_ramp(&profile, -20.0f, 1.0f);
+    sp_runner_start(&runner, &profile, 160.0f);
+
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 159.0f, sp_runner_step(&runner, 160.0f, 160.0f, 1.0f));
+    TEST_ASSERT_EQUAL(19, run_tracking(&runner, 160.0f, 1.0f, 100));
+    TEST_ASSERT_EQUAL_FLOAT(140.0f, runner.setpoint);
+}
+
+// A ramp with no rate steps to its target at once
+void test_sp_ramp_immediate(void)
+{
+    sp_profile_t profile;
+    sp_runner_t runner;
+    sp_profile_clear(&profile);
+    sp_profile_add_ramp(&profile, 5.0f, 0.0f);
+    sp_runner_start(&runner, &profile, 25.0f);
+
+    TEST_ASSERT_EQUAL_FLOAT(165.0f, sp_runner_step(&runner, 160.0f, 25.0f, 1.0f));
+    TEST_ASSERT_FALSE(sp_runner_is_active(&runner));
+}
+
+// =============================================================================
+// Soak Tests
+// =============================================================================
+
+// Without holdback the soak timer runs regardless of the measurement
+void test_sp_soak_duration(void)
+{
+    sp_profile_t profile;
+    sp_runner_t runner;
+    sp_profile_clear(&profile);
+    sp_profile_add_soak(&profile, 0.0f, 10, 0.0f);
+    sp_runner_start(&runner, &profile, 160.0f);
+
+    for (int i = 0; i < 9; i++)
+    {
+        TEST_ASSERT_EQUAL_FLOAT(160.0f, sp_runner_step(&runner, 160.0f, 25.0f, 1.0f));
+        TEST_ASSERT_TRUE(sp_runner_is_active(&runner));
+    }
+    sp_runner_step(&runner, 160.0f, 25.0f, 1.0f);
+    TEST_ASSERT_FALSE(sp_runner_is_active(&runner));
+}
+
+// Holdback pauses the soak while the measurement is out of the band
+void test_sp_soak_holdback(void)
+{
+    sp_profile_t profile;
+    sp_runner_t runner;
+    sp_profile_clear(&profile);
+    sp_profile_add_soak(&profile, 0.0f, 10, 2.0f);
+    sp_runner_start(&runner, &profile, 160.0f);
+
+    // Lagging 5°C behind: the timer does not run
+    for (int i = 0; i < 30; i++)
+    {
+        sp_runner_step(&runner, 160.0f, 155.0f, 1.0f);
+    }
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, runner.soak_elapsed);
+    TEST_ASSERT_TRUE(sp_runner_is_active(&runner));
+
+    // In the band for 4 s, overshoot out of it, then back in
+    for (int i = 0; i < 4; i++)
+    {
+        sp_runner_step(&runner, 160.0f, 158.5f, 1.0f);
+    }
+    for (int i = 0; i < 5; i++)
+    {
+        sp_runner_step(&runner, 160.0f, 163.0f, 1.0f);
+    }
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 4.0f, runner.soak_elapsed);
+
+    for (int i = 0; i < 5; i++)
+    {
+        sp_runner_step(&runner, 160.0f, 161.5f, 1.0f);
+    }
+    TEST_ASSERT_TRUE(sp_runner_is_active(&runner));
+    sp_runner_step(&runner, 160.0f, 160.0f, 1.0f);
+    TEST_ASSERT_FALSE(sp_runner_is_active(&runner));
+}
+
+// A zero-length soak with holdback just waits for the measurement
+void test_sp_soak_wait_only(void)
+{
+    sp_profile_t profile;
+    sp_runner_t runner;
+    sp_profile_clear(&profile);
+    sp_profile_add_soak(&profile, 0.0f, 0, 1.0f);
+    sp_runner_start(&runner, &profile, 160.0f);
+
+    sp_runner_step(&runner, 160.0f, 150.0f, 1.0f);
+    TEST_ASSERT_TRUE(sp_runner_is_active(&runner));
+    sp_runner_step(&runner, 160.0f, 159.5f, 1.0f);
+    TEST_ASSERT_FALSE(sp_runner_is_active(&runner));
+}
+
+// =============================================================================
+// Profile Tests
+// =============================================================================
+
+// Ramp, soak, ramp: timing adds up and the runner ends on the base target
+void test_sp_full_profile(void)
+{
+    sp_profile_t profile;
+    sp_runner_t runner;
+    sp_profile_clear(&profile);
+    sp_profile_add_ramp(&profile, -20.0f, 1.0f); // 120 -> 140 in 20 s
+    sp_profile_add_soak(&profile, -20.0f, 15, 0.0f);
+    sp_profile_add_ramp(&profile, 0.0f, 2.0f);   // 140 -> 160 in 10 s
+    sp_runner_start(&runner, &profile, 120.0f);
+
+    TEST_ASSERT_EQUAL(45, run_tracking(&runner, 160.0f, 1.0f, 200));
+    TEST_ASSERT_EQUAL_FLOAT(160.0f, runner.setpoint);
+
+    // Finished: the base target passes straight through
+    TEST_ASSERT_EQUAL_FLOAT(170.0f, sp_runner_step(&runner, 170.0f, 0.0f, 1.0f));
+}
+
+// Segment offsets follow a base target edited mid-soak
+void test_sp_base_target_edit(void)
+{
+    sp_profile_t profile;
+    sp_runner_t runner;
+    sp_profile_clear(&profile);
+    sp_profile_add_soak(&profile, -10.0f, 60, 0.0f);
+    sp_runner_start(&runner, &profile, 150.0f);
+
+    TEST_ASSERT_EQUAL_FLOAT(150.0f, sp_runner_step(&runner, 160.0f, 150.0f, 1.0f));
+    TEST_ASSERT_EQUAL_FLOAT(170.0f, sp_runner_step(&runner, 180.0f, 150.0f, 1.0f));
+}
+
+// The segment list is bounded and an empty profile never starts
+void test_sp_profile_limits(void)
+{
+    sp_profile_t profile;
+    sp_runner_t runner;
+    sp_profile_clear(&profile);
+
+    sp_runner_start(&runner, &profile, 100.0f);
+    TEST_ASSERT_FALSE(sp_runner_is_active(&runner));
+    TEST_ASSERT_EQUAL_FLOAT(160.0f, sp_runner_step(&runner, 160.0f, 100.0f, 1.0f));
+
+    for (int i = 0; i < SP_PROFILE_MAX_SEGMENTS; i++)
+    {
+        TEST_ASSERT_TRUE(sp_profile_add_soak(&profile, 0.0f, 1, 0.0f));
+    }
+    TEST_ASSERT_FALSE(sp_profile_add_ramp(&profile, 0.0f, 1.0f));
+    TEST_ASSERT_EQUAL(SP_PROFILE_MAX_SEGMENTS, profile.count);
+
+    sp_runner_start(&runner, &profile, 160.0f);
+    sp_runner_stop(&runner);
+    TEST_ASSERT_FALSE(sp_runner_is_active(&runner));
+}
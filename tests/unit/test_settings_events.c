@@ -0,0 +1,85 @@
+/**
+ * @file test_settings_events.c
+ * @brief Unit tests for settings change notifications
+ *
+ * This test suite validates change publishing and the deferred save.
+ * Tests cover:
+ * - Changes coalesce until consumed, then clear
+ * - Empty publishes are ignored
+ * - One save per burst of edits, only after the quiet time
+ *
+ * The save test waits out SETTINGS_SAVE_DELAY_SEC in real time.
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#include <unity.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "settings_events.h"
+#include "system_config.h"
+
+// =============================================================================
+// Change Flag Tests
+// =============================================================================
+
+// Flags from several publishes are merged and consumed once
+void test_settings_changes_coalesce(void)
+{
+    settings_events_init();
+    TEST_ASSERT_EQUAL(SETTINGS_CHANGE_NONE, settings_consume_changes());
+
+    settings_publish_change(SETTINGS_CHANGE_TARGET);
+    settings_publish_change(SETTINGS_CHANGE_PID_GAINS);
+    settings_publish_change(SETTINGS_CHANGE_TARGET);
+
+    TEST_ASSERT_EQUAL(SETTINGS_CHANGE_TARGET | SETTINGS_CHANGE_PID_GAINS, settings_consume_changes());
+    TEST_ASSERT_EQUAL(SETTINGS_CHANGE_NONE, settings_consume_changes());
+
+    settings_publish_change(SETTINGS_CHANGE_MATERIAL);
+    uint32_t changes = settings_consume_changes();
+    TEST_ASSERT_TRUE(changes & SETTINGS_CHANGE_HEAT_UP);
+    TEST_ASSERT_FALSE(changes & SETTINGS_CHANGE_PID_GAINS);
+}
+
+// Publishing nothing neither sets flags nor schedules a save
+void test_settings_empty_publish(void)
+{
+    settings_events_init();
+
+    settings_publish_change(SETTINGS_CHANGE_NONE);
+    TEST_ASSERT_EQUAL(SETTINGS_CHANGE_NONE, settings_consume_changes());
+
+    vTaskDelay(pdMS_TO_TICKS((SETTINGS_SAVE_DELAY_SEC + 1) * 1000));
+    TEST_ASSERT_FALSE(settings_save_due());
+}
+
+// =============================================================================
+// Deferred Save Tests
+// =============================================================================
+
+// A burst of edits is saved once, after edits have gone quiet
+void test_settings_save_deferred(void)
+{
+    settings_events_init();
+
+    settings_publish_change(SETTINGS_CHANGE_TARGET);
+    settings_publish_change(SETTINGS_CHANGE_TARGET);
+    if (SETTINGS_SAVE_DELAY_SEC > 0)
+    {
+        TEST_ASSERT_FALSE(settings_save_due());
+    }
+
+    // Consuming the flags does not cancel the save
+    settings_consume_changes();
+    vTaskDelay(pdMS_TO_TICKS((SETTINGS_SAVE_DELAY_SEC + 1) * 1000));
+    TEST_ASSERT_TRUE(settings_save_due());
+    TEST_ASSERT_FALSE(settings_save_due());
+
+    // Learned data schedules a save like any other change
+    settings_publish_change(SETTINGS_CHANGE_LEARNED);
+    vTaskDelay(pdMS_TO_TICKS((SETTINGS_SAVE_DELAY_SEC + 1) * 1000));
+    TEST_ASSERT_TRUE(settings_save_due());
+}
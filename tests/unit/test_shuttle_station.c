@@ -0,0 +1,209 @@
+/**
+ * @file test_shuttle_station.c
+ * @brief Unit tests for shuttle press station switching
+ *
+ * This test suite drives the pressing cycle globals in main.h the way the
+ * UI task does and restores them afterwards. Tests cover:
+ * - A waiting cycle parked and a fresh cycle on the other station
+ * - The parked cycle restored with its timestamps moved by the time away
+ * - Next shirt side kept per station
+ * - Per-station press counts, press loads and summaries
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#include <unity.h>
+#include <stddef.h>
+
+#include "shuttle_station.h"
+#include "main.h"
+#include "system_config.h"
+
+// =============================================================================
+// Test Helpers
+// =============================================================================
+
+extern cycle_engine_t cycle_engine;
+
+/**
+ * @brief Cycle globals touched by a station switch
+ */
+typedef struct
+{
+    bool pressing_active;
+    bool press_safety_locked;
+    pressing_cycle_t cycle;
+    cycle_engine_t engine;
+    uint32_t cycle_start_time;
+    uint32_t stage_start_time;
+    cycle_status_t stage;
+    ui_state_t ui_state;
+    shirt_side_t next_side;
+} saved_globals_t;
+
+static void save_globals(saved_globals_t *saved)
+{
+    saved->pressing_active = pressing_active;
+    saved->press_safety_locked = press_safety_locked;
+    saved->cycle = current_cycle;
+    saved->engine = cycle_engine;
+    saved->cycle_start_time = cycle_start_time;
+    saved->stage_start_time = stage_start_time;
+    saved->stage = current_stage;
+    saved->ui_state = ui_get_current_state();
+    saved->next_side = print_run.next_side;
+}
+
+static void restore_globals(const saved_globals_t *saved)
+{
+    pressing_active = saved->pressing_active;
+    press_safety_locked = saved->press_safety_locked;
+    current_cycle = saved->cycle;
+    cycle_engine = saved->engine;
+    cycle_start_time = saved->cycle_start_time;
+    stage_start_time = saved->stage_start_time;
+    current_stage = saved->stage;
+    ui_set_state(saved->ui_state);
+    print_run.next_side = saved->next_side;
+    reset_station_cycles();
+    reset_station_presses();
+}
+
+/**
+ * @brief Put station A's platen cycle between its two stages
+ *
+ * First stage pressed from t=100 to t=115, press opened at t=116.
+ */
+static void start_waiting_cycle(void)
+{
+    cycle_definition_t definition;
+    TEST_ASSERT_TRUE(cycle_program_build(0, 15, 5, &definition));
+    TEST_ASSERT_TRUE(cycle_engine_start(&cycle_engine, &definition, 100));
+    cycle_engine_update(&cycle_engine, 115, 160.0f, 160.0f);
+    TEST_ASSERT_EQUAL(CYCLE_PHASE_READY, cycle_engine_press_opened(&cycle_engine, 116));
+
+    pressing_active = true;
+    press_safety_locked = false;
+    current_cycle.shirt_id = 7;
+    current_cycle.side = FRONT;
+    current_cycle.stage = 1;
+    cycle_start_time = 100;
+    stage_start_time = 100;
+    current_stage = IDLE;
+    print_run.next_side = BACK;
+    ui_set_state(UI_STATE_STAGE_READY);
+}
+
+// =============================================================================
+// Switching Tests
+// =============================================================================
+
+// The waiting cycle is parked and the other station starts clean
+void test_shuttle_park_and_fresh_station(void)
+{
+    saved_globals_t saved;
+    save_globals(&saved);
+    reset_station_cycles();
+    start_waiting_cycle();
+
+    switch_station(1, 120);
+
+    TEST_ASSERT_EQUAL(1, get_platen_station());
+    TEST_ASSERT_FALSE(pressing_active);
+    TEST_ASSERT_TRUE(press_safety_locked);
+    TEST_ASSERT_EQUAL(IDLE, current_stage);
+    TEST_ASSERT_EQUAL(CYCLE_PHASE_IDLE, cycle_engine.phase);
+    TEST_ASSERT_EQUAL(0, cycle_start_time);
+    TEST_ASSERT_TRUE(ui_get_current_state() == UI_STATE_START_PRESSING ||
+                     ui_get_current_state() == UI_STATE_FREE_PRESS);
+
+    const station_context_t *parked = get_parked_station(0);
+    TEST_ASSERT_TRUE(parked->pressing_active);
+    TEST_ASSERT_EQUAL(7, parked->cycle.shirt_id);
+    TEST_ASSERT_EQUAL(UI_STATE_STAGE_READY, parked->ui_state);
+    TEST_ASSERT_EQUAL(BACK, parked->next_side);
+    TEST_ASSERT_EQUAL(120, parked->parked_time);
+    TEST_ASSERT_EQUAL(SHUTTLE_ENABLED, is_parked_cycle_active());
+    TEST_ASSERT_NULL(get_parked_station(STATION_COUNT));
+
+    switch_station(0, 121);
+    restore_globals(&saved);
+}
+
+// Coming back restores the cycle, shifted by the time it spent parked
+void test_shuttle_restore_parked_cycle(void)
+{
+    saved_globals_t saved;
+    save_globals(&saved);
+    reset_station_cycles();
+    start_waiting_cycle();
+
+    switch_station(1, 120);
+    print_run.next_side = FRONT; // Station B's own shirt
+    switch_station(0, 160);
+
+    TEST_ASSERT_EQUAL(0, get_platen_station());
+    TEST_ASSERT_TRUE(pressing_active);
+    TEST_ASSERT_FALSE(press_safety_locked);
+    TEST_ASSERT_EQUAL(7, current_cycle.shirt_id);
+    TEST_ASSERT_EQUAL(140, cycle_start_time);
+    TEST_ASSERT_EQUAL(140, stage_start_time);
+    TEST_ASSERT_EQUAL(CYCLE_PHASE_READY, cycle_engine.phase);
+    TEST_ASSERT_EQUAL(UI_STATE_STAGE_READY, ui_get_current_state());
+    TEST_ASSERT_EQUAL(BACK, print_run.next_side);
+
+    // Station B was parked idle with its own next side
+    const station_context_t *parked = get_parked_station(1);
+    TEST_ASSERT_FALSE(parked->pressing_active);
+    TEST_ASSERT_EQUAL(FRONT, parked->next_side);
+    TEST_ASSERT_FALSE(is_parked_cycle_active());
+
+    restore_globals(&saved);
+}
+
+// =============================================================================
+// Station Figures Tests
+// =============================================================================
+
+// Presses and loads are kept for the station under the platen
+void test_shuttle_station_presses_and_loads(void)
+{
+    saved_globals_t saved;
+    station_summary_t summary;
+    save_globals(&saved);
+    reset_station_cycles();
+    reset_station_presses();
+    start_waiting_cycle();
+
+    count_station_press();
+    set_station_press_load(450.0f);
+    switch_station(1, 120);
+    count_station_press();
+    count_station_press();
+    set_station_press_load(600.0f);
+
+    TEST_ASSERT_EQUAL_FLOAT(450.0f, get_station_press_load(0));
+    TEST_ASSERT_EQUAL_FLOAT(600.0f, get_station_press_load(1));
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, get_station_press_load(STATION_COUNT));
+
+    // Station A is parked waiting for its finishing press
+    TEST_ASSERT_TRUE(get_station_summary(0, &summary));
+    TEST_ASSERT_TRUE(summary.cycle_active);
+    TEST_ASSERT_NOT_NULL(summary.next_stage);
+    TEST_ASSERT_EQUAL(1, summary.presses);
+
+    TEST_ASSERT_TRUE(get_station_summary(1, &summary));
+    TEST_ASSERT_FALSE(summary.cycle_active);
+    TEST_ASSERT_NULL(summary.next_stage);
+    TEST_ASSERT_EQUAL(2, summary.presses);
+
+    TEST_ASSERT_FALSE(get_station_summary(STATION_COUNT, &summary));
+
+    reset_station_presses();
+    TEST_ASSERT_TRUE(get_station_summary(1, &summary));
+    TEST_ASSERT_EQUAL(0, summary.presses);
+
+    switch_station(0, 130);
+    restore_globals(&saved);
+}
@@ -0,0 +1,135 @@
+/**
+ * @file test_surface_cal.c
+ * @brief Unit tests for the multi-point surface temperature correction
+ *
+ * This test suite validates the surface calibration table. Tests cover:
+ * - Interpolation between points and holding the end corrections
+ * - Point ordering and replacement of a re-measured setpoint
+ * - As-found drift against the previous table
+ * - Leave-one-out interpolation error
+ * - Corruption checks on a loaded table
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#include <unity.h>
+
+#include "surface_cal.h"
+
+// =============================================================================
+// Test Helpers
+// =============================================================================
+
+/**
+ * @brief A four-point table whose correction grows with temperature
+ *
+ * Corrections: 120 -> -2, 150 -> -3, 180 -> -4.5, 210 -> -6 (°C).
+ */
+static void build_table(surface_calibration_t *table)
+{
+    surface_calibration_t none;
+
+    surface_cal_clear(&none);
+    surface_cal_clear(table);
+    TEST_ASSERT_TRUE(surface_cal_add_point(table, &none, 150.0f, 147.0f));
+    TEST_ASSERT_TRUE(surface_cal_add_point(table, &none, 120.0f, 118.0f));
+    TEST_ASSERT_TRUE(surface_cal_add_point(table, &none, 210.0f, 204.0f));
+    TEST_ASSERT_TRUE(surface_cal_add_point(table, &none, 180.0f, 175.5f));
+    surface_cal_finish(table, 20000);
+}
+
+// =============================================================================
+// Correction Tests
+// =============================================================================
+
+// An empty table leaves readings alone
+void test_surface_cal_empty_table(void)
+{
+    surface_calibration_t table;
+
+    surface_cal_clear(&table);
+    TEST_ASSERT_EQUAL_FLOAT(180.0f, surface_cal_apply(&table, 180.0f));
+    TEST_ASSERT_TRUE(surface_cal_validate(&table));
+}
+
+// Corrections are interpolated between points and held beyond the ends
+void test_surface_cal_apply(void)
+{
+    surface_calibration_t table;
+    build_table(&table);
+
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 118.0f, surface_cal_apply(&table, 120.0f));
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 132.5f, surface_cal_apply(&table, 135.0f));
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 194.5f, surface_cal_apply(&table, 200.0f));
+
+    // No extrapolation outside 120-210 °C
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 98.0f, surface_cal_apply(&table, 100.0f));
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 224.0f, surface_cal_apply(&table, 230.0f));
+}
+
+// =============================================================================
+// Table Building Tests
+// =============================================================================
+
+// Points are kept in order and a setpoint measured again replaces its point
+void test_surface_cal_add_point(void)
+{
+    surface_calibration_t table;
+    surface_calibration_t none;
+    build_table(&table);
+    surface_cal_clear(&none);
+
+    TEST_ASSERT_EQUAL_UINT8(4, table.count);
+    for (uint8_t i = 1; i < table.count; i++)
+    {
+        TEST_ASSERT_LESS_THAN(table.points[i].sensor_celsius, table.points[i - 1].sensor_celsius);
+    }
+
+    TEST_ASSERT_TRUE(surface_cal_add_point(&table, &none, 181.0f, 175.0f));
+    TEST_ASSERT_EQUAL_UINT8(4, table.count);
+    TEST_ASSERT_EQUAL_FLOAT(181.0f, table.points[2].sensor_celsius);
+
+    // Fill the table, then one more is refused
+    TEST_ASSERT_TRUE(surface_cal_add_point(&table, &none, 90.0f, 89.0f));
+    TEST_ASSERT_TRUE(surface_cal_add_point(&table, &none, 240.0f, 233.0f));
+    TEST_ASSERT_EQUAL_UINT8(SURFACE_CAL_POINTS, table.count);
+    TEST_ASSERT_FALSE(surface_cal_add_point(&table, &none, 60.0f, 60.0f));
+}
+
+// The residuals show drift since the last table and the interpolation error
+void test_surface_cal_residuals(void)
+{
+    surface_calibration_t table;
+    surface_calibration_t recheck;
+    build_table(&table);
+
+    // Against no previous table the as-found error is the full correction
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 6.0f, table.as_found_max);
+    TEST_ASSERT_EQUAL_UINT32(20000, table.day);
+
+    // 180 °C left out: the 150-210 line predicts -4.5, as measured
+    // 150 °C left out: the 120-180 line predicts -3.25, measured -3
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 0.25f, table.interpolation_max);
+
+    // Re-measuring 165 °C one degree hotter than the table says is 1 °C of drift
+    surface_cal_clear(&recheck);
+    TEST_ASSERT_TRUE(surface_cal_add_point(&recheck, &table, 165.0f, 162.25f));
+    surface_cal_finish(&recheck, 0);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 1.0f, recheck.points[0].as_found);
+}
+
+// A corrupted table loaded from storage is rejected
+void test_surface_cal_validate(void)
+{
+    surface_calibration_t table;
+    build_table(&table);
+    TEST_ASSERT_TRUE(surface_cal_validate(&table));
+
+    table.points[1].surface_celsius = table.points[1].sensor_celsius - 2.0f * SURFACE_CAL_LIMIT;
+    TEST_ASSERT_FALSE(surface_cal_validate(&table));
+
+    build_table(&table);
+    table.count = SURFACE_CAL_POINTS + 1;
+    TEST_ASSERT_FALSE(surface_cal_validate(&table));
+}
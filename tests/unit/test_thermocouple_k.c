@@ -0,0 +1,75 @@
+/**
+ * @file test_thermocouple_k.c
+ * @brief Unit tests for the NIST type K linearization
+ *
+ * This test suite validates thermocouple_k_centi_celsius() against the
+ * NIST ITS-90 type K tables. Tests cover:
+ * - The pressing range (150, 200 and 220 °C) with the board at 25 °C
+ * - The same temperatures with the cold junction at 0 °C
+ * - Clamping at the ends of the tables
+ *
+ * Inputs are the raw fields a MAX31855 reports for the NIST voltage at
+ * each temperature: T_cj + (E(T) - E(T_cj)) / 41.276 uV/°C, in 0.25 °C
+ * steps. One step is about 0.25 °C, which bounds the expected error.
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#include <unity.h>
+
+#include "thermocouple_k.h"
+#include "system_config.h"
+
+#define TK_TOLERANCE_CENTI 25  ///< One MAX31855 LSB (0.01 °C)
+#define TK_CJ_25C (25 * 16)    ///< Cold junction field at 25 °C (0.0625 °C/LSB)
+
+/**
+ * @brief One NIST check point
+ */
+typedef struct
+{
+    int32_t centi_celsius;  ///< Hot junction temperature (0.01 °C)
+    int16_t raw_cj_25;      ///< Thermocouple field with the cold junction at 25 °C
+    int16_t raw_cj_0;       ///< Thermocouple field with the cold junction at 0 °C
+} tk_point_t;
+
+// NIST E(T): 150 °C 6.138 mV, 200 °C 8.138 mV, 220 °C 8.940 mV; E(25 °C) 1.000 mV
+static const tk_point_t nist_points[] = {
+    {15000, 598, 595},
+    {20000, 792, 789},
+    {22000, 869, 866},
+};
+
+// =============================================================================
+// Linearization Tests
+// =============================================================================
+
+// The chip's straight-line reading is about 2 °C low at 200 °C; the tables correct it
+void test_thermocouple_k_matches_nist_board_temperature(void)
+{
+    for (int i = 0; i < (int)ARRAY_SIZE(nist_points); i++)
+    {
+        TEST_ASSERT_INT_WITHIN(TK_TOLERANCE_CENTI, nist_points[i].centi_celsius,
+                               thermocouple_k_centi_celsius(nist_points[i].raw_cj_25, TK_CJ_25C));
+    }
+}
+
+// With the cold junction at 0 °C only the hot junction curve is involved
+void test_thermocouple_k_matches_nist_ice_point(void)
+{
+    for (int i = 0; i < (int)ARRAY_SIZE(nist_points); i++)
+    {
+        TEST_ASSERT_INT_WITHIN(TK_TOLERANCE_CENTI, nist_points[i].centi_celsius,
+                               thermocouple_k_centi_celsius(nist_points[i].raw_cj_0, 0));
+    }
+
+    TEST_ASSERT_INT_WITHIN(TK_TOLERANCE_CENTI, 0, thermocouple_k_centi_celsius(0, 0));
+}
+
+// Readings outside the tables clamp instead of extrapolating
+void test_thermocouple_k_clamps(void)
+{
+    TEST_ASSERT_EQUAL_INT32(-20000, thermocouple_k_centi_celsius(-8192, -2000));
+    TEST_ASSERT_EQUAL_INT32(137200, thermocouple_k_centi_celsius(8191, 2000));
+}
@@ -0,0 +1,192 @@
+/**
+ * @file test_throughput.c
+ * @brief Unit tests for rolling throughput and operator pacing
+ *
+ * This test suite books production second by second as the control task
+ * does. Tests cover:
+ * - On-pace production against the plan
+ * - Naming the press or the operator as the limit
+ * - Double-sided and shuttle press plans
+ * - Window shortened to the data since reset, and buckets ageing out
+ * - Paused time not counted against the pace
+ *
+ * @author Insta Retrofit Development Team
+ * @date 2025
+ */
+
+#include <unity.h>
+
+#include "throughput.h"
+
+// =============================================================================
+// Test Helpers
+// =============================================================================
+
+#define PACE_TEST_START 600000   ///< Arbitrary time since boot, on a minute edge (s)
+
+/**
+ * @brief Run presses with fixed handling, pressing and recovery times
+ *
+ * @return Time after the last press (s)
+ */
+static uint32_t run_presses(throughput_t *throughput, uint32_t now, int presses,
+                            uint16_t handling, uint16_t pressing, uint16_t recovery,
+                            uint8_t presses_per_shirt)
+{
+    for (int p = 0; p < presses; p++)
+    {
+        for (uint16_t s = 0; s < handling; s++)
+        {
+            throughput_add_time(throughput, now++, PACE_HANDLING, 1);
+        }
+        for (uint16_t s = 0; s < pressing; s++)
+        {
+            throughput_add_time(throughput, now++, PACE_PRESSING, 1);
+        }
+        throughput_add_press(throughput, now, (p + 1) % presses_per_shirt == 0);
+        for (uint16_t s = 0; s < recovery; s++)
+        {
+            throughput_add_time(throughput, now++, PACE_RECOVERY, 1);
+        }
+    }
+    return now;
+}
+
+static pace_plan_t single_press_plan(void)
+{
+    pace_plan_t plan = {.press_sec = 20, .handling_sec = 20, .presses_per_shirt = 1, .overlapped = false};
+    return plan;
+}
+
+// =============================================================================
+// Pace Tests
+// =============================================================================
+
+// Production at or under the plan is on pace
+void test_throughput_on_pace(void)
+{
+    throughput_t throughput;
+    pace_status_t status;
+    pace_plan_t plan = single_press_plan();
+    throughput_reset(&throughput, PACE_TEST_START);
+
+    uint32_t now = run_presses(&throughput, PACE_TEST_START, 30, 18, 20, 0, 1);
+    throughput_pace(&throughput, now, 30, &plan, &status);
+
+    TEST_ASSERT_EQUAL(PACE_LIMIT_NONE, status.limit);
+    TEST_ASSERT_EQUAL(40, status.target_takt);
+    TEST_ASSERT_EQUAL(38, status.actual_takt);
+    TEST_ASSERT_EQUAL(20, status.press_sec);
+    TEST_ASSERT_EQUAL(18, status.handling_sec);
+    TEST_ASSERT_EQUAL(30, status.presses);
+    TEST_ASSERT_EQUAL(30, status.shirts);
+}
+
+// Slow loading makes the operator the limit
+void test_throughput_operator_limit(void)
+{
+    throughput_t throughput;
+    pace_status_t status;
+    pace_plan_t plan = single_press_plan();
+    throughput_reset(&throughput, PACE_TEST_START);
+
+    uint32_t now = run_presses(&throughput, PACE_TEST_START, 20, 35, 20, 2, 1);
+    throughput_pace(&throughput, now, 30, &plan, &status);
+
+    TEST_ASSERT_EQUAL(PACE_LIMIT_OPERATOR, status.limit);
+    TEST_ASSERT_EQUAL(57, status.actual_takt);
+    TEST_ASSERT_EQUAL_STRING("Operator", throughput_limit_name(status.limit));
+}
+
+// Waiting for the platen to recover makes the press the limit
+void test_throughput_press_limit(void)
+{
+    throughput_t throughput;
+    pace_status_t status;
+    pace_plan_t plan = single_press_plan();
+    throughput_reset(&throughput, PACE_TEST_START);
+
+    uint32_t now = run_presses(&throughput, PACE_TEST_START, 20, 22, 20, 15, 1);
+    throughput_pace(&throughput, now, 30, &plan, &status);
+
+    TEST_ASSERT_EQUAL(PACE_LIMIT_PRESS, status.limit);
+    TEST_ASSERT_EQUAL(15, status.recovery_sec);
+    TEST_ASSERT_EQUAL_STRING("Press", throughput_limit_name(status.limit));
+}
+
+// =============================================================================
+// Plan Tests
+// =============================================================================
+
+// Two presses make a double-sided shirt; a shuttle press overlaps handling
+void test_throughput_plans(void)
+{
+    throughput_t throughput;
+    pace_status_t status;
+    pace_plan_t plan = single_press_plan();
+    throughput_reset(&throughput, PACE_TEST_START);
+
+    uint32_t now = run_presses(&throughput, PACE_TEST_START, 20, 20, 20, 0, 2);
+    plan.presses_per_shirt = 2;
+    throughput_pace(&throughput, now, 30, &plan, &status);
+    TEST_ASSERT_EQUAL(20, status.presses);
+    TEST_ASSERT_EQUAL(10, status.shirts);
+    TEST_ASSERT_EQUAL(80, status.target_takt);
+    TEST_ASSERT_EQUAL(80, status.actual_takt);
+    TEST_ASSERT_EQUAL(PACE_LIMIT_NONE, status.limit);
+
+    // The same presses are behind a shuttle plan, which expects 2 x 20 s per shirt
+    plan.overlapped = true;
+    throughput_pace(&throughput, now, 30, &plan, &status);
+    TEST_ASSERT_EQUAL(40, status.target_takt);
+    TEST_ASSERT_TRUE(status.limit != PACE_LIMIT_NONE);
+}
+
+// =============================================================================
+// Window Tests
+// =============================================================================
+
+// The window never reaches past the reset and old minutes age out
+void test_throughput_window(void)
+{
+    throughput_t throughput;
+    pace_status_t status;
+    pace_plan_t plan = single_press_plan();
+    throughput_reset(&throughput, PACE_TEST_START);
+
+    uint32_t now = run_presses(&throughput, PACE_TEST_START, 6, 20, 20, 0, 1);
+    throughput_pace(&throughput, now, 30, &plan, &status);
+    TEST_ASSERT_EQUAL(5, status.window_min);
+    TEST_ASSERT_EQUAL(6, status.presses);
+
+    // An hour and a bit later nothing of it is left
+    now += (THROUGHPUT_BUCKETS + 5) * THROUGHPUT_BUCKET_SEC;
+    throughput_pace(&throughput, now, THROUGHPUT_BUCKETS + 10, &plan, &status);
+    TEST_ASSERT_EQUAL(THROUGHPUT_BUCKETS, status.window_min);
+    TEST_ASSERT_EQUAL(0, status.presses);
+    TEST_ASSERT_EQUAL(PACE_LIMIT_NONE, status.limit);
+}
+
+// A pause in the middle of production does not count against the pace
+void test_throughput_pause_not_counted(void)
+{
+    throughput_t throughput;
+    pace_status_t status;
+    pace_plan_t plan = single_press_plan();
+    throughput_reset(&throughput, PACE_TEST_START);
+
+    uint32_t now = run_presses(&throughput, PACE_TEST_START, 10, 18, 20, 0, 1);
+    for (int s = 0; s < 300; s++)
+    {
+        throughput_add_time(&throughput, now++, PACE_OFF, 1);
+    }
+    now = run_presses(&throughput, now, 10, 18, 20, 0, 1);
+
+    throughput_pace(&throughput, now, 30, &plan, &status);
+    TEST_ASSERT_EQUAL(20, status.shirts);
+    TEST_ASSERT_EQUAL(38, status.actual_takt);
+    TEST_ASSERT_EQUAL(PACE_LIMIT_NONE, status.limit);
+
+    throughput_add_time(&throughput, now, PACE_CATEGORY_COUNT, 100); // ignored
+    TEST_ASSERT_EQUAL_STRING("?", throughput_limit_name((pace_limit_t)(PACE_LIMIT_OPERATOR + 1)));
+}
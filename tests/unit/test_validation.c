@@ -10,6 +10,8 @@
  * - Error state management
  * - Cycle safety validation
  * - Safety limits and constraints
+ * - Double-sided run validation and back side targets
+ * - Pause keep-warm limits and the resume ready estimate
  *
  * These tests ensure the safety-critical functions operate correctly and
  * provide appropriate fail-safe behavior under various conditions.
@@ -23,9 +25,11 @@
 #include <esp_timer.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include <string.h>
 
 // Include the main header to access validation functions
 #include "main.h"
+#include "system_config.h"
 
 // =============================================================================
 // Test Setup and Teardown
@@ -45,6 +49,7 @@ void setUp(void)
     sensor_error_count = 0;
     press_safety_locked = true;
     current_temperature = 25.0f;
+    current_sensor_temperature = 25.0f;
     last_temp_reading = esp_timer_get_time() / 1000000;
 }
 
@@ -111,6 +116,11 @@ void test_check_system_safety(void)
     current_temperature = 250.0f; // Above MAX_TEMPERATURE (220°C)
     TEST_ASSERT_FALSE(check_system_safety());
 
+    // Surface-corrected reading below the limit, thermocouple above it
+    current_sensor_temperature = 235.0f;
+    TEST_ASSERT_FALSE(check_system_safety());
+    current_sensor_temperature = 200.0f;
+
     // Reset temperature
     current_temperature = 200.0f;
 
@@ -266,3 +276,156 @@ void test_cycle_timeout_protection(void)
 
     // This would be tested more thoroughly in integration tests
 }
+
+// =============================================================================
+// Double-Sided Workflow Tests
+// =============================================================================
+
+/**
+ * @brief Fill in settings that pass validate_settings()
+ */
+static void make_valid_settings(settings_t *edited)
+{
+    memset(edited, 0, sizeof(settings_t));
+    edited->target_temp = 160.0f;
+    edited->stage1_default = 15;
+    edited->stage2_default = 5;
+    edited->back_stage1_default = 15;
+    edited->back_stage2_default = 5;
+    edited->station_b_stage1_default = 15;
+    edited->station_b_stage2_default = 5;
+}
+
+// Test side-aware print run validation
+void test_print_run_side_validation(void)
+{
+    print_run_t run;
+    memset(&run, 0, sizeof(run));
+    run.num_shirts = 10;
+
+    run.type = DOUBLE_SIDED;
+    run.next_side = BACK;
+    TEST_ASSERT_TRUE(validate_print_run(&run));
+
+    // A single-sided run never has a back side pending
+    run.type = SINGLE_SIDED;
+    TEST_ASSERT_FALSE(validate_print_run(&run));
+
+    run.next_side = FRONT;
+    TEST_ASSERT_TRUE(validate_print_run(&run));
+}
+
+// Test back side timer and temperature offset limits
+void test_back_side_settings_validation(void)
+{
+    settings_t edited;
+    make_valid_settings(&edited);
+    TEST_ASSERT_TRUE(validate_settings(&edited));
+
+    edited.back_stage1_default = 0;
+    TEST_ASSERT_FALSE(validate_settings(&edited));
+
+    make_valid_settings(&edited);
+    edited.back_temp_offset = 30.0f;
+    TEST_ASSERT_TRUE(validate_settings(&edited));
+    edited.back_temp_offset = -31.0f;
+    TEST_ASSERT_FALSE(validate_settings(&edited));
+}
+
+// Test the back side target on double-sided runs
+void test_active_side_target(void)
+{
+    settings_t saved_settings = settings;
+    print_run_t saved_run = print_run;
+
+    settings.target_temp = 160.0f;
+    settings.back_temp_offset = -10.0f;
+    pressing_active = false;
+
+    // Between presses: the side the next cycle will press
+    print_run.type = DOUBLE_SIDED;
+    print_run.next_side = BACK;
+    TEST_ASSERT_EQUAL(BACK, get_active_side());
+    TEST_ASSERT_EQUAL_FLOAT(150.0f, get_active_target_temp());
+
+    print_run.next_side = FRONT;
+    TEST_ASSERT_EQUAL(FRONT, get_active_side());
+    TEST_ASSERT_EQUAL_FLOAT(160.0f, get_active_target_temp());
+
+    // Single-sided runs always press the front at the plain target
+    print_run.type = SINGLE_SIDED;
+    TEST_ASSERT_EQUAL(FRONT, get_active_side());
+    TEST_ASSERT_EQUAL_FLOAT(160.0f, get_active_target_temp());
+
+    settings = saved_settings;
+    print_run = saved_run;
+}
+
+// =============================================================================
+// Pause Keep-Warm Tests
+// =============================================================================
+
+// Test keep-warm drop limits
+void test_keep_warm_settings_validation(void)
+{
+    settings_t edited;
+    make_valid_settings(&edited);
+
+    edited.keep_warm_drop = 0.0f; // heater off while paused
+    TEST_ASSERT_TRUE(validate_settings(&edited));
+    edited.keep_warm_drop = 150.0f;
+    TEST_ASSERT_TRUE(validate_settings(&edited));
+    edited.keep_warm_drop = -1.0f;
+    TEST_ASSERT_FALSE(validate_settings(&edited));
+    edited.keep_warm_drop = 151.0f;
+    TEST_ASSERT_FALSE(validate_settings(&edited));
+}
+
+// Test that pause without a keep-warm drop leaves the heater off
+void test_keep_warm_disabled(void)
+{
+    settings_t saved_settings = settings;
+
+    settings.keep_warm_drop = 0.0f;
+    pause_mode = true;
+    TEST_ASSERT_FALSE(is_keep_warm_active());
+
+    // Not paused: never keeping warm, whatever the drop
+    settings.keep_warm_drop = 30.0f;
+    pause_mode = false;
+    TEST_ASSERT_FALSE(is_keep_warm_active());
+
+    settings = saved_settings;
+}
+
+// Test the ready estimate after unpause
+void test_resume_ready_eta(void)
+{
+    settings_t saved_settings = settings;
+    print_run_t saved_run = print_run;
+
+    settings.target_temp = 160.0f;
+    print_run.type = SINGLE_SIDED;
+    print_run.next_side = FRONT;
+    pressing_active = false;
+
+    // Inside the ready band: ready now
+    current_temperature = 160.0f;
+    TEST_ASSERT_EQUAL(0, get_resume_ready_eta());
+
+    // Colder platen takes longer, and never faster than the resume ramp
+    current_temperature = 140.0f;
+    uint32_t eta_warm = get_resume_ready_eta();
+    current_temperature = 100.0f;
+    uint32_t eta_cold = get_resume_ready_eta();
+    TEST_ASSERT_GREATER_THAN(0, eta_warm);
+    TEST_ASSERT_GREATER_THAN(eta_warm, eta_cold);
+
+    float ready_temp = 160.0f - TEMP_HYSTERESIS;
+    uint32_t fastest = (uint32_t)((ready_temp - 100.0f) / PAUSE_RESUME_RAMP_RATE);
+    TEST_ASSERT_TRUE(eta_cold >= fastest);
+
+    settings = saved_settings;
+    print_run = saved_run;
+    current_temperature = 25.0f;
+}